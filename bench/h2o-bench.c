@@ -0,0 +1,468 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+/* h2o-bench -- time the initializers and getters
+ *
+ * The program draws random state points in every region (with a fixed
+ * seed, so that the runs are comparable), then calls each h2o_new_*()
+ * initializer and h2o_get_*() getter on them repeatedly, per region
+ * and backward equation subregion. The results are written as CSV:
+ *
+ *   function,region,subregion,ns_per_call,calls_per_s
+ *
+ * Usage: h2o-bench [seconds per case [seed]]
+ *
+ * Run it using 'make bench'.
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "consts.h"
+#include "h2o.h"
+#include "region1.h"
+#include "region2.h"
+#include "region3.h"
+
+/* points per region, and the minimum per subregion to report it */
+#define POOL 4096
+#define MIN_POINTS 16
+
+typedef h2o_t (*func_new)(double, double);
+typedef double (*func_get)(const h2o_t);
+
+/* the initializer arguments */
+enum args
+{
+	ARGS_PT,
+	ARGS_TX,
+	ARGS_PX,
+	ARGS_PH,
+	ARGS_PS,
+	ARGS_HS,
+	ARGS_RHOT,
+	ARGS_VU
+};
+
+/* classifies the backward equation subregion, -1 if there are none */
+typedef int (*func_sub)(enum h2o_region region, double arg1, double arg2);
+
+static int sub_none(enum h2o_region region, double arg1, double arg2)
+{
+	(void) region;
+	(void) arg1;
+	(void) arg2;
+
+	return -1;
+}
+
+static int sub_pT(enum h2o_region region, double p, double T)
+{
+	return region == H2O_REGION3 ? (int) h2o_region3_subregion_pT(p, T) : -1;
+}
+
+static int sub_ph(enum h2o_region region, double p, double h)
+{
+	if (region == H2O_REGION2)
+		return h2o_region2_subregion_ph(p, h);
+	else if (region == H2O_REGION3)
+		return h2o_region3_subregion_ph(p, h);
+	return -1;
+}
+
+static int sub_ps(enum h2o_region region, double p, double s)
+{
+	if (region == H2O_REGION2)
+		return h2o_region2_subregion_ps(p, s);
+	else if (region == H2O_REGION3)
+		return h2o_region3_subregion_ps(p, s);
+	return -1;
+}
+
+static int sub_hs(enum h2o_region region, double h, double s)
+{
+	if (region == H2O_REGION2)
+		return h2o_region2_subregion_hs(h, s);
+	else if (region == H2O_REGION3)
+		return h2o_region3_subregion_hs(h, s);
+	return -1;
+}
+
+/* the tables, built in main() */
+static h2o_sbtl_t* sbtl;
+static h2o_ttse_t* ttse;
+
+static h2o_t sbtl_new_vu(double v, double u)
+{
+	return h2o_sbtl_new_vu(sbtl, v, u);
+}
+
+static h2o_t ttse_new_ph(double p, double h)
+{
+	return h2o_ttse_new_ph(ttse, p, h);
+}
+
+static h2o_t ttse_new_ps(double p, double s)
+{
+	return h2o_ttse_new_ps(ttse, p, s);
+}
+
+static const struct
+{
+	const char* name;
+	func_new func;
+	enum args args;
+	func_sub sub;
+} initializers[] = {
+	{ "h2o_new_pT", h2o_new_pT, ARGS_PT, sub_pT },
+	{ "h2o_new_Tx", h2o_new_Tx, ARGS_TX, sub_none },
+	{ "h2o_new_px", h2o_new_px, ARGS_PX, sub_none },
+	{ "h2o_new_ph", h2o_new_ph, ARGS_PH, sub_ph },
+	{ "h2o_new_ps", h2o_new_ps, ARGS_PS, sub_ps },
+	{ "h2o_new_hs", h2o_new_hs, ARGS_HS, sub_hs },
+	{ "h2o_new_rhoT", h2o_new_rhoT, ARGS_RHOT, sub_none },
+	{ "h2o_new_ph_exact", h2o_new_ph_exact, ARGS_PH, sub_ph },
+	{ "h2o_new_ps_exact", h2o_new_ps_exact, ARGS_PS, sub_ps },
+	{ "h2o_new_hs_exact", h2o_new_hs_exact, ARGS_HS, sub_hs },
+	{ "h2o_new_vu", h2o_new_vu, ARGS_VU, sub_none },
+	{ "h2o_sbtl_new_vu", sbtl_new_vu, ARGS_VU, sub_none },
+	{ "h2o_ttse_new_ph", ttse_new_ph, ARGS_PH, sub_none },
+	{ "h2o_ttse_new_ps", ttse_new_ps, ARGS_PS, sub_none }
+};
+
+#define INITIALIZERS ((int) (sizeof(initializers) / sizeof(*initializers)))
+
+static const struct
+{
+	const char* name;
+	func_get func;
+} getters[] = {
+	{ "h2o_get_p", h2o_get_p },
+	{ "h2o_get_T", h2o_get_T },
+	{ "h2o_get_x", h2o_get_x },
+	{ "h2o_get_rho", h2o_get_rho },
+	{ "h2o_get_v", h2o_get_v },
+	{ "h2o_get_u", h2o_get_u },
+	{ "h2o_get_h", h2o_get_h },
+	{ "h2o_get_s", h2o_get_s },
+	{ "h2o_get_cp", h2o_get_cp },
+	{ "h2o_get_cv", h2o_get_cv },
+	{ "h2o_get_w", h2o_get_w }
+};
+
+#define GETTERS ((int) (sizeof(getters) / sizeof(*getters)))
+
+/* the random state points of a region, with all the properties
+ * the initializers take */
+struct pool
+{
+	int count;
+	h2o_t states[POOL];
+	struct h2o_props props[POOL];
+};
+
+static struct pool pools[H2O_REGION_MAX];
+
+/* the points of a single case */
+static double arg1s[POOL], arg2s[POOL];
+
+static double seconds_per_case = 0.05;
+
+/* keeps the calls from being optimized out */
+static volatile double sink;
+
+/* xorshift64*, so that the points do not depend on the libc */
+static unsigned long long rng_state = 0x2545F4914F6CDD1DULL;
+
+static double rng_uniform(double min, double max)
+{
+	unsigned long long r;
+
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	r = rng_state * 0x2545F4914F6CDD1DULL;
+
+	return min + (max - min) * (double) (r >> 11) / (double) (1ULL << 53);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+static void pool_add(const h2o_t state)
+{
+	struct pool* pool;
+
+	if (!h2o_is_valid(state))
+		return;
+
+	pool = &pools[state.region];
+	if (pool->count == POOL)
+		return;
+
+	pool->states[pool->count] = state;
+	h2o_get_all(state, &pool->props[pool->count]);
+	++pool->count;
+}
+
+/* p is drawn with a logarithmic distribution, to cover the low
+ * pressure steam as well; Region 3 gets its own ranges since it is
+ * so small, and half of it goes to the near-critical subregions */
+static void fill_pools(void)
+{
+	int i;
+
+	for (i = 0; i < 1000 * POOL
+			&& (pools[H2O_REGION1].count < POOL
+				|| pools[H2O_REGION2].count < POOL
+				|| pools[H2O_REGION5].count < POOL); ++i)
+	{
+		double p = exp(rng_uniform(log(psatmin), log(pmax)));
+		double T = rng_uniform(Tmin, Tmax);
+
+		pool_add(h2o_new_pT(p, T));
+	}
+
+	for (i = 0; i < 100 * POOL && pools[H2O_REGION3].count < POOL / 2; ++i)
+	{
+		double p = rng_uniform(psat12max, pmax);
+		double T = rng_uniform(Tb13, h2o_b23_T_p(pmax));
+
+		pool_add(h2o_new_pT(p, T));
+	}
+
+	for (i = 0; i < 100 * POOL && pools[H2O_REGION3].count < POOL; ++i)
+	{
+		double p = rng_uniform(psat12max, 25);
+		double T = rng_uniform(Tb13, h2o_b23_T_p(25));
+
+		pool_add(h2o_new_pT(p, T));
+	}
+
+	for (i = 0; i < POOL; ++i)
+		pool_add(h2o_new_Tx(rng_uniform(Tmin, Tcrit), rng_uniform(0, 1)));
+}
+
+static void get_args(enum args args, const h2o_t state,
+		const struct h2o_props* props, double* arg1, double* arg2)
+{
+	switch (args)
+	{
+		case ARGS_PT:
+			*arg1 = props->p;
+			*arg2 = props->T;
+			break;
+		case ARGS_TX:
+			*arg1 = props->T;
+			*arg2 = h2o_get_x(state);
+			break;
+		case ARGS_PX:
+			*arg1 = props->p;
+			*arg2 = h2o_get_x(state);
+			break;
+		case ARGS_PH:
+			*arg1 = props->p;
+			*arg2 = props->h;
+			break;
+		case ARGS_PS:
+			*arg1 = props->p;
+			*arg2 = props->s;
+			break;
+		case ARGS_HS:
+			*arg1 = props->h;
+			*arg2 = props->s;
+			break;
+		case ARGS_RHOT:
+			*arg1 = props->rho;
+			*arg2 = props->T;
+			break;
+		case ARGS_VU:
+			*arg1 = props->v;
+			*arg2 = props->u;
+			break;
+		default:
+			assert(not_reached);
+			*arg1 = *arg2 = NAN;
+	}
+}
+
+static void report(const char* name, enum h2o_region region, int sub,
+		double ns)
+{
+	if (sub >= 0)
+		printf("%s,%d,%c,%.1f,%.0f\n", name, region, 'a' + sub,
+				ns, 1E9 / ns);
+	else
+		printf("%s,%d,,%.1f,%.0f\n", name, region, ns, 1E9 / ns);
+	fflush(stdout);
+}
+
+/* repeat the loop over count points until seconds_per_case passes,
+ * return ns per call */
+#define TIME_LOOP(count, body) \
+	do { \
+		double start = now(); \
+		double elapsed; \
+		long calls = 0; \
+		int i_; \
+		\
+		do { \
+			for (i_ = 0; i_ < (count); ++i_) \
+			{ \
+				body; \
+			} \
+			calls += (count); \
+			elapsed = now() - start; \
+		} while (elapsed < seconds_per_case); \
+		\
+		ns = elapsed / calls * 1E9; \
+	} while (0)
+
+static void bench_initializer(int f, enum h2o_region region, int sub)
+{
+	const struct pool* pool = &pools[region];
+	func_new func = initializers[f].func;
+	double ns, acc = 0;
+	int count = 0;
+	int i;
+
+	for (i = 0; i < pool->count; ++i)
+	{
+		double arg1, arg2;
+		h2o_t state;
+
+		if (region == H2O_REGION3 && (initializers[f].args == ARGS_TX
+					|| initializers[f].args == ARGS_PX))
+			break;
+
+		get_args(initializers[f].args, pool->states[i], &pool->props[i],
+				&arg1, &arg2);
+		if (initializers[f].sub(region, arg1, arg2) != sub)
+			continue;
+
+		/* only the points the initializer handles in that region,
+		 * e.g. the backward equations may put some near the boundaries
+		 * in the neighbouring one */
+		state = func(arg1, arg2);
+		if (state.region != region)
+			continue;
+
+		arg1s[count] = arg1;
+		arg2s[count] = arg2;
+		++count;
+	}
+
+	if (count < MIN_POINTS)
+		return;
+
+	TIME_LOOP(count, acc += func(arg1s[i_], arg2s[i_]).region);
+	sink += acc;
+
+	report(initializers[f].name, region, sub, ns);
+}
+
+static void bench_getter(int f, enum h2o_region region)
+{
+	const struct pool* pool = &pools[region];
+	func_get func = getters[f].func;
+	double ns, acc = 0;
+
+	/* x is not defined in Region 3 */
+	if (func == h2o_get_x && region == H2O_REGION3)
+		return;
+
+	TIME_LOOP(pool->count, acc += func(pool->states[i_]));
+	sink += acc;
+
+	report(getters[f].name, region, -1, ns);
+}
+
+static void bench_get_all(enum h2o_region region)
+{
+	const struct pool* pool = &pools[region];
+	struct h2o_props props;
+	double ns, acc = 0;
+
+	TIME_LOOP(pool->count, (h2o_get_all(pool->states[i_], &props),
+				acc += props.h));
+	sink += acc;
+
+	report("h2o_get_all", region, -1, ns);
+}
+
+/* the Region 1 equation through the generic polynomial function,
+ * not the h2o-polygen straight-line code */
+static void bench_poly(void)
+{
+	const struct pool* pool = &pools[H2O_REGION1];
+	double ns, acc = 0;
+
+	TIME_LOOP(pool->count, acc += h2o_region1_gamma_generic_pT(
+				pool->props[i_].p, pool->props[i_].T));
+	sink += acc;
+
+	report("twoarg_poly_value", H2O_REGION1, -1, ns);
+}
+
+int main(int argc, char* argv[])
+{
+	enum h2o_region region;
+	int f, sub;
+
+	if (argc > 1)
+		seconds_per_case = atof(argv[1]);
+	if (argc > 2)
+		rng_state = strtoull(argv[2], NULL, 0);
+
+	fill_pools();
+
+	sbtl = h2o_sbtl_new();
+	ttse = h2o_ttse_new();
+	if (!sbtl || !ttse)
+	{
+		fprintf(stderr, "Unable to allocate the tables\n");
+		return 1;
+	}
+
+	printf("function,region,subregion,ns_per_call,calls_per_s\n");
+
+	for (f = 0; f < INITIALIZERS; ++f)
+	{
+		for (region = H2O_REGION1; region < H2O_REGION_MAX; ++region)
+		{
+			/* the most subregions are in Region 3 (p, T) */
+			for (sub = -1; sub < H2O_REGION3_PT_MAX; ++sub)
+				bench_initializer(f, region, sub);
+		}
+	}
+
+	for (f = 0; f < GETTERS; ++f)
+	{
+		for (region = H2O_REGION1; region < H2O_REGION_MAX; ++region)
+			bench_getter(f, region);
+	}
+
+	for (region = H2O_REGION1; region < H2O_REGION_MAX; ++region)
+		bench_get_all(region);
+
+	bench_poly();
+
+	h2o_sbtl_free(sbtl);
+	h2o_ttse_free(ttse);
+
+	return 0;
+}
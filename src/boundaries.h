@@ -13,6 +13,8 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
 enum h2o_region
 {
 	H2O_REGION_OUT_OF_RANGE,
@@ -34,7 +36,30 @@ enum h2o_region h2o_region_Tx(double T, double x);
 enum h2o_region h2o_region_px(double p, double x);
 enum h2o_region h2o_region_rhoT(double rho, double T);
 
+/* h2o_region_pT() for count points at once, using branch-free
+ * comparisons over the whole block */
+void h2o_region_pT_n(size_t count, const double p[], const double T[],
+		enum h2o_region out[]);
+
+/* Like the functions above, checking the expected region first. */
+enum h2o_region h2o_region_pT_hint(double p, double T,
+		enum h2o_region expected);
+enum h2o_region h2o_region_ph_hint(double p, double h,
+		enum h2o_region expected);
+enum h2o_region h2o_region_ps_hint(double p, double s,
+		enum h2o_region expected);
+
+/* The open box { pmin, pmax, xmin, xmax } near (p, x) lying within
+ * the region, for h2o_tracker_t. NaN if there is none. */
+void h2o_region_pT_box(double p, double T, enum h2o_region region,
+		double box[4]);
+void h2o_region_ph_box(double p, double h, enum h2o_region region,
+		double box[4]);
+void h2o_region_ps_box(double p, double s, enum h2o_region region,
+		double box[4]);
+
 double h2o_b23_p_T(double T);
+void h2o_b23_p_T_n(size_t count, const double T[], double p[]);
 double h2o_b23_T_p(double p);
 
 double h2o_b13_h_s(double s);
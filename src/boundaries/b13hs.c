@@ -10,6 +10,10 @@
 #include "boundaries.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/b13hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -55,7 +59,7 @@ double h2o_b13_h_s(double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(sigma - 0.884, sigma - 0.864,
+	return TWOARG_POLY_VALUE(b13hs, sigma - 0.884, sigma - 0.864,
 			I, Ipows, 0, 5, 0,
 			J, Jpows, 4, 7, 0,
 			n, 6) * hstar;
@@ -10,6 +10,10 @@
 #include "boundaries.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/b14hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -71,7 +75,7 @@ double h2o_b14_h_s(double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(sigma - 1.09, sigma + 0.366E-4,
+	return TWOARG_POLY_VALUE(b14hs, sigma - 1.09, sigma + 0.366E-4,
 			I, Ipows, 0, 16, 0,
 			J, Jpows, 0, 17, 0,
 			n, 27) * hstar;
@@ -28,6 +28,14 @@ double h2o_b23_p_T(double T)
 	return quadr_value(n[3], n[2], n[1], T);
 }
 
+void h2o_b23_p_T_n(size_t count, const double T[], double p[])
+{
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+		p[i] = quadr_value(n[3], n[2], n[1], T[i]);
+}
+
 double h2o_b23_T_p(double p)
 {
 	return sqrt((p - n[5]) / n[3]) + n[4];
@@ -10,6 +10,10 @@
 #include "boundaries.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/b23hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -71,7 +75,7 @@ double h2o_b23_T_hs(double h, double s)
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(eta - 0.727, sigma - 0.864,
+	return TWOARG_POLY_VALUE(b23hs, eta - 0.727, sigma - 0.864,
 			I, Ipows, 6, 14, 0,
 			J, Jpows, 7, 14, 0,
 			n, 25) * Tstar;
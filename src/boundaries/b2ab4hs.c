@@ -10,6 +10,10 @@
 #include "boundaries.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/b2ab4hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -71,7 +75,7 @@ double h2o_b2ab4_h_s(double s)
 	double sigma1 = s1star / s;
 	double sigma2 = s / s2star;
 
-	double sum = twoarg_poly_value(sigma1 - 0.513, sigma2 - 0.524,
+	double sum = TWOARG_POLY_VALUE(b2ab4hs, sigma1 - 0.513, sigma2 - 0.524,
 			I, Ipows, 0, 14, 0,
 			J, Jpows, 0, 15, 0,
 			n, 30);
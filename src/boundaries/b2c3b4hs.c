@@ -10,6 +10,10 @@
 #include "boundaries.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/b2c3b4hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -58,7 +62,7 @@ double h2o_b2c3b4_h_s(double s)
 {
 	double sigma = s / sstar;
 
-	double sum = twoarg_poly_value(sigma - 1.02, sigma - 0.726,
+	double sum = TWOARG_POLY_VALUE(b2c3b4hs, sigma - 1.02, sigma - 0.726,
 			I, Ipows, 0, 11, 0,
 			J, Jpows, 0, 11, 0,
 			n, 16);
@@ -0,0 +1,811 @@
+/* generated by h2o-bndtabgen, do not edit */
+
+/* beta = p^0.25 = bmin + i * bstep */
+static const double bndtab_low_bmin = 0x1.42043803c9d91p-3;
+static const double bndtab_low_bstep = 0x1.ddcbcf5bcedd8p-8;
+
+/* the interpolation errors */
+static const double bndtab_low_err[BNDTAB_COLUMNS] = {
+	0x1.d033c6609b5a5p-28, 0x1.c7c60be826d69p-26, 0x1.c8dd449fd04dbp-19,
+	0x1.4a3d7ef0d7a0ap-12, 0x1.550f50e0be827p-14, 0x1.98fa06d4809b6p-20,
+	0x1.8d5e9ab7d04dbp-19
+};
+
+/* the margins outside the values at the two nodes around p */
+static const double bndtab_low_span[BNDTAB_COLUMNS] = {
+	0x1.12e0be826d695p-30, 0x1.12e0be826d695p-30, 0x1.12e0be826d695p-30,
+	0x1.12e0be826d695p-30, 0x1.b4a571c82fa0ap-12, 0x1.12e0be826d695p-30,
+	0x1.12e0be826d695p-30
+};
+
+static const double bndtab_low[256][BNDTAB_COLUMNS] = {
+	{ -0.041587825659316062, 4160.660928248667, 11.921054825051103,
+		-0.041557163716171991, 2500.8926311699647, -0.00015443733878954606, 9.1557592006839617 },
+	{ -0.041464048076458787, 4160.6603792831529, 11.837380248059288,
+		10.585291371580908, 2505.5226501604106, 0.038571567227390753, 9.08900745075956 },
+	{ -0.041322674900593992, 4160.6597522790553, 11.757334249372535,
+		20.942957072893911, 2510.0384022268499, 0.075976979327643468, 9.0253234171377912 },
+	{ -0.041162112687651242, 4160.6590401691101, 11.680615140469579,
+		31.054453974254884, 2514.4479101280658, 0.11217516099294231, 8.9644475596633733 },
+	{ -0.04098069891650339, 4160.6582355796399, 11.606957358564227,
+		40.939588740924016, 2518.7583254043179, 0.14726389128106537, 8.9061517300131143 },
+	{ -0.040776701989777966, 4160.6573308305506, 11.536125919308928,
+		50.615592903576911, 2522.9760523065684, 0.1813283531725855, 8.8502343168245279 },
+	{ -0.040548321234257487, 4160.6563179353243, 11.467911895015105,
+		60.09759926530721, 2527.1068496883004, 0.21444340102651041, 8.7965162916547222 },
+	{ -0.04029368690187142, 4160.6551886010084, 11.402128698976632,
+		69.399006907915975, 2531.1559155042523, 0.24667531099614867, 8.7448379627858319 },
+	{ -0.040010860170438409, 4160.6539342282076, 11.338609009370856,
+		78.531765205687009, 2535.1279574490923, 0.27808315328094219, 8.6950562904213928 },
+	{ -0.039697833144544184, 4160.6525459110753, 11.277202205013776,
+		87.50659801229159, 2539.0272524516704, 0.30871988320404231, 8.6470426509543916 },
+	{ -0.039352528856554408, 4160.6510144373005, 11.217772214047361,
+		96.333182988791776, 2542.8576971322877, 0.33863321999232998, 8.6006809633254893 },
+	{ -0.038972801267902223, 4160.6493302880945, 11.160195698246886,
+		105.02029681790873, 2546.6228508731474, 0.36786636294707825, 8.5558661095011033 },
+	{ -0.038556435270174071, 4160.6474836381813, 11.104360512013828,
+		113.57593412891984, 2550.3259728050321, 0.39645858138750556, 8.5125025955089324 },
+	{ -0.038101146686646617, 4160.6454643557763, 11.050164387648648,
+		122.00740590823183, 2553.9700537472818, 0.42444570538295345, 8.4705034104905756 },
+	{ -0.037604582273624051, 4160.643262002578, 10.997513808166349,
+		130.32142171316121, 2557.5578439328165, 0.45186053760135336, 8.4297890497366694 },
+	{ -0.037064319722271227, 4160.6408658337405, 10.946323036440244,
+		138.52415895645908, 2561.0918771899251, 0.47873320176151263, 8.3902866742877169 },
+	{ -0.036477867660266575, 4160.6382647978589, 10.896513275357334,
+		146.62132176322456, 2564.5744921271776, 0.50509143962815772, 8.3519293848723297 },
+	{ -0.035842665653963893, 4160.6354475369517, 10.848011938326538,
+		154.61819133668334, 2568.0078507687504, 0.53096086585552282, 8.3146555920523237 },
+	{ -0.03515608421028709, 4160.6324023864281, 10.800752013184347,
+		162.51966934747952, 2571.3939550086284, 0.55636518800826762, 8.2784084677014746 },
+	{ -0.03441542477920382, 4160.6291173750715, 10.754671505506169,
+		170.3303155429837, 2574.7346611892253, 0.5813263975881473, 8.2431354655520401 },
+	{ -0.03361791975614635, 4160.6255802250043, 10.709712949717552,
+		178.05438053060442, 2578.0316930591575, 0.60586493674384356, 8.2087879006413367 },
+	{ -0.032760732484810949, 4160.6217783516668, 10.665822978331564,
+		185.69583450249266, 2581.2866533238821, 0.62999984444994683, 8.1753205791899379 },
+	{ -0.031840957259902235, 4160.6176988637781, 10.622951941211461,
+		193.25839252405834, 2584.5010339694641, 0.653748885243986, 8.1426914718260228 },
+	{ -0.030855619330383968, 4160.6133285633068, 10.581053568045236,
+		200.74553689512612, 2587.6762255123513, 0.67712866306064157, 8.1108614242019819 },
+	{ -0.029801674902754909, 4160.6086539454345, 10.540084668277165,
+		208.16053700274728, 2590.8135253054993, 0.70015472226479147, 8.0797938999797942 },
+	{ -0.028676011144689897, 4160.6036611985128, 10.500004863616343,
+		215.50646701313065, 2593.9141450125576, 0.72284163763437981, 8.0494547519300568 },
+	{ -0.02747544618870397, 4160.5983362040242, 10.460776348968134,
+		222.78622169273362, 2596.9792173463215, 0.7452030947609225, 8.0198120175271335 },
+	{ -0.026196729136561382, 4160.592664536538, 10.422363678239691,
+		230.00253060203772, 2600.0098021546487, 0.76725196210483682, 7.9908357359537918 },
+	{ -0.024836540063314878, 4160.5866314636605, 10.384733571977085,
+		237.15797086774285, 2603.0068919262262, 0.78900035575427818, 7.9624977838730731 },
+	{ -0.023391490022173087, 4160.5802219459874, 10.347854744217063,
+		244.25497870803812, 2605.9714167792918, 0.81045969778055926, 7.9347717276977914 },
+	{ -0.021858121049306498, 4160.5734206370462, 10.311697746295375,
+		251.29585986006165, 2608.9042489886856, 0.83164076895440497, 7.9076326904024583 },
+	{ -0.020232906169201956, 4160.5662118832406, 10.276234825657136,
+		258.28279903737376, 2611.8062070998985, 0.85255375647982812, 7.8810572311879472 },
+	{ -0.018512249400185275, 4160.5585797237918, 10.241439797972708,
+		265.21786852758885, 2614.6780596731351, 0.87320829731246818, 7.8550232365345769 },
+	{ -0.016692485760335041, 4160.5505078906708, 10.207287931082156,
+		272.10303602541711, 2617.5205286954438, 0.89361351755342522, 7.8295098213711043 },
+	{ -0.014769881273775683, 4160.5419798085286, 10.173755839479245,
+		278.94017178384627, 2620.3342926947844, 0.91377806834551756, 7.8044972392506935 },
+	{ -0.012740632977215975, 4160.5329785946324, 10.140821388206861,
+		285.73105515555562, 2623.1199895861682, 0.93371015864440488, 7.779966800565135 },
+	{ -0.010600868926992701, 4160.5234870587828, 10.1084636051741,
+		292.47738058766163, 2625.8782192768135, 0.95341758519065989, 7.7559007979487973 },
+	{ -0.0083466482064719332, 4160.5134877032306, 10.076662601024708,
+		299.18076312512056, 2628.6095460544002, 0.97290775996891943, 7.7322824381272746 },
+	{ -0.0059739609337121332, 4160.5029627226022, 10.045399495789699,
+		305.8427434715237, 2631.3145007800517, 0.99218773540614036, 7.7090957795550699 },
+	{ -0.0034787282697925754, 4160.4918940037996, 10.01465635164625,
+		312.46479265031928, 2633.9935829054612, 1.0112642275314605, 7.6863256752639142 },
+	{ -0.00085680242732812898, 4160.4802631259172, 9.9844161111829823,
+		319.04831630453924, 2636.6472623315831, 1.0301436372945805, 7.6639577204102523 },
+	{ 0.0018960333203230841, 4160.4680513601324, 9.9546625406390863,
+		325.59465866884926, 2639.2759811246046, 1.0488320702174001, 7.641978204068625 },
+	{ 0.0047840646298098477, 4160.4552396696108, 9.9253801776441222,
+		332.10510624401894, 2641.8801551033398, 1.0673353545343631, 7.6203740648686056 },
+	{ 0.0078116460774437218, 4160.4418087093927, 9.8965542830368776,
+		338.58089120066438, 2644.4601753107281, 1.0856590579600818, 7.5991328501167983 },
+	{ 0.010983201148956807, 4160.4277388262808, 9.8681707963871261,
+		345.02319453624921, 2647.0164093809126, 1.1038085032079661, 7.578242678084564 },
+	{ 0.014303222228392747, 4160.4130100587217, 9.8402162948839056,
+		351.43314900687625, 2649.5492028121798, 1.1217887823707307, 7.5576922031757441 },
+	{ 0.017776270586636372, 4160.397602136678, 9.812677955289141,
+		357.8118418531572, 2652.0588801549807, 1.1396047702620919, 7.5374705837185809 },
+	{ 0.021406976369346319, 4160.3814944814994, 9.7855435186863442,
+		364.16031733755165, 2654.54574612337, 1.1572611368090262, 7.5175674521523241 },
+	{ 0.02520003858428873, 4160.3646662057918, 9.7588012577815437,
+		370.47957910882593, 2657.0100866372118, 1.1747623585749365, 7.4979728874019012 },
+	{ 0.029160225088260109, 4160.3470961132571, 9.7324399465378661,
+		376.77059240777777, 2659.4521698018448, 1.1921127294862641, 7.4786773892547433 },
+	{ 0.033292372573215753, 4160.3287626985675, 9.7064488319467461,
+		383.03428612700804, 2661.8722468310557, 1.2093163708279966, 7.4596718545717193 },
+	{ 0.037601386552005484, 4160.3096441471907, 9.6808176077577954,
+		389.27155473633104, 2664.2705529186037, 1.2263772405673463, 7.4409475551802116 },
+	{ 0.042092241343194614, 4160.2897183352397, 9.6555363900065352,
+		395.48326008434827, 2666.647308062933, 1.2432991420592918, 7.4224961173116988 },
+	{ 0.046769980055652485, 4160.2689628292956, 9.6305956941942963,
+		401.6702330857226, 2669.0027178491214, 1.2600857321826631, 7.4043095024587648 },
+	{ 0.051639714572084779, 4160.2473548862372, 9.6059864139882425,
+		407.83327530286641, 2671.336974191639, 1.2767405289510776, 7.3863799895378586 },
+	{ 0.056706625532143208, 4160.2248714530551, 9.5816998013215695,
+		413.97316042996823, 2673.6502560410086, 1.2932669186390182, 7.368700158254204 },
+	{ 0.061975962314726199, 4160.201489166664, 9.5577274477848793,
+		420.09063568659121, 2675.942730057051, 1.3096681624597326, 7.3512628735743384 },
+	{ 0.067453043019525011, 4160.1771843536999, 9.5340612672094824,
+		426.18642312745823, 2678.2145512510174, 1.3259474028285039, 7.3340612712199134 },
+	{ 0.073143254448225878, 4160.1519330303172, 9.5106934793521578,
+		432.26122087447169, 2680.4658635985525, 1.3421076692418334, 7.3170887441036232 },
+	{ 0.079052052084137944, 4160.1257109019762, 9.4876165945988316,
+		438.31570427652753, 2682.6968006251723, 1.3581518838006101, 7.3003389296349424 },
+	{ 0.085184960072046609, 4160.0984933632199, 9.4648233996117384,
+		444.35052700218159, 2684.9074859655962, 1.3740828664028109, 7.2838056978290231 },
+	{ 0.091547571196534797, 4160.0702554974432, 9.4423069438511185,
+		450.36632206986923, 2687.0980338981076, 1.3899033396293083, 7.2674831401578315 },
+	{ 0.098145546859711982, 4160.0409720766556, 9.4200605269082072,
+		456.36370281994982, 2689.2685498548531, 1.4056159333443139, 7.251365559087291 },
+	{ 0.10498461705843669, 4160.0106175612318, 9.3980776865916837,
+		462.34326383254734, 2691.4191309088383, 1.421223189030306, 7.2354474582488013 },
+	{ 0.11207058036001874, 4159.9791660996616, 9.3763521877143781,
+		468.30558179480931, 2693.5498662382138, 1.4367275638756463, 7.219723533197552 },
+	{ 0.11940930387784422, 4159.9465915282735, 9.3548780115314258,
+		474.25121632095778, 2695.6608375683063, 1.4521314346316829, 7.2041886627137757 },
+	{ 0.12700672324537973, 4159.9128673709738, 9.3336493457849983,
+		480.18071072823113, 2697.752119591782, 1.467437101254832, 7.1888379006065897 },
+	{ 0.13486884258973553, 4159.8779668389552, 9.31266057531424,
+		486.09459277157691, 2699.8237803671886, 1.4826467903478695, 7.1736664679831179 },
+	{ 0.14300173450429834, 4159.8418628304044, 9.2919062731923585,
+		491.99337533975068, 2701.8758816961276, 1.4977626584136485, 7.1586697459486119 },
+	{ 0.15141154001992541, 4159.8045279301987, 9.2713811923557365,
+		497.87755711527541, 2703.9084794792002, 1.5127867949334066, 7.1438432687058846 },
+	{ 0.16010446857587132, 4159.7659344095955, 9.2510802576926618,
+		503.74762320053327, 2705.9216240509095, 1.5277212252809305, 7.1291827170248867 },
+	{ 0.16908679798909096, 4159.7260542259037, 9.2309985585616925,
+		509.60404571210665, 2707.9153604936332, 1.5425679134830326, 7.1146839120555629 },
+	{ 0.17836487442295376, 4159.6848590221589, 9.2111313417119742,
+		515.44728434531828, 2709.8897289308393, 1.5573287648359941, 7.1003428094592351 },
+	{ 0.18794511235476399, 4159.642320126768, 9.1914740045798666,
+		521.27778691079254, 2711.8447647996836, 1.5720056283869319, 7.0861554938357205 },
+	{ 0.19783399454201636, 4159.5984085531654, 9.1720220889381281,
+		527.09598984473291, 2713.7804991032122, 1.5866002992884369, 7.0721181734253014 },
+	{ 0.20803807198800528, 4159.5530949994409, 9.1527712748756151,
+		532.90231869449417, 2715.6969586423793, 1.6011145210342332, 7.0582271750662828 },
+	{ 0.21856396390590696, 4159.5063498479612, 9.1337173750871106,
+		538.69718858090084, 2717.5941662281657, 1.6155499875829868, 7.0444789393905092 },
+	{ 0.22941835768208088, 4159.4581431649858, 9.1148563294542484,
+		544.48100463869514, 2719.472140874137, 1.629908345377024, 7.0308700162406979 },
+	{ 0.24060800883791256, 4159.408444700267, 9.0961841998999446,
+		550.25416243638097, 2721.3308979698108, 1.6441911952621502, 7.0173970602947797 },
+	{ 0.2521397409906726, 4159.3572238866354, 9.0776971654999254,
+		556.01704837665773, 2723.1704494352944, 1.6584000943143902, 7.004056826883744 },
+	{ 0.26402044581305545, 4159.3044498395793, 9.0593915178360529,
+		561.77004007854657, 2724.9908038576918, 1.6725365575790379, 6.9908461679906431 },
+	{ 0.27625708299166918, 4159.2500913568092, 9.0412636565772946,
+		567.51350674227126, 2726.7919666098578, 1.6866020597271263, 6.9777620284195434 },
+	{ 0.2888566801841867, 4159.1941169178099, 9.0233100852750265,
+		573.2478094978344, 2728.5739399521035, 1.700598036633957, 6.9648014421241369 },
+	{ 0.30182633297500072, 4159.1364946833774, 9.0055274073603471,
+		578.97330173822729, 2730.3367231175916, 1.7145258868841617, 6.9519615286868008 },
+	{ 0.31517320483014083, 4159.0771924951532, 8.9879123223318285,
+		584.69032943810589, 2732.0803123821074, 1.7283869732073747, 6.939239489939597 },
+	{ 0.32890452705015105, 4159.0161778751344, 8.9704616221229898,
+		590.39923145875025, 2733.804701119037, 1.7421826238484142, 6.9266326067195729 },
+	{ 0.34302759872229621, 4158.9534180251767, 8.9531721876393462,
+		596.10033984003883, 2735.5098798403824, 1.7559141338755355, 6.9141382357514738 },
+	{ 0.35754978667093917, 4158.8888798264825, 8.9360409854556746,
+		601.79398008015426, 2737.1958362247069, 1.7695827664301778, 6.9017538066515423 },
+	{ 0.3724785254067981, 4158.8225298390807, 8.9190650646646663,
+		607.48047140367646, 2738.8625551328969, 1.7831897539213577, 6.889476819046747 },
+	{ 0.38782131707462897, 4158.7543343012831, 8.9022415538686701,
+		613.16012701869249, 2740.5100186127361, 1.7967362991677052, 6.8773048398043004 },
+	{ 0.40358573139948528, 4158.6842591291379, 8.8855676583068863,
+		618.83325436348969, 2742.1382058932022, 1.8102235764898922, 6.8652355003667793 },
+	{ 0.41977940563159094, 4158.6122699158605, 8.8690406571106593,
+		624.50015534339639, 2743.7470933694967, 1.8236527327561098, 6.8532664941886097 },
+	{ 0.43641004448965259, 4158.5383319312614, 8.8526579006801338,
+		630.16112655829465, 2745.3366545797921, 1.8370248883830826, 6.841395574270102 },
+	{ 0.45348542010275061, 4158.4624101211475, 8.8364168081758621,
+		635.81645952126485, 2746.9068601746567, 1.8503411382948542, 6.8296205507854255 },
+	{ 0.47101337195044146, 4158.384469106717, 8.8203148651193874,
+		641.4664408688617, 2748.4576778801556, 1.8636025528416325, 6.8179392888013997 },
+	{ 0.48900180680163274, 4158.3044731839418, 8.804349621097149,
+		647.11135256341095, 2749.9890724555503, 1.8768101786806337, 6.8063497060839815 },
+	{ 0.50745869865156712, 4158.2223863229265, 8.7885186875624086,
+		652.75147208778276, 2751.5010056465667, 1.8899650396209688, 6.7948497709898046 },
+	{ 0.52639208865735287, 4158.1381721672642, 8.7728197357302555,
+		658.38707263299193, 2752.9934361350897, 1.9030681374343126, 6.783437500440062 },
+	{ 0.5458100850718467, 4158.0517940333702, 8.757250494560946,
+		664.0184232790092, 2754.4663194861728, 1.9161204526330993, 6.7721109579743564 },
+	{ 0.56572086317558545, 4157.963214909797, 8.7418087488271912,
+		669.64578916912637, 2755.9196080931679, 1.9291229452178797, 6.7608682518821235 },
+	{ 0.58613266520766794, 4157.8723974565555, 8.7264923372612486,
+		675.26943167820718, 2757.353251121755, 1.9420765553953627, 6.7497075334094463 },
+	{ 0.60705380029397682, 4157.7793040043898, 8.7112991507778332,
+		680.88960857511961, 2758.7671944535646, 1.954982204268555, 6.7386269950390165 },
+	{ 0.6284926443746589, 4157.6838965540646, 8.6962271307692323,
+		686.50657417966124, 2760.1613806300707, 1.9678407945004142, 6.7276248688411613 },
+	{ 0.65045764012877227, 4157.5861367756188, 8.6812742674690622,
+		692.12057951425561, 2761.5357487973456, 1.9806532109522925, 6.7166994248938341 },
+	{ 0.67295729689821571, 4157.4859860076203, 8.6664385983814007,
+		697.73187245066129, 2762.8902346521954, 1.9934203212983399, 6.705848969769475 },
+	{ 0.69600019060890361, 4157.3834052563889, 8.6517182067722018,
+		703.34069785198039, 2764.2247703901594, 2.0061429766171135, 6.6950718450866971 },
+	{ 0.7195949636906277, 4157.2783551952143, 8.6371112202200049,
+		708.94729771017921, 2765.5392846557543, 2.0188220119614155, 6.6843664261246802 },
+	{ 0.7437503249947095, 4157.170796163563, 8.6226158092232055,
+		714.55191127935745, 2766.8337024953075, 2.0314582469074245, 6.6737311204982221 },
+	{ 0.76847504971012948, 4157.0606881662543, 8.6082301858612329,
+		720.15477520499019, 2768.1079453126345, 2.0440524860841176, 6.6631643668913316 },
+	{ 0.79377797927713667, 4156.9479908726325, 8.5939526025071444,
+		725.75612364933102, 2769.3619308277598, 2.0566055196838811, 6.652664633847241 },
+	{ 0.81966802129955507, 4156.8326636157262, 8.579781350589295,
+		731.3561884131924, 2770.59557303881, 2.0691181239552257, 6.6422304186126748 },
+	{ 0.8461541494544581, 4156.7146653913805, 8.5657147593998388,
+		736.95519905428853, 2771.8087821871554, 2.0815910616784619, 6.6318602460342611 },
+	{ 0.873245403400289, 4156.5939548573861, 8.5517511949479861,
+		742.55338300229982, 2773.0014647257963, 2.0940250826250701, 6.6215526675048562 },
+	{ 0.90095088868268491, 4156.4704903325828, 8.5378890588559315,
+		748.15096567086221, 2774.1735232909577, 2.1064209240016063, 6.6113062599576242 },
+	{ 0.92927977663827754, 4156.3442297959546, 8.5241267872956552,
+		753.74817056662528, 2775.3248566767907, 2.1187793108788187, 6.6011196249056576 },
+	{ 0.95824130429635879, 4156.2151308857128, 8.5104628499647337,
+		759.34521939554281, 2776.4553598130237, 2.1311009566066779, 6.5909913875249497 },
+	{ 0.98784477427852568, 4156.0831508983447, 8.4968957490994441,
+		764.94233216655448, 2777.5649237453849, 2.143386563215989, 6.5809201957785151 },
+	{ 1.0180995546960467, 4155.9482467876742, 8.4834240185236034,
+		770.53972729278507, 2778.6534356185516, 2.1556368218071795, 6.5709047195794748 },
+	{ 1.0490150790449457, 4155.8103751638855, 8.4700462227315167,
+		776.13762169043309, 2779.7207786613726, 2.1678524129269228, 6.5609436499909508 },
+	{ 1.0806008460991241, 4155.6694922925435, 8.456760956003647,
+		781.73623087545695, 2780.7668321740694, 2.1800340069331048, 6.5510356984606393 },
+	{ 1.1128664198010387, 4155.5255540935959, 8.4435668415535705,
+		787.33576905819416, 2781.7914715170928, 2.1921822643487068, 6.5411795960879466 },
+	{ 1.1458214291501498, 4155.3785161403584, 8.4304625307048955,
+		792.9364492360645, 2782.794568101323, 2.2042978362051651, 6.5313740929216744 },
+	{ 1.1794755680890288, 4155.2283336584878, 8.4174467020969281,
+		798.53848328444269, 2783.7759893792354, 2.2163813643756347, 6.5216179572862076 },
+	{ 1.2138385953872664, 4155.0749615249406, 8.4045180609178214,
+		804.14208204584747, 2784.7355988367162, 2.2284334818986968, 6.5119099751343175 },
+	{ 1.2489203345228486, 4154.9183542669134, 8.3916753381641449,
+		809.74745541756181, 2785.6732559851648, 2.2404548132929731, 6.5022489494247111 },
+	{ 1.2847306735613844, 4154.7584660607799, 8.3789172899257274,
+		815.35481243777167, 2786.5888163535037, 2.2524459748630328, 6.4926336995224583 },
+	{ 1.3212795650324372, 4154.5952507309958, 8.3662426966947674,
+		820.96436137037688, 2787.4821314798014, 2.2644075749971035, 6.483063060620716 },
+	{ 1.3585770258041316, 4154.4286617490097, 8.3536503626982412,
+		826.57630978854604, 2788.3530489021423, 2.2763402144569409, 6.473535883182004 },
+	{ 1.3966331369546146, 4154.2586522321426, 8.3411391152526253,
+		832.19086465712917, 2789.2014121484299, 2.2882444866602456, 6.4640510323975544 },
+	{ 1.4354580436413775, 4154.0851749424692, 8.3287078041401159,
+		837.8082324140521, 2790.0270607248381, 2.3001209779560772, 6.4546073876632928 },
+	{ 1.4750619549681183, 4153.908182285677, 8.316355301005391,
+		843.42861905078666, 2790.8298301026257, 2.3119702678935887, 6.4452038420710913 },
+	{ 1.5154551438485906, 4153.7276263099129, 8.3040804987722066,
+		849.05223019196922, 2791.6095517030358, 2.3237929294844188, 6.4358393019139921 },
+	{ 1.556647946868561, 4153.5434587046238, 8.291882311078961,
+		854.67927117433533, 2792.3660528800783, 2.3355895294591869, 6.4265126862043278 },
+	{ 1.5986507641445229, 4153.3556307993776, 8.2797596717325614,
+		860.3099471249933, 2793.0991569009611, 2.3473606285183011, 6.4172229262035838 },
+	{ 1.6414740591802111, 4153.1640935626774, 8.2677115341798402,
+		865.9444630392104, 2793.8086829239846, 2.3591067815775588, 6.4079689649630645 },
+	{ 1.6851283587200923, 4152.9687976007599, 8.2557368709958361,
+		871.58302385775198, 2794.4944459737562, 2.3708285380087171, 6.3987497568744622 },
+	{ 1.7296242526005614, 4152.7696931563923, 8.2438346733883563,
+		877.22583454392327, 2795.1562569135531, 2.3825264418754832, 6.3895642672294857 },
+	{ 1.7749723935981485, 4152.566730107641, 8.2320039507181306,
+		882.87310016038259, 2795.7939224147235, 2.3942010321651486, 6.380411471787804 },
+	{ 1.8211834972749932, 4152.3598579666532, 8.2202437300340101,
+		888.52502594584325, 2796.4072449230489, 2.4058528430162007, 6.3712903563526959 },
+	{ 1.8682683418216952, 4152.1490258784079, 8.2085530556226409,
+		894.18181739177942, 2796.9960226219355, 2.4174824039422598, 6.3621999163536627 },
+	{ 1.9162377678972347, 4151.9341826194686, 8.1969309885720687,
+		899.84368031919723, 2797.5600493923866, 2.4290902400525209, 6.3531391564355344 },
+	{ 1.9651026784662609, 4151.7152765967294, 8.1853766063487505,
+		905.51082095565039, 2798.0991147697027, 2.4406768722691674, 6.3441070900535239 },
+	{ 2.0148740386331623, 4151.492255846144, 8.1738890023875079,
+		911.18344601253341, 2798.6130038967976, 2.4522428175418809, 6.3351027390736565 },
+	{ 2.0655628754737281, 4151.2650680314555, 8.1624672856939036,
+		916.86176276282424, 2799.101497474137, 2.4637885890598645, 6.3261251333782216 },
+	{ 2.1171802778635227, 4151.0336604429131, 8.1511105804586368,
+		922.54597911935321, 2799.5643717061785, 2.4753146964615995, 6.3171733104756829 },
+	{ 2.1697373963036024, 4150.7979799959885, 8.1398180256835051,
+		928.23630371373565, 2800.0013982442683, 2.4868216460426593, 6.3082463151146158 },
+	{ 2.2232454427431692, 4150.5579732300794, 8.1285887748184891,
+		933.93294597606905, 2800.4123441258907, 2.498309940961839, 6.2993431989012239 },
+	{ 2.2777156903992402, 4150.3135863072193, 8.1174219954096234,
+		939.6361162155597, 2800.7969717102101, 2.5097800814459674, 6.2904630199199509 },
+	{ 2.3331594735732097, 4150.0647650107703, 8.1063168687572045,
+		945.34602570214645, 2801.1550386096997, 2.5212325649935869, 6.281604842356618 },
+	{ 2.3895881874648537, 4149.8114547441191, 8.095272589584031,
+		951.06288674931147, 2801.4862976177888, 2.5326678865778991, 6.2727677361235994 },
+	{ 2.4470132879825344, 4149.5536005293716, 8.0842883657132809,
+		956.78691279816985, 2801.7904966322781, 2.5440865388491973, 6.2639507764864417 },
+	{ 2.505446291551098, 4149.2911470060426, 8.0733634177557132,
+		962.51831850302676, 2802.0673785743661, 2.5554890123371758, 6.255153043691263 },
+	{ 2.5648987749160774, 4149.0240384297467, 8.0624969788058589,
+		968.25731981849719, 2802.316681302962, 2.5668757956533237, 6.2463736225922437 },
+	{ 2.6253823749452176, 4148.7522186708848, 8.0516882941469081,
+		974.00413408838222, 2802.5381375240554, 2.578247375693802, 6.2376116022784869 },
+	{ 2.6869087884265066, 4148.4756312133377, 8.0409366209639774,
+		979.7589801364378, 2802.7314746947418, 2.5896042378430684, 6.2288660756993819 },
+	{ 2.7494897718633542, 4148.1942191531589, 8.0302412280654814,
+		985.52207835922911, 2802.8964149215803, 2.6009468661786426, 6.2201361392876517 },
+	{ 2.8131371412662989, 4147.9079251972689, 8.0196013956123391,
+		991.29365082119205, 2803.03267485278, 2.612275743677233, 6.2114208925790351 },
+	{ 2.877862771941718, 4147.6166916621532, 8.009016414854738,
+		997.07392135214764, 2803.1399655638006, 2.6235913524227108, 6.2027194378277173 },
+	{ 2.9436785982772276, 4147.3204604725652, 7.9984855878762264,
+		1002.8631156474003, 2803.2179924357829, 2.6348941738161518, 6.1940308796162586 },
+	{ 3.0105966135237696, 4147.0191731602417, 7.9880082273448556,
+		1008.6614613706579, 2803.2664550262793, 2.6461846887884115, 6.185354324459043 },
+	{ 3.0786288695746173, 4146.7127708626158, 7.9775836562711842,
+		1014.469188259939, 2803.2850469316159, 2.6574633780155055, 6.176688880397851 },
+	{ 3.1477874767407594, 4146.4011943215419, 7.9672112077728743,
+		1020.2865282367381, 2803.2734556402593, 2.668730722137302, 6.1680336565884399 },
+	{ 3.2180846035234172, 4146.0843838820338, 7.9568902248456954,
+		1026.1137155185977, 2803.2313623764317, 2.6799872019797717, 6.1593877628766789 },
+	{ 3.2895324763827714, 4145.7622794910085, 7.9466200601407264,
+		1031.9509867354084, 2803.1584419332821, 2.6912332987813636, 6.1507503093629694 },
+	{ 3.362143379503554, 4145.4348206960449, 7.9364000757475237,
+		1037.7985810495998, 2803.0543624947486, 2.7024694944237786, 6.1421204059534258 },
+	{ 3.4359296545573859, 4145.1019466441576, 7.9262296429831203,
+		1043.6567402805601, 2802.9187854453826, 2.7136962716677218, 6.1334971618965097 },
+	{ 3.5109037004615833, 4144.7635960805837, 7.9161081421866166,
+		1049.5257090334817, 2802.7513651672025, 2.7249141143939579, 6.1248796853035357 },
+	{ 3.5870779731344218, 4144.4197073475825, 7.9060349625192066,
+		1055.4057348329725, 2802.551748822772, 2.7361235078502375, 6.1162670826516399 },
+	{ 3.6644649852472471, 4144.0702183832618, 7.8960095017694876,
+		1061.2970682617051, 2802.3195761235907, 2.7473249389045376, 6.1076584582677587 },
+	{ 3.7430773059729985, 4143.7150667204151, 7.8860311661638587,
+		1067.1999631044266, 2802.0544790829144, 2.7585188963051532, 6.0990529137921259 },
+	{ 3.8229275607312263, 4143.354189485387, 7.8760993701818549,
+		1073.1146764976445, 2801.7560817521016, 2.7697058709481293, 6.090449547619877 },
+	{ 3.9040284309297841, 4142.9875233969569, 7.8662135363762955,
+		1079.0414690853443, 2801.4239999396118, 2.7808863561526249, 6.0818474543193952 },
+	{ 3.9863926537028438, 4142.6150047652482, 7.8563730951980384,
+		1084.9806051811067, 2801.0578409117666, 2.7920608479447746, 6.0732457240260613 },
+	{ 4.0700330216456688, 4142.2365694906612, 7.8465774848252714,
+		1090.9323529369826, 2800.6572030744264, 2.8032298453506224, 6.0646434418101141 },
+	{ 4.1549623825454782, 4141.8521530628459, 7.8368261509971529,
+		1096.8969845195375, 2800.2216756347602, 2.8143938506987696, 6.0560396870175124 },
+	{ 4.2411936391091691, 4141.4616905596849, 7.8271185468516711,
+		1102.8747762934931, 2799.7508382423189, 2.8255533699333997, 6.0474335325826534 },
+	{ 4.328739748687279, 4141.0651166463267, 7.8174541327676437,
+		1108.8660090133603, 2799.2442606086647, 2.8367089129382785, 6.0388240443119843 },
+	{ 4.4176137229944477, 4140.6623655742414, 7.8078323762106683,
+		1114.870968023572, 2798.7015021048974, 2.8478609938725286, 6.030210280137724 },
+	{ 4.5078286278262665, 4140.2533711803198, 7.7982527515829547,
+		1120.8899434675675, 2798.122111336434, 2.8590101315188456, 6.0215912893408854 },
+	{ 4.5993975827725047, 4139.8380668860036, 7.7887147400769168,
+		1126.9232305062999, 2797.5056256944986, 2.8701568496448697, 6.0129661117431015 },
+	{ 4.6923337609270241, 4139.4163856964597, 7.779217829532393,
+		1132.9711295467598, 2796.85157088387, 2.8813016773786138, 6.0043337768668525 },
+	{ 4.7866503885936584, 4138.988260199797, 7.7697615142974126,
+		1139.0339464809542, 2796.1594604264637, 2.8924451495985859, 5.9956933030637645 },
+	{ 4.8823607449888149, 4138.55362256633, 7.7603452950923968,
+		1145.1119929360079, 2795.4287951404963, 2.9035878073395973, 5.9870436966110185 },
+	{ 4.9794781619402224, 4138.1124045478782, 7.7509686788777028,
+		1151.2055865358664, 2794.6590625949525, 2.9147301982149534, 5.9783839507758083 },
+	{ 5.0780160235824354, 4137.6645374771324, 7.7416311787243997,
+		1157.3150511753142, 2793.8497365393382, 2.92587287685609, 5.9697130448482865 },
+	{ 5.1779877660481555, 4137.2099522670569, 7.7323323136882083,
+		1163.4407173068325, 2793.0002763085745, 2.9370164053703651, 5.9610299431431839 },
+	{ 5.2794068771561795, 4136.7485794103568, 7.7230716086864977,
+		1169.5829222409677, 2792.1101262031157, 2.9481613538179881, 5.952333593970728 },
+	{ 5.382286896096109, 4136.2803489789967, 7.7138485943782573,
+		1175.7420104609491, 2791.1787148444705, 2.9593083007091714, 5.9436229285775903 },
+	{ 5.4866414131084271, 4135.8051906237779, 7.7046628070469776,
+		1181.9183339520794, 2790.2054545061301, 2.9704578335221448, 5.9348968600583341 },
+	{ 5.5924840691620696, 4135.3230335739845, 7.6955137884863323,
+		1188.1122525467631, 2789.189740420255, 2.981610549243344, 5.9261542822383602 },
+	{ 5.6998285556273638, 4134.8338066370898, 7.6864010858886189,
+		1194.3241342857179, 2788.1309500601487, 2.9927670549304115, 5.9173940685288153 },
+	{ 5.8086886139459031, 4134.3374381985295, 7.6773242517358415,
+		1200.5543557962471, 2787.0284423987869, 3.0039279682993101, 5.9086150707543119 },
+	{ 5.9190780352965406, 4133.8338562215467, 7.6682828436934187,
+		1206.8033026881615, 2785.8815571433347, 3.0150939183362384, 5.8998161179536757 },
+	{ 6.0310106602577758, 4133.3229882471187, 7.6592764245063947,
+		1213.0713699682221, 2784.6896139456485, 3.0262655459355794, 5.8909960151540384 },
+	{ 6.1445003784663514, 4132.8047613939452, 7.6503045618981202,
+		1219.3589624737895, 2783.4519115884109, 3.0374435045647474, 5.8821535421179689 },
+	{ 6.2595611282724368, 4132.2791023585314, 7.6413668284713276,
+		1225.6664953264653, 2782.1677271462972, 3.0486284609569441, 5.8732874520628675 },
+	{ 6.3762068963909044, 4131.7459374153459, 7.6324628016115428,
+		1231.9943944065831, 2780.8363151212898, 3.059821095832965, 5.8643964703513305 },
+	{ 6.494451717549091, 4131.2051924170728, 7.623592063392767,
+		1238.3430968492703, 2779.4569065505975, 3.0710221046529429, 5.8554792931500357 },
+	{ 6.6143096741308796, 4130.65679279494, 7.6147542004853843,
+		1244.713051563024, 2778.0287080852581, 3.0822321983992551, 5.8465345860540578 },
+	{ 6.735794895817075, 4130.1006635591566, 7.6059488040662036,
+		1251.1047197716746, 2776.5509010366964, 3.0934521043917189, 5.8375609826720982 },
+	{ 6.858921559222221, 4129.5367292994424, 7.5971754697306499,
+		1257.5185755806503, 2775.022640387614, 3.1046825671362281, 5.8285570831666034 },
+	{ 6.9837038875277777, 4128.9649141856517, 7.5884337974069833,
+		1263.9551065686708, 2773.4430537627923, 3.1159243492083593, 5.8195214527414105 },
+	{ 7.1101561501116333, 4128.3851419685043, 7.5797233912725002,
+		1270.4148144059634, 2771.8112403540504, 3.1271782321733634, 5.8104526200672995 },
+	{ 7.2382926621739809, 4127.7973359804391, 7.5710438596717653,
+		1276.8982155003366, 2770.1262697924763, 3.1384450175443948, 5.8013490756339703 },
+	{ 7.3681277843596309, 4127.2014191365515, 7.5623948150366518,
+		1283.40584167261, 2768.3871809594862, 3.1497255277810807, 5.7922092700144319 },
+	{ 7.4996759223767162, 4126.5973139356738, 7.5537758738083465,
+		1289.9382408631463, 2766.5929807266875, 3.1610206073309066, 5.7830316120251464 },
+	{ 7.6329515266119135, 4125.9849424615577, 7.545186656361091,
+		1296.4959778715897, 2764.7426426127349, 3.1723311237165386, 5.7738144667624951 },
+	{ 7.7679690917417679, 4125.364226384193, 7.5366267869277612,
+		1303.079635132319, 2762.8351053434258, 3.1836579686728252, 5.7645561534929337 },
+	{ 7.9047431563409551, 4124.7350869612437, 7.528095893527154,
+		1309.6898135285132, 2760.8692712990023, 3.1950020593378565, 5.7552549433706641 },
+	{ 8.0432883024865838, 4124.0974450396288, 7.519593607892979,
+		1316.3271332487514, 2758.8440048307725, 3.2063643395042067, 5.7459090569537699 },
+	{ 8.1836191553592084, 4123.4512210572257, 7.5111195654045124,
+		1322.9922346902592, 2756.7581304261566, 3.2177457809366854, 5.7365166614850178 },
+	{ 8.325750382840166, 4122.7963350447262, 7.5026734050188795,
+		1329.6857794145205, 2754.6104306993911, 3.2291473847656986, 5.7270758679008278 },
+	{ 8.4696966951056538, 4122.1327066276381, 7.4942547692049075,
+		1336.4084511616804, 2752.3996441820946, 3.2405701829663207, 5.7175847275271998 },
+	{ 8.615472844217086, 4121.4602550284299, 7.4858633038785669,
+		1343.1609569318107, 2750.1244628854533, 3.2520152399360045, 5.7080412284178781 },
+	{ 8.763093623708178, 4120.7788990688359, 7.4774986583398917,
+		1349.9440281426923, 2747.7835296030994, 3.2634836541863024, 5.6984432912860568 },
+	{ 8.9125738681686837, 4120.0885571723247, 7.4691604852114333,
+		1356.7584218757734, 2745.3754349211322, 3.2749765601672864, 5.6887887649772262 },
+	{ 9.0639284528243955, 4119.3891473667245, 7.4608484403781334,
+		1363.6049222242925, 2742.8987138991533, 3.2864951302470828, 5.6790754214271741 },
+	{ 9.2171722931141922, 4118.6805872870227, 7.4525621829286566,
+		1370.4843417602256, 2740.3518423838277, 3.2980405768731993, 5.6693009500459581 },
+	{ 9.3723203442633505, 4117.9627941783447, 7.4443013750981146,
+		1377.3975231398822, 2737.7332329142296, 3.3096141549473947, 5.6594629514658079 },
+	{ 9.5293876008539478, 4117.2356848991085, 7.4360656822121607,
+		1384.3453408714554, 2735.0412301762076, 3.3212171644513231, 5.6495589305884097 },
+	{ 9.6883890963916244, 4116.4991759243603, 7.4278547726324318,
+		1391.3287032720207, 2732.2741059614241, 3.3328509533668713, 5.6395862888653818 },
+	{ 9.8493399028692021, 4115.7531833493185, 7.4196683177033247,
+		1398.3485546459544, 2729.4300535854031, 3.34451692094202, 5.6295423157445281 },
+	{ 10.012255130327201, 4114.9976228930891, 7.4115059917000563,
+		1405.4058777218495, 2726.5071817179605, 3.3562165213611301, 5.6194241792139152 },
+	{ 10.17714992641106, 4114.2324099026046, 7.4033674717779974,
+		1412.501696390849, 2723.5035075793598, 3.3679512678875732, 5.6092289153768302 },
+	{ 10.344039475924964, 4113.4574593567631, 7.3952524379232791,
+		1419.6370787952412, 2720.4169494553166, 3.3797227375556846, 5.5989534169913266 },
+	{ 10.512939000383232, 4112.6726858707798, 7.3871605729045973,
+		1426.8131408233235, 2717.2453184853775, 3.391532576500079, 5.5885944209115168 },
+	{ 10.68386375755771, 4111.8780037007527, 7.3790915622262441,
+		1434.0310500734315, 2713.9863096802242, 3.4033825060206975, 5.5781484943703843 },
+	{ 10.856829041022829, 4111.0733267484738, 7.3710450940823389,
+		1441.292030357987, 2710.6374921260822, 3.4152743294939052, 5.5676120200493235 },
+	{ 11.031850179697418, 4110.2585685664462, 7.3630208593121953,
+		1448.5973668264876, 2707.1962983373164, 3.4272099402520331, 5.5569811798852271 },
+	{ 11.208942537383475, 4109.4336423631548, 7.3550185513568662,
+		1455.9484117944407, 2703.660012721909, 3.4391913305653614, 5.5462519375727446 },
+	{ 11.388121512302039, 4108.5984610085798, 7.3470378662168079,
+		1463.346591373856, 2700.025759129348, 3.4512206018732319, 5.5354200197280417 },
+	{ 11.56940253662631, 4107.7529370399552, 7.3390785024106711,
+		1470.7934130089141, 2696.2904874554711, 3.4632999764219718, 5.5244808956891642 },
+	{ 11.752801076011851, 4106.8969826677903, 7.3311401609351661,
+		1478.2904740281863, 2692.4509592849095, 3.4754318104780815, 5.5134297559386161 },
+	{ 11.93833262912394, 4106.0305097821456, 7.3232225452260371,
+		1485.8394713318212, 2688.5037325583735, 3.4876186092942629, 5.5022614891448045 },
+	{ 12.12601272716234, 4105.1534299591949, 7.3153253611200908,
+		1493.4422123377506, 2684.445145259142, 3.4998630440126917, 5.4909706578308022 },
+	{ 12.315856933383285, 4104.2656544680431, 7.307448316818272,
+		1501.1006273151797, 2680.2712981207151, 3.5121679706940085, 5.4795514726911065 },
+	{ 12.507880842618651, 4103.3670942778472, 7.2995911228497929,
+		1508.8167832353529, 2675.9780363652858, 3.5245364516605631, 5.4679977655894199 },
+	{ 12.702100080793109, 4102.4576600652181, 7.2917534920372731,
+		1516.5928992686333, 2671.5609304907643, 3.5369717793379825, 5.4563029612830229 },
+	{ 12.898530304438069, 4101.537262221922, 7.2839351394629004,
+		1524.4313640521689, 2667.0152561315299, 3.5494775027683403, 5.4444600479306979 },
+	{ 13.097187200203576, 4100.6058108628886, 7.2761357824355892,
+		1532.3347548433155, 2662.3359730256575, 3.5620574569505372, 5.4324615464525303 },
+	{ 13.298086484367696, 4099.6632158345255, 7.2683551404591249,
+		1540.3058586591926, 2657.5177031273297, 3.5747157951364175, 5.4202994788183414 },
+	{ 13.501243902343615, 4098.709386723368, 7.2605929352012941,
+		1548.34769548189, 2652.5547079091971, 3.5874570241750501, 5.4079653353500463 },
+	{ 13.706675228184116, 4097.7442328650377, 7.2528488904639694,
+		1556.4635435801952, 2647.4408649025245, 3.6002860429486092, 5.3954500411266073 },
+	{ 13.91439626408444, 4096.7676633535448, 7.2451227321541616,
+		1564.6569669612275, 2642.1696435251101, 3.613208183880956, 5.3827439215820849 },
+	{ 14.124422839882325, 4095.7795870509367, 7.2374141882560128,
+		1572.9318449181403, 2636.734080245868, 3.6262292574230108, 5.3698366673838578 },
+	{ 14.336770812556349, 4094.7799125972933, 7.2297229888037347,
+		1581.2924035816052, 2631.1267531309313, 3.6393555993239963, 5.3567172986697544 },
+	{ 14.551456065722217, 4093.7685484210742, 7.2220488658554647,
+		1589.7432493114322, 2625.3397558076972, 3.6525941203841832, 5.3433741287076293 },
+	{ 14.76849450912683, 4092.745402749847, 7.2143915534680572,
+		1598.289403680129, 2619.3646708707092, 3.6659523582510194, 5.3297947270192099 },
+	{ 14.987902078140856, 4091.7103836213746, 7.2067507876727719,
+		1606.9363396999715, 2613.1925427334904, 3.679438530663405, 5.3159658819770677 },
+	{ 15.209694733249044, 4090.6633988951007, 7.1991263064518938,
+		1615.6900188295513, 2606.8138499053653, 3.6930615893697931, 5.301873562842391 },
+	{ 15.43388845953913, 4089.6043562640111, 7.1915178497162273,
+		1624.5569281618907, 2600.2184766364007, 3.7068312737400295, 5.2875028811534683 },
+	{ 15.660499266188825, 4088.5331632669026, 7.1839251592834934,
+		1633.5441170464082, 2593.3956838295981, 3.7207581628618178, 5.2728380513048023 },
+	{ 15.889543185951531, 4087.4497273010638, 7.1763479788576188,
+		1642.6592322251429, 2586.3340790595489, 3.7348537246534441, 5.2578623500623776 },
+	{ 16.121036274640144, 4086.353955635363, 7.1687860540089039,
+		1651.9105503769983, 2579.021585463669, 3.7491303602436257, 5.2425580746466638 },
+	{ 16.35499461060963, 4085.245755423769, 7.1612391321550559,
+		1661.3070067525762, 2571.445409175712, 3.7636014415555703, 5.2269064988653584 },
+	{ 16.591434294238315, 4084.1250337193001, 7.1537069625431213,
+		1670.8582183547874, 2563.5920048494972, 3.7782813396961727, 5.2108878265903318 }
+};
+
+/* beta = p^0.25 = bmin + i * bstep */
+static const double bndtab_high_bmin = 0x1.021745467624ep+1;
+static const double bndtab_high_bstep = 0x1.27abd4774dbc2p-7;
+
+/* the interpolation errors */
+static const double bndtab_high_err[BNDTAB_COLUMNS] = {
+	0x1.e263afa09b5a5p-28, 0x1.07eb3c17d04dbp-19, 0x1.9818df4136b4ap-29,
+	0x1.a5509000be827p-14, 0x1.95bd1696a0be8p-6, 0x1.5ea530fd04dadp-23,
+	0x1.59f1e48c7d04ep-15
+};
+
+/* the margins outside the values at the two nodes around p */
+static const double bndtab_high_span[BNDTAB_COLUMNS] = {
+	0x1.12e0be826d695p-30, 0x1.12e0be826d695p-30, 0x1.12e0be826d695p-30,
+	0x1.12e0be826d695p-30, 0x1.3079ad1d05f41p-9, 0x1.12e0be826d695p-30,
+	0x1.bc83af97fa09bp-16
+};
+
+static const double bndtab_high[128][BNDTAB_COLUMNS] = {
+	{ 16.591434294238315, 4084.1250337193001, 7.1537069625431213,
+		1670.8582183535059, 2563.5920035076838, 3.7782813396940873, 5.2108878244370569 },
+	{ 16.887522930523936, 4082.7204994748449, 7.144404859427806,
+		1668.1121093817867, 2575.6647030092681, 3.7730447976950034, 5.2260239467929219 },
+	{ 17.187467718552668, 4081.2964661858628, 7.1351245039839943,
+		1665.4866007178459, 2585.3224382324829, 3.7679946008484464, 5.2372009986637549 },
+	{ 17.491299314039725, 4079.8527572089338, 7.1258654322470463,
+		1662.9704850414437, 2593.1797568630091, 3.763112583063867, 5.2454419946397142 },
+	{ 17.799048418892248, 4078.389195823413, 7.1166271843795563,
+		1660.5536969957939, 2599.6457412912787, 3.758382423066684, 5.2514279015454441 },
+	{ 18.110745779685097, 4076.9056052794826, 7.1074093046327897,
+		1658.2272261577391, 2605.0048395666199, 3.7537895036566726, 5.2556322385293432 },
+	{ 18.426422186134182, 4075.4018088479797, 7.0982113413111358,
+		1655.9830316418022, 2609.4623537092139, 3.749320773625946, 5.2583967648783059 },
+	{ 18.746108469567201, 4073.877629872055, 7.0890328467396344,
+		1653.8139589507687, 2613.1712958763228, 3.7449646133265797, 5.2599761443448791 },
+	{ 19.069835501392745, 4072.3328918206867, 7.0798733772344988,
+		1651.7136596208366, 2616.2489228361414, 3.740710704772968, 5.2605654374157407 },
+	{ 19.397634191567398, 4070.7674183441081, 7.0707324930766804,
+		1649.676514139813, 2618.7872984169012, 3.7365499070514296, 5.2603176636190732 },
+	{ 19.729535487062282, 4069.1810333311828, 7.0616097584884354,
+		1647.6975585468226, 2620.860264982723, 3.7324741376958075, 5.2593553949851239 },
+	{ 20.065570370328736, 4067.5735609687754, 7.0525047416129043,
+		1645.7724150499332, 2622.5281802196073, 3.7284762605719717, 5.2577786355951668 },
+	{ 20.405769857763723, 4065.9448258031589, 7.043417014496705,
+		1643.8972269270516, 2623.8412197338293, 3.7245499806983302, 5.2556703175771302 },
+	{ 20.750164998175755, 4064.2946528035118, 7.0343461530755302,
+		1642.0685979047416, 2624.8417332742865, 3.7206897463155775, 5.2531002240617957 },
+	{ 21.098786871251548, 4062.6228674275321, 7.0252917371627417,
+		1640.2835361415787, 2625.5659605549313, 3.7168906584086003, 5.2501278474588489 },
+	{ 21.451666586023823, 4060.92929568923, 7.0162533504409828,
+		1638.5394028767068, 2626.0453036996778, 3.7131483877770708, 5.2468045104225967 },
+	{ 21.808835279340773, 4059.2137642289426, 7.0072305804567856,
+		1636.8338657428569, 2626.3072862448689, 3.7094590996516934, 5.2431749654544086 },
+	{ 22.170324114337923, 4057.4761003855992, 6.9982230186182086,
+		1635.1648566852666, 2626.3762862849344, 3.7058193857596984, 5.2392786187556641 },
+	{ 22.536164278912626, 4055.7161322713109, 6.989230260195467,
+		1633.5305343757354, 2626.2741039966204, 3.7022262036589737, 5.2351504785186975 },
+	{ 22.906386984201649, 4053.9336888483003, 6.9802519043245965,
+		1631.9292509637701, 2626.0204057400224, 3.6986768230837828, 5.2308218978795953 },
+	{ 23.281023463062962, 4052.1286000082437, 6.9712875540141424,
+		1630.3595229660698, 2625.6330748079649, 3.6951687789790952, 5.2263211626055943 },
+	{ 23.66010496856077, 4050.3006966540574, 6.9623368161548731,
+		1628.8200060603638, 2625.1284905967814, 3.6916998308440645, 5.2216739597943782 },
+	{ 24.043662772456518, 4048.4498107841709, 6.9533993015325395,
+		1627.3094735213524, 2624.5217521990708, 3.6882679279593606, 5.2169037542613523 },
+	{ 24.431728163704303, 4046.5757755793484, 6.9444746248436839,
+		1625.8267980142957, 2623.8268583432487, 3.6848711800374692, 5.2120320925071493 },
+	{ 24.824332446952507, 4044.6784254920935, 6.9355624047144948,
+		1624.3709364460765, 2623.0568526866923, 3.6815078328096402, 5.2070788492968516 },
+	{ 25.221506941051608, 4042.7575963386867, 6.9266622637227497,
+		1622.940917564044, 2622.2239413535913, 3.6781762480481395, 5.2020624283542904 },
+	{ 25.62328297756892, 4040.8131253938973, 6.9177738284228028,
+		1621.5358319892991, 2621.3395880566268, 3.6748748875166761, 5.196999926083409 },
+	{ 26.029691899310972, 4038.8448514884326, 6.9088967293736907,
+		1620.1548243730749, 2620.4145909907297, 3.6716023003451284, 5.1919072653038896 },
+	{ 26.440765058853454, 4036.8526151091423, 6.9000306011703172,
+		1618.7970873718825, 2619.4591448250012, 3.6683571133364521, 5.1867993045434533 },
+	{ 26.856533817080049, 4034.8362585020559, 6.8911750824777531,
+		1617.4618571488274, 2618.4828904671804, 3.6651380237325974, 5.1816899273345589 },
+	{ 27.27702954173035, 4032.7956257782712, 6.882329816068661,
+		1616.1484101241315, 2617.4949547774445, 3.6619437939917621, 5.1765921151248619 },
+	{ 27.70228360595717, 4030.7305630227579, 6.8734944488638501,
+		1614.8560607170684, 2616.5039820252746, 3.6587732481604953, 5.171518006763459 },
+	{ 28.132327386894097, 4028.6409184061158, 6.8646686319759729,
+		1613.5841598433608, 2615.5181585850137, 3.6556252694595188, 5.1664789470191801 },
+	{ 28.567192264234158, 4026.5265422993225, 6.8558520207563962,
+		1612.332093956094, 2614.5452321318035, 3.652498798741139, 5.1614855261887813 },
+	{ 29.006909618819392, 4024.3872873915366, 6.8470442748452234,
+		1611.0992844436039, 2613.5925264130788, 3.6493928335172625, 5.1565476125341201 },
+	{ 29.451510831242384, 4022.2230088109782, 6.8382450582245227,
+		1609.8851872240143, 2612.6669525207508, 3.6463064272995096, 5.1516743790301343 },
+	{ 29.901027280460426, 4020.0335642489413, 6.8294540392747303,
+		1608.6892924025119, 2611.7750174658736, 3.6432386890356638, 5.1468743256936227 },
+	{ 30.355490342422637, 4017.8188140869834, 6.8206708908342906,
+		1607.5111238833902, 2610.9228307545554, 3.6401887824687229, 5.1421552985859167 },
+	{ 30.814931388710193, 4015.578621527321, 6.8118952902624939,
+		1606.3502388539669, 2610.1161095758785, 3.6371559252853567, 5.1375245064320518 },
+	{ 31.279381785191379, 4013.3128527264894, 6.803126919505571,
+		1605.2062270811107, 2609.3601831354231, 3.6341393879587569, 5.1329885356678622 },
+	{ 31.74887289069083, 4011.0213769322936, 6.7943654651660266,
+		1604.0787099829017, 2608.6599965991027, 3.6311384922261567, 5.1285533646106529 },
+	{ 32.223436055673972, 4008.704066624095, 6.7856106185752303,
+		1602.9673394576851, 2608.0201150485627, 3.6281526091730867, 5.1242243773439684 },
+	{ 32.703102620947405, 4006.3607976564745, 6.7768620758692917,
+		1601.8717964700022, 2607.4447277902823, 3.6251811569242913, 5.1200063778107276 },
+	{ 33.187903916375575, 4003.9914494063059, 6.7681195380682135,
+		1600.791789407642, 2606.9376533043019, 3.6222235979650228, 5.1159036045192154 },
+	{ 33.677871259613973, 4001.5959049232788, 6.7593827111583451,
+		1599.7270522360714, 2606.5023450643303, 3.6192794361357503, 5.1119197461817674 },
+	{ 34.173035954860232, 3999.1740510838972, 6.7506513061781304,
+		1598.6773424858218, 2606.1418984087863, 3.6163482133583744, 5.1080579585261399 },
+	{ 34.673429291622433, 3996.7257787490034, 6.7419250393071888,
+		1597.6424391152034, 2605.8590585916586, 3.6134295061628481, 5.1043208824437416 },
+	{ 35.179082543506233, 3994.2509829248547, 6.7332036319587205,
+		1596.6221402947435, 2605.656230093075, 3.610522922089606, 5.1007106635672184 },
+	{ 35.690026967020763, 3991.749562927761, 6.7244868108752298,
+		1595.616261161684, 2605.5354872226062, 3.6076280960461751, 5.0972289733027516 },
+	{ 36.206293800404033, 3989.2214225523498, 6.7157743082276129,
+		1594.6246315924277, 2605.4985860036695, 3.604744686695581, 5.093877031279967 },
+	{ 36.727914262467657, 3986.6664702434628, 6.707065861717588,
+		1593.6470940386516, 2605.5469772859083, 3.6018723729505204, 5.0906556291255978 },
+	{ 37.254919551462741, 3984.0846192717104, 6.6983612146834846,
+		1592.6835014689493, 2605.6818209941639, 3.5990108506409726, 5.0875651554160042 },
+	{ 37.787340843965694, 3981.4757879127142, 6.6896601162093869,
+		1591.7337154527399, 2605.904001388762, 3.5961598294145642, 5.0846056216197635 },
+	{ 38.325209293785832, 3978.8398996300607, 6.6809623212376712,
+		1590.7976044171069, 2606.2141431825721, 3.5933190299190958, 5.0817766888049434 },
+	{ 38.868556030894453, 3976.176883261975, 6.6722675906848794,
+		1589.8750421004513, 2606.6126283363296, 3.5904881813056178, 5.0790776948570775 },
+	{ 39.417412160375832, 3973.4866732117462, 6.6635756915609994,
+		1588.9659062197586, 2607.0996133356489, 3.5876670190789604, 5.0765076819339221 },
+	{ 39.971808761400744, 3970.7692096419023, 6.6548863970921026,
+		1588.0700773610731, 2607.6750467411734, 3.584855283310902, 5.0740654238719065 },
+	{ 40.531776886222936, 3968.0244386721688, 6.6461994868463723,
+		1587.1874380958554, 2608.3386867979866, 3.5820527172199821, 5.071749453257171 },
+	{ 41.09734755919829, 3965.2523125811922, 6.6375147468634923,
+		1586.3178723192761, 2609.0901188914668, 3.5792590661112138, 5.0695580878808686 },
+	{ 41.668551775828234, 3962.452790012062, 6.6288319697874325,
+		1585.4612648006532, 2609.9287726444991, 3.5764740766595007, 5.067489456313921 },
+	{ 42.245420501826111, 3959.6258361816185, 6.6201509550025825,
+		1584.6175009310173, 2610.8539384649189, 3.5736974965121577, 5.0655415223601388 },
+	{ 42.827984672208132, 3956.7714230935508, 6.6114715087732767,
+		1583.7864666485928, 2611.8647833718987, 3.5709290741790984, 5.0637121081776035 },
+	{ 43.416275190408641, 3953.8895297552854, 6.6027934443866592,
+		1582.9680485196391, 2612.9603659548729, 3.568168559173944, 5.0619989158954422 },
+	{ 44.010322927419594, 3950.9801423986478, 6.5941165822989181,
+		1582.1621339498281, 2614.1396503482333, 3.5654157023656272, 5.0603995475957877 },
+	{ 44.61015872095502, 3948.0432547043083, 6.5854407502848691,
+		1581.368611499975, 2615.4015191376325, 3.5626702564978974, 5.0589115235766648 },
+	{ 45.215813374640589, 3945.0788680299702, 6.5767657835908588,
+		1580.587371279632, 2616.7447851490783, 3.5599319768337208, 5.0575322988599645 },
+	{ 45.827317657227717, 3942.0869916423094, 6.5680915250910106,
+		1579.818305392489, 2618.1682021081265, 3.5572006218822838, 5.0562592779573432 },
+	{ 46.444702301833154, 3939.0676429526179, 6.5594178254467774,
+		1579.0613084088777, 2619.6704741925673, 3.5544759541685176, 5.0550898279543564 },
+	{ 47.067998005203954, 3936.0208477561496, 6.5507445432697944,
+		1578.3162778425765, 2621.2502645364507, 3.5517577410082453, 5.0540212900175776 },
+	{ 47.697235427007001, 3932.9466404751138, 6.5420715452880138,
+		1577.5831146116498, 2622.9062027749605, 3.5490457552561323, 5.0530509894692761 },
+	{ 48.332445189144728, 3929.8450644052973, 6.5333987065151042,
+		1576.8617234659068, 2624.6368917470991, 3.5463397759982915, 5.0521762446076925 },
+	{ 48.973657875095064, 3926.7161719662645, 6.5247259104231112,
+		1576.1520133667561, 2626.4409134954635, 3.5436395891666326, 5.0513943744770859 },
+	{ 49.620904029276744, 3923.5600249550912, 6.5160530491183284,
+		1575.453897808495, 2628.3168347183705, 3.5409449880572592, 5.050702705808888 },
+	{ 50.274214156440244, 3920.3766948035804, 6.5073800235203896,
+		1574.7672950733872, 2630.2632118386523, 3.5382557737407092, 5.0500985793632704 },
+	{ 50.933618721082134, 3917.1662628389054, 6.4987067435445445,
+		1574.0921284160431, 2632.2785958548538, 3.5355717553568939, 5.0495793558980688 },
+	{ 51.599148146884879, 3913.9288205476073, 6.490033128287096,
+		1573.4283261756048, 2634.3615371342921, 3.5328927502924539, 5.0491424219799175 },
+	{ 52.270832816180508, 3910.664469842884, 6.4813591062139695,
+		1572.7758218169067, 2636.510590293326, 3.5302185842425997, 5.0487851958302237 },
+	{ 52.948703069438118, 3907.373323335099, 6.47268461535241,
+		1572.1345539041338, 2638.7243192886604, 3.5275490911632721, 5.0485051333674154 },
+	{ 53.632789204774838, 3904.0555046054078, 6.4640096034857466,
+		1571.5044660123997, 2641.0013028152775, 3.524884113122571, 5.0482997345675518 },
+	{ 54.323121477489543, 3900.7111484824327, 6.4553340283512313,
+		1570.8855065842217, 2643.3401400725534, 3.5222235000628657, 5.048166550219344 },
+	{ 55.019730099619188, 3897.3404013218706, 6.4466578578408988,
+		1570.2776287389165, 2645.7394569214794, 3.5195671094867267, 5.0481031890987085 },
+	{ 55.722645239517043, 3893.943421288945, 6.4379810702054305,
+		1569.6807900436418, 2648.1979124142931, 3.5169148060809059, 5.0481073255340645 },
+	{ 56.431897021451761, 3890.5203786435691, 6.4293036542609974,
+		1569.0949522551039, 2650.7142056347561, 3.514266461293075, 5.0481767072789827 },
+	{ 57.147515525226929, 3887.0714560281135, 6.4206256095990417,
+		1568.5200810408264, 2653.2870827446518, 3.5116219528758075, 5.0483091635558139 },
+	{ 57.869530785820629, 3883.5968487576379, 6.4119469467989694,
+		1567.9561456886011, 2655.9153440917894, 3.508981164411817, 5.0485026130848825 },
+	{ 58.597972793043198, 3880.0967651124561, 6.4032676876437398,
+		1567.4031188120061, 2658.5978511986668, 3.5063439848332822, 5.0487550718710841 },
+	{ 59.332871491212899, 3876.5714266328737, 6.3945878653383099,
+		1566.8609760591535, 2661.3335334208004, 3.503710307946867, 5.0490646604854765 },
+	{ 60.074256778848664, 3873.0210684159492, 6.3859075247309063,
+		1566.3296958307844, 2664.1213940412958, 3.5010800319743769, 5.049429610555447 },
+	{ 60.822158508377669, 3869.4459394141027, 6.3772267225371069,
+		1565.8092590128408, 2666.960515554932, 3.4984530591173444, 5.0498482701651515 },
+	{ 61.576606485858058, 3865.8463027353996, 6.3685455275666998,
+		1565.2996487275216, 2669.8500638918804, 3.4958292951520229, 5.0503191078689458 },
+	{ 62.337630470714252, 3862.2224359453089, 6.3598640209533022,
+		1564.8008501057629, 2672.7892913392316, 3.4932086490595355, 5.0508407150356138 },
+	{ 63.105260175483906, 3858.5746313697446, 6.3511822963867246,
+		1564.3128500830742, 2675.7775379379132, 3.4905910326942742, 5.0514118062702265 },
+	{ 63.879525265575104, 3854.9031963991692, 6.3425004603480426,
+		1563.8356372196963, 2678.8142311633701, 3.4879763604920799, 5.0520312177030187 },
+	{ 64.660455359032085, 3851.2084537935339, 6.3338186323473877,
+		1563.3692015452148, 2681.8988837401862, 3.4853645492183762, 5.0526979029903041 },
+	{ 65.448080026307593, 3847.490741987825, 6.325136945164429,
+		1562.9135344270653, 2685.0310894924792, 3.4827555177553124, 5.0534109269390042 },
+	{ 66.242428790040606, 3843.7504153979544, 6.316455545091558,
+		1562.4686284617467, 2688.2105171921776, 3.4801491869259475, 5.0541694567425663 },
+	{ 67.043531124836292, 3839.9878447267301, 6.3077745921797472,
+		1562.0344773871363, 2691.436902434265, 3.4775454793528544, 5.0549727508987656 },
+	{ 67.851416457047847, 3836.203417269639, 6.2990942604871352,
+		1561.6110760139566, 2694.7100376396916, 3.4749443193479244, 5.055820145967 },
+	{ 68.666114164556475, 3832.397537220128, 6.2904147383302895,
+		1561.1984201742659, 2698.0297603603494, 3.4723456328299149, 5.0567110414104182 },
+	{ 69.487653576548027, 3828.5706259741028, 6.2817362285382403,
+		1560.7965066847241, 2701.3959401337479, 3.4697493472660699, 5.0576448828538627 },
+	{ 70.316063973283732, 3824.7231224332772, 6.273058948709239,
+		1560.4053333224124, 2704.8084642049098, 3.4671553916341882, 5.0586211441683391 },
+	{ 71.151374585862271, 3820.8554833070843, 6.2643831314703409,
+		1560.0248988110698, 2708.2672224968264, 3.46456369640166, 5.0596393088635994 },
+	{ 71.993614595970513, 3816.9681834127432, 6.2557090247398337,
+		1559.6552028157298, 2711.772092265981, 3.4619741935182242, 5.0606988513292324 },
+	{ 72.842813135620403, 3813.0617159731369, 6.2470368919925647,
+		1559.2962459439934, 2715.3229229231765, 3.4593868164195518, 5.0617992185085203 },
+	{ 73.698999286868187, 3809.1365929120975, 6.2383670125282675,
+		1558.9480297523262, 2718.9195215304444, 3.4568015000390782, 5.0629398126162348 },
+	{ 74.562202081513632, 3805.1933451466848, 6.2296996817429511,
+		1558.6105567560764, 2722.5616394999952, 3.4542181808259778, 5.0641199755193611 },
+	{ 75.432450500775914, 3801.2325228760265, 6.2210352114034668,
+		1558.2838304421259, 2726.2489610200414, 3.4516367967675188, 5.0653389753876263 },
+	{ 76.309773474941565, 3797.2546958662788, 6.2123739299253842,
+		1557.9678552833534, 2729.9810937138423, 3.4490572874145222, 5.0665959961880489 },
+	{ 77.194199882982048, 3793.2604537312222, 6.2037161826542908,
+		1557.662636754292, 2733.7575620027278, 3.4464795939089252, 5.0678901305448978 },
+	{ 78.085758552136866, 3789.2504062080061, 6.1950623321507017,
+		1557.3681813476178, 2737.5778035912881, 3.4439036590128969, 5.0692203764144983 },
+	{ 78.984478257457454, 3785.2251834275244, 6.1864127584787481,
+		1557.0844965912538, 2741.441169424822, 3.4413294271392032, 5.0705856379350092 },
+	{ 79.890387721308727, 3781.1854361788887, 6.1777678594988581,
+		1556.8115910660699, 2745.3469273871592, 3.4387568443828043, 5.0719847307072552 },
+	{ 80.803515612822764, 3777.1318361674298, 6.1691280511646767,
+		1556.5494744242742, 2749.2942699133805, 3.4361858585539018, 5.0734163916467834 },
+	{ 81.723890547300996, 3773.0650762656451, 6.1604937678244545,
+		1556.2981574086846, 2753.2823255897961, 3.4336164192127514, 5.0748792934235203 },
+	{ 82.65154108555943, 3768.9858707564822, 6.1518654625272466,
+		1556.0576518731827, 2757.31017470593, 3.4310484777067964, 5.0763720633775637 },
+	{ 83.586495733212359, 3764.8949555683212, 6.1432436073342203,
+		1555.8279708046466, 2761.3768686136805, 3.4284819872106143, 5.0778933066720304 },
+	{ 84.528782939888416, 3760.7930885009823, 6.1346286936354479,
+		1555.6091283467044, 2765.4814526413911, 3.4259169027692793, 5.0794416333212258 },
+	{ 85.478431098375253, 3756.6810494420874, 6.1260212324725964,
+		1555.4011398256487, 2769.6229922085076, 3.4233531813457239, 5.0810156886187094 },
+	{ 86.435468543684948, 3752.5596405730271, 6.1174217548679648,
+		1555.2040217787778, 2773.8006016940353, 3.4207907818725465, 5.0826141863894705 },
+	{ 87.399923552035844, 3748.4296865638153, 6.1088308121603614,
+		1555.0177919854045, 2778.0134755322429, 3.4182296653086852, 5.0842359444071858 },
+	{ 88.37182433974418, 3744.292034756018, 6.1002489763483734,
+		1554.8424695006627, 2782.2609209450688, 3.4156697947011798, 5.085879921254298 },
+	{ 89.351199062018338, 3740.1475553329765, 6.0916768404416297,
+		1554.6780746921463, 2786.5423916751097, 3.4131111352520951, 5.0875452538623565 },
+	{ 90.338075811650498, 3735.9971414764564, 6.0831150188207372,
+		1554.5246292792719, 2790.8575220576481, 3.4105536543904145, 5.0892312949540441 },
+	{ 91.332482617597094, 3731.8417095088566, 6.0745641476065755,
+		1554.3821563751023, 2795.2061607660289, 3.4079973218484794, 5.0909376496174499 },
+	{ 92.334447443441846, 3727.6821990200715, 6.0660248850397833,
+		1554.2506805301955, 2799.5884035821659, 3.4054421097422454, 5.0926642102773139 },
+	{ 93.343998185733724, 3723.5195729780476, 6.0574979118712866,
+		1554.1302277778418, 2804.0046245824897, 3.4028879926542865, 5.0944111893858901 },
+	{ 94.361162672191369, 3719.3548178220553, 6.0489839317648046,
+		1554.0208256798217, 2808.4555051877282, 3.4003349477180995, 5.0961791492355326 },
+	{ 95.385968659767016, 3715.1889435376725, 6.0404836717123827,
+		1553.9225033716014, 2812.9420606003791, 3.3977829547018907, 5.0979690283931456 }
+};
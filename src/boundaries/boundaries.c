@@ -14,10 +14,15 @@
 #include "region3.h"
 #include "region4.h"
 #include "region5.h"
+#include "stats.h"
 #include "xmath.h"
 
+#include <math.h>
+
 enum h2o_region h2o_region_pT(double p, double T)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PT);
+
 	if (T < Tmin || T > Tmax || p <= pmin || p > pmax)
 		return H2O_REGION_OUT_OF_RANGE;
 
@@ -46,23 +51,231 @@ enum h2o_region h2o_region_pT(double p, double T)
 	}
 }
 
+void h2o_region_pT_n(size_t count, const double p[], const double T[],
+		enum h2o_region out[])
+{
+	double psat[XMATH_BLOCK], pb23[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		/* both boundaries for all the points, the one that does not
+		 * apply is simply not selected */
+		h2o_region4_p_T_n(block, T, psat);
+		h2o_b23_p_T_n(block, T, pb23);
+
+		for (i = 0; i < block; ++i)
+		{
+			int in_range = T[i] >= Tmin && T[i] <= Tmax
+				&& p[i] > pmin && p[i] <= pmax;
+			int r12 = p[i] > psat[i] ? H2O_REGION1 : H2O_REGION2;
+			int r32 = p[i] >= pb23[i] ? H2O_REGION3 : H2O_REGION2;
+			int r5 = p[i] > pmax5 ? H2O_REGION_OUT_OF_RANGE : H2O_REGION5;
+			int r = T[i] <= Tb13 ? r12 : T[i] <= Tb25 ? r32 : r5;
+
+			out[i] = in_range ? r : H2O_REGION_OUT_OF_RANGE;
+		}
+
+		p += block;
+		T += block;
+		out += block;
+		count -= block;
+	}
+}
+
+enum h2o_region h2o_region_pT_hint(double p, double T,
+		enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PT_HINT);
+
+	if (T < Tmin || T > Tmax || p <= pmin || p > pmax)
+		return H2O_REGION_OUT_OF_RANGE;
+
+	switch (expected)
+	{
+		case H2O_REGION1:
+			if (T <= Tb13 && p > h2o_region4_p_T(T))
+				return expected;
+			break;
+		case H2O_REGION2:
+			if (T <= Tb13 ? p <= h2o_region4_p_T(T)
+					: T <= Tb25 && p < h2o_b23_p_T(T))
+				return expected;
+			break;
+		case H2O_REGION3:
+			if (T > Tb13 && T <= Tb25 && p >= h2o_b23_p_T(T))
+				return expected;
+			break;
+		case H2O_REGION5:
+			if (T > Tb25 && p <= pmax5)
+				return expected;
+			break;
+		default:
+			break;
+	}
+
+	return h2o_region_pT(p, T);
+}
+
+/* The h(p) and s(p) boundaries are interpolated from the tables emitted
+ * by tools/bndtabgen.c, and the exact functions are evaluated only
+ * if the point is within the interpolation error of the boundary. */
+
+enum bndtab_column
+{
+	BNDTAB_HMIN,
+	BNDTAB_HB25,
+	BNDTAB_SB25,
+	/* h', h'', s' and s'' up to psat12max, B13 and B23 above */
+	BNDTAB_H1,
+	BNDTAB_H2,
+	BNDTAB_S1,
+	BNDTAB_S2,
+
+	BNDTAB_COLUMNS
+};
+
+#include "bndtab.h"
+
+typedef double (*boundary_func_t)(double);
+
+/* the interpolation at a particular p */
+struct bndtab_point
+{
+	const double (*f)[BNDTAB_COLUMNS];
+	const double* err;
+	double w[4];
+};
+
+static double hmin_p(double p)
+{
+	return h2o_region1_h_pT(p, Tmin);
+}
+
+static double hb25_p(double p)
+{
+	return h2o_region2_h_pT(p, Tb25);
+}
+
+static double sb25_p(double p)
+{
+	return h2o_region2_s_pT(p, Tb25);
+}
+
+static double hsat1_p(double p)
+{
+	return h2o_region1_h_pT(p, h2o_region4_T_p(p));
+}
+
+static double hsat2_p(double p)
+{
+	return h2o_region2_h_pT(p, h2o_region4_T_p(p));
+}
+
+static double ssat1_p(double p)
+{
+	return h2o_region1_s_pT(p, h2o_region4_T_p(p));
+}
+
+static double ssat2_p(double p)
+{
+	return h2o_region2_s_pT(p, h2o_region4_T_p(p));
+}
+
+static double hb13_p(double p)
+{
+	return h2o_region1_h_pT(p, Tb13);
+}
+
+static double hb23_p(double p)
+{
+	return h2o_region2_h_pT(p, h2o_b23_T_p(p));
+}
+
+static double sb13_p(double p)
+{
+	return h2o_region1_s_pT(p, Tb13);
+}
+
+static double sb23_p(double p)
+{
+	return h2o_region2_s_pT(p, h2o_b23_T_p(p));
+}
+
+/* f is NULL below psatmin, where the boundaries are not tabulated */
+static void bndtab_point(double p, struct bndtab_point* out)
+{
+	double beta = sqrt(sqrt(p));
+	int base;
+
+	if (p < psatmin)
+		out->f = NULL;
+	else if (p <= psat12max)
+	{
+		base = xmath_lagrange4_weights(
+				(beta - bndtab_low_bmin) / bndtab_low_bstep,
+				sizeof(bndtab_low) / sizeof(*bndtab_low), out->w);
+		out->f = &bndtab_low[base];
+		out->err = bndtab_low_err;
+	}
+	else
+	{
+		base = xmath_lagrange4_weights(
+				(beta - bndtab_high_bmin) / bndtab_high_bstep,
+				sizeof(bndtab_high) / sizeof(*bndtab_high), out->w);
+		out->f = &bndtab_high[base];
+		out->err = bndtab_high_err;
+	}
+}
+
+/* Compare x with the boundary at p: negative if x is below it, zero
+ * if on it, positive if above it. */
+static int bndtab_compare(double x, const struct bndtab_point* pt,
+		enum bndtab_column col, boundary_func_t exact, double p)
+{
+	double y;
+
+	if (pt->f)
+	{
+		const double (*f)[BNDTAB_COLUMNS] = pt->f;
+		const double* w = pt->w;
+
+		y = w[0] * f[0][col] + w[1] * f[1][col]
+			+ w[2] * f[2][col] + w[3] * f[3][col];
+
+		if (x < y - pt->err[col])
+			return -1;
+		else if (x > y + pt->err[col])
+			return 1;
+	}
+
+	y = exact(p);
+	return (x > y) - (x < y);
+}
+
 enum h2o_region h2o_region_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PH);
+
+	struct bndtab_point pt;
+
 	if (p < pmin || p > pmax)
 		return H2O_REGION_OUT_OF_RANGE;
 
+	bndtab_point(p, &pt);
+
 	/* Left boundary. */
-	if (h < h2o_region1_h_pT(p, Tmin))
+	if (bndtab_compare(h, &pt, BNDTAB_HMIN, hmin_p, p) < 0)
 		return H2O_REGION_OUT_OF_RANGE;
 
 	/* Check the region4 curves. */
 	if (p <= psat12max)
 	{
-		double Tsat = h2o_region4_T_p(p);
-
-		if (h <= h2o_region1_h_pT(p, Tsat))
+		if (bndtab_compare(h, &pt, BNDTAB_H1, hsat1_p, p) <= 0)
 			return H2O_REGION1;
-		else if (h < h2o_region2_h_pT(p, Tsat))
+		else if (bndtab_compare(h, &pt, BNDTAB_H2, hsat2_p, p) < 0)
 			return H2O_REGION4;
 	}
 	else /* Then, check the B13 & B23. */
@@ -75,14 +288,14 @@ enum h2o_region h2o_region_ph(double p, double h)
 			else
 				return H2O_REGION4;
 		}
-		else if (h <= h2o_region1_h_pT(p, Tb13))
+		else if (bndtab_compare(h, &pt, BNDTAB_H1, hb13_p, p) <= 0)
 			return H2O_REGION1;
-		else if (h < h2o_region2_h_pT(p, h2o_b23_T_p(p)))
+		else if (bndtab_compare(h, &pt, BNDTAB_H2, hb23_p, p) < 0)
 			return H2O_REGION3;
 	}
 
 	/* Finally, check B25/right border. */
-	if (h <= h2o_region2_h_pT(p, Tb25))
+	if (bndtab_compare(h, &pt, BNDTAB_HB25, hb25_p, p) <= 0)
 		return H2O_REGION2;
 	else if (p <= pmax5 && h <= h2o_region5_s_pT(p, Tmax))
 		return H2O_REGION5;
@@ -92,32 +305,36 @@ enum h2o_region h2o_region_ph(double p, double h)
 
 enum h2o_region h2o_region_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PS);
+
+	struct bndtab_point pt;
+
 	if (p < pmin || p > pmax || s < smin)
 		return H2O_REGION_OUT_OF_RANGE;
 
+	bndtab_point(p, &pt);
+
 	/* First, check the region4 curves. */
 	if (p <= psat12max)
 	{
-		double Tsat = h2o_region4_T_p(p);
-
-		if (s <= h2o_region1_s_pT(p, Tsat))
+		if (bndtab_compare(s, &pt, BNDTAB_S1, ssat1_p, p) <= 0)
 			return H2O_REGION1;
-		else if (s < h2o_region2_s_pT(p, Tsat))
+		else if (bndtab_compare(s, &pt, BNDTAB_S2, ssat2_p, p) < 0)
 			return H2O_REGION4;
 	}
 	else /* Then, check the B13 & B23. */
 	{
-		if (s <= h2o_region1_s_pT(p, Tb13))
+		if (bndtab_compare(s, &pt, BNDTAB_S1, sb13_p, p) <= 0)
 			return H2O_REGION1;
 		/* psat3(s) validity range */
 		else if (s >= psat3_smin && s <= psat3_smax && p < h2o_region3_psat_s(s))
 			return H2O_REGION4;
-		else if (s < h2o_region2_s_pT(p, h2o_b23_T_p(p)))
+		else if (bndtab_compare(s, &pt, BNDTAB_S2, sb23_p, p) < 0)
 			return H2O_REGION3;
 	}
 
 	/* Finally, check B25/right border. */
-	if (s <= h2o_region2_s_pT(p, Tb25))
+	if (bndtab_compare(s, &pt, BNDTAB_SB25, sb25_p, p) <= 0)
 		return H2O_REGION2;
 	else if (p <= pmax5 && s <= h2o_region5_s_pT(p, Tmax))
 		return H2O_REGION5;
@@ -125,8 +342,356 @@ enum h2o_region h2o_region_ps(double p, double s)
 		return H2O_REGION_OUT_OF_RANGE;
 }
 
+/* The hinted classification checks only the boundaries of the expected
+ * region, against the values at the two table nodes around p (widened
+ * by the span margin). The boundaries are not interpolated, and any
+ * point it is not sure about is classified the regular way. */
+
+struct bndtab_nodes
+{
+	const double (*f)[BNDTAB_COLUMNS];
+	const double* span;
+	double pa, pb; /* the pressures at the nodes */
+};
+
+/* f is NULL outside the tables */
+static void bndtab_nodes(double p, struct bndtab_nodes* out)
+{
+	double beta = sqrt(sqrt(p));
+	double bmin, bstep;
+	int last, i;
+
+	if (p < psatmin || p > pmax)
+	{
+		out->f = NULL;
+		return;
+	}
+	else if (p <= psat12max)
+	{
+		last = sizeof(bndtab_low) / sizeof(*bndtab_low) - 2;
+		bmin = bndtab_low_bmin;
+		bstep = bndtab_low_bstep;
+		out->f = bndtab_low;
+		out->span = bndtab_low_span;
+	}
+	else
+	{
+		last = sizeof(bndtab_high) / sizeof(*bndtab_high) - 2;
+		bmin = bndtab_high_bmin;
+		bstep = bndtab_high_bstep;
+		out->f = bndtab_high;
+		out->span = bndtab_high_span;
+	}
+
+	i = (beta - bmin) / bstep;
+	if (i < 0)
+		i = 0;
+	else if (i > last)
+		i = last;
+	out->f += i;
+
+	beta = bmin + i * bstep;
+	out->pa = beta * beta * beta * beta;
+	beta += bstep;
+	out->pb = beta * beta * beta * beta;
+	/* the grids meet there, with different boundaries */
+	if (p <= psat12max)
+		out->pb = fmin(out->pb, psat12max);
+	else
+		out->pa = fmax(out->pa, psat12max);
+}
+
+static int bndtab_below(double x, const struct bndtab_nodes* nd,
+		enum bndtab_column col)
+{
+	return x < fmin(nd->f[0][col], nd->f[1][col]) - nd->span[col];
+}
+
+static int bndtab_above(double x, const struct bndtab_nodes* nd,
+		enum bndtab_column col)
+{
+	return x > fmax(nd->f[0][col], nd->f[1][col]) + nd->span[col];
+}
+
+enum h2o_region h2o_region_ph_hint(double p, double h,
+		enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PH_HINT);
+
+	struct bndtab_nodes nd;
+	int psat3;
+
+	bndtab_nodes(p, &nd);
+	if (!nd.f || !bndtab_above(h, &nd, BNDTAB_HMIN))
+		return h2o_region_ph(p, h);
+
+	/* psat3(h) validity range */
+	psat3 = p > psat12max && h >= psat3_hmin && h <= psat3_hmax;
+
+	switch (expected)
+	{
+		case H2O_REGION1:
+			if (!psat3 && bndtab_below(h, &nd, BNDTAB_H1))
+				return expected;
+			break;
+		case H2O_REGION2:
+			if (!psat3 && bndtab_above(h, &nd, BNDTAB_H2)
+					&& bndtab_below(h, &nd, BNDTAB_HB25))
+				return expected;
+			break;
+		case H2O_REGION3:
+			if (psat3 ? p >= h2o_region3_psat_h(h)
+					: p > psat12max && bndtab_above(h, &nd, BNDTAB_H1)
+						&& bndtab_below(h, &nd, BNDTAB_H2))
+				return expected;
+			break;
+		case H2O_REGION4:
+			if (psat3 ? p < h2o_region3_psat_h(h)
+					: p <= psat12max && bndtab_above(h, &nd, BNDTAB_H1)
+						&& bndtab_below(h, &nd, BNDTAB_H2))
+				return expected;
+			break;
+		default:
+			break;
+	}
+
+	return h2o_region_ph(p, h);
+}
+
+enum h2o_region h2o_region_ps_hint(double p, double s,
+		enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PS_HINT);
+
+	struct bndtab_nodes nd;
+	int psat3;
+
+	bndtab_nodes(p, &nd);
+	if (!nd.f || s < smin)
+		return h2o_region_ps(p, s);
+
+	/* wet steam above psat12max */
+	psat3 = p > psat12max && s >= psat3_smin && s <= psat3_smax
+		&& p < h2o_region3_psat_s(s);
+
+	switch (expected)
+	{
+		case H2O_REGION1:
+			if (bndtab_below(s, &nd, BNDTAB_S1))
+				return expected;
+			break;
+		case H2O_REGION2:
+			if (!psat3 && bndtab_above(s, &nd, BNDTAB_S2)
+					&& bndtab_below(s, &nd, BNDTAB_SB25))
+				return expected;
+			break;
+		case H2O_REGION3:
+			if (!psat3 && p > psat12max && bndtab_above(s, &nd, BNDTAB_S1)
+					&& bndtab_below(s, &nd, BNDTAB_S2))
+				return expected;
+			break;
+		case H2O_REGION4:
+			if (psat3 ? bndtab_above(s, &nd, BNDTAB_S1)
+					: p <= psat12max && bndtab_above(s, &nd, BNDTAB_S1)
+						&& bndtab_below(s, &nd, BNDTAB_S2))
+				return expected;
+			break;
+		default:
+			break;
+	}
+
+	return h2o_region_ps(p, s);
+}
+
+/* The boxes are open rectangles, with p between box[0] and box[1],
+ * and the other argument between box[2] and box[3], lying entirely
+ * within the region. They are found around the given point, which
+ * does not need to be inside them. In (p,T), they reach up to box_dT
+ * past it. If there is no such box, it is set to NaN. */
+
+static const double box_dT = 5; /* [K] */
+
+static void box_set(double box[4], double pa, double pb,
+		double xa, double xb)
+{
+	box[0] = pa;
+	box[1] = pb;
+	box[2] = xa;
+	box[3] = xb;
+}
+
+void h2o_region_pT_box(double p, double T, enum h2o_region region,
+		double box[4])
+{
+	double Tb;
+
+	/* the boxes only depend on T here */
+	(void) p;
+
+	switch (region)
+	{
+		case H2O_REGION1:
+			Tb = fmin(T + box_dT, Tb13);
+			box_set(box, h2o_region4_p_T(Tb), pmax, Tmin, Tb);
+			return;
+		case H2O_REGION2:
+			if (T <= Tb13)
+			{
+				Tb = fmax(T - box_dT, Tmin);
+				box_set(box, pmin, h2o_region4_p_T(Tb), Tb, Tb13);
+			}
+			else
+			{
+				Tb = fmax(T - box_dT, Tb13);
+				box_set(box, pmin, fmin(h2o_b23_p_T(Tb), pmax), Tb, Tb25);
+			}
+			return;
+		case H2O_REGION3:
+			Tb = fmin(T + box_dT, Tb25);
+			box_set(box, h2o_b23_p_T(Tb), pmax, Tb13, Tb);
+			return;
+		case H2O_REGION5:
+			box_set(box, pmin, pmax5, Tb25, Tmax);
+			return;
+		default:
+			box_set(box, NAN, NAN, NAN, NAN);
+	}
+}
+
+void h2o_region_ph_box(double p, double h, enum h2o_region region,
+		double box[4])
+{
+	struct bndtab_nodes nd;
+	double ha = NAN, hb = NAN;
+
+	bndtab_nodes(p, &nd);
+	if (nd.f)
+	{
+		double h1a = fmax(nd.f[0][BNDTAB_H1], nd.f[1][BNDTAB_H1])
+			+ nd.span[BNDTAB_H1];
+		double h2b = fmin(nd.f[0][BNDTAB_H2], nd.f[1][BNDTAB_H2])
+			- nd.span[BNDTAB_H2];
+		int high = p > psat12max;
+
+		switch (region)
+		{
+			case H2O_REGION1:
+				ha = fmax(nd.f[0][BNDTAB_HMIN], nd.f[1][BNDTAB_HMIN])
+					+ nd.span[BNDTAB_HMIN];
+				hb = fmin(nd.f[0][BNDTAB_H1], nd.f[1][BNDTAB_H1])
+					- nd.span[BNDTAB_H1];
+				/* and below the psat3(h) range */
+				if (high)
+					hb = fmin(hb, psat3_hmin);
+				break;
+			case H2O_REGION2:
+				ha = fmax(nd.f[0][BNDTAB_H2], nd.f[1][BNDTAB_H2])
+					+ nd.span[BNDTAB_H2];
+				hb = fmin(nd.f[0][BNDTAB_HB25], nd.f[1][BNDTAB_HB25])
+					- nd.span[BNDTAB_HB25];
+				if (high)
+					ha = fmax(ha, psat3_hmax);
+				break;
+			case H2O_REGION3:
+				/* on either side of the psat3(h) range */
+				if (!high)
+					break;
+				else if (h < psat3_hmin)
+				{
+					ha = h1a;
+					hb = psat3_hmin;
+				}
+				else if (h > psat3_hmax)
+				{
+					ha = psat3_hmax;
+					hb = h2b;
+				}
+				break;
+			case H2O_REGION4:
+				if (!high)
+				{
+					ha = h1a;
+					hb = h2b;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (isnan(ha))
+		box_set(box, NAN, NAN, NAN, NAN);
+	else
+		box_set(box, nd.pa, nd.pb, ha, hb);
+}
+
+void h2o_region_ps_box(double p, double s, enum h2o_region region,
+		double box[4])
+{
+	struct bndtab_nodes nd;
+	double sa = NAN, sb = NAN;
+
+	bndtab_nodes(p, &nd);
+	if (nd.f)
+	{
+		double s1a = fmax(nd.f[0][BNDTAB_S1], nd.f[1][BNDTAB_S1])
+			+ nd.span[BNDTAB_S1];
+		double s2b = fmin(nd.f[0][BNDTAB_S2], nd.f[1][BNDTAB_S2])
+			- nd.span[BNDTAB_S2];
+		int high = p > psat12max;
+
+		switch (region)
+		{
+			case H2O_REGION1:
+				sa = smin;
+				sb = fmin(nd.f[0][BNDTAB_S1], nd.f[1][BNDTAB_S1])
+					- nd.span[BNDTAB_S1];
+				break;
+			case H2O_REGION2:
+				sa = fmax(nd.f[0][BNDTAB_S2], nd.f[1][BNDTAB_S2])
+					+ nd.span[BNDTAB_S2];
+				sb = fmin(nd.f[0][BNDTAB_SB25], nd.f[1][BNDTAB_SB25])
+					- nd.span[BNDTAB_SB25];
+				/* and above the psat3(s) range */
+				if (high)
+					sa = fmax(sa, psat3_smax);
+				break;
+			case H2O_REGION3:
+				if (!high)
+					break;
+				else if (s < psat3_smin)
+				{
+					sa = s1a;
+					sb = psat3_smin;
+				}
+				else if (s > psat3_smax)
+				{
+					sa = psat3_smax;
+					sb = s2b;
+				}
+				break;
+			case H2O_REGION4:
+				if (!high)
+				{
+					sa = s1a;
+					sb = s2b;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (isnan(sa))
+		box_set(box, NAN, NAN, NAN, NAN);
+	else
+		box_set(box, nd.pa, nd.pb, sa, sb);
+}
+
 enum h2o_region h2o_region_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_HS);
+
 	/* XXX: check range better */
 
 	if (s < smin)
@@ -178,6 +743,8 @@ enum h2o_region h2o_region_hs(double h, double s)
 
 enum h2o_region h2o_region_Tx(double T, double x)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_TX);
+
 	if (x < 0 || x > 1 || T < Tmin || T > Tcrit)
 		return H2O_REGION_OUT_OF_RANGE;
 
@@ -186,6 +753,8 @@ enum h2o_region h2o_region_Tx(double T, double x)
 
 enum h2o_region h2o_region_px(double p, double x)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION_PX);
+
 	if (x < 0 || x > 1 || p < psatmin || p > pcrit)
 		return H2O_REGION_OUT_OF_RANGE;
 
@@ -194,14 +763,55 @@ enum h2o_region h2o_region_px(double p, double x)
 
 enum h2o_region h2o_region_rhoT(double rho, double T)
 {
-	/* XXX: support other regions */
-	if (T >= Tb13)
+	H2O_STATS_SCOPE(H2O_STATS_REGION_RHOT);
+	double v = 1/rho;
+
+	if (!(rho > 0) || T < Tmin || T > Tmax)
+		return H2O_REGION_OUT_OF_RANGE;
+
+	else if (T > Tb25) /* 5? */
+	{
+		if (v >= h2o_region5_v_pT(pmax5, T))
+			return H2O_REGION5;
+		else
+			return H2O_REGION_OUT_OF_RANGE;
+	}
+
+	/* Check the saturated volumes first. */
+	if (T < Tcrit)
+	{
+		double x = h2o_region4_x_Tv(T, v);
+
+		if (x >= 0 && x <= 1)
+			return H2O_REGION4;
+	}
+
+	if (T <= Tb13) /* 1 or 2 */
+	{
+		/* the two-phase range has been checked already */
+		if (v > h2o_region4_v_Tx(T, 0))
+			return H2O_REGION2;
+		else if (v >= h2o_region1_v_pT(pmax, T))
+			return H2O_REGION1;
+	}
+	else /* 3 or 2 */
 	{
-		double v = 1/rho;
+		double pb = h2o_b23_p_T(T);
 
-		if (v <= h2o_region2_v_pT(h2o_b23_p_T(T), T))
+		/* past B23 at pmax, it is Region 2 up to pmax */
+		if (pb > pmax)
+		{
+			if (v >= h2o_region2_v_pT(pmax, T))
+				return H2O_REGION2;
+		}
+		else if (v > h2o_region2_v_pT(pb, T))
+			return H2O_REGION2;
+		/* the Region 3 equation gives spurious pressures far past
+		 * pmax, so the backward v(pmax, T) is checked first; it is
+		 * within 1E-5 of the forward one, so allow some margin */
+		else if (v >= h2o_region3_v_pT(pmax, T) * 0.999
+				&& h2o_region3_p_rhoT(rho, T) <= pmax)
 			return H2O_REGION3;
-		/* XXX: upper limit? */
 	}
 
 	return H2O_REGION_OUT_OF_RANGE;
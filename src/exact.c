@@ -0,0 +1,322 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "consts.h"
+#include "h2o.h"
+#include "region1.h"
+#include "region2.h"
+#include "region3.h"
+#include "region4.h"
+#include "stats.h"
+#include "xmath.h"
+
+#include <assert.h>
+#include <math.h>
+
+/* Backward equations refined with the Newton method on the forward
+ * ones. The backward results are within a few tens of mK, so the first
+ * step is already close to the round-off, and the second one is
+ * usually the last one needed. The limit is higher for Tsat(h, s),
+ * which is far off below 623.15 K. */
+
+static const int exact_max_steps = 8;
+
+/* the variables the forward equations are solved for */
+enum exact_var
+{
+	EXACT_P,
+	EXACT_H,
+	EXACT_S
+};
+
+/* Evaluate the forward equations at the state arguments: (p, T)
+ * in Regions 1 and 2, (rho, T) in Region 3. dx1 and dx2 are
+ * the derivatives of v in the former, and of p in the latter. */
+static void exact_eval(enum h2o_region region, double arg1, double T,
+		struct h2o_props* props, double* dx1, double* dx2)
+{
+	switch (region)
+	{
+		case H2O_REGION1:
+			h2o_region1_props_derivs_pT(arg1, T, props, dx1, dx2);
+			break;
+		case H2O_REGION2:
+			h2o_region2_props_derivs_pT(arg1, T, props, dx1, dx2);
+			break;
+		case H2O_REGION3:
+			h2o_region3_props_derivs_rhoT(arg1, T, props, dx1, dx2);
+			break;
+		default:
+			assert(not_reached);
+	}
+}
+
+/* A variable and its derivatives wrt the state arguments */
+static void exact_var(enum h2o_region region, enum exact_var var,
+		const struct h2o_props* props, double dx1, double dx2,
+		double* val, double* d1, double* d2)
+{
+	double rho = props->rho;
+	double T = props->T;
+
+	if (region == H2O_REGION3)
+	{
+		double dpdrho = dx1;
+		double dpdT = dx2;
+
+		switch (var)
+		{
+			case EXACT_P:
+				*val = props->p;
+				*d1 = dpdrho;
+				*d2 = dpdT;
+				break;
+			case EXACT_H:
+				*val = props->h;
+				*d1 = (dpdrho - T * dpdT / rho) / rho * 1E3;
+				*d2 = props->cv + dpdT / rho * 1E3;
+				break;
+			case EXACT_S:
+				*val = props->s;
+				*d1 = -dpdT / pow2(rho) * 1E3;
+				*d2 = props->cv / T;
+				break;
+		}
+	}
+	else
+	{
+		double dvdT = dx2;
+
+		switch (var)
+		{
+			case EXACT_P:
+				*val = props->p;
+				*d1 = 1;
+				*d2 = 0;
+				break;
+			case EXACT_H:
+				*val = props->h;
+				*d1 = (props->v - T * dvdT) * 1E3;
+				*d2 = props->cp;
+				break;
+			case EXACT_S:
+				*val = props->s;
+				*d1 = -dvdT * 1E3;
+				*d2 = props->cp / T;
+				break;
+		}
+	}
+}
+
+/* Solve var1 = y1, var2 = y2 for the state arguments, starting with
+ * the backward equation results. One pass of the forward equations
+ * gives both variables and their derivatives. Returns false if
+ * the Newton did not converge; the arguments are not touched then. */
+static int exact_solve(enum h2o_region region,
+		enum exact_var var1, double y1, enum exact_var var2, double y2,
+		double* arg1, double* T)
+{
+	double a1 = *arg1;
+	double a2 = *T;
+	int i;
+
+	for (i = 0; i < exact_max_steps; ++i)
+	{
+		struct h2o_props props;
+		double dx1, dx2, f1, f2, j11, j12, j21, j22, det, d1, d2;
+
+		exact_eval(region, a1, a2, &props, &dx1, &dx2);
+		exact_var(region, var1, &props, dx1, dx2, &f1, &j11, &j12);
+		exact_var(region, var2, &props, dx1, dx2, &f2, &j21, &j22);
+		f1 -= y1;
+		f2 -= y2;
+
+		det = j11 * j22 - j12 * j21;
+		d1 = (f1 * j22 - f2 * j12) / det;
+		d2 = (j11 * f2 - j21 * f1) / det;
+		a1 -= d1;
+		a2 -= d2;
+
+		/* also catches NaN */
+		if (!(a1 > 0 && a2 > 0))
+			return 0;
+
+		/* the error is quadratic in the step from here on */
+		if (fabs(d1) <= a1 * 1E-7 && fabs(d2) <= a2 * 1E-7)
+		{
+			*arg1 = a1;
+			*T = a2;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* Region 4: solve s(T, x) = s along the saturation line, with x giving
+ * h at T. The mixture has h - Ts = g' = g'', which gives the derivative
+ * with dp/dT from the Clapeyron equation. The forward equations satisfy
+ * g' = g'' only approximately, so the convergence is not quite
+ * quadratic, but still nearly so. */
+static int exact_solve_sat_hs(double h, double s, double* T)
+{
+	double Ts = *T;
+	int i;
+
+	for (i = 0; i < exact_max_steps; ++i)
+	{
+		struct h2o_sat sat;
+		const struct h2o_props* l = &sat.liquid;
+		const struct h2o_props* g = &sat.vapour;
+		double x, f, df, dT;
+
+		h2o_region4_sat_T(Ts, &sat);
+		x = (h - l->h) / (g->h - l->h);
+		f = l->s + x * (g->s - l->s) - s;
+		df = (l->s - s - l->v * (g->s - l->s) / (g->v - l->v)) / Ts;
+
+		dT = f / df;
+		Ts -= dT;
+
+		/* T_hs() is far off below 623.15 K, so keep on trying
+		 * within the range */
+		if (Ts < Tmin)
+			Ts = Tmin;
+		else if (Ts > Tcrit)
+			Ts = Tcrit;
+		else if (!(Ts == Ts))
+			return 0;
+
+		if (fabs(dT) <= Ts * 1E-7)
+		{
+			*T = Ts;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* p is exact already, so only T (and rho in Region 3) is solved */
+static h2o_t exact_refine_p(h2o_t state, double p,
+		enum exact_var var, double y)
+{
+	switch (state.region)
+	{
+		case H2O_REGION1:
+		case H2O_REGION2:
+		case H2O_REGION3:
+			exact_solve(state.region, EXACT_P, p, var, y,
+					&state._arg1, &state._arg2);
+			break;
+		/* the saturation equation is inverted exactly,
+		 * and x follows from y linearly */
+		case H2O_REGION4:
+		case H2O_REGION_OUT_OF_RANGE:
+			break;
+		default:
+			assert(not_reached);
+	}
+
+	return state;
+}
+
+h2o_t h2o_new_ph_exact(double p, double h)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PH_EXACT);
+
+	return exact_refine_p(h2o_new_ph(p, h), p, EXACT_H, h);
+}
+
+h2o_t h2o_new_ps_exact(double p, double s)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PS_EXACT);
+
+	return exact_refine_p(h2o_new_ps(p, s), p, EXACT_S, s);
+}
+
+/* Region 4. The backward equations may put (h, s) near the saturation
+ * line on its wrong side, so if x comes out of range (or there is
+ * no two-phase solution at all), the state is solved for
+ * in the single-phase region next to it instead. x is the dryness
+ * the backward equations gave. */
+static void exact_refine_sat_hs(double h, double s, double T, double x,
+		h2o_t* state)
+{
+	struct h2o_sat sat;
+	const struct h2o_props* phase;
+	enum h2o_region region;
+	double arg1;
+
+	if (exact_solve_sat_hs(h, s, &T))
+	{
+		x = h2o_region4_x_Th(T, h);
+		if (x >= 0 && x <= 1)
+		{
+			*state = h2o_new_Tx(T, x);
+			return;
+		}
+	}
+
+	h2o_region4_sat_T(T, &sat);
+	phase = x < 0.5 ? &sat.liquid : &sat.vapour;
+	if (T > Tb13)
+	{
+		region = H2O_REGION3;
+		arg1 = phase->rho;
+	}
+	else
+	{
+		region = x < 0.5 ? H2O_REGION1 : H2O_REGION2;
+		arg1 = phase->p;
+	}
+
+	if (exact_solve(region, EXACT_H, h, EXACT_S, s, &arg1, &T))
+	{
+		state->region = region;
+		state->_arg1 = arg1;
+		state->_arg2 = T;
+	}
+}
+
+h2o_t h2o_new_hs_exact(double h, double s)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_HS_EXACT);
+	h2o_t ret = h2o_new_hs(h, s);
+
+	switch (ret.region)
+	{
+		case H2O_REGION1:
+		case H2O_REGION2:
+		case H2O_REGION3:
+			exact_solve(ret.region, EXACT_H, h, EXACT_S, s,
+					&ret._arg1, &ret._arg2);
+
+			/* the same, the other way around */
+			if (ret.region != H2O_REGION3 && ret._arg2 <= Tb13)
+			{
+				double psat = h2o_region4_p_T(ret._arg2);
+
+				if (ret.region == H2O_REGION1 && ret._arg1 < psat)
+					exact_refine_sat_hs(h, s, ret._arg2, 0, &ret);
+				else if (ret.region == H2O_REGION2 && ret._arg1 > psat)
+					exact_refine_sat_hs(h, s, ret._arg2, 1, &ret);
+			}
+			break;
+		case H2O_REGION4:
+			exact_refine_sat_hs(h, s, ret._arg1, ret._arg2, &ret);
+			break;
+		case H2O_REGION_OUT_OF_RANGE:
+			break;
+		default:
+			assert(not_reached);
+	}
+
+	return ret;
+}
@@ -7,6 +7,7 @@
 #	include "config.h"
 #endif
 
+#include "boundaries.h"
 #include "consts.h"
 #include "h2o.h"
 #include "region1.h"
@@ -14,15 +15,18 @@
 #include "region3.h"
 #include "region4.h"
 #include "region5.h"
+#include "stats.h"
+#include "xmath.h"
 
 #include <assert.h>
+#include <math.h>
 
 typedef double (*twoarg_func_t)(double, double);
 
-h2o_t h2o_new_pT(double p, double T)
+/* Construct the state in the region found by h2o_region_pT(). */
+static h2o_t new_pT_in(double p, double T, enum h2o_region region)
 {
 	h2o_t ret;
-	enum h2o_region region = h2o_region_pT(p, T);
 
 	switch (region)
 	{
@@ -46,8 +50,23 @@ h2o_t h2o_new_pT(double p, double T)
 	return ret;
 }
 
+h2o_t h2o_new_pT(double p, double T)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PT);
+
+	return new_pT_in(p, T, h2o_region_pT(p, T));
+}
+
+h2o_t h2o_new_pT_hint(double p, double T, enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PT_HINT);
+
+	return new_pT_in(p, T, h2o_region_pT_hint(p, T, expected));
+}
+
 h2o_t h2o_new_Tx(double T, double x)
 {
+	H2O_STATS_SCOPE(H2O_STATS_NEW_TX);
 	h2o_t ret;
 	enum h2o_region region = h2o_region_Tx(T, x);
 
@@ -69,6 +88,7 @@ h2o_t h2o_new_Tx(double T, double x)
 
 h2o_t h2o_new_px(double p, double x)
 {
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PX);
 	h2o_t ret;
 	enum h2o_region region = h2o_region_px(p, x);
 
@@ -88,10 +108,10 @@ h2o_t h2o_new_px(double p, double x)
 	return ret;
 }
 
-h2o_t h2o_new_ph(double p, double h)
+/* Construct the state in the region found by h2o_region_ph(). */
+static h2o_t new_ph_in(double p, double h, enum h2o_region region)
 {
 	h2o_t ret;
-	enum h2o_region region = h2o_region_ph(p, h);
 
 	switch (region)
 	{
@@ -141,10 +161,24 @@ h2o_t h2o_new_ph(double p, double h)
 	return ret;
 }
 
-h2o_t h2o_new_ps(double p, double s)
+h2o_t h2o_new_ph(double p, double h)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PH);
+
+	return new_ph_in(p, h, h2o_region_ph(p, h));
+}
+
+h2o_t h2o_new_ph_hint(double p, double h, enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PH_HINT);
+
+	return new_ph_in(p, h, h2o_region_ph_hint(p, h, expected));
+}
+
+/* Construct the state in the region found by h2o_region_ps(). */
+static h2o_t new_ps_in(double p, double s, enum h2o_region region)
 {
 	h2o_t ret;
-	enum h2o_region region = h2o_region_ps(p, s);
 
 	switch (region)
 	{
@@ -194,56 +228,233 @@ h2o_t h2o_new_ps(double p, double s)
 	return ret;
 }
 
+h2o_t h2o_new_ps(double p, double s)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PS);
+
+	return new_ps_in(p, s, h2o_region_ps(p, s));
+}
+
+h2o_t h2o_new_ps_hint(double p, double s, enum h2o_region expected)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_PS_HINT);
+
+	return new_ps_in(p, s, h2o_region_ps_hint(p, s, expected));
+}
+
+/* Compute (p, T) using the backward equations of the given region. */
+static void hs_backward(enum h2o_region region, double h, double s,
+		double* p, double* T)
+{
+	twoarg_func_t p_getter, T_getter;
+
+	switch (region)
+	{
+		case H2O_REGION1:
+			p_getter = &h2o_region1_p_hs;
+			T_getter = &h2o_region1_T_ps;
+			break;
+		case H2O_REGION2:
+			p_getter = &h2o_region2_p_hs;
+			T_getter = &h2o_region2_T_ps;
+			break;
+		case H2O_REGION3:
+			p_getter = &h2o_region3_p_hs;
+			T_getter = &h2o_region3_T_ps;
+			break;
+		default:
+			assert(not_reached);
+			*p = *T = NAN;
+			return;
+	}
+
+	*p = p_getter(h, s);
+	*T = T_getter(*p, s);
+}
+
+/* h2o_region_hs() does not check the pressure range and the outer
+ * borders, and the backward equations give meaningless (p, T) past
+ * them. Check the result, allowing for the backward equation errors
+ * (below 0.2 K). Region 1 is bounded by B14 in (h, s) already. */
+static int hs_pT_in_region(enum h2o_region region, double p, double T)
+{
+	static const double Ttol = 1; /* [K] */
+
+	if (p <= pmin || p > pmax)
+		return 0;
+
+	switch (region)
+	{
+		case H2O_REGION1:
+			return T >= Tmin - Ttol && T <= Tb13 + Ttol;
+		case H2O_REGION2:
+			return T >= Tmin - Ttol && T <= Tb25
+				&& T >= (p > psat12max ? h2o_b23_T_p(p)
+					: h2o_region4_T_p(p)) - Ttol;
+		default: /* Region 3 */
+			return 1;
+	}
+}
+
 h2o_t h2o_new_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_NEW_HS);
 	h2o_t ret;
 	enum h2o_region region = h2o_region_hs(h, s);
 
+	/* The region is carried through, so (p, s) is not classified again
+	 * and the region's own T(p, s) backward equation is used. */
 	switch (region)
 	{
+		case H2O_REGION4:
+		{
+			double T = h2o_region4_T_hs(h, s);
+
+			ret = h2o_new_Tx(T, h2o_region4_x_Th(T, h));
+			region = ret.region;
+			break;
+		}
 		case H2O_REGION5:
-			ret.region = H2O_REGION_OUT_OF_RANGE;
+			region = H2O_REGION_OUT_OF_RANGE;
 			break;
 		case H2O_REGION_OUT_OF_RANGE:
-			ret.region = region;
 			break;
+
 		default:
 		{
-			twoarg_func_t getter;
-			double arg1;
+			double p, T;
 
-			switch (region)
+			hs_backward(region, h, s, &p, &T);
+
+			/* B13 and B23 are approximated in (h, s), so move
+			 * the points found across them to Region 3
+			 * or out of it */
+			if (p > psat12max)
 			{
-				case H2O_REGION1:
-					getter = &h2o_region1_p_hs;
-					break;
-				case H2O_REGION2:
-					getter = &h2o_region2_p_hs;
-					break;
-				case H2O_REGION3:
-					getter = &h2o_region3_p_hs;
-					break;
-				case H2O_REGION4:
-					getter = &h2o_region4_T_hs;
-					break;
-				default:
-					assert(not_reached);
+				enum h2o_region pT_region = h2o_region_pT(p, T);
+
+				if ((region == H2O_REGION3) != (pT_region == H2O_REGION3)
+						&& pT_region >= H2O_REGION1
+						&& pT_region <= H2O_REGION3)
+				{
+					region = region == H2O_REGION3
+						? pT_region : H2O_REGION3;
+					hs_backward(region, h, s, &p, &T);
+				}
 			}
 
-			arg1 = getter(h, s);
-
-			if (region == H2O_REGION4)
-				ret = h2o_new_Tx(arg1, h2o_region4_x_Th(arg1, h));
+			if (region == H2O_REGION3)
+				ret._arg1 = 1 / h2o_region3_v_ps(p, s);
 			else
-				ret = h2o_new_ps(arg1, s);
+				ret._arg1 = p;
+			ret._arg2 = T;
+
+			if (!hs_pT_in_region(region, p, T))
+				region = H2O_REGION_OUT_OF_RANGE;
 		}
 	}
+	ret.region = region;
 
 	return ret;
 }
 
+h2o_tracker_t h2o_tracker_new(void)
+{
+	h2o_tracker_t ret;
+
+	ret.state.region = H2O_REGION_OUT_OF_RANGE;
+	ret.prev_region = H2O_REGION_OUT_OF_RANGE;
+	ret._box_args = H2O_TRACKER_BOX_NONE;
+	ret._subregion = -1;
+
+	return ret;
+}
+
+/* the boxes are open, and NaN always fails the check */
+static int in_box(const double box[4], double p, double x)
+{
+	return p > box[0] && p < box[1] && x > box[2] && x < box[3];
+}
+
+/* Find the region of the new point, and the box if it is outside
+ * the last one. */
+static enum h2o_region tracker_region(h2o_tracker_t* tr,
+		enum h2o_tracker_box_args args, double p, double x)
+{
+	enum h2o_region region;
+
+	if (tr->_box_args == args && in_box(tr->_box, p, x))
+		return tr->state.region;
+
+	switch (args)
+	{
+		case H2O_TRACKER_BOX_PT:
+			region = h2o_region_pT_hint(p, x, tr->state.region);
+			h2o_region_pT_box(p, x, region, tr->_box);
+			break;
+		case H2O_TRACKER_BOX_PH:
+			region = h2o_region_ph_hint(p, x, tr->state.region);
+			h2o_region_ph_box(p, x, region, tr->_box);
+			break;
+		case H2O_TRACKER_BOX_PS:
+			region = h2o_region_ps_hint(p, x, tr->state.region);
+			h2o_region_ps_box(p, x, region, tr->_box);
+			break;
+		default:
+			assert(not_reached);
+	}
+	tr->_box_args = args;
+
+	return region;
+}
+
+static int tracker_move(h2o_tracker_t* tr, h2o_t state)
+{
+	tr->prev_region = tr->state.region;
+	tr->state = state;
+
+	return state.region != tr->prev_region;
+}
+
+int h2o_tracker_update_pT(h2o_tracker_t* tr, double p, double T)
+{
+	H2O_STATS_SCOPE(H2O_STATS_TRACKER_UPDATE_PT);
+	enum h2o_region region = tracker_region(tr, H2O_TRACKER_BOX_PT, p, T);
+	h2o_t state;
+
+	if (region != H2O_REGION3)
+		return tracker_move(tr, new_pT_in(p, T, region));
+
+	/* the subregion box does not depend on the region box */
+	if (tr->_subregion == -1 || !in_box(tr->_subbox, p, T))
+		tr->_subregion = h2o_region3_subregion_pT_box(p, T, tr->_subbox);
+
+	state.region = region;
+	state._arg1 = 1 / h2o_region3_v_pT_subregion(p, T, tr->_subregion);
+	state._arg2 = T;
+
+	return tracker_move(tr, state);
+}
+
+int h2o_tracker_update_ph(h2o_tracker_t* tr, double p, double h)
+{
+	H2O_STATS_SCOPE(H2O_STATS_TRACKER_UPDATE_PH);
+
+	return tracker_move(tr,
+			new_ph_in(p, h, tracker_region(tr, H2O_TRACKER_BOX_PH, p, h)));
+}
+
+int h2o_tracker_update_ps(h2o_tracker_t* tr, double p, double s)
+{
+	H2O_STATS_SCOPE(H2O_STATS_TRACKER_UPDATE_PS);
+
+	return tracker_move(tr,
+			new_ps_in(p, s, tracker_region(tr, H2O_TRACKER_BOX_PS, p, s)));
+}
+
 h2o_t h2o_new_rhoT(double rho, double T)
 {
+	H2O_STATS_SCOPE(H2O_STATS_NEW_RHOT);
 	h2o_t ret;
 	enum h2o_region region = h2o_region_rhoT(rho, T);
 
@@ -251,13 +462,33 @@ h2o_t h2o_new_rhoT(double rho, double T)
 	{
 		case H2O_REGION_OUT_OF_RANGE:
 			break;
+		case H2O_REGION1:
+			ret._arg1 = h2o_region1_p_rhoT(rho, T);
+			ret._arg2 = T;
+			break;
+		case H2O_REGION2:
+			ret._arg1 = h2o_region2_p_rhoT(rho, T);
+			ret._arg2 = T;
+			break;
 		case H2O_REGION3:
 			ret._arg1 = rho;
 			ret._arg2 = T;
 			break;
+		case H2O_REGION4: /* (T, x) */
+			ret._arg1 = T;
+			ret._arg2 = h2o_region4_x_Tv(T, 1/rho);
+			break;
+		case H2O_REGION5:
+			ret._arg1 = h2o_region5_p_rhoT(rho, T);
+			ret._arg2 = T;
+			break;
 		default:
 			assert(not_reached);
 	}
+
+	/* the Newton did not converge */
+	if (region != H2O_REGION_OUT_OF_RANGE && isnan(ret._arg1))
+		region = H2O_REGION_OUT_OF_RANGE;
 	ret.region = region;
 
 	return ret;
@@ -275,6 +506,7 @@ enum h2o_region h2o_get_region(const h2o_t state)
 
 double h2o_get_p(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_P);
 	double ret;
 
 	switch (state.region)
@@ -299,6 +531,7 @@ double h2o_get_p(const h2o_t state)
 
 double h2o_get_T(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_T);
 	double ret;
 
 	switch (state.region)
@@ -321,6 +554,7 @@ double h2o_get_T(const h2o_t state)
 
 double h2o_get_x(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_X);
 	double ret;
 
 	switch (state.region)
@@ -344,6 +578,7 @@ double h2o_get_x(const h2o_t state)
 
 double h2o_get_rho(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_RHO);
 	double ret;
 
 	switch (state.region)
@@ -365,6 +600,7 @@ static double region3_v_rhoT(double rho, double T)
 
 double h2o_get_v(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_V);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -393,6 +629,7 @@ double h2o_get_v(const h2o_t state)
 
 double h2o_get_u(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_U);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -421,6 +658,7 @@ double h2o_get_u(const h2o_t state)
 
 double h2o_get_h(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_H);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -449,6 +687,7 @@ double h2o_get_h(const h2o_t state)
 
 double h2o_get_s(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_S);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -477,6 +716,7 @@ double h2o_get_s(const h2o_t state)
 
 double h2o_get_cp(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_CP);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -505,6 +745,7 @@ double h2o_get_cp(const h2o_t state)
 
 double h2o_get_cv(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_CV);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -533,6 +774,7 @@ double h2o_get_cv(const h2o_t state)
 
 double h2o_get_w(const h2o_t state)
 {
+	H2O_STATS_SCOPE(H2O_STATS_GET_W);
 	twoarg_func_t func;
 
 	switch (state.region)
@@ -559,6 +801,621 @@ double h2o_get_w(const h2o_t state)
 	return func(state._arg1, state._arg2);
 }
 
+void h2o_get_all(const h2o_t state, struct h2o_props* out)
+{
+	H2O_STATS_SCOPE(H2O_STATS_GET_ALL);
+
+	switch (state.region)
+	{
+		case H2O_REGION1:
+			h2o_region1_props_pT(state._arg1, state._arg2, out);
+			out->x = 0;
+			break;
+		case H2O_REGION2:
+			h2o_region2_props_pT(state._arg1, state._arg2, out);
+			out->x = 1;
+			break;
+		case H2O_REGION3:
+			h2o_region3_props_rhoT(state._arg1, state._arg2, out);
+			out->x = NAN;
+			break;
+		case H2O_REGION4:
+			h2o_region4_props_Tx(state._arg1, state._arg2, out);
+			out->x = state._arg2;
+			break;
+		case H2O_REGION5:
+			h2o_region5_props_pT(state._arg1, state._arg2, out);
+			out->x = 1;
+			break;
+		default:
+			assert(not_reached);
+	}
+}
+
+/* The derivatives of a property wrt the basis variables, (p, T). */
+static void deriv_pT(enum h2o_prop prop, const struct h2o_props* props,
+		double dvdp, double dvdT, double* dp, double* dT)
+{
+	double p = props->p;
+	double T = props->T;
+
+	/* p v is in MPa m³/kg, i.e. 1E3 kJ/kg */
+	switch (prop)
+	{
+		case H2O_PROP_P:
+			*dp = 1;
+			*dT = 0;
+			break;
+		case H2O_PROP_T:
+			*dp = 0;
+			*dT = 1;
+			break;
+		case H2O_PROP_V:
+			*dp = dvdp;
+			*dT = dvdT;
+			break;
+		case H2O_PROP_RHO:
+			*dp = -dvdp * pow2(props->rho);
+			*dT = -dvdT * pow2(props->rho);
+			break;
+		case H2O_PROP_U:
+			*dp = -(T * dvdT + p * dvdp) * 1E3;
+			*dT = props->cp - p * dvdT * 1E3;
+			break;
+		case H2O_PROP_H:
+			*dp = (props->v - T * dvdT) * 1E3;
+			*dT = props->cp;
+			break;
+		case H2O_PROP_S:
+			*dp = -dvdT * 1E3;
+			*dT = props->cp / T;
+			break;
+		default:
+			*dp = NAN;
+			*dT = NAN;
+	}
+}
+
+static double prop_value(enum h2o_prop prop, const struct h2o_props* props)
+{
+	double ret;
+
+	switch (prop)
+	{
+		case H2O_PROP_V:
+			ret = props->v;
+			break;
+		case H2O_PROP_U:
+			ret = props->u;
+			break;
+		case H2O_PROP_H:
+			ret = props->h;
+			break;
+		case H2O_PROP_S:
+			ret = props->s;
+			break;
+		default:
+			assert(not_reached);
+	}
+
+	return ret;
+}
+
+/* The derivatives of a property wrt (T, x) in Region 4. The phases
+ * follow the saturation line, dp = dpsat/dT dT (as in
+ * the Clausius-Clapeyron equation), and the mixture properties are
+ * linear in x. */
+static void deriv_Tx(enum h2o_prop prop, const struct h2o_sat* sat,
+		const double dvdp[2], const double dvdT[2], double dpsdT,
+		double x, double* dT, double* dx)
+{
+	double d1p, d1T, d2p, d2T;
+
+	switch (prop)
+	{
+		case H2O_PROP_P:
+			*dT = dpsdT;
+			*dx = 0;
+			return;
+		case H2O_PROP_T:
+			*dT = 1;
+			*dx = 0;
+			return;
+		case H2O_PROP_RHO:
+		{
+			double v = sat->liquid.v + (sat->vapour.v - sat->liquid.v) * x;
+
+			deriv_Tx(H2O_PROP_V, sat, dvdp, dvdT, dpsdT, x, dT, dx);
+			*dT /= -pow2(v);
+			*dx /= -pow2(v);
+			return;
+		}
+		case H2O_PROP_V:
+		case H2O_PROP_U:
+		case H2O_PROP_H:
+		case H2O_PROP_S:
+			break;
+		default:
+			*dT = NAN;
+			*dx = NAN;
+			return;
+	}
+
+	deriv_pT(prop, &sat->liquid, dvdp[0], dvdT[0], &d1p, &d1T);
+	deriv_pT(prop, &sat->vapour, dvdp[1], dvdT[1], &d2p, &d2T);
+
+	*dT = (d1p * dpsdT + d1T) * (1 - x) + (d2p * dpsdT + d2T) * x;
+	*dx = prop_value(prop, &sat->vapour) - prop_value(prop, &sat->liquid);
+}
+
+/* The derivative set of a state: the properties and dv/dp, dv/dT
+ * in single phase, and those of both phases ([0] liquid, [1] vapour)
+ * in Region 4, where props is left untouched. */
+static void get_derivs(const h2o_t state, struct h2o_props* props,
+		struct h2o_sat* sat, double dvdp[2], double dvdT[2])
+{
+	switch (state.region)
+	{
+		case H2O_REGION1:
+			h2o_region1_props_derivs_pT(state._arg1, state._arg2,
+					props, &dvdp[0], &dvdT[0]);
+			props->x = 0;
+			break;
+		case H2O_REGION2:
+			h2o_region2_props_derivs_pT(state._arg1, state._arg2,
+					props, &dvdp[0], &dvdT[0]);
+			props->x = 1;
+			break;
+		case H2O_REGION3:
+		{
+			double dpdrho, dpdT;
+
+			h2o_region3_props_derivs_rhoT(state._arg1, state._arg2,
+					props, &dpdrho, &dpdT);
+			props->x = NAN;
+			dvdp[0] = -1 / (pow2(props->rho) * dpdrho);
+			dvdT[0] = dpdT / (pow2(props->rho) * dpdrho);
+			break;
+		}
+		case H2O_REGION4:
+			h2o_region4_sat_derivs_T(state._arg1, sat, dvdp, dvdT);
+			break;
+		case H2O_REGION5:
+			h2o_region5_props_derivs_pT(state._arg1, state._arg2,
+					props, &dvdp[0], &dvdT[0]);
+			props->x = 1;
+			break;
+		default:
+			assert(not_reached);
+	}
+}
+
+/* whether the derivative is defined for any state */
+static int deriv_args_valid(enum h2o_prop of, enum h2o_prop wrt,
+		enum h2o_prop const_)
+{
+	if (of >= H2O_PROP_MAX || wrt >= H2O_PROP_MAX
+			|| const_ >= H2O_PROP_MAX)
+		return 0;
+	/* v and rho are constant together */
+	if (wrt == const_ || (wrt == H2O_PROP_V && const_ == H2O_PROP_RHO)
+			|| (wrt == H2O_PROP_RHO && const_ == H2O_PROP_V))
+		return 0;
+
+	return 1;
+}
+
+/* The Bridgman ratio from the derivative set filled by get_derivs(). */
+static double deriv_from_set(const h2o_t state,
+		const struct h2o_props* props, const struct h2o_sat* sat,
+		const double dvdp[2], const double dvdT[2],
+		enum h2o_prop of, enum h2o_prop wrt, enum h2o_prop const_)
+{
+	/* wrt the basis variables, (p, T) or (T, x) */
+	double of_1, of_2, wrt_1, wrt_2, c_1, c_2;
+
+	if (state.region == H2O_REGION4)
+	{
+		double x = state._arg2;
+		double dpsdT = h2o_region4_dpdT_T(sat->T);
+
+		deriv_Tx(of, sat, dvdp, dvdT, dpsdT, x, &of_1, &of_2);
+		deriv_Tx(wrt, sat, dvdp, dvdT, dpsdT, x, &wrt_1, &wrt_2);
+		deriv_Tx(const_, sat, dvdp, dvdT, dpsdT, x, &c_1, &c_2);
+
+		/* p and T are constant together */
+		if (wrt_1 * c_2 - wrt_2 * c_1 == 0)
+			return NAN;
+	}
+	else
+	{
+		deriv_pT(of, props, dvdp[0], dvdT[0], &of_1, &of_2);
+		deriv_pT(wrt, props, dvdp[0], dvdT[0], &wrt_1, &wrt_2);
+		deriv_pT(const_, props, dvdp[0], dvdT[0], &c_1, &c_2);
+	}
+
+	return (of_1 * c_2 - of_2 * c_1) / (wrt_1 * c_2 - wrt_2 * c_1);
+}
+
+double h2o_get_deriv(const h2o_t state, enum h2o_prop of,
+		enum h2o_prop wrt, enum h2o_prop const_)
+{
+	H2O_STATS_SCOPE(H2O_STATS_GET_DERIV);
+	struct h2o_props props;
+	struct h2o_sat sat;
+	double dvdp[2] = { NAN, NAN }, dvdT[2] = { NAN, NAN };
+
+	if (!h2o_is_valid(state) || !deriv_args_valid(of, wrt, const_))
+		return NAN;
+
+	get_derivs(state, &props, &sat, dvdp, dvdT);
+	return deriv_from_set(state, &props, &sat, dvdp, dvdT,
+			of, wrt, const_);
+}
+
+int h2o_sat_T(double T, struct h2o_sat* out)
+{
+	if (h2o_region_Tx(T, 0) != H2O_REGION4)
+		return 0;
+
+	h2o_region4_sat_T(T, out);
+	return 1;
+}
+
+int h2o_sat_p(double p, struct h2o_sat* out)
+{
+	if (h2o_region_px(p, 0) != H2O_REGION4)
+		return 0;
+
+	h2o_region4_sat_p(p, out);
+	return 1;
+}
+
+int h2o_sat_approx_T(double T, struct h2o_sat* out)
+{
+	if (h2o_region_Tx(T, 0) != H2O_REGION4)
+		return 0;
+
+	h2o_region4_sat_approx_T(T, out);
+	return 1;
+}
+
+int h2o_sat_approx_p(double p, struct h2o_sat* out)
+{
+	if (h2o_region_px(p, 0) != H2O_REGION4)
+		return 0;
+
+	h2o_region4_sat_approx_p(p, out);
+	return 1;
+}
+
+h2o_ex_t h2o_ex_new(const h2o_t state)
+{
+	h2o_ex_t ret;
+
+	assert(h2o_is_valid(state));
+
+	ret.state = state;
+	ret._have_props = 0;
+	ret._have_sat = 0;
+	ret._have_derivs = 0;
+
+	return ret;
+}
+
+const struct h2o_sat* h2o_ex_get_sat(h2o_ex_t* state)
+{
+	if (state->state.region != H2O_REGION4)
+		return NULL;
+
+	if (!state->_have_sat)
+	{
+		h2o_region4_sat_T(state->state._arg1, &state->_sat);
+		state->_have_sat = 1;
+	}
+
+	return &state->_sat;
+}
+
+const struct h2o_props* h2o_ex_get_all(h2o_ex_t* state)
+{
+	if (!state->_have_props)
+	{
+		if (state->state.region == H2O_REGION4)
+		{
+			h2o_region4_props_sat_x(h2o_ex_get_sat(state),
+					state->state._arg2, &state->_props);
+			state->_props.x = state->state._arg2;
+		}
+		else
+			h2o_get_all(state->state, &state->_props);
+		state->_have_props = 1;
+	}
+
+	return &state->_props;
+}
+
+double h2o_ex_get_deriv(h2o_ex_t* state, enum h2o_prop of,
+		enum h2o_prop wrt, enum h2o_prop const_)
+{
+	if (!deriv_args_valid(of, wrt, const_))
+		return NAN;
+
+	if (!state->_have_derivs)
+	{
+		struct h2o_props props;
+		struct h2o_sat sat;
+
+		/* the properties come along, keep them unless already there,
+		 * so that the pointers returned before keep their values */
+		get_derivs(state->state, &props, &sat,
+				state->_dvdp, state->_dvdT);
+		if (state->state.region == H2O_REGION4)
+		{
+			if (!state->_have_sat)
+			{
+				state->_sat = sat;
+				state->_have_sat = 1;
+			}
+		}
+		else if (!state->_have_props)
+		{
+			state->_props = props;
+			state->_have_props = 1;
+		}
+		state->_have_derivs = 1;
+	}
+
+	return deriv_from_set(state->state, &state->_props, &state->_sat,
+			state->_dvdp, state->_dvdT, of, wrt, const_);
+}
+
+double h2o_ex_get_p(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->p;
+}
+
+double h2o_ex_get_T(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->T;
+}
+
+double h2o_ex_get_x(h2o_ex_t* state)
+{
+	assert(state->state.region != H2O_REGION3);
+
+	return h2o_ex_get_all(state)->x;
+}
+
+double h2o_ex_get_rho(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->rho;
+}
+
+double h2o_ex_get_v(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->v;
+}
+
+double h2o_ex_get_u(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->u;
+}
+
+double h2o_ex_get_h(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->h;
+}
+
+double h2o_ex_get_s(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->s;
+}
+
+double h2o_ex_get_cp(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->cp;
+}
+
+double h2o_ex_get_cv(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->cv;
+}
+
+double h2o_ex_get_w(h2o_ex_t* state)
+{
+	return h2o_ex_get_all(state)->w;
+}
+
+/* gather the arguments of the points in the given region;
+ * returns their count, ri[] is filled with their indexes */
+static int batch_gather(int block, const enum h2o_region regions[],
+		const double a1[], const double a2[], enum h2o_region region,
+		double ra1[], double ra2[], int ri[])
+{
+	int i, count = 0;
+
+	for (i = 0; i < block; ++i)
+	{
+		if (regions[i] == region)
+		{
+			ra1[count] = a1[i];
+			ra2[count] = a2[i];
+			ri[count++] = i;
+		}
+	}
+
+	return count;
+}
+
+void h2o_batch_new_pT(size_t n, const double p[], const double T[],
+		h2o_t out[])
+{
+	double rp[XMATH_BLOCK], rT[XMATH_BLOCK], rv[XMATH_BLOCK];
+	int ri[XMATH_BLOCK];
+
+	enum h2o_region regions[XMATH_BLOCK];
+
+	while (n > 0)
+	{
+		int i, count;
+		int block = n < XMATH_BLOCK ? n : XMATH_BLOCK;
+
+		h2o_region_pT_n(block, p, T, regions);
+
+		for (i = 0; i < block; ++i)
+		{
+			out[i].region = regions[i];
+			out[i]._arg1 = p[i];
+			out[i]._arg2 = T[i];
+		}
+
+		/* Region 3 needs to be converted into (rho,T) */
+		count = batch_gather(block, regions, p, T, H2O_REGION3,
+				rp, rT, ri);
+		if (count)
+		{
+			h2o_region3_v_pT_n(count, rp, rT, rv);
+
+			for (i = 0; i < count; ++i)
+				out[ri[i]]._arg1 = 1 / rv[i];
+		}
+
+		p += block;
+		T += block;
+		out += block;
+		n -= block;
+	}
+}
+
+typedef void (*batch_props_func_t)(size_t, const double[], const double[],
+		struct h2o_props*);
+
+void h2o_batch_get_props(size_t n, const h2o_t states[],
+		struct h2o_props out[])
+{
+	static const batch_props_func_t funcs[] = {
+		NULL,
+		&h2o_region1_props_pT_n,
+		&h2o_region2_props_pT_n,
+		&h2o_region3_props_rhoT_n,
+		&h2o_region4_props_Tx_n,
+		&h2o_region5_props_pT_n
+	};
+
+	double a1[XMATH_BLOCK], a2[XMATH_BLOCK];
+	double ra1[XMATH_BLOCK], ra2[XMATH_BLOCK];
+	int ri[XMATH_BLOCK];
+	struct h2o_props props[XMATH_BLOCK];
+
+	enum h2o_region regions[XMATH_BLOCK];
+
+	while (n > 0)
+	{
+		int i, count;
+		enum h2o_region r;
+		int block = n < XMATH_BLOCK ? n : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			assert(h2o_is_valid(states[i]));
+
+			regions[i] = states[i].region;
+			a1[i] = states[i]._arg1;
+			a2[i] = states[i]._arg2;
+		}
+
+		for (r = H2O_REGION1; r <= H2O_REGION5; ++r)
+		{
+			count = batch_gather(block, regions, a1, a2, r, ra1, ra2, ri);
+			if (!count)
+				continue;
+
+			funcs[r](count, ra1, ra2, props);
+
+			for (i = 0; i < count; ++i)
+			{
+				out[ri[i]] = props[i];
+				out[ri[i]].x = r == H2O_REGION3 ? NAN
+					: h2o_get_x(states[ri[i]]);
+			}
+		}
+
+		states += block;
+		out += block;
+		n -= block;
+	}
+}
+
+void h2o_batch_get_h_pT(size_t n, const double p[], const double T[],
+		double h[])
+{
+	static const enum h2o_region batch_regions[] = {
+		H2O_REGION1, H2O_REGION2, H2O_REGION5
+	};
+
+	double rp[XMATH_BLOCK], rT[XMATH_BLOCK], rh[XMATH_BLOCK];
+	int ri[XMATH_BLOCK];
+
+	enum h2o_region regions[XMATH_BLOCK];
+
+	while (n > 0)
+	{
+		int i, j, count;
+		int block = n < XMATH_BLOCK ? n : XMATH_BLOCK;
+
+		h2o_region_pT_n(block, p, T, regions);
+
+		for (i = 0; i < block; ++i)
+		{
+			if (regions[i] == H2O_REGION_OUT_OF_RANGE)
+				h[i] = NAN;
+		}
+
+		count = batch_gather(block, regions, p, T, H2O_REGION3,
+				rp, rT, ri);
+		if (count)
+		{
+			h2o_region3_v_pT_n(count, rp, rT, rh);
+
+			for (i = 0; i < count; ++i)
+				h[ri[i]] = h2o_region3_h_rhoT(1 / rh[i], rT[i]);
+		}
+
+		/* evaluate the points of each region in one go */
+		for (j = 0; j < 3; ++j)
+		{
+			count = batch_gather(block, regions, p, T, batch_regions[j],
+					rp, rT, ri);
+			if (!count)
+				continue;
+
+			switch (batch_regions[j])
+			{
+				case H2O_REGION1:
+					h2o_region1_h_pT_n(count, rp, rT, rh);
+					break;
+				case H2O_REGION2:
+					h2o_region2_h_pT_n(count, rp, rT, rh);
+					break;
+				case H2O_REGION5:
+					h2o_region5_h_pT_n(count, rp, rT, rh);
+					break;
+				default:
+					assert(not_reached);
+			}
+
+			for (i = 0; i < count; ++i)
+				h[ri[i]] = rh[i];
+		}
+
+		p += block;
+		T += block;
+		h += block;
+		n -= block;
+	}
+}
+
 h2o_t h2o_expand(const h2o_t in_state, double pout)
 {
 	/* h2o_new_ps() will return OOR in R5 */
@@ -580,3 +1437,93 @@ h2o_t h2o_expand_real(const h2o_t in_state, double pout, double eta)
 		return h2o_new_ph(pout, houtr);
 	}
 }
+
+/* A stage expanding wet steam. It stays wet on an isentrope as
+ * the pressure falls, since s' falls and s'' rises with it, so one
+ * saturation state gives both the ideal and the real outlet. Only
+ * the real outlet needs to be classified, if it is dry (x > 1). */
+static h2o_t expand_line_wet(double p, double eta, double* s, double* h)
+{
+	struct h2o_sat sat;
+	const struct h2o_props* water = &sat.liquid;
+	const struct h2o_props* steam = &sat.vapour;
+	double T = h2o_region4_T_p(p);
+	double x;
+
+	h2o_region4_sat_T(T, &sat);
+	x = (*s - water->s) / (steam->s - water->s);
+
+	if (eta != 1)
+	{
+		*h -= (*h - (water->h + (steam->h - water->h) * x)) * eta;
+		x = (*h - water->h) / (steam->h - water->h);
+
+		if (x > 1)
+		{
+			h2o_t ret = h2o_new_ph(p, *h);
+
+			if (ret.region != H2O_REGION_OUT_OF_RANGE)
+				*s = h2o_get_s(ret);
+			return ret;
+		}
+		*s = water->s + (steam->s - water->s) * x;
+	}
+
+	return h2o_new_Tx(T, x);
+}
+
+/* A stage expanding any other state, like h2o_expand_real(). */
+static h2o_t expand_line_dry(double p, double eta, double* s, double* h)
+{
+	h2o_t ret = h2o_new_ps(p, *s);
+
+	if (eta != 1 && ret.region != H2O_REGION_OUT_OF_RANGE)
+	{
+		*h -= (*h - h2o_get_h(ret)) * eta;
+		ret = h2o_new_ph(p, *h);
+		if (ret.region != H2O_REGION_OUT_OF_RANGE)
+			*s = h2o_get_s(ret);
+	}
+
+	return ret;
+}
+
+void h2o_expand_line(const h2o_t in_state, size_t nstages,
+		const double pout[], const double eta[], h2o_t out[])
+{
+	h2o_t state = in_state;
+	double s = 0, h = 0;
+	size_t i;
+
+	if (state.region != H2O_REGION_OUT_OF_RANGE)
+	{
+		s = h2o_get_s(state);
+		/* the enthalpy is carried over by the real stages */
+		if (eta)
+			h = h2o_get_h(state);
+	}
+
+	for (i = 0; i < nstages; ++i)
+	{
+		/* once out of range, the following stages are too */
+		if (state.region != H2O_REGION_OUT_OF_RANGE)
+		{
+			double p = pout[i];
+			double stage_eta = eta ? eta[i] : 1;
+
+			/* above psat12max, h2o_new_ph() uses psat3(h) instead */
+			if (state.region == H2O_REGION4 && p >= psatmin
+					&& p <= psat12max && p <= h2o_get_p(state))
+				state = expand_line_wet(p, stage_eta, &s, &h);
+			else
+				state = expand_line_dry(p, stage_eta, &s, &h);
+
+			/* an ideal stage in a real line */
+			if (eta && stage_eta == 1
+					&& state.region != H2O_REGION_OUT_OF_RANGE)
+				h = h2o_get_h(state);
+		}
+
+		out[i] = state;
+	}
+}
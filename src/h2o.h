@@ -15,6 +15,8 @@ extern "C"
 
 #include "boundaries.h"
 
+#include <stddef.h>
+
 /**
  * A struct describing IF97 state point.
  *
@@ -47,6 +49,19 @@ typedef struct
  * x - dryness [0..1].
  */
 
+/**
+ * A bundle of all the properties of a state point, filled
+ * by h2o_get_all(). The fields use the same units as the getters.
+ *
+ * x is set only for Regions 1, 2, 4 and 5 (as with h2o_get_x()),
+ * it is NaN in Region 3.
+ */
+struct h2o_props
+{
+	double p, T, x, rho;
+	double v, u, h, s, cp, cv, w;
+};
+
 /**
  * Initializers.
  *
@@ -56,6 +71,9 @@ typedef struct
  * If the parameters are out of range, the struct will have region set
  * to H2O_REGION_OUT_OF_RANGE. You can use h2o_is_valid() to easily
  * check for that. Such a struct must not be passed to h2o_get_*().
+ *
+ * h2o_new_rhoT() finds p in Regions 1, 2 and 5 using the Newton method
+ * on the Gibbs free energy equation.
  */
 
 h2o_t h2o_new_pT(double p, double T);
@@ -66,6 +84,93 @@ h2o_t h2o_new_ps(double p, double s);
 h2o_t h2o_new_hs(double h, double s);
 h2o_t h2o_new_rhoT(double rho, double T);
 
+/**
+ * Exact-consistency initializers.
+ *
+ * h2o_new_ph(), h2o_new_ps() and h2o_new_hs() use the IF97 backward
+ * equations, which agree with the forward ones only within the IF97
+ * tolerances (e.g. 25 mK for T(p,h) in Region 1). Therefore, the h
+ * and s of the resulting state point differ from the parameters
+ * slightly.
+ *
+ * Those variants refine the backward equation results using the Newton
+ * method on the forward equations, with their analytic derivatives.
+ * The results agree with the parameters to the round-off, except
+ * for states within about 1 K of the critical point. Usually two steps
+ * are necessary, making the call 2-3 times slower (and up to 6 times
+ * for wet steam in h2o_new_hs_exact()). That still beats correcting
+ * the parameters in an outer loop, which takes about four calls.
+ */
+
+h2o_t h2o_new_ph_exact(double p, double h);
+h2o_t h2o_new_ps_exact(double p, double s);
+h2o_t h2o_new_hs_exact(double h, double s);
+
+/**
+ * Initializers with a region hint.
+ *
+ * Those work like the initializers above, but take the region
+ * the state point is expected to be in, and check the boundaries
+ * of that region first (e.g. a single saturation pressure for Region 1
+ * in (p,T)). If the hint is wrong, or the point is too close
+ * to a boundary to tell cheaply, the regular classification is used.
+ * The results are the same as of the initializers above.
+ *
+ * There is no (h,s) variant, the classification is a single comparison
+ * for most points already.
+ */
+
+h2o_t h2o_new_pT_hint(double p, double T, enum h2o_region expected);
+h2o_t h2o_new_ph_hint(double p, double h, enum h2o_region expected);
+h2o_t h2o_new_ps_hint(double p, double s, enum h2o_region expected);
+
+/**
+ * A state point following a trajectory.
+ *
+ * 1) Create a new one using h2o_tracker_new(),
+ * 2) move it using h2o_tracker_update_*(), which work like
+ * the respective initializers,
+ * 3) read the state from the state field.
+ *
+ * The tracker keeps a box of (p,T), (p,h) or (p,s) around the last
+ * point that lies within its region, and (in Region 3) another one
+ * for the v(p,T) subregion. While the points stay inside them, they
+ * are not classified again. Otherwise, the last region is used
+ * as the hint (see above).
+ *
+ * h2o_tracker_update_*() return a true (non-zero) value if the state
+ * is in a different region than before (including going out of range
+ * or back), and false (zero) otherwise. The previous region is kept
+ * in the prev_region field. The first update after h2o_tracker_new()
+ * starts from H2O_REGION_OUT_OF_RANGE.
+ */
+/* the arguments the tracker box is in (private) */
+enum h2o_tracker_box_args
+{
+	H2O_TRACKER_BOX_NONE,
+	H2O_TRACKER_BOX_PT,
+	H2O_TRACKER_BOX_PH,
+	H2O_TRACKER_BOX_PS
+};
+
+typedef struct
+{
+	h2o_t state;
+	enum h2o_region prev_region;
+
+/*private:*/
+	enum h2o_tracker_box_args _box_args;
+	double _box[4];
+	int _subregion;
+	double _subbox[4];
+} h2o_tracker_t;
+
+h2o_tracker_t h2o_tracker_new(void);
+
+int h2o_tracker_update_pT(h2o_tracker_t* tr, double p, double T);
+int h2o_tracker_update_ph(h2o_tracker_t* tr, double p, double h);
+int h2o_tracker_update_ps(h2o_tracker_t* tr, double p, double s);
+
 /**
  * Check whether a particular state point is valid and in range.
  *
@@ -109,6 +214,336 @@ double h2o_get_cp(const h2o_t state);
 double h2o_get_cv(const h2o_t state);
 double h2o_get_w(const h2o_t state);
 
+/**
+ * Get all the properties for a given state point at once.
+ *
+ * The state must be initialized and valid, like with h2o_get_*().
+ * This is much faster than calling all the getters separately since
+ * the region equations are evaluated only once.
+ */
+
+void h2o_get_all(const h2o_t state, struct h2o_props* out);
+
+/**
+ * Get a partial derivative of a property.
+ *
+ * h2o_get_deriv() returns (d@of / d@wrt) at constant @const_, e.g.
+ * (H2O_PROP_H, H2O_PROP_P, H2O_PROP_T) gives dh/dp at constant T
+ * [kJ/kg / MPa]. The units are those of the getters.
+ *
+ * The derivatives are exact (of the region equations), and computed
+ * from the same derivatives of the fundamental equation as cp, in the
+ * way of Bridgman's tables: any property is first differentiated wrt
+ * (p,T), and the result is a ratio of two Jacobians.
+ *
+ * In Region 4, the properties are differentiated wrt (T,x) instead.
+ * The phases follow the saturation line, with dpsat/dT differentiated
+ * from the saturation-pressure equation (it agrees with the
+ * Clausius-Clapeyron equation within the IF97 consistency). Above
+ * 623.15 K, the phase densities come from the backward equations,
+ * so the results are consistent with h2o_new_Tx() only as far as
+ * those are with the Region 3 equation.
+ *
+ * Returns NaN if the state is not valid, any of the properties is not
+ * one of enum h2o_prop, or @wrt can not change with @const_ constant
+ * (the same property, v and rho, or p and T in Region 4).
+ */
+
+enum h2o_prop
+{
+	H2O_PROP_P,
+	H2O_PROP_T,
+	H2O_PROP_V,
+	H2O_PROP_RHO,
+	H2O_PROP_U,
+	H2O_PROP_H,
+	H2O_PROP_S,
+
+	H2O_PROP_MAX
+};
+
+double h2o_get_deriv(const h2o_t state, enum h2o_prop of,
+		enum h2o_prop wrt, enum h2o_prop const_);
+
+/**
+ * The properties of both saturated phases at a given temperature
+ * or pressure, filled by h2o_sat_T() and h2o_sat_p().
+ *
+ * liquid holds the saturated water (x = 0) properties, vapour
+ * the saturated steam (x = 1) ones.
+ */
+struct h2o_sat
+{
+	double p, T;
+	struct h2o_props liquid, vapour;
+};
+
+/**
+ * Compute the saturation state for a given temperature [K] or pressure
+ * [MPa]. Both phases are evaluated in a single pass, which is much
+ * faster than calling the Region 4 getters for x = 0 and x = 1.
+ *
+ * Returns a true (non-zero) value on success, or false (zero) if
+ * the parameter is out of the saturation line range. In the latter
+ * case, the struct is left untouched.
+ */
+
+int h2o_sat_T(double T, struct h2o_sat* out);
+int h2o_sat_p(double p, struct h2o_sat* out);
+
+/**
+ * Approximate h2o_sat_T() and h2o_sat_p() using precomputed tables.
+ *
+ * p, T, rho, v, u, h and s of both phases are interpolated with
+ * piecewise cubics from the Region 4 equations evaluated on a grid
+ * (see tools/sattabgen.c). The maximum deviation from h2o_sat_T() is:
+ *
+ * - 2E-6 relative for p and rho,
+ * - 1E-3 kJ/kg for u and h, and 1E-6 kJ/kgK for s,
+ *
+ * the largest ones being within 1 K from the critical point (and less
+ * than 1E-5 kJ/kg, 1E-7 relative below 623.15 K). Tsat in
+ * h2o_sat_approx_p() is within 5E-6 K from h2o_region4_T_p(), which
+ * doubles the deviations of u and h near the critical point.
+ *
+ * cp, cv and w are not tabulated, and are set to NaN.
+ *
+ * Returns a true (non-zero) value on success, or false (zero) if
+ * the parameter is out of the saturation line range.
+ */
+
+int h2o_sat_approx_T(double T, struct h2o_sat* out);
+int h2o_sat_approx_p(double p, struct h2o_sat* out);
+
+/**
+ * An extended state point, caching the properties.
+ *
+ * 1) Create a new one from a valid h2o_t using h2o_ex_new(),
+ * 2) call any of h2o_ex_get_*() on it.
+ *
+ * All the properties are computed (like with h2o_get_all()) the first
+ * time any of the getters needs them, and retained in the struct.
+ * The following calls just return the stored values, so this is
+ * preferable to h2o_t when the same state is read many times.
+ * The same goes for the derivative set of h2o_ex_get_deriv(),
+ * and for the saturated phases in Region 4.
+ *
+ * The struct must not be shared between threads without locking, since
+ * the getters write to it.
+ */
+typedef struct
+{
+	h2o_t state;
+
+/*private:*/
+	int _have_props, _have_sat, _have_derivs;
+	struct h2o_props _props;
+	struct h2o_sat _sat;
+	/* of both phases in Region 4, [0] for liquid, [1] for vapour */
+	double _dvdp[2], _dvdT[2];
+} h2o_ex_t;
+
+h2o_ex_t h2o_ex_new(const h2o_t state);
+
+double h2o_ex_get_p(h2o_ex_t* state);
+double h2o_ex_get_T(h2o_ex_t* state);
+double h2o_ex_get_x(h2o_ex_t* state);
+double h2o_ex_get_rho(h2o_ex_t* state);
+
+double h2o_ex_get_v(h2o_ex_t* state);
+double h2o_ex_get_u(h2o_ex_t* state);
+double h2o_ex_get_h(h2o_ex_t* state);
+double h2o_ex_get_s(h2o_ex_t* state);
+double h2o_ex_get_cp(h2o_ex_t* state);
+double h2o_ex_get_cv(h2o_ex_t* state);
+double h2o_ex_get_w(h2o_ex_t* state);
+
+/**
+ * Get all the cached properties. The returned pointer is valid as long
+ * as the struct is.
+ */
+
+const struct h2o_props* h2o_ex_get_all(h2o_ex_t* state);
+
+/**
+ * Get the cached saturated phases of a Region 4 state, like
+ * h2o_sat_T() gives them. Returns NULL for the other regions.
+ * The returned pointer is valid as long as the struct is.
+ */
+
+const struct h2o_sat* h2o_ex_get_sat(h2o_ex_t* state);
+
+/**
+ * Get a partial derivative like h2o_get_deriv(). The derivatives
+ * of v (of both phases in Region 4) are computed on the first call
+ * and retained, so the following calls only take the ratios.
+ */
+
+double h2o_ex_get_deriv(h2o_ex_t* state, enum h2o_prop of,
+		enum h2o_prop wrt, enum h2o_prop const_);
+
+/**
+ * Create a new state point from specific volume v [m³/kg] and internal
+ * energy u [kJ/kg], the variables of the CFD solvers.
+ *
+ * There are no backward equations for (v,u), so the forward ones are
+ * solved iteratively. This is rather slow; for the hot loops, see
+ * the SBTL tables below.
+ */
+
+h2o_t h2o_new_vu(double v, double u);
+
+/**
+ * SBTL (Spline-Based Table Look-up) tables for (v,u) state points.
+ *
+ * 1) Build the tables using h2o_sbtl_new(), it takes a few seconds,
+ * 2) call h2o_sbtl_new_vu() or h2o_sbtl_get_vu() on them (from any
+ *    number of threads),
+ * 3) release them using h2o_sbtl_free().
+ *
+ * T and p of Regions 1, 2 and 3 are interpolated with bicubics over
+ * a (ln(v - v0), u) grid, and polished with a Newton step using
+ * the forward equation of the region, which also gives cp and w.
+ * The two-phase states are found by interpolating Tsat and solving
+ * the rest of the way using h2o_sat_approx_T(). Points close to
+ * the saturation line, in Region 5 and outside the grid (v up to
+ * 1000 m³/kg, u from -1 to 3700 kJ/kg) are solved using h2o_new_vu().
+ * The maximum deviation from h2o_new_vu() is:
+ *
+ * - 1E-6 K for T and 1E-7 relative for p,
+ * - 2E-4 relative for cp and w (3E-3 for cp within 25 K from
+ *   the critical temperature),
+ * - 1E-5 K for T and 1E-7 for x in the two-phase region,
+ *
+ * T, p and x being well within the permissible deviations of the IAPWS
+ * Guideline on the SBTL Method. Close to the saturation line, where
+ * IF97 is not quite consistent with itself, a few (v,u) points have
+ * both a single-phase and a two-phase solution (or two two-phase ones
+ * within 0.01 K from where the saturated phases switch equations, e.g.
+ * 623.15 K), and either may be returned.
+ *
+ * A look-up takes about as long as h2o_get_all() on the state; that is
+ * 4 (Region 3) to 60 (Region 4) times less than h2o_new_vu().
+ *
+ * h2o_sbtl_new() returns NULL if it is unable to allocate memory.
+ *
+ * h2o_sbtl_new_vu() works like h2o_new_vu(). Since the tables give
+ * (p,T), Region 3 states carry the exact v.
+ *
+ * h2o_sbtl_get_vu() fills in p, T, x, rho, v, u, h and (in single phase)
+ * cp and w; s and cv are set to NaN. It returns a true (non-zero) value
+ * on success, or false (zero) if the point is out of range.
+ */
+typedef struct h2o_sbtl h2o_sbtl_t;
+
+h2o_sbtl_t* h2o_sbtl_new(void);
+void h2o_sbtl_free(h2o_sbtl_t* tab);
+
+h2o_t h2o_sbtl_new_vu(const h2o_sbtl_t* tab, double v, double u);
+int h2o_sbtl_get_vu(const h2o_sbtl_t* tab, double v, double u,
+		struct h2o_props* out);
+
+/**
+ * TTSE (Tabular Taylor Series Expansion) tables for (p,h) and (p,s)
+ * state points.
+ *
+ * 1) Build the tables using h2o_ttse_new(), it takes a few seconds,
+ * 2) call h2o_ttse_new_ph() or h2o_ttse_new_ps() on them (from any
+ *    number of threads),
+ * 3) release them using h2o_ttse_free().
+ *
+ * The tables hold T and v with their first and second derivatives over
+ * a (ln p, h) and a (ln p, s) grid, solved using the forward equations,
+ * and the region each node was solved in. Each row (p) additionally
+ * holds Tsat, h' and h'' (s' and s'') and h (s) on the B13, B23 and
+ * Region 2/5 boundaries, with their derivatives over ln p. The region
+ * of a point is found by comparing it against these, and the point is
+ * then found using a second-order Taylor series from the nearest node
+ * of the same region. Points within the error bound of a boundary,
+ * around the critical point, below psat(Tmin) and outside the grid
+ * (h from -20 to 4200 kJ/kg, s from -0.02 to 12 kJ/kgK) are found
+ * using h2o_new_ph() and h2o_new_ps(); so are about 0.4% of random
+ * points. The maximum deviation from the forward equations is:
+ *
+ * - 0.006 K for T, up to 0.014 K close to the saturated vapour line
+ *   in (p,s),
+ * - 1.2E-4 relative for rho,
+ * - 1E-5 K for T and 1E-5 for x in the two-phase region,
+ *
+ * which is within the deviations of the backward equations
+ * h2o_new_ph() and h2o_new_ps() use. A look-up takes about as long
+ * as h2o_new_ph() and h2o_new_ps() in Regions 1 and 2, about 3/4
+ * of that in Region 3 and 1/3 or less in Region 4.
+ *
+ * h2o_ttse_new() returns NULL if it is unable to allocate memory.
+ * h2o_ttse_new_ph() and h2o_ttse_new_ps() work like h2o_new_ph()
+ * and h2o_new_ps(), and return states in the same regions.
+ */
+typedef struct h2o_ttse h2o_ttse_t;
+
+h2o_ttse_t* h2o_ttse_new(void);
+void h2o_ttse_free(h2o_ttse_t* tab);
+
+h2o_t h2o_ttse_new_ph(const h2o_ttse_t* tab, double p, double h);
+h2o_t h2o_ttse_new_ps(const h2o_ttse_t* tab, double p, double s);
+
+/**
+ * Batch initializer and getter.
+ *
+ * h2o_batch_new_pT() initializes n states from (p,T) pairs, like calling
+ * h2o_new_pT() for each of them. h2o_batch_get_props() fills in all
+ * the properties for n valid states, like h2o_get_all().
+ *
+ * The states are grouped by region and each region's equations are
+ * evaluated for the whole group at once, so mixed-phase arrays don't
+ * pay for switching between regions on every point.
+ */
+
+void h2o_batch_new_pT(size_t n, const double p[], const double T[],
+		h2o_t out[]);
+void h2o_batch_get_props(size_t n, const h2o_t states[],
+		struct h2o_props out[]);
+
+/**
+ * Compute the specific enthalpy for n (p,T) pairs at once.
+ *
+ * The points are grouped by region and the region equations are
+ * evaluated for a number of points at once, which is much faster than
+ * calling h2o_new_pT() and h2o_get_h() for each of them. For points out
+ * of range, h is set to NaN.
+ */
+
+void h2o_batch_get_h_pT(size_t n, const double p[], const double T[],
+		double h[]);
+
+/**
+ * Parallel batch initializer and getter.
+ *
+ * h2o_pool_new() starts a pool of worker threads for the parallel batch
+ * functions. @nthreads counts the calling thread, which takes part
+ * in the work too; 0 means the number of online CPUs. It returns NULL
+ * if it is unable to allocate memory. h2o_pool_threads() returns
+ * the number of threads actually used, which is 1 if libh2o was built
+ * without thread support (--disable-threads).
+ *
+ * h2o_batch_new_pT_par() and h2o_batch_get_props_par() work like
+ * h2o_batch_new_pT() and h2o_batch_get_props(), with the arrays split
+ * into chunks that the threads take as they finish the previous ones.
+ * Short arrays are processed in the calling thread. The calls on one
+ * pool are serialized. The call statistics of the work done
+ * by the workers are kept in their own threads.
+ */
+typedef struct h2o_pool h2o_pool_t;
+
+h2o_pool_t* h2o_pool_new(int nthreads);
+void h2o_pool_free(h2o_pool_t* pool);
+int h2o_pool_threads(const h2o_pool_t* pool);
+
+void h2o_batch_new_pT_par(h2o_pool_t* pool, size_t n,
+		const double p[], const double T[], h2o_t out[]);
+void h2o_batch_get_props_par(h2o_pool_t* pool, size_t n,
+		const h2o_t states[], struct h2o_props out[]);
+
 /**
  * Perform an expansion calculation from the given state point.
  *
@@ -125,6 +560,143 @@ double h2o_get_w(const h2o_t state);
 h2o_t h2o_expand(const h2o_t in_state, double pout);
 h2o_t h2o_expand_real(const h2o_t in_state, double pout, double eta);
 
+/**
+ * Perform the expansions through a number of turbine stages.
+ *
+ * @nstages: number of stages
+ * @pout: stage outlet pressures [MPa]
+ * @eta: (optional) stage isenthropic efficiencies [0..1], or NULL
+ * @out: stage outlet states
+ *
+ * Each stage expands the previous stage's outlet state (@in_state
+ * for the first one), like h2o_expand_real(). The entropy and enthalpy
+ * are carried over between the stages rather than recomputed, and
+ * the stages expanding wet steam (up to psat12max, about 16.5 MPa)
+ * evaluate a single saturation state instead of classifying
+ * the outlets. If a stage goes out of range, it and all the following
+ * ones have region set to H2O_REGION_OUT_OF_RANGE.
+ *
+ * Without @eta, all the stages are ideal expansions (@eta = 1).
+ */
+
+void h2o_expand_line(const h2o_t in_state, size_t nstages,
+		const double pout[], const double eta[], h2o_t out[]);
+
+/**
+ * Call statistics.
+ *
+ * If libh2o is configured with --enable-stats, it counts the calls
+ * to the initializers, getters, region and subregion classifiers,
+ * backward equations, saturation functions and the polynomial
+ * evaluators (the batch functions count every point). With
+ * --enable-stats=time, it also accumulates the time spent in each
+ * of them (except for the polynomials), using a monotonic clock.
+ * The times are inclusive, e.g. h2o_new_ph() covers h2o_region_ph()
+ * and the backward equation, and include the clock overhead (a few
+ * tens of ns per call).
+ *
+ * The statistics are kept per thread. h2o_stats_get() copies
+ * the calling thread's ones to the struct and returns a true (non-zero)
+ * value, or zeroes the struct and returns false (zero) if libh2o was
+ * built without the statistics. h2o_stats_reset() zeroes the calling
+ * thread's ones.
+ *
+ * h2o_stats_name() returns the name of the counted function, or NULL
+ * for an invalid counter.
+ */
+enum h2o_stats_counter
+{
+	H2O_STATS_NEW_PT,
+	H2O_STATS_NEW_TX,
+	H2O_STATS_NEW_PX,
+	H2O_STATS_NEW_PH,
+	H2O_STATS_NEW_PS,
+	H2O_STATS_NEW_HS,
+	H2O_STATS_NEW_RHOT,
+	H2O_STATS_NEW_PH_EXACT,
+	H2O_STATS_NEW_PS_EXACT,
+	H2O_STATS_NEW_HS_EXACT,
+	H2O_STATS_NEW_PT_HINT,
+	H2O_STATS_NEW_PH_HINT,
+	H2O_STATS_NEW_PS_HINT,
+	H2O_STATS_TRACKER_UPDATE_PT,
+	H2O_STATS_TRACKER_UPDATE_PH,
+	H2O_STATS_TRACKER_UPDATE_PS,
+	H2O_STATS_NEW_VU,
+	H2O_STATS_SBTL_NEW_VU,
+	H2O_STATS_TTSE_NEW_PH,
+	H2O_STATS_TTSE_NEW_PS,
+
+	H2O_STATS_GET_P,
+	H2O_STATS_GET_T,
+	H2O_STATS_GET_X,
+	H2O_STATS_GET_RHO,
+	H2O_STATS_GET_V,
+	H2O_STATS_GET_U,
+	H2O_STATS_GET_H,
+	H2O_STATS_GET_S,
+	H2O_STATS_GET_CP,
+	H2O_STATS_GET_CV,
+	H2O_STATS_GET_W,
+	H2O_STATS_GET_ALL,
+	H2O_STATS_GET_DERIV,
+
+	H2O_STATS_REGION_PT,
+	H2O_STATS_REGION_PH,
+	H2O_STATS_REGION_PS,
+	H2O_STATS_REGION_PT_HINT,
+	H2O_STATS_REGION_PH_HINT,
+	H2O_STATS_REGION_PS_HINT,
+	H2O_STATS_REGION_HS,
+	H2O_STATS_REGION_TX,
+	H2O_STATS_REGION_PX,
+	H2O_STATS_REGION_RHOT,
+	H2O_STATS_REGION2_SUBREGION_PH,
+	H2O_STATS_REGION2_SUBREGION_PS,
+	H2O_STATS_REGION2_SUBREGION_HS,
+	H2O_STATS_REGION3_SUBREGION_PH,
+	H2O_STATS_REGION3_SUBREGION_PS,
+	H2O_STATS_REGION3_SUBREGION_HS,
+	H2O_STATS_REGION3_SUBREGION_PT,
+
+	H2O_STATS_REGION1_T_PH,
+	H2O_STATS_REGION1_T_PS,
+	H2O_STATS_REGION1_P_HS,
+	H2O_STATS_REGION2_T_PH,
+	H2O_STATS_REGION2_T_PS,
+	H2O_STATS_REGION2_P_HS,
+	H2O_STATS_REGION3_T_PH,
+	H2O_STATS_REGION3_V_PH,
+	H2O_STATS_REGION3_T_PS,
+	H2O_STATS_REGION3_V_PS,
+	H2O_STATS_REGION3_P_HS,
+	H2O_STATS_REGION3_V_PT,
+	H2O_STATS_REGION4_T_HS,
+
+	H2O_STATS_REGION4_P_T,
+	H2O_STATS_REGION4_T_P,
+	H2O_STATS_REGION4_SAT_T,
+	H2O_STATS_REGION4_SAT_P,
+	H2O_STATS_REGION4_SAT_APPROX_T,
+	H2O_STATS_REGION4_SAT_APPROX_P,
+
+	H2O_STATS_TWOARG_POLY_VALUE,
+	H2O_STATS_TWOARG_POLY_DERIVS,
+
+	H2O_STATS_MAX
+};
+
+struct h2o_stats
+{
+	unsigned long long calls[H2O_STATS_MAX];
+	/* [ns], with --enable-stats=time only */
+	unsigned long long ns[H2O_STATS_MAX];
+};
+
+int h2o_stats_get(struct h2o_stats* out);
+void h2o_stats_reset(void);
+const char* h2o_stats_name(enum h2o_stats_counter counter);
+
 #ifdef __cplusplus
 };
 #endif /*__cplusplus*/
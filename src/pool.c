@@ -0,0 +1,252 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "h2o.h"
+#include "xmath.h"
+
+#include <stdlib.h>
+
+#ifdef H2O_THREADS
+#	include <pthread.h>
+#	include <unistd.h>
+#endif
+
+/* The parallel batch functions split the arrays into chunks, which
+ * the workers (and the calling thread) take from a shared counter
+ * as they finish the previous ones. The chunks are small enough that
+ * the ones heavy on Region 3 and 4 points even out. */
+
+struct pool_job
+{
+	void (*func)(const struct pool_job* job, size_t begin, size_t end);
+	size_t n;
+	size_t chunk;
+	size_t next; /* the first point not taken yet */
+
+	const double* p;
+	const double* T;
+	const h2o_t* states;
+	h2o_t* out_states;
+	struct h2o_props* out_props;
+};
+
+struct h2o_pool
+{
+	int nworkers; /* not counting the calling thread */
+
+#ifdef H2O_THREADS
+	pthread_t* workers;
+	pthread_mutex_t lock;
+	pthread_cond_t start, done;
+
+	struct pool_job* job;
+	unsigned long generation; /* increased for every job */
+	int busy; /* workers still running the current job */
+	int quit;
+#endif
+};
+
+/* the chunks per thread, and their size limits (in points) */
+static const size_t chunks_per_thread = 16;
+static const size_t chunk_min = 4 * XMATH_BLOCK;
+static const size_t chunk_max = 256 * XMATH_BLOCK;
+
+#ifdef H2O_THREADS
+
+/* Run the chunks of the current job, with the lock held. */
+static void pool_run(h2o_pool_t* pool, struct pool_job* job)
+{
+	while (job->next < job->n)
+	{
+		size_t begin = job->next;
+		size_t end = job->n - begin > job->chunk
+			? begin + job->chunk : job->n;
+
+		job->next = end;
+
+		pthread_mutex_unlock(&pool->lock);
+		job->func(job, begin, end);
+		pthread_mutex_lock(&pool->lock);
+	}
+}
+
+static void* pool_worker(void* arg)
+{
+	h2o_pool_t* pool = arg;
+	unsigned long seen = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;)
+	{
+		while (!pool->quit && pool->generation == seen)
+			pthread_cond_wait(&pool->start, &pool->lock);
+		if (pool->quit)
+			break;
+
+		seen = pool->generation;
+		pool_run(pool, pool->job);
+
+		if (--pool->busy == 0)
+			pthread_cond_broadcast(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	return NULL;
+}
+
+#endif /*H2O_THREADS*/
+
+h2o_pool_t* h2o_pool_new(int nthreads)
+{
+	h2o_pool_t* pool = malloc(sizeof(*pool));
+
+	if (!pool)
+		return NULL;
+
+	pool->nworkers = 0;
+
+#ifdef H2O_THREADS
+	if (nthreads <= 0)
+	{
+		long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		nthreads = ncpus > 0 ? ncpus : 1;
+	}
+
+	pool->workers = malloc((nthreads - 1) * sizeof(*pool->workers));
+	if (nthreads > 1 && !pool->workers)
+	{
+		free(pool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	pool->job = NULL;
+	pool->generation = 0;
+	pool->busy = 0;
+	pool->quit = 0;
+
+	/* if some of the threads fail to start, do with the rest */
+	while (pool->nworkers < nthreads - 1
+			&& !pthread_create(&pool->workers[pool->nworkers], NULL,
+				pool_worker, pool))
+		++pool->nworkers;
+#else
+	(void) nthreads;
+#endif
+
+	return pool;
+}
+
+void h2o_pool_free(h2o_pool_t* pool)
+{
+#ifdef H2O_THREADS
+	int i;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < pool->nworkers; ++i)
+		pthread_join(pool->workers[i], NULL);
+
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->start);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool->workers);
+#endif
+
+	free(pool);
+}
+
+int h2o_pool_threads(const h2o_pool_t* pool)
+{
+	return pool->nworkers + 1;
+}
+
+static void pool_submit(h2o_pool_t* pool, struct pool_job* job)
+{
+	size_t nthreads = pool->nworkers + 1;
+
+	job->next = 0;
+	job->chunk = job->n / (nthreads * chunks_per_thread);
+	if (job->chunk < chunk_min)
+		job->chunk = chunk_min;
+	else if (job->chunk > chunk_max)
+		job->chunk = chunk_max;
+
+#ifdef H2O_THREADS
+	if (pool->nworkers > 0 && job->n > job->chunk)
+	{
+		pthread_mutex_lock(&pool->lock);
+		/* one job at a time */
+		while (pool->job)
+			pthread_cond_wait(&pool->done, &pool->lock);
+
+		pool->job = job;
+		pool->busy = pool->nworkers;
+		++pool->generation;
+		pthread_cond_broadcast(&pool->start);
+
+		pool_run(pool, job);
+		while (pool->busy > 0)
+			pthread_cond_wait(&pool->done, &pool->lock);
+
+		pool->job = NULL;
+		pthread_cond_broadcast(&pool->done);
+		pthread_mutex_unlock(&pool->lock);
+		return;
+	}
+#endif
+
+	job->func(job, 0, job->n);
+}
+
+static void new_pT_chunk(const struct pool_job* job, size_t begin, size_t end)
+{
+	h2o_batch_new_pT(end - begin, &job->p[begin], &job->T[begin],
+			&job->out_states[begin]);
+}
+
+static void get_props_chunk(const struct pool_job* job,
+		size_t begin, size_t end)
+{
+	h2o_batch_get_props(end - begin, &job->states[begin],
+			&job->out_props[begin]);
+}
+
+void h2o_batch_new_pT_par(h2o_pool_t* pool, size_t n,
+		const double p[], const double T[], h2o_t out[])
+{
+	struct pool_job job;
+
+	job.func = new_pT_chunk;
+	job.n = n;
+	job.p = p;
+	job.T = T;
+	job.out_states = out;
+
+	pool_submit(pool, &job);
+}
+
+void h2o_batch_get_props_par(h2o_pool_t* pool, size_t n,
+		const h2o_t states[], struct h2o_props out[])
+{
+	struct pool_job job;
+
+	job.func = get_props_chunk;
+	job.n = n;
+	job.states = states;
+	job.out_props = out;
+
+	pool_submit(pool, &job);
+}
@@ -13,18 +13,35 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
+struct h2o_props; /* see h2o.h */
+
 double h2o_region1_v_pT(double p, double T);
+double h2o_region1_p_rhoT(double rho, double T);
 double h2o_region1_u_pT(double p, double T);
 double h2o_region1_s_pT(double p, double T);
 double h2o_region1_h_pT(double p, double T);
+void h2o_region1_h_pT_n(size_t count, const double p[],
+		const double T[], double h[]);
 double h2o_region1_cp_pT(double p, double T);
 double h2o_region1_cv_pT(double p, double T);
 double h2o_region1_w_pT(double p, double T);
+void h2o_region1_props_pT(double p, double T,
+		struct h2o_props* out);
+void h2o_region1_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT);
+void h2o_region1_props_pT_n(size_t count, const double p[],
+		const double T[], struct h2o_props* out);
 
 double h2o_region1_T_ph(double p, double h);
 double h2o_region1_T_ps(double p, double s);
 double h2o_region1_p_hs(double h, double s);
 
+/* special use functions */
+
+double h2o_region1_gamma_generic_pT(double p, double T);
+
 #ifdef __cplusplus
 };
 #endif /*__cplusplus*/
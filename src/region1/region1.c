@@ -9,9 +9,14 @@
 
 
 #include "consts.h"
+#include "h2o.h"
 #include "region1.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region1.h"
+#endif
+
 /* Based on IF97-Rev, s. 5: Equations for Region 1 */
 
 /* coefficient table; n[0] added for convenience */
@@ -84,7 +89,7 @@ static const double Tstar = 1386; /* [K] */
 
 static double h2o_region1_gamma_pitau(double pi, double tau, int pider, int tauder)
 {
-	double sum = twoarg_poly_value(7.1 - pi, tau - 1.222,
+	double sum = TWOARG_POLY_VALUE(region1, 7.1 - pi, tau - 1.222,
 			I, Ipows, 0, 13, pider,
 			J, Jpows, 16, 25, tauder,
 			n, 34);
@@ -95,6 +100,32 @@ static double h2o_region1_gamma_pitau(double pi, double tau, int pider, int taud
 	return sum;
 }
 
+/* gamma, always through the generic twoarg_poly_value(), so that
+ * h2o-bench can time it against the h2o-polygen code on the same table */
+double h2o_region1_gamma_generic_pT(double p, double T)
+{
+	double pi = p / pstar;
+	double tau = Tstar / T;
+
+	return twoarg_poly_value(7.1 - pi, tau - 1.222,
+			I, Ipows, 0, 13, 0,
+			J, Jpows, 16, 25, 0,
+			n, 34);
+}
+
+/* all the derivatives at once; d1 is wrt pi, d2 wrt tau */
+static void h2o_region1_gamma_derivs(double pi, double tau,
+		struct twoarg_derivs* gamma)
+{
+	TWOARG_POLY_DERIVS(region1, 7.1 - pi, tau - 1.222,
+			I, Ipows, 0, 13,
+			J, Jpows, 16, 25,
+			n, 34, gamma);
+
+	gamma->d1 *= -1;
+	gamma->d12 *= -1;
+}
+
 double h2o_region1_v_pT(double p, double T)
 {
 	double pi = p / pstar;
@@ -105,15 +136,45 @@ double h2o_region1_v_pT(double p, double T)
 	return pi * gammapi * R * T / p * 1E-3;
 }
 
+/* Solve v(p, T) = 1/rho for p, using the Newton method on
+ * gamma_pi - c = 0 where c = gamma_pi at the solution. */
+double h2o_region1_p_rhoT(double rho, double T)
+{
+	double tau = Tstar / T;
+	double c = pstar / rho / (R * T) * 1E3;
+	double pi = 1;
+	int i;
+
+	for (i = 0; i < 50; ++i)
+	{
+		double gammapi = h2o_region1_gamma_pitau(pi, tau, 1, 0);
+		double gammapipi = h2o_region1_gamma_pitau(pi, tau, 2, 0);
+		double dpi = (gammapi - c) / gammapipi;
+
+		if (pi - dpi <= 0)
+			pi /= 2;
+		else
+			pi -= dpi;
+
+		/* the liquid is barely compressible, so p can't be resolved
+		 * any better than that at low pressures */
+		if (fabs(dpi) < 1E-12)
+			return pi * pstar;
+	}
+
+	return NAN;
+}
+
 double h2o_region1_u_pT(double p, double T)
 {
 	double pi = p / pstar;
 	double tau = Tstar / T;
 
-	double gammatau = h2o_region1_gamma_pitau(pi, tau, 0, 1);
-	double gammapi = h2o_region1_gamma_pitau(pi, tau, 1, 0);
+	struct twoarg_derivs gamma;
 
-	return (tau * gammatau - pi * gammapi) * R * T;
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+
+	return (tau * gamma.d2 - pi * gamma.d1) * R * T;
 }
 
 double h2o_region1_s_pT(double p, double T)
@@ -121,10 +182,11 @@ double h2o_region1_s_pT(double p, double T)
 	double pi = p / pstar;
 	double tau = Tstar / T;
 
-	double gammatau = h2o_region1_gamma_pitau(pi, tau, 0, 1);
-	double gamma = h2o_region1_gamma_pitau(pi, tau, 0, 0);
+	struct twoarg_derivs gamma;
 
-	return (tau * gammatau - gamma) * R;
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+
+	return (tau * gamma.d2 - gamma.val) * R;
 }
 
 double h2o_region1_h_pT(double p, double T)
@@ -152,10 +214,15 @@ double h2o_region1_cv_pT(double p, double T)
 	double pi = p / pstar;
 	double tau = Tstar / T;
 
-	double gammatautau = h2o_region1_gamma_pitau(pi, tau, 0, 2);
-	double gammapi = h2o_region1_gamma_pitau(pi, tau, 1, 0);
-	double gammapitau = h2o_region1_gamma_pitau(pi, tau, 1, 1);
-	double gammapipi = h2o_region1_gamma_pitau(pi, tau, 2, 0);
+	struct twoarg_derivs gamma;
+
+	double gammatautau, gammapi, gammapitau, gammapipi;
+
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+	gammatautau = gamma.d22;
+	gammapi = gamma.d1;
+	gammapitau = gamma.d12;
+	gammapipi = gamma.d11;
 
 	return (-pow2(tau) * gammatautau
 			+ pow2(gammapi - tau * gammapitau) / gammapipi) * R;
@@ -166,10 +233,15 @@ double h2o_region1_w_pT(double p, double T)
 	double pi = p / pstar;
 	double tau = Tstar / T;
 
-	double gammatautau = h2o_region1_gamma_pitau(pi, tau, 0, 2);
-	double gammapi = h2o_region1_gamma_pitau(pi, tau, 1, 0);
-	double gammapitau = h2o_region1_gamma_pitau(pi, tau, 1, 1);
-	double gammapipi = h2o_region1_gamma_pitau(pi, tau, 2, 0);
+	struct twoarg_derivs gamma;
+
+	double gammatautau, gammapi, gammapitau, gammapipi;
+
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+	gammatautau = gamma.d22;
+	gammapi = gamma.d1;
+	gammapitau = gamma.d12;
+	gammapipi = gamma.d11;
 
 	return sqrt(
 			pow2(gammapi) /
@@ -179,3 +251,135 @@ double h2o_region1_w_pT(double p, double T)
 			)
 			* R * T * 1E3);
 }
+
+static void h2o_region1_props_from_gamma(double p, double T,
+		double pi, double tau, const struct twoarg_derivs* gamma,
+		struct h2o_props* out)
+{
+	double cvsubexpr = pow2(gamma->d1 - tau * gamma->d12);
+
+	out->p = p;
+	out->T = T;
+	out->v = pi * gamma->d1 * R * T / p * 1E-3;
+	out->rho = 1 / out->v;
+	out->u = (tau * gamma->d2 - pi * gamma->d1) * R * T;
+	out->s = (tau * gamma->d2 - gamma->val) * R;
+	out->h = tau * gamma->d2 * R * T;
+	out->cp = -pow2(tau) * gamma->d22 * R;
+	out->cv = (-pow2(tau) * gamma->d22 + cvsubexpr / gamma->d11) * R;
+	out->w = sqrt(
+			pow2(gamma->d1) /
+			(
+				cvsubexpr / pow2(tau) / gamma->d22
+				- gamma->d11
+			)
+			* R * T * 1E3);
+}
+
+void h2o_region1_props_pT(double p, double T, struct h2o_props* out)
+{
+	double pi = p / pstar;
+	double tau = Tstar / T;
+
+	struct twoarg_derivs gamma;
+
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+	h2o_region1_props_from_gamma(p, T, pi, tau, &gamma, out);
+}
+
+/* props plus the first derivatives of v, for the Newton solvers */
+void h2o_region1_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT)
+{
+	double pi = p / pstar;
+	double tau = Tstar / T;
+
+	struct twoarg_derivs gamma;
+
+	h2o_region1_gamma_derivs(pi, tau, &gamma);
+	h2o_region1_props_from_gamma(p, T, pi, tau, &gamma, out);
+
+	*dvdp = gamma.d11 * R * T / pow2(pstar) * 1E-3;
+	*dvdT = (gamma.d1 - tau * gamma.d12) * R / pstar * 1E-3;
+}
+
+static XMATH_ALWAYS_INLINE void h2o_region1_props_pT_n_impl(
+		size_t count, const double p[],
+		const double T[], struct h2o_props* out)
+{
+	double x1[XMATH_BLOCK], x2[XMATH_BLOCK];
+	struct twoarg_derivs gamma[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			x1[i] = 7.1 - p[i] / pstar;
+			x2[i] = Tstar / T[i] - 1.222;
+		}
+
+		TWOARG_POLY_DERIVS_N(region1, block, x1, x2,
+				I, Ipows, 0, 13,
+				J, Jpows, 16, 25,
+				n, 34, gamma);
+
+		for (i = 0; i < block; ++i)
+		{
+			gamma[i].d1 *= -1;
+			gamma[i].d12 *= -1;
+
+			h2o_region1_props_from_gamma(p[i], T[i],
+					p[i] / pstar, Tstar / T[i], &gamma[i], &out[i]);
+		}
+
+		p += block;
+		T += block;
+		out += block;
+		count -= block;
+	}
+}
+
+XMATH_DISPATCH_VOID(h2o_region1_props_pT_n,
+		(size_t count, const double p[],
+		const double T[], struct h2o_props* out),
+		(count, p, T, out))
+
+static XMATH_ALWAYS_INLINE void h2o_region1_h_pT_n_impl(
+		size_t count, const double p[],
+		const double T[], double h[])
+{
+	double x1[XMATH_BLOCK], x2[XMATH_BLOCK], gammatau[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			x1[i] = 7.1 - p[i] / pstar;
+			x2[i] = Tstar / T[i] - 1.222;
+		}
+
+		TWOARG_POLY_VALUE_N(region1, block, x1, x2,
+				I, Ipows, 0, 13, 0,
+				J, Jpows, 16, 25, 1,
+				n, 34, gammatau);
+
+		for (i = 0; i < block; ++i)
+			h[i] = Tstar / T[i] * gammatau[i] * R * T[i];
+
+		p += block;
+		T += block;
+		h += block;
+		count -= block;
+	}
+}
+
+XMATH_DISPATCH_VOID(h2o_region1_h_pT_n,
+		(size_t count, const double p[],
+		const double T[], double h[]),
+		(count, p, T, h))
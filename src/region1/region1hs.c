@@ -8,8 +8,13 @@
 #endif
 
 #include "region1.h"
+#include "stats.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region1hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Pressure as a Function
  * of Enthalpy and Entropy p(h,s) to the IAPWS Industrial Formulation 1997
  * for the Thermodynamic Properties of Water and Steam;
@@ -61,10 +66,11 @@ static const double sstar = 7.6; /* [kJ/kgK] */
 
 double h2o_region1_p_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION1_P_HS);
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(eta + 0.05, sigma + 0.05,
+	return TWOARG_POLY_VALUE(region1hs, eta + 0.05, sigma + 0.05,
 			I, Ipows, 0, 6, 0,
 			J, Jpows, 0, 9, 0,
 			n, 19) * pstar;
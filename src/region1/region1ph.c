@@ -9,8 +9,13 @@
 
 
 #include "region1.h"
+#include "stats.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region1ph.h"
+#endif
+
 /* Based on IF97-Rev, s. 5.2.1: The Backward Equation T(p, h) */
 
 /* coefficient table; n[0] added for convenience */
@@ -62,9 +67,10 @@ static const double hstar = 2500; /* [kJ/kg] */
 
 double h2o_region1_T_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION1_T_PH);
 	double eta = h / hstar;
 
-	return twoarg_poly_value(p, eta + 1,
+	return TWOARG_POLY_VALUE(region1ph, p, eta + 1,
 			I, Ipows, 0, 7, 0,
 			J, Jpows, 0, 9, 0,
 			n, 20);
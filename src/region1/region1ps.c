@@ -9,8 +9,13 @@
 
 
 #include "region1.h"
+#include "stats.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region1ps.h"
+#endif
+
 /* Based on IF97-Rev, s. 5.2.2: The Backward Equation T(p, s) */
 
 /* coefficient table; n[0] added for convenience */
@@ -58,7 +63,9 @@ static const int J[] = {
 
 double h2o_region1_T_ps(double p, double s)
 {
-	return twoarg_poly_value(p, s + 2,
+	H2O_STATS_SCOPE(H2O_STATS_REGION1_T_PS);
+
+	return TWOARG_POLY_VALUE(region1ps, p, s + 2,
 			I, Ipows, 0, 5, 0,
 			J, Jpows, 0, 10, 0,
 			n, 20);
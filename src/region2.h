@@ -13,13 +13,26 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
+struct h2o_props; /* see h2o.h */
+
 double h2o_region2_v_pT(double p, double T);
+double h2o_region2_p_rhoT(double rho, double T);
 double h2o_region2_u_pT(double p, double T);
 double h2o_region2_s_pT(double p, double T);
 double h2o_region2_h_pT(double p, double T);
+void h2o_region2_h_pT_n(size_t count, const double p[],
+		const double T[], double h[]);
 double h2o_region2_cp_pT(double p, double T);
 double h2o_region2_cv_pT(double p, double T);
 double h2o_region2_w_pT(double p, double T);
+void h2o_region2_props_pT(double p, double T,
+		struct h2o_props* out);
+void h2o_region2_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT);
+void h2o_region2_props_pT_n(size_t count, const double p[],
+		const double T[], struct h2o_props* out);
 
 double h2o_region2_T_ph(double p, double h);
 double h2o_region2_T_ps(double p, double s);
@@ -34,6 +47,12 @@ double h2o_region2_meta_h_pT(double p, double T);
 double h2o_region2_meta_cp_pT(double p, double T);
 double h2o_region2_meta_cv_pT(double p, double T);
 double h2o_region2_meta_w_pT(double p, double T);
+void h2o_region2_meta_props_pT(double p, double T,
+		struct h2o_props* out);
+void h2o_region2_meta_props_pT_n(size_t count, const double p[],
+		const double T[], struct h2o_props* out);
+void h2o_region2_meta_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT);
 
 /* special use functions */
 
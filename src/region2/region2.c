@@ -10,9 +10,14 @@
 #include <assert.h>
 
 #include "consts.h"
+#include "h2o.h"
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2.h"
+#endif
+
 /* Based on IF97-Rev, s. 6: Equations for Region 2 */
 
 /* ideal-gas part coefficients */
@@ -135,7 +140,7 @@ static double h2o_region2_gammao_pitau(double pi, double tau, int pider, int tau
 
 static double h2o_region2_gammar_pitau(double pi, double tau, int pider, int tauder)
 {
-	return twoarg_poly_value(pi, tau - 0.5,
+	return TWOARG_POLY_VALUE(region2, pi, tau - 0.5,
 			I, Ipows, 0, 18, pider,
 			J, Jpows, 0, 27, tauder,
 			n, 43);
@@ -151,6 +156,33 @@ static double h2o_region2_gamma_pitau(double pi, double tau, int pider, int taud
 	return sum;
 }
 
+/* all the derivatives at once; d1 is wrt pi, d2 wrt tau */
+static void h2o_region2_gammao_derivs_lnpi(double pi, double lnpi,
+		double tau, struct twoarg_derivs* gammao)
+{
+	gammao->val = poly_value(tau, -5, 3, 0, no) + lnpi;
+	gammao->d1 = 1/pi;
+	gammao->d2 = poly_value(tau, -5, 3, 1, no);
+	gammao->d11 = -1/pow2(pi);
+	gammao->d12 = 0;
+	gammao->d22 = poly_value(tau, -5, 3, 2, no);
+}
+
+static void h2o_region2_gammao_derivs(double pi, double tau,
+		struct twoarg_derivs* gammao)
+{
+	h2o_region2_gammao_derivs_lnpi(pi, log(pi), tau, gammao);
+}
+
+static void h2o_region2_gammar_derivs(double pi, double tau,
+		struct twoarg_derivs* gammar)
+{
+	TWOARG_POLY_DERIVS(region2, pi, tau - 0.5,
+			I, Ipows, 0, 18,
+			J, Jpows, 0, 27,
+			n, 43, gammar);
+}
+
 double h2o_region2_v_pT(double p, double T)
 {
 	double pi = p;
@@ -161,15 +193,54 @@ double h2o_region2_v_pT(double p, double T)
 	return pi * gammapi * R * T / p * 1E-3;
 }
 
+/* Solve v(p, T) = 1/rho for p, using the Newton method on
+ * gamma_pi - c = 0. The steam is less compressible than the ideal gas,
+ * and gamma_pi is convex in pi, so the first step from the ideal gas
+ * guess lands below the solution and the further ones approach it
+ * monotonically. */
+double h2o_region2_p_rhoT(double rho, double T)
+{
+	double tau = Tstar / T;
+	double c = 1 / rho / (R * T) * 1E3;
+	double pi = 1 / c;
+	double pimax = T > Tb13 ? h2o_b23_p_T(T) : h2o_b23_p_T(Tb13);
+	int i;
+
+	/* the equation loses monotonicity past the B23 line, so start
+	 * at most from there -- the ideal gas guess is too high anyway */
+	if (pi > pimax)
+		pi = pimax;
+
+	for (i = 0; i < 50; ++i)
+	{
+		double gammapi = h2o_region2_gamma_pitau(pi, tau, 1, 0);
+		double gammapipi = h2o_region2_gamma_pitau(pi, tau, 2, 0);
+		double dpi = (gammapi - c) / gammapipi;
+
+		if (pi - dpi <= 0)
+			pi /= 2;
+		else
+			pi -= dpi;
+
+		if (fabs(dpi) < pi * 1E-14)
+			return pi;
+	}
+
+	return NAN;
+}
+
 double h2o_region2_u_pT(double p, double T)
 {
 	double pi = p;
 	double tau = Tstar / T;
 
-	double gammatau = h2o_region2_gamma_pitau(pi, tau, 0, 1);
-	double gammapi = h2o_region2_gamma_pitau(pi, tau, 1, 0);
+	struct twoarg_derivs gammao, gammar, gamma;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	twoarg_derivs_add(&gamma, &gammao, &gammar);
 
-	return (tau * gammatau - pi * gammapi) * R * T;
+	return (tau * gamma.d2 - pi * gamma.d1) * R * T;
 }
 
 double h2o_region2_s_pT(double p, double T)
@@ -177,10 +248,13 @@ double h2o_region2_s_pT(double p, double T)
 	double pi = p;
 	double tau = Tstar / T;
 
-	double gammatau = h2o_region2_gamma_pitau(pi, tau, 0, 1);
-	double gamma = h2o_region2_gamma_pitau(pi, tau, 0, 0);
+	struct twoarg_derivs gammao, gammar, gamma;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	twoarg_derivs_add(&gamma, &gammao, &gammar);
 
-	return (tau * gammatau - gamma) * R;
+	return (tau * gamma.d2 - gamma.val) * R;
 }
 
 double h2o_region2_h_pT(double p, double T)
@@ -208,10 +282,16 @@ double h2o_region2_cv_pT(double p, double T)
 	double pi = p;
 	double tau = Tstar / T;
 
-	double gammatautau = h2o_region2_gamma_pitau(pi, tau, 0, 2);
-	double gammarpi = h2o_region2_gammar_pitau(pi, tau, 1, 0);
-	double gammarpitau = h2o_region2_gammar_pitau(pi, tau, 1, 1);
-	double gammarpipi = h2o_region2_gammar_pitau(pi, tau, 2, 0);
+	struct twoarg_derivs gammao, gammar;
+
+	double gammatautau, gammarpi, gammarpitau, gammarpipi;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	gammatautau = gammao.d22 + gammar.d22;
+	gammarpi = gammar.d1;
+	gammarpitau = gammar.d12;
+	gammarpipi = gammar.d11;
 
 	return (-pow2(tau) * gammatautau -
 		(
@@ -226,10 +306,16 @@ double h2o_region2_w_pT(double p, double T)
 	double pi = p;
 	double tau = Tstar / T;
 
-	double gammatautau = h2o_region2_gamma_pitau(pi, tau, 0, 2);
-	double gammarpi = h2o_region2_gammar_pitau(pi, tau, 1, 0);
-	double gammarpitau = h2o_region2_gammar_pitau(pi, tau, 1, 1);
-	double gammarpipi = h2o_region2_gammar_pitau(pi, tau, 2, 0);
+	struct twoarg_derivs gammao, gammar;
+
+	double gammatautau, gammarpi, gammarpitau, gammarpipi;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	gammatautau = gammao.d22 + gammar.d22;
+	gammarpi = gammar.d1;
+	gammarpitau = gammar.d12;
+	gammarpipi = gammar.d11;
 
 	return sqrt(
 			(1 + pi * gammarpi * (2 + pi * gammarpi)) /
@@ -242,3 +328,159 @@ double h2o_region2_w_pT(double p, double T)
 			)
 			* R * T * 1E3);
 }
+
+static void h2o_region2_props_from_gamma(double p, double T,
+		double pi, double tau, const struct twoarg_derivs* gammao,
+		const struct twoarg_derivs* gammar, struct h2o_props* out)
+{
+	struct twoarg_derivs gamma;
+	double cvsubexpr;
+
+	twoarg_derivs_add(&gamma, gammao, gammar);
+	cvsubexpr = pow2(1 + pi * (gammar->d1 - tau * gammar->d12));
+
+	out->p = p;
+	out->T = T;
+	out->v = pi * gamma.d1 * R * T / p * 1E-3;
+	out->rho = 1 / out->v;
+	out->u = (tau * gamma.d2 - pi * gamma.d1) * R * T;
+	out->s = (tau * gamma.d2 - gamma.val) * R;
+	out->h = tau * gamma.d2 * R * T;
+	out->cp = -pow2(tau) * gamma.d22 * R;
+	out->cv = (-pow2(tau) * gamma.d22 -
+		(
+			cvsubexpr
+			/ (1 - pow2(pi) * gammar->d11)
+		)
+		) * R;
+	out->w = sqrt(
+			(1 + pi * gammar->d1 * (2 + pi * gammar->d1)) /
+			(
+				(1 - pow2(pi) * gammar->d11) +
+				(
+					cvsubexpr
+					/ pow2(tau) / gamma.d22
+				)
+			)
+			* R * T * 1E3);
+}
+
+void h2o_region2_props_pT(double p, double T, struct h2o_props* out)
+{
+	double pi = p;
+	double tau = Tstar / T;
+
+	struct twoarg_derivs gammao, gammar;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	h2o_region2_props_from_gamma(p, T, pi, tau, &gammao, &gammar, out);
+}
+
+/* props plus the first derivatives of v, for the Newton solvers */
+void h2o_region2_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT)
+{
+	double pi = p;
+	double tau = Tstar / T;
+
+	struct twoarg_derivs gammao, gammar;
+
+	h2o_region2_gammao_derivs(pi, tau, &gammao);
+	h2o_region2_gammar_derivs(pi, tau, &gammar);
+	h2o_region2_props_from_gamma(p, T, pi, tau, &gammao, &gammar, out);
+
+	*dvdp = (gammao.d11 + gammar.d11) * R * T * 1E-3;
+	*dvdT = (gammao.d1 + gammar.d1
+			- tau * (gammao.d12 + gammar.d12)) * R * 1E-3;
+}
+
+static XMATH_ALWAYS_INLINE void h2o_region2_props_pT_n_impl(
+		size_t count, const double p[],
+		const double T[], struct h2o_props* out)
+{
+	double x2[XMATH_BLOCK], lnpi[XMATH_BLOCK];
+	struct twoarg_derivs gammar[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			x2[i] = Tstar / T[i] - 0.5;
+			lnpi[i] = p[i];
+		}
+		/* pad the block, so that the log loop can be vectorized */
+		for (; i < XMATH_BLOCK; ++i)
+			lnpi[i] = 1;
+		for (i = 0; i < XMATH_BLOCK; ++i)
+			lnpi[i] = xmath_log(lnpi[i]);
+
+		TWOARG_POLY_DERIVS_N(region2, block, p, x2,
+				I, Ipows, 0, 18,
+				J, Jpows, 0, 27,
+				n, 43, gammar);
+
+		for (i = 0; i < block; ++i)
+		{
+			double tau = Tstar / T[i];
+			struct twoarg_derivs gammao;
+
+			h2o_region2_gammao_derivs_lnpi(p[i], lnpi[i], tau,
+					&gammao);
+			h2o_region2_props_from_gamma(p[i], T[i], p[i], tau,
+					&gammao, &gammar[i], &out[i]);
+		}
+
+		p += block;
+		T += block;
+		out += block;
+		count -= block;
+	}
+}
+
+XMATH_DISPATCH_VOID(h2o_region2_props_pT_n,
+		(size_t count, const double p[],
+		const double T[], struct h2o_props* out),
+		(count, p, T, out))
+
+static XMATH_ALWAYS_INLINE void h2o_region2_h_pT_n_impl(
+		size_t count, const double p[],
+		const double T[], double h[])
+{
+	double x2[XMATH_BLOCK], gammatau[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+			x2[i] = Tstar / T[i] - 0.5;
+
+		TWOARG_POLY_VALUE_N(region2, block, p, x2,
+				I, Ipows, 0, 18, 0,
+				J, Jpows, 0, 27, 1,
+				n, 43, gammatau);
+
+		for (i = 0; i < block; ++i)
+		{
+			double tau = Tstar / T[i];
+
+			gammatau[i] += h2o_region2_gammao_pitau(p[i], tau, 0, 1);
+			h[i] = tau * gammatau[i] * R * T[i];
+		}
+
+		p += block;
+		T += block;
+		h += block;
+		count -= block;
+	}
+}
+
+XMATH_DISPATCH_VOID(h2o_region2_h_pT_n,
+		(size_t count, const double p[],
+		const double T[], double h[]),
+		(count, p, T, h))
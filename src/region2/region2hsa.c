@@ -10,6 +10,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2hsa.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Pressure as a Function
  * of Enthalpy and Entropy p(h,s) to the IAPWS Industrial Formulation 1997
  * for the Thermodynamic Properties of Water and Steam;
@@ -76,7 +80,7 @@ double h2o_region2a_p_hs(double h, double s)
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	double sum = twoarg_poly_value(eta - 0.5, sigma - 1.2,
+	double sum = TWOARG_POLY_VALUE(region2hsa, eta - 0.5, sigma - 1.2,
 			I, Ipows, 0, 8, 0,
 			J, Jpows, 0, 10, 0,
 			n, 29);
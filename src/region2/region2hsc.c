@@ -10,6 +10,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2hsc.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Pressure as a Function
  * of Enthalpy and Entropy p(h,s) to the IAPWS Industrial Formulation 1997
  * for the Thermodynamic Properties of Water and Steam;
@@ -79,7 +83,7 @@ double h2o_region2c_p_hs(double h, double s)
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	double sum = twoarg_poly_value(eta - 0.7, sigma - 1.1,
+	double sum = TWOARG_POLY_VALUE(region2hsc, eta - 0.7, sigma - 1.1,
 			I, Ipows, 0, 10, 0,
 			J, Jpows, 0, 13, 0,
 			n, 31);
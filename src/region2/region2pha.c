@@ -11,6 +11,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2pha.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.1: The Backward Equation T(p, h) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -80,7 +84,7 @@ double h2o_region2a_T_ph(double p, double h)
 {
 	double eta = h / hstar;
 
-	return twoarg_poly_value(p, eta - 2.1,
+	return TWOARG_POLY_VALUE(region2pha, p, eta - 2.1,
 			I, Ipows, 0, 8, 0,
 			J, Jpows, 0, 19, 0,
 			n, 34);
@@ -11,6 +11,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2phb.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.1: The Backward Equation T(p, h) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -83,7 +87,7 @@ double h2o_region2b_T_ph(double p, double h)
 {
 	double eta = h / hstar;
 
-	return twoarg_poly_value(p - 2, eta - 2.6,
+	return TWOARG_POLY_VALUE(region2phb, p - 2, eta - 2.6,
 			I, Ipows, 0, 10, 0,
 			J, Jpows, 0, 10, 0,
 			n, 38);
@@ -11,6 +11,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2phc.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.1: The Backward Equation T(p, h) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -65,7 +69,7 @@ double h2o_region2c_T_ph(double p, double h)
 {
 	double eta = h / hstar;
 
-	return twoarg_poly_value(p + 25, eta - 1.8,
+	return TWOARG_POLY_VALUE(region2phc, p + 25, eta - 1.8,
 			I, Ipows, 5, 9, 0,
 			J, Jpows, 0, 10, 0,
 			n, 23);
@@ -11,6 +11,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2psa.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.2: The Backward Equation T(p, s) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -97,7 +101,7 @@ double h2o_region2a_T_ps(double p, double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(sqrt(sqrt(p)), sigma - 2,
+	return TWOARG_POLY_VALUE(region2psa, sqrt(sqrt(p)), sigma - 2,
 			I, Ipows, 6, 13, 0,
 			J, Jpows, 18, 34, 0,
 			n, 46);
@@ -10,6 +10,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2psb.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.2: The Backward Equation T(p, s) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -70,7 +74,7 @@ double h2o_region2b_T_ps(double p, double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(p, 10 - sigma,
+	return TWOARG_POLY_VALUE(region2psb, p, 10 - sigma,
 			I, Ipows, 6, 12, 0,
 			J, Jpows, 0, 13, 0,
 			n, 44);
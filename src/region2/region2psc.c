@@ -11,6 +11,10 @@
 #include "region2.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region2psc.h"
+#endif
+
 /* Based on IF97-Rev, s. 6.3.2: The Backward Equation T(p, s) ... */
 
 /* coefficient table; n[0] added for convenience */
@@ -80,7 +84,7 @@ double h2o_region2c_T_ps(double p, double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(p, 2 - sigma,
+	return TWOARG_POLY_VALUE(region2psc, p, 2 - sigma,
 			I, Ipows, 2, 10, 0,
 			J, Jpows, 0, 6, 0,
 			n, 30);
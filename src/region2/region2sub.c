@@ -10,11 +10,14 @@
 #include <stdlib.h>
 
 #include "region2.h"
+#include "stats.h"
 
 /* Based on IF97-Rev, s. 6.3: Backward Equations */
 
 enum h2o_region2_subregion h2o_region2_subregion_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_SUBREGION_PH);
+
 	if (p < 4)
 		return H2O_REGION2A;
 	if (p < h2o_region2_b2bc_p_h(h))
@@ -25,6 +28,8 @@ enum h2o_region2_subregion h2o_region2_subregion_ph(double p, double h)
 
 enum h2o_region2_subregion h2o_region2_subregion_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_SUBREGION_PS);
+
 	if (p < 4)
 		return H2O_REGION2A;
 	if (s >= 5.85)
@@ -35,6 +40,8 @@ enum h2o_region2_subregion h2o_region2_subregion_ps(double p, double s)
 
 enum h2o_region2_subregion h2o_region2_subregion_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_SUBREGION_HS);
+
 	if (h < h2o_region2_b2ab_h_s(s))
 		return H2O_REGION2A;
 	if (s >= 5.85)
@@ -57,6 +64,7 @@ static double impossible_happened(double a, double b)
 
 double h2o_region2_T_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_T_PH);
 	twoarg_func_t T_getter;
 
 	switch (h2o_region2_subregion_ph(p, h))
@@ -79,6 +87,7 @@ double h2o_region2_T_ph(double p, double h)
 
 double h2o_region2_T_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_T_PS);
 	twoarg_func_t T_getter;
 
 	switch (h2o_region2_subregion_ps(p, s))
@@ -101,6 +110,7 @@ double h2o_region2_T_ps(double p, double s)
 
 double h2o_region2_p_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION2_P_HS);
 	twoarg_func_t p_getter;
 
 	switch (h2o_region2_subregion_hs(h, s))
@@ -13,6 +13,10 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
+struct h2o_props; /* see h2o.h */
+
 double h2o_region3_p_rhoT(double rho, double T);
 double h2o_region3_u_rhoT(double rho, double T);
 double h2o_region3_s_rhoT(double rho, double T);
@@ -20,6 +24,12 @@ double h2o_region3_h_rhoT(double rho, double T);
 double h2o_region3_cv_rhoT(double rho, double T);
 double h2o_region3_cp_rhoT(double rho, double T);
 double h2o_region3_w_rhoT(double rho, double T);
+void h2o_region3_props_rhoT(double rho, double T,
+		struct h2o_props* out);
+void h2o_region3_props_derivs_rhoT(double rho, double T,
+		struct h2o_props* out, double* dpdrho, double* dpdT);
+void h2o_region3_props_rhoT_n(size_t count, const double rho[],
+		const double T[], struct h2o_props* out);
 
 double h2o_region3_T_ph(double p, double h);
 double h2o_region3_v_ph(double p, double h);
@@ -28,6 +38,8 @@ double h2o_region3_v_ps(double p, double s);
 double h2o_region3_p_hs(double h, double s);
 
 double h2o_region3_v_pT(double p, double T);
+void h2o_region3_v_pT_n(size_t count, const double p[], const double T[],
+		double v[]);
 
 /* special use functions */
 
@@ -81,6 +93,15 @@ enum h2o_region3_subregion_pT
 
 enum h2o_region3_subregion_pT
 	h2o_region3_subregion_pT(double p, double T);
+/* the same without the lookup tables */
+enum h2o_region3_subregion_pT
+	h2o_region3_subregion_pT_exact(double p, double T);
+/* the same, with the box around (p, T) where it does not change */
+enum h2o_region3_subregion_pT
+	h2o_region3_subregion_pT_box(double p, double T, double box[4]);
+
+double h2o_region3_v_pT_subregion(double p, double T,
+		enum h2o_region3_subregion_pT subregion);
 
 double h2o_region3a_v_pT(double p, double T);
 double h2o_region3b_v_pT(double p, double T);
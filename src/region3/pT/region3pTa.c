@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTa.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -70,7 +74,7 @@ double h2o_region3a_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.085, theta - 0.817,
+	return TWOARG_POLY_VALUE(region3pTa, pi - 0.085, theta - 0.817,
 			I, Ipows, 9, 12, 0,
 			J, Jpows, 0, 9, 0,
 			n, 30) * vstar;
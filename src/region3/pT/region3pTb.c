@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTb.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -71,7 +75,7 @@ double h2o_region3b_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.280, theta - 0.779,
+	return TWOARG_POLY_VALUE(region3pTb, pi - 0.280, theta - 0.779,
 			I, Ipows, 9, 14, 0,
 			J, Jpows, 0, 11, 0,
 			n, 32) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTd.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -75,7 +79,7 @@ double h2o_region3d_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.559, theta - 0.939,
+	double sum = TWOARG_POLY_VALUE(region3pTd, pi - 0.559, theta - 0.939,
 			I, Ipows, 9, 12, 0,
 			J, Jpows, 0, 13, 0,
 			n, 38);
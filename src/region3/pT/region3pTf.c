@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTf.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -79,7 +83,7 @@ double h2o_region3f_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(sqrt(pi - 0.587), theta - 0.891,
+	double sum = TWOARG_POLY_VALUE(region3pTf, sqrt(pi - 0.587), theta - 0.891,
 			I, Ipows, 0, 18, 0,
 			J, Jpows, 9, 13, 0,
 			n, 42);
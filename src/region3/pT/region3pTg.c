@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTg.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -76,7 +80,7 @@ double h2o_region3g_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.872, theta - 0.971,
+	double sum = TWOARG_POLY_VALUE(region3pTg, pi - 0.872, theta - 0.971,
 			I, Ipows, 9, 16, 0,
 			J, Jpows, 0, 15, 0,
 			n, 38);
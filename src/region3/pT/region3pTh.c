@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTh.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -70,7 +74,7 @@ double h2o_region3h_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.898, theta - 0.983,
+	double sum = TWOARG_POLY_VALUE(region3pTh, pi - 0.898, theta - 0.983,
 			I, Ipows, 9, 11, 0,
 			J, Jpows, 0, 12, 0,
 			n, 29);
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTj.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -70,7 +74,7 @@ double h2o_region3j_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(sqrt(pi - 0.875), theta - 0.964,
+	double sum = TWOARG_POLY_VALUE(region3pTj, sqrt(pi - 0.875), theta - 0.964,
 			I, Ipows, 0, 15, 0,
 			J, Jpows, 8, 12, 0,
 			n, 29);
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTk.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -73,7 +77,7 @@ double h2o_region3k_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.802, theta - 0.935,
+	return TWOARG_POLY_VALUE(region3pTk, pi - 0.802, theta - 0.935,
 			I, Ipows, 2, 10, 0,
 			J, Jpows, 8, 17, 0,
 			n, 34) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTn.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -76,10 +80,11 @@ double h2o_region3n_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.976, theta - 0.997,
+	double sum = TWOARG_POLY_VALUE(region3pTn, pi - 0.976, theta - 0.997,
 			I, Ipows, 0, 13, 0,
 			J, Jpows, 9, 15, 0,
 			n, 39);
 
-	return exp(sum) * vstar;
+	/* the sum is ln(v/v*), a few units at most */
+	return xmath_exp(sum) * vstar;
 }
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTo.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -64,7 +68,7 @@ double h2o_region3o_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(sqrt(pi - 0.974), theta - 0.996,
+	return TWOARG_POLY_VALUE(region3pTo, sqrt(pi - 0.974), theta - 0.996,
 			I, Ipows, 0, 13, 0,
 			J, Jpows, 7, 9, 0,
 			n, 24) * vstar;
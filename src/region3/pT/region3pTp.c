@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTp.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -67,7 +71,7 @@ double h2o_region3p_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(sqrt(pi - 0.972), theta - 0.997,
+	return TWOARG_POLY_VALUE(region3pTp, sqrt(pi - 0.972), theta - 0.997,
 			I, Ipows, 0, 17, 0,
 			J, Jpows, 9, 12, 0,
 			n, 27) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTr.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -67,7 +71,7 @@ double h2o_region3r_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.874, theta - 0.982,
+	return TWOARG_POLY_VALUE(region3pTr, pi - 0.874, theta - 0.982,
 			I, Ipows, 2, 9, 0,
 			J, Jpows, 9, 17, 0,
 			n, 27) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTt.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -71,7 +75,7 @@ double h2o_region3t_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.803, theta - 1.02,
+	return TWOARG_POLY_VALUE(region3pTt, pi - 0.803, theta - 1.02,
 			I, Ipows, 0, 14, 0,
 			J, Jpows, 0, 18, 0,
 			n, 33) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTu.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -76,7 +80,7 @@ double h2o_region3u_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	return twoarg_poly_value(pi - 0.902, theta - 0.988,
+	return TWOARG_POLY_VALUE(region3pTu, pi - 0.902, theta - 0.988,
 			I, Ipows, 7, 17, 0,
 			J, Jpows, 9, 20, 0,
 			n, 38) * vstar;
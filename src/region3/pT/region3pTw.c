@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTw.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -74,7 +78,7 @@ double h2o_region3w_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.959, theta - 0.995,
+	double sum = TWOARG_POLY_VALUE(region3pTw, pi - 0.959, theta - 0.995,
 			I, Ipows, 9, 16, 0,
 			J, Jpows, 8, 15, 0,
 			n, 35);
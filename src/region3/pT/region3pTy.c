@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTy.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -62,7 +66,7 @@ double h2o_region3y_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.996, theta - 0.994,
+	double sum = TWOARG_POLY_VALUE(region3pTy, pi - 0.996, theta - 0.994,
 			I, Ipows, 0, 9, 0,
 			J, Jpows, 7, 13, 0,
 			n, 20);
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3pTz.h"
+#endif
+
 /* Supplementary Release on Backward Equations for Specific Volume
  * as a Function of Pressure and Temperature v(p,T)
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
@@ -64,7 +68,7 @@ double h2o_region3z_v_pT(double p, double T)
 	double pi = p / pstar;
 	double theta = T / Tstar;
 
-	double sum = twoarg_poly_value(pi - 0.993, theta - 0.994,
+	double sum = TWOARG_POLY_VALUE(region3pTz, pi - 0.993, theta - 0.994,
 			I, Ipows, 7, 13, 0,
 			J, Jpows, 6, 13, 0,
 			n, 23);
@@ -0,0 +1,2440 @@
+/* generated by h2o-region3tabgen, do not edit */
+
+#define PTTAB_SEGMENTS 13
+
+/* pmax, pmin, pstep, first bin, bin count */
+static const struct pTtab_segment pTtab_segments[PTTAB_SEGMENTS] = {
+	{ 0x1.9p+6, 0x1.4p+5, 0x1p+0, 0, 60 },
+	{ 0x1.4p+5, 0x1.9p+4, 0x1p-2, 60, 60 },
+	{ 0x1.9p+4, 0x1.78p+4, 0x1.47ae147ae147bp-6, 120, 75 },
+	{ 0x1.78p+4, 0x1.7p+4, 0x1.47ae147ae147bp-6, 195, 25 },
+	{ 0x1.7p+4, 0x1.68p+4, 0x1.47ae147ae147bp-6, 220, 25 },
+	{ 0x1.68p+4, 0x1.61c28f5c28f5cp+4, 0x1.3f7ced9168733p-6, 245, 20 },
+	{ 0x1.61c28f5c28f5cp+4, 0x1.610624dd2f1aap+4, 0x1.78d4fdf3b64p-7, 265, 4 },
+	{ 0x1.610624dd2f1aap+4, 0x1.5ee7e5aa3e578p+4, 0x1.0f1f9978619p-6, 269, 8 },
+	{ 0x1.5ee7e5aa3e578p+4, 0x1.5e6a57cfcaae1p+4, 0x1.f63769cea5cp-8, 277, 4 },
+	{ 0x1.5e6a57cfcaae1p+4, 0x1.50b1a1eab9007p+4, 0x1.46c3866ccea9bp-6, 281, 43 },
+	{ 0x1.50b1a1eab9007p+4, 0x1.48p+4, 0x1.49b92c415565fp-6, 324, 27 },
+	{ 0x1.48p+4, 0x1.302417f02d60dp+4, 0x1.97319aa7a4366p-5, 351, 30 },
+	{ 0x1.302417f02d60dp+4, 0x1.087774ed37b26p+4, 0x1.9643f5e0de048p-5, 381, 50 }
+};
+
+/* the first cut for each bin, or -1 if the boundaries change within it */
+static const int pTtab_bins[431] = {
+	0,
+	2,
+	4,
+	6,
+	8,
+	10,
+	12,
+	14,
+	16,
+	18,
+	20,
+	22,
+	24,
+	26,
+	28,
+	30,
+	32,
+	34,
+	36,
+	38,
+	40,
+	42,
+	44,
+	46,
+	48,
+	50,
+	52,
+	54,
+	56,
+	58,
+	60,
+	62,
+	64,
+	66,
+	68,
+	70,
+	72,
+	74,
+	76,
+	78,
+	80,
+	82,
+	84,
+	86,
+	88,
+	90,
+	92,
+	94,
+	96,
+	98,
+	100,
+	102,
+	104,
+	106,
+	108,
+	110,
+	112,
+	114,
+	116,
+	118,
+	120,
+	124,
+	128,
+	132,
+	136,
+	140,
+	144,
+	148,
+	152,
+	156,
+	160,
+	164,
+	168,
+	172,
+	176,
+	180,
+	184,
+	188,
+	192,
+	196,
+	200,
+	204,
+	208,
+	212,
+	216,
+	220,
+	224,
+	228,
+	232,
+	236,
+	240,
+	244,
+	248,
+	252,
+	256,
+	260,
+	264,
+	268,
+	272,
+	276,
+	280,
+	284,
+	288,
+	292,
+	296,
+	300,
+	304,
+	308,
+	312,
+	316,
+	320,
+	324,
+	328,
+	332,
+	336,
+	340,
+	344,
+	348,
+	352,
+	356,
+	360,
+	366,
+	372,
+	378,
+	384,
+	390,
+	396,
+	402,
+	408,
+	414,
+	420,
+	426,
+	432,
+	438,
+	444,
+	450,
+	456,
+	462,
+	468,
+	474,
+	480,
+	486,
+	492,
+	498,
+	504,
+	510,
+	516,
+	522,
+	528,
+	534,
+	540,
+	546,
+	552,
+	558,
+	564,
+	570,
+	576,
+	582,
+	588,
+	594,
+	600,
+	606,
+	612,
+	618,
+	624,
+	630,
+	636,
+	642,
+	648,
+	654,
+	660,
+	666,
+	672,
+	678,
+	684,
+	690,
+	696,
+	702,
+	708,
+	714,
+	720,
+	726,
+	732,
+	738,
+	744,
+	750,
+	756,
+	762,
+	768,
+	774,
+	780,
+	786,
+	792,
+	798,
+	804,
+	810,
+	816,
+	822,
+	828,
+	834,
+	840,
+	846,
+	852,
+	858,
+	864,
+	870,
+	876,
+	882,
+	888,
+	894,
+	900,
+	906,
+	912,
+	918,
+	924,
+	930,
+	936,
+	942,
+	948,
+	954,
+	960,
+	968,
+	976,
+	984,
+	992,
+	1000,
+	1008,
+	1016,
+	1024,
+	1032,
+	1040,
+	1048,
+	1056,
+	1064,
+	1072,
+	1080,
+	1088,
+	1096,
+	1104,
+	1112,
+	1120,
+	1128,
+	1136,
+	1144,
+	1152,
+	1160,
+	1168,
+	1176,
+	1184,
+	1192,
+	1200,
+	1208,
+	1216,
+	1224,
+	1232,
+	1240,
+	1248,
+	1256,
+	1264,
+	1272,
+	1280,
+	1288,
+	1296,
+	1304,
+	1312,
+	1320,
+	1328,
+	1336,
+	1344,
+	1352,
+	1360,
+	1368,
+	1376,
+	1384,
+	1392,
+	1400,
+	1408,
+	-1,
+	1416,
+	1423,
+	1430,
+	-1,
+	1437,
+	1443,
+	1449,
+	1455,
+	1461,
+	1467,
+	1473,
+	1479,
+	1485,
+	1491,
+	1497,
+	1503,
+	1509,
+	1515,
+	1521,
+	1527,
+	1533,
+	1539,
+	1545,
+	1551,
+	1557,
+	1563,
+	1569,
+	1575,
+	1581,
+	1587,
+	1593,
+	1599,
+	1605,
+	1611,
+	1617,
+	1623,
+	1629,
+	1635,
+	1641,
+	1647,
+	1653,
+	1659,
+	1665,
+	1671,
+	1677,
+	1683,
+	-1,
+	1689,
+	1693,
+	1697,
+	1701,
+	1705,
+	1709,
+	1713,
+	1717,
+	1721,
+	1725,
+	1729,
+	1733,
+	1737,
+	1741,
+	1745,
+	1749,
+	1753,
+	1757,
+	1761,
+	1765,
+	1769,
+	1773,
+	1777,
+	1781,
+	1785,
+	1789,
+	1793,
+	1796,
+	1799,
+	1802,
+	1805,
+	1808,
+	1811,
+	1814,
+	1817,
+	1820,
+	1823,
+	1826,
+	1829,
+	1832,
+	1835,
+	1838,
+	1841,
+	1844,
+	1847,
+	1850,
+	1853,
+	1856,
+	1859,
+	1862,
+	1865,
+	1868,
+	1871,
+	1874,
+	1877,
+	1880,
+	-1,
+	1883,
+	1885,
+	1887,
+	1889,
+	1891,
+	1893,
+	1895,
+	1897,
+	1899,
+	1901,
+	1903,
+	1905,
+	1907,
+	1909,
+	1911,
+	1913,
+	1915,
+	1917,
+	1919,
+	1921,
+	1923,
+	1925,
+	1927,
+	1929,
+	1931,
+	1933,
+	1935,
+	1937,
+	1939,
+	1941,
+	1943,
+	1945,
+	1947,
+	1949,
+	1951,
+	1953,
+	1955,
+	1957,
+	1959,
+	1961,
+	1963,
+	1965,
+	1967,
+	1969,
+	1971,
+	1973,
+	1975,
+	1977,
+	1979
+};
+
+/* T = T0 + dTdp * (p - pbin) within Terr, the subregion below */
+static const struct pTtab_cut pTtab_cuts[1981] = {
+	{ 0x1.5a845eba094e8p+9, 0x1.d38e39d1e4p+0, 0x1.83e705d6217dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5b6e25d6f2408p+9, 0x1.c7c909d0d98p+0, 0x1.6da40fa4417dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5c520a5bdaad4p+9, 0x1.bcae62eb2fap+0, 0x1.593df194c17dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5d30618d50451p+9, 0x1.b2302d3d844p+0, 0x1.4681d4c5217dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5e0979a3ef073p+9, 0x1.a841cd26f1cp+0, 0x1.35435e1c617dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5edd9a8a82801p+9, 0x1.9ed7f351298p+0, 0x1.255bba44417dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.5fad06842b14dp+9, 0x1.95e873b326p+0, 0x1.16a8d202c17dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6077fabe04a7dp+9, 0x1.8d6a2269ebep+0, 0x1.090c9f8ae17dp-7, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.613eafcf399dcp+9, 0x1.8554b577cbap+0, 0x1.f8d93dc242fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.62015a29f5839p+9, 0x1.7da0aaa51d6p+0, 0x1.e162a92602fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.62c02a7f48124p+9, 0x1.764730df9bap+0, 0x1.cb8bcdcd42fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.637b4e17b7e01p+9, 0x1.6f42149167ap+0, 0x1.b72f8cd1c2fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6432ef220093ep+9, 0x1.688bae7f2dap+0, 0x1.a42cc69942fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.64e734f9402abp+9, 0x1.621ed4cf81p+0, 0x1.9265db0582fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.65984463a7eb3p+9, 0x1.5bf6cdec824p+0, 0x1.81c03bb782fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.66463fca9e2c5p+9, 0x1.560f44fd7d2p+0, 0x1.72240d8282fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.66f1476d1ceaep+9, 0x1.50643fc0664p+0, 0x1.637bd6c3c2fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6799798cfd1ep+9, 0x1.4af21593b68p+0, 0x1.55b438a102fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.683ef297c6f94p+9, 0x1.45b5678849cp+0, 0x1.48bbb19a82fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.68e1cd4b8b1e2p+9, 0x1.40ab1958cc8p+0, 0x1.3c82680c02fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.698222d837846p+9, 0x1.3bd04b2951ap+0, 0x1.30f9fb73c2fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6a200afdcc2d3p+9, 0x1.372253f5cc4p+0, 0x1.26155b9b02fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6abb9c27c7135p+9, 0x1.329ebc99c52p+0, 0x1.1bc8a4bc02fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6b54eb8613f5ep+9, 0x1.2e433b5e94p+0, 0x1.1209000482fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6bec0d23c33fep+9, 0x1.2a0daffff7cp+0, 0x1.08cc87d282fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6c8113fbc33bcp+9, 0x1.25fc20190aap+0, 0x1.000a2f39c2fa1p-8, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6d14120bcfc11p+9, 0x1.220cb3ed792p+0, 0x1.ef7358a585f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6da51865c67dap+9, 0x1.1e3db384524p+0, 0x1.dfa6ca1c85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6e34373f88a6cp+9, 0x1.1a8d840b562p+0, 0x1.d0a0bc4905f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6ec17e018e51dp+9, 0x1.16faa57a9acp+0, 0x1.c25457cd85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6f4cfb544b9f3p+9, 0x1.1383b07184ap+0, 0x1.b4b5c98685f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.6fd6bd2c84618p+9, 0x1.10275446e4cp+0, 0x1.a7ba2a5605f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.705ed0d6a7d3ep+9, 0x1.0ce45546bbcp+0, 0x1.9b57699a85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.70e543014b31cp+9, 0x1.09b98b18e9cp+0, 0x1.8f8439ce05f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.716a1fc6d7a6ap+9, 0x1.06a5df4c784p+0, 0x1.8437ff3c05f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.71ed72b67de2cp+9, 0x1.03a84c03dbap+0, 0x1.796ac05e05f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.726f46dc7fd09p+9, 0x1.00bfdabeb72p+0, 0x1.6f1517d885f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.72efa6c9df2c2p+9, 0x1.fbd7467cb8cp-1, 0x1.653027dd85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.736e9c9b7e5a5p+9, 0x1.f6559504818p-1, 0x1.5bb58ebb05f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.73ec3200bf7abp+9, 0x1.f0f903b4668p-1, 0x1.529f5c9005f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.74687041ac945p+9, 0x1.ebc00c185e8p-1, 0x1.49e809f605f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.74e36044b2abfp+9, 0x1.e6a93d17e5p-1, 0x1.418a6f8d85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.755d0a93f8a53p+9, 0x1.e1b33985798p-1, 0x1.3981be4d05f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.75d577625a039p+9, 0x1.dcdcb6cb484p-1, 0x1.31c9788f85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.764cae900cd5ap+9, 0x1.d8247bb28d8p-1, 0x1.2a5d6bb405f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.76c2b7aef979p+9, 0x1.d3895f43138p-1, 0x1.2339aa5f85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.77379a06ca3dep+9, 0x1.cf0a47b8dfcp-1, 0x1.1c5a873385f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.77ab5c98b875dp+9, 0x1.caa6298df14p-1, 0x1.15bc8ffe85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.781e06231bf22p+9, 0x1.c65c0696634p-1, 0x1.0f5c895905f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.788f9d24c18afp+9, 0x1.c22aed2d70cp-1, 0x1.09376aa305f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.790027e00ce72p+9, 0x1.be11f771cbp-1, 0x1.034a5a4f85f41p-9, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.796fac5de959ep+9, 0x1.ba104a9018p-1, 0x1.fb2555150be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.79de30708d5fep+9, 0x1.b625161a598p-1, 0x1.f01bac350be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7a4bb9b613f64p+9, 0x1.b24f936b3a4p-1, 0x1.e572fb1c0be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7ab84d9aeec4dp+9, 0x1.ae8f0514458p-1, 0x1.db26c92d0be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7b23f15c33d63p+9, 0x1.aae2b65627p-1, 0x1.d132df4e0be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7b8eaa09c95ffp+9, 0x1.a749faa2308p-1, 0x1.c793436b0be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7bf87c8871ec1p+9, 0x1.a3c42d24614p-1, 0x1.be4434690be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7c616d93bb046p+9, 0x1.a050b0554d8p-1, 0x1.b54226600be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.7cc981bfd057cp+9, 0x1.9ceeed9348cp-1, 0x1.ac89bf0b0be82p-10, H2O_REGION3A_PT },
+	{ INFINITY, 0, 0, H2O_REGION3B_PT },
+	{ 0x1.44aed67e6b751p+9, 0x1.38d5c358ddp+1, 0x1.825bfc02fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.489d5e2172f3fp+9, 0x1.95667ff4a9cp+1, 0x1.45f4fea185f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4905421522c6p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.44fd0bef41ac5p+9, 0x1.38caaad5becp+1, 0x1.43cfc442fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4902b7c1701e6p+9, 0x1.905f8d4ce8p+1, 0x1.3d8e729785f41p-9, H2O_REGION3D_PT },
+	{ 0x1.497c8cf0eb50ap+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.454b3e99f71cp+9, 0x1.38c186c76b8p+1, 0x1.0550cec2fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4966cfa4c3586p+9, 0x1.8b7996e652cp+1, 0x1.3576669685f41p-9, H2O_REGION3D_PT },
+	{ 0x1.49f3d7ccb3db3p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.45996efba8f6ep+9, 0x1.38ba572de24p+1, 0x1.8da3b205f4137p-17, H2O_REGION3C_PT },
+	{ 0x1.49c9ae0a7ced1p+9, 0x1.86b36a0fd2p+1, 0x1.2da939bc85f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4a6b22a87c65cp+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.45e79d91746f7p+9, 0x1.38b51c0924p+1, 0x1.10a5c685f4137p-17, H2O_REGION3C_PT },
+	{ 0x1.4a2b5ae500e19p+9, 0x1.820be23400cp+1, 0x1.26237ea785f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4ae26d8444f06p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4635cad876b87p+9, 0x1.38b1d5593p+1, 0x1.27be650be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.4a8bdddd8de1cp+9, 0x1.7d81e811e98p+1, 0x1.1ee1f81a85f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4b59b8600d7afp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4683f74dcd047p+9, 0x1.38b0831e06cp+1, 0x1.9c40a85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4aeb3e57925c2p+9, 0x1.79147102964p+1, 0x1.17e195f685f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4bd1033bd6058p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.46d2236e94862p+9, 0x1.38b12557a84p+1, 0x1.a0b69817d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.4b498373d301bp+9, 0x1.74c27e4a608p+1, 0x1.111f725885f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4c484e179e902p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.47204fb7ea703p+9, 0x1.38b3bc0614p+1, 0x1.c960c90be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.4ba6b4136599dp+9, 0x1.708b1c75488p+1, 0x1.0a98cf0005f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4cbf98f3671abp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.476e7ca6ebf53p+9, 0x1.38b847294a8p+1, 0x1.61ae5005f4137p-17, H2O_REGION3C_PT },
+	{ 0x1.4c02d6da82ebfp+9, 0x1.6c6d62bd6f4p+1, 0x1.044b12d105f41p-9, H2O_REGION3D_PT },
+	{ 0x1.4d36e3cf2fa54p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.47bcaab8b647dp+9, 0x1.38bec6c14bcp+1, 0x1.deac3b85f4137p-17, H2O_REGION3C_PT },
+	{ 0x1.4c5df2333247cp+9, 0x1.6868727b164p+1, 0x1.fc678f230be82p-10, H2O_REGION3D_PT },
+	{ 0x1.4dae2eaaf82fep+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.480ada6a669acp+9, 0x1.38c73ace17p+1, 0x1.2dd51342fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4cb80c4fd10d5p+9, 0x1.647b769d6p+1, 0x1.f0a12f900be82p-10, H2O_REGION3D_PT },
+	{ 0x1.4e257986c0ba7p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.48590c391a208p+9, 0x1.38d1a34fad4p+1, 0x1.6c5bcac2fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4d112b2d78655p+9, 0x1.60a5a32b518p+1, 0x1.e53e99830be82p-10, H2O_REGION3D_PT },
+	{ 0x1.4e9cc4628945p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.48a740a1ee0bdp+9, 0x1.38de00460e4p+1, 0x1.aaea6442fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4d6954964339bp+9, 0x1.5ce634cc64cp+1, 0x1.da3b99760be82p-10, H2O_REGION3D_PT },
+	{ 0x1.4f140f3e51cfap+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.48f57821ff8f6p+9, 0x1.38ec51b1394p+1, 0x1.e978fd82fa09bp-16, H2O_REGION3C_PT },
+	{ 0x1.4dc08e237652ep+9, 0x1.593c70584a4p+1, 0x1.cf9432550be82p-10, H2O_REGION3D_PT },
+	{ 0x1.4f8b5a1a1a5a3p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4943b3366bddbp+9, 0x1.38fc97912f8p+1, 0x1.1403cb817d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4e16dd3f8c657p+9, 0x1.55a7a26d4p+1, 0x1.c5449a430be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5002a4f5e2e4cp+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4991f25c50299p+9, 0x1.390ed1e5efcp+1, 0x1.334b18217d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4e6c472827b57p+9, 0x1.52271f0c97p+1, 0x1.bb4937a50be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5079efd1ab6f6p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.49e03610c9a58p+9, 0x1.392300af7acp+1, 0x1.529264e17d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4ec0d0efeadb3p+9, 0x1.4eba413d0ccp+1, 0x1.b19e9e5c0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.50f13aad73f9fp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4a2e7ed0f5843p+9, 0x1.393923edd08p+1, 0x1.71d9b1817d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4f147f803a1e6p+9, 0x1.4b606ab27ap+1, 0x1.a8418d1a0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.516885893c848p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4a7ccd19f0f85p+9, 0x1.39513ba0f08p+1, 0x1.9120fe217d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4f67579ae6bcep+9, 0x1.4819037a98p+1, 0x1.9f2eeb000be82p-10, H2O_REGION3D_PT },
+	{ 0x1.51dfd065050f1p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4acb2168d9347p+9, 0x1.396b47c8db4p+1, 0x1.b0684ae17d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.4fb95ddbc562ep+9, 0x1.44e379ae74cp+1, 0x1.9663c54f0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.52571b40cd99bp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4b197c3acb6b4p+9, 0x1.3987486590cp+1, 0x1.cfaf97817d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.500a96ba31001p+9, 0x1.41bf4128564p+1, 0x1.8ddd4d4d0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.52ce661c96244p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4b67de0ce4cf7p+9, 0x1.39a53d77108p+1, 0x1.eef6e4017d04ep-15, H2O_REGION3C_PT },
+	{ 0x1.505b068a7b15ap+9, 0x1.3eabd33dbdcp+1, 0x1.8598d63f0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5345b0f85eaedp+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4bb6475c42939p+9, 0x1.39c526fd5bp+1, 0x1.071f1860be827p-14, H2O_REGION3C_PT },
+	{ 0x1.50aab17f4a851p+9, 0x1.3ba8ae7d47cp+1, 0x1.7d93d3890be82p-10, H2O_REGION3D_PT },
+	{ 0x1.53bcfbd427397p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4c04b8a601ea5p+9, 0x1.39e704f8704p+1, 0x1.16c2bec0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.50f99baae9d7p+9, 0x1.38b556702bp+1, 0x1.75cbd6f20be82p-10, H2O_REGION3D_PT },
+	{ 0x1.543446afefc4p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4c53326740066p+9, 0x1.3a0ad7684f8p+1, 0x1.26666500be827p-14, H2O_REGION3C_PT },
+	{ 0x1.5147c90085e1cp+9, 0x1.35d1535f254p+1, 0x1.6e3e8eff0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.54ab918bb84e9p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4ca1b51d1a1a4p+9, 0x1.3a309e4cfap+1, 0x1.360a0b60be827p-14, H2O_REGION3C_PT },
+	{ 0x1.51953d555dab1p+9, 0x1.32fc321a8d8p+1, 0x1.66e9c55e0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5522dc6780d93p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4cf04144ad58cp+9, 0x1.3a5859a66e8p+1, 0x1.45adb1b0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.51e1fc61e44e7p+9, 0x1.303583c56e4p+1, 0x1.5fcb5d810be82p-10, H2O_REGION3D_PT },
+	{ 0x1.559a27434963cp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4d3ed75b16f46p+9, 0x1.3a820974aep+1, 0x1.55515800be827p-14, H2O_REGION3C_PT },
+	{ 0x1.522e09c2d5aap+9, 0x1.2d7cdda36b8p+1, 0x1.58e153380be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5611721f11ee5p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4d8d77dd741fep+9, 0x1.3aadadb7b8p+1, 0x1.64f4fe60be827p-14, H2O_REGION3C_PT },
+	{ 0x1.527968fa3e84ep+9, 0x1.2ad1d8e94ap+1, 0x1.5229b9620be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5688bcfada78fp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4ddc2348e20dep+9, 0x1.3adb466f8c4p+1, 0x1.7498a4a0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.52c41d7078d76p+9, 0x1.2834128ff84p+1, 0x1.4ba2b8d20be82p-10, H2O_REGION3D_PT },
+	{ 0x1.570007d6a3038p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4e2ada1a7df0fp+9, 0x1.3b0ad39c2b8p+1, 0x1.843c4b00be827p-14, H2O_REGION3C_PT },
+	{ 0x1.530e2a751cd57p+9, 0x1.25a32b29ed4p+1, 0x1.454a8f100be82p-10, H2O_REGION3D_PT },
+	{ 0x1.577752b26b8e1p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4e799ccf64fbdp+9, 0x1.3b3c553d95p+1, 0x1.93dff160be827p-14, H2O_REGION3C_PT },
+	{ 0x1.5357933fe750cp+9, 0x1.231ec6baad4p+1, 0x1.3f1f8d5e0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.57ee9d8e3418bp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4ec86be4b4611p+9, 0x1.3b6fcb53c9p+1, 0x1.a38397b0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.53a05af195fc1p+9, 0x1.20a68c90768p+1, 0x1.392017a70be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5865e869fca34p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4f1747d789535p+9, 0x1.3ba535dec8p+1, 0x1.b3273e00be827p-14, H2O_REGION3C_PT },
+	{ 0x1.53e88494ba19bp+9, 0x1.1e3a271fcb8p+1, 0x1.334aa39b0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.58dd3345c52ddp+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4f66312501055p+9, 0x1.3bdc94de914p+1, 0x1.c2cae450be827p-14, H2O_REGION3C_PT },
+	{ 0x1.5430131e820c9p+9, 0x1.1bd943e0decp+1, 0x1.2d9db7c10be82p-10, H2O_REGION3D_PT },
+	{ 0x1.59547e218db87p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.4fb5284a38a9ap+9, 0x1.3c15e853254p+1, 0x1.d26e8aa0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.5477096f7a444p+9, 0x1.1983932eb4p+1, 0x1.2817ea9f0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.59cbc8fd5643p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.50042dc44d72fp+9, 0x1.3c51303c83cp+1, 0x1.e21230f0be827p-14, H2O_REGION3C_PT },
+	{ 0x1.54bd6a5445f14p+9, 0x1.1738c827ecp+1, 0x1.22b7e2020be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5a4313d91ecd9p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.505342105c93ep+9, 0x1.3c8e6c9aaccp+1, 0x1.f1b5d760be827p-14, H2O_REGION3C_PT },
+	{ 0x1.550338864fec4p+9, 0x1.14f898910e8p+1, 0x1.1d7c521e0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5aba5eb4e7583p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.50a265ab833f1p+9, 0x1.3ccd9d6da04p+1, 0x1.00acbed85f413p-13, H2O_REGION3C_PT },
+	{ 0x1.554876ac742fep+9, 0x1.12c2bcb84ccp+1, 0x1.1863fcfa0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5b31a990afe2cp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.50f19912dea72p+9, 0x1.3d0ec2b55e8p+1, 0x1.087e92005f413p-13, H2O_REGION3C_PT },
+	{ 0x1.558d275ba2431p+9, 0x1.1096ef5aacp+1, 0x1.136db1ad0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5ba8f46c786d5p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.5140dcc38bfecp+9, 0x1.3d51dc71e74p+1, 0x1.105065205f413p-13, H2O_REGION3C_PT },
+	{ 0x1.55d14d1778ee1p+9, 0x1.0e74ed8a6bcp+1, 0x1.0e984bcc0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5c203f4840f7fp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.5190313aa8789p+9, 0x1.3d96eaa33acp+1, 0x1.182238505f413p-13, H2O_REGION3C_PT },
+	{ 0x1.5614ea52db89p+9, 0x1.0c5c7696b3cp+1, 0x1.09e2b2ca0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5c978a2409828p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.51df96f551474p+9, 0x1.3ddded49588p+1, 0x1.1ff40b805f413p-13, H2O_REGION3C_PT },
+	{ 0x1.565801708135fp+9, 0x1.0a4d4bf462p+1, 0x1.054bd96e0be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5d0ed4ffd20d1p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.522f0e70a39d6p+9, 0x1.3e26e46441p+1, 0x1.27c5dea85f413p-13, H2O_REGION3C_PT },
+	{ 0x1.569a94c37e4e7p+9, 0x1.08473127f68p+1, 0x1.00d2bd400be82p-10, H2O_REGION3D_PT },
+	{ 0x1.5d861fdb9a97bp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.527e9829bcadap+9, 0x1.3e71cff3f4p+1, 0x1.2f97b1d05f413p-13, H2O_REGION3C_PT },
+	{ 0x1.56dca68fc84c1p+9, 0x1.0649ebb082p+1, 0x1.f8eccc2217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.5dfd6ab763224p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.52ce349db9aaap+9, 0x1.3ebeaff871cp+1, 0x1.376985005f413p-13, H2O_REGION3C_PT },
+	{ 0x1.571e390ab46c9p+9, 0x1.045542f3964p+1, 0x1.f06bcb0217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.5e74b5932bacdp+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.531de449b7c71p+9, 0x1.3f0d8471bap+1, 0x1.3f3b58285f413p-13, H2O_REGION3C_PT },
+	{ 0x1.575f4e5b71522p+9, 0x1.0269002a23cp+1, 0x1.e820ad1217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.5eec006ef4377p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.536da7aad4359p+9, 0x1.3f5e4d5fcccp+1, 0x1.470d2b505f413p-13, H2O_REGION3C_PT },
+	{ 0x1.579fe89b7bdb1p+9, 0x1.0084ee4e304p+1, 0x1.e009ba1217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.5f634b4abcc2p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.53bd7f3e2c28cp+9, 0x1.3fb10ac2aap+1, 0x1.4edefe805f413p-13, H2O_REGION3C_PT },
+	{ 0x1.57e009d70f672p+9, 0x1.fd51b412dc8p+0, 0x1.d8254ad217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.5fda9626854c9p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.540d6b80dcd34p+9, 0x1.4005bc9a51cp+1, 0x1.56b0d1a85f413p-13, H2O_REGION3C_PT },
+	{ 0x1.581fb40d91c2bp+9, 0x1.f9a923492d8p+0, 0x1.d071c85c17d05p-11, H2O_REGION3D_PT },
+	{ 0x1.6051e1024dd73p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.545d6cf00367bp+9, 0x1.405c62e6c48p+1, 0x1.5e82a4d05f413p-13, H2O_REGION3C_PT },
+	{ 0x1.585ee931fae86p+9, 0x1.f60fc9ef0dp+0, 0x1.c8edab4817d05p-11, H2O_REGION3D_PT },
+	{ 0x1.60c92bde1661cp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.54ad8408bd18dp+9, 0x1.40b4fda8018p+1, 0x1.665477f85f413p-13, H2O_REGION3C_PT },
+	{ 0x1.589dab2b38cap+9, 0x1.f2854ab424p+0, 0x1.c1977b0017d05p-11, H2O_REGION3D_PT },
+	{ 0x1.614076b9deec5p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.54fdb14827193p+9, 0x1.410f8cde09p+1, 0x1.6e264b205f413p-13, H2O_REGION3C_PT },
+	{ 0x1.58dbfbd48f4e8p+9, 0x1.ef094b2b02p+0, 0x1.ba6dcd1217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.61b7c195a776fp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.554df52b5e9b7p+9, 0x1.416c1088db4p+1, 0x1.75f81e505f413p-13, H2O_REGION3C_PT },
+	{ 0x1.5919dcfdf4aecp+9, 0x1.eb9b73ad64p+0, 0x1.b36f44aa17d05p-11, H2O_REGION3D_PT },
+	{ 0x1.622f0c7170018p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.559e502f80d24p+9, 0x1.41ca88a8784p+1, 0x1.7dc9f1785f413p-13, H2O_REGION3C_PT },
+	{ 0x1.5957506c6a5b4p+9, 0x1.e83b6f41bb8p+0, 0x1.ac9a91e417d05p-11, H2O_REGION3D_PT },
+	{ 0x1.62a6574d388c1p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.55eec2d1aaf05p+9, 0x1.422af53cdf4p+1, 0x1.859bc4a85f413p-13, H2O_REGION3C_PT },
+	{ 0x1.599457da5292bp+9, 0x1.e4e8eb81cap+0, 0x1.a5ee714217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.631da2290116bp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.563f4d8efa282p+9, 0x1.428d5646118p+1, 0x1.8d6d97d05f413p-13, H2O_REGION3C_PT },
+	{ 0x1.59d0f4f7c2cbfp+9, 0x1.e1a39882608p+0, 0x1.9f69ab2217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.6394ed04c9a14p+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.568ff0e48bac8p+9, 0x1.42f1abc40dcp+1, 0x1.953f6b005f413p-13, H2O_REGION3C_PT },
+	{ 0x1.5a0d296ad318p+9, 0x1.de6b28bc2f8p+0, 0x1.990b133417d05p-11, H2O_REGION3D_PT },
+	{ 0x1.640c37e0922bdp+9, 0x1.dd2b6f222a4p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.56e0ad4f7caffp+9, 0x1.4357f5b6d4cp+1, 0x1.9d113e205f413p-13, H2O_REGION3C_PT },
+	{ 0x1.5a48f6cfea9dfp+9, 0x1.db3f50f5848p+0, 0x1.92d1881217d05p-11, H2O_REGION3D_PT },
+	{ 0x1.648382bc5ab66p+9, 0x1.dd2b6f222a8p+1, 0x1.12f0be826d695p-30, H2O_REGION3E_PT },
+	{ INFINITY, 0, 0, H2O_REGION3F_PT },
+	{ 0x1.42d9403a52b79p+9, 0x1.394c773ad2475p+1, 0x1.44d8b0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45c8f5d0bfb23p+9, 0x1.ace2b84ecc0a1p+1, 0x1.53e2c805f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.463980ee6f868p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46ef09b8fc1b3p+9, 0x1.25ae8ab59a56ep+2, 0x1.d86f1e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.497228eb80c35p+9, 0x1.88f39b27e7a93p+2, 0x1.2953db05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42df8451300dbp+9, 0x1.394a7eefb0275p+1, 0x1.42cbf0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45d189b5b7083p+9, 0x1.ad297e2ba2ea1p+1, 0x1.80940b05f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.46430c0a4220fp+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46fac9063692p+9, 0x1.25ba0d6ef7b6ep+2, 0x1.d6c97417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4981e0be825bfp+9, 0x1.891095941c193p+2, 0x1.2836c305f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42e5c85df7684p+9, 0x1.394889d87a075p+1, 0x1.40bf30be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45da1f0509d32p+9, 0x1.ad78bf3ecf6a1p+1, 0x1.aabc1585f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.464c972614bb7p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.470688c94f7d3p+9, 0x1.25c585e23496ep+2, 0x1.d5257817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.499199ba409a8p+9, 0x1.892d743726393p+2, 0x1.271acd85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42ec0c60b92d4p+9, 0x1.394697f53c675p+1, 0x1.3eb260be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45e2b5ea24ae5p+9, 0x1.adcffcc9812a1p+1, 0x1.d25b1b85f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.46562241e755ep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47124901dda84p+9, 0x1.25d0f419e976ep+2, 0x1.d3833417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49a153dd9ef83p+9, 0x1.894a372d74293p+2, 0x1.25fffb85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42f2505985c2fp+9, 0x1.3944a945f1075p+1, 0x1.3ca5a0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45eb4e8deb456p+9, 0x1.ae2eb7ff22ca1p+1, 0x1.f7718e05f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.465fad5db9f05p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.471e09af784b3p+9, 0x1.25dc5820b9c6ep+2, 0x1.d1e2a017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49b10f2782115p+9, 0x1.8966de9370e94p+2, 0x1.24e64c85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42f894486d8f7p+9, 0x1.3942bdca91a75p+1, 0x1.3a98e0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45f3e916b8071p+9, 0x1.ae94721e152a1p+1, 0x1.0cff2202fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.466938798c8acp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4729cad1b70afp+9, 0x1.25e7b20142b6ep+2, 0x1.d043c017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49c0cb96cfa53p+9, 0x1.89836a858f494p+2, 0x1.23cdc085f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42fed82d80f8cp+9, 0x1.3940d5832ac75p+1, 0x1.388c20be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45fc85a85c782p+9, 0x1.af00ac5eefea2p+1, 0x1.1d00eb42fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4672c3955f253p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47358c6831f92p+9, 0x1.25f301c627b6ep+2, 0x1.cea69417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49d0892a6e967p+9, 0x1.899fdb2037294p+2, 0x1.22b65805f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43051c08d0652p+9, 0x1.393ef06fb6275p+1, 0x1.367f60be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4605246420ed9p+9, 0x1.af72e800076a2p+1, 0x1.2bbe64c2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.467c4eb131bfap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47414e7281945p+9, 0x1.25fe477a0466ep+2, 0x1.cd0b1c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49e047e146ea9p+9, 0x1.89bc307fd9c94p+2, 0x1.21a01285f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.430b5fda6c3abp+9, 0x1.393d0e9033c75p+1, 0x1.347290be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.460dc568c4c4cp+9, 0x1.afeaa634c96a2p+1, 0x1.39374a82fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4685d9cd045a1p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.474d10f03ec7bp+9, 0x1.260983277aa6ep+2, 0x1.cb715617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49f007ba41ca5p+9, 0x1.89d86ac0e3b94p+2, 0x1.208aef85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4311a3a264df9p+9, 0x1.393b2fe4a0875p+1, 0x1.3265d0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.461668d27e24fp+9, 0x1.b067683e752a2p+1, 0x1.456b8dc2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.468f64e8d6f49p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4758d3e102eb5p+9, 0x1.2614b4d927a6ep+2, 0x1.c9d94217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49ffc8b449818p+9, 0x1.89f489ffc6394p+2, 0x1.1f76ef85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4317e760cab9dp+9, 0x1.3939546d02a75p+1, 0x1.305900be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.461f0ebafa46p+9, 0x1.b0e8af5101ea2p+1, 0x1.505b4342fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4698f004a98fp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4764974467c3fp+9, 0x1.261fdc99aed6ep+2, 0x1.c842e217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a0f8ace497f3p+9, 0x1.8a108e58e9294p+2, 0x1.1e641385f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.431e2b15ae2fap+9, 0x1.39377c2957075p+1, 0x1.2e4c50be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4627b7395d2c7p+9, 0x1.b16dfcadaeea3p+1, 0x1.5a0667c2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46a27b207c297p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47705b1a07834p+9, 0x1.262afa73ad66ep+2, 0x1.c6ae3417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a1f4e072e555p+9, 0x1.8a2c77e8bdc94p+2, 0x1.1d525a05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43246ec11fa72p+9, 0x1.3935a719a0c75p+1, 0x1.2c3f80be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4630626241ed6p+9, 0x1.b1f6d18ac84a3p+1, 0x1.626d33c2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46ac063c4ec3ep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.477c1f617cc7ap+9, 0x1.26360e71c3a6ep+2, 0x1.c51b3c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a2f125de5b91p+9, 0x1.8a4846cbb2394p+2, 0x1.1c41c405f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.432ab2632f868p+9, 0x1.3933d53dd6875p+1, 0x1.2a32c0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46391047ba72ap+9, 0x1.b282af1f26ca3p+1, 0x1.698f5502fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46b59158215e5p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4787e41a629c4p+9, 0x1.2641189e8ec6ep+2, 0x1.c389f417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a3ed7d15e82cp+9, 0x1.8a63fb1e33094p+2, 0x1.1b325105f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4330f5fbee33cp+9, 0x1.3932069604c75p+1, 0x1.282600be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4641c0f94f8dp+9, 0x1.b31116ad328a3p+1, 0x1.6f6d0742fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46bf1c73f3f8cp+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4793a9445479p+9, 0x1.264c1904b3c6ep+2, 0x1.c1fa6217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a4e9e6088adcp+9, 0x1.8a7f94fcacc94p+2, 0x1.1a240105f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4337398b6c152p+9, 0x1.39303b2222275p+1, 0x1.261930be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.464a748401184p+9, 0x1.b3a18967b9ea3p+1, 0x1.74063702fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46c8a78fc6934p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.479f6edeee42cp+9, 0x1.26570faecb26ep+2, 0x1.c06c8017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a5e660a55588p+9, 0x1.8a9b148390b94p+2, 0x1.1916d485f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.433d7d11b990bp+9, 0x1.392e72e234e75p+1, 0x1.240c80be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46532af245babp+9, 0x1.b433888c8e0a4p+1, 0x1.775a9a82fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46d232ab992dbp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47ab34e9cc4aep+9, 0x1.2661fca77d06ep+2, 0x1.bee05417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a6e2ecdb6c4bp+9, 0x1.8ab679cf49d94p+2, 0x1.180aca85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4343c08ee70cap+9, 0x1.392cadd636c75p+1, 0x1.21ffb0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.465be44c0b19bp+9, 0x1.b4c69558e6ea4p+1, 0x1.796ab182fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46dbbdc76bc82p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47b6fb648b4fep+9, 0x1.266cdff96056ep+2, 0x1.bd55dc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a7df8a9a057p+9, 0x1.8ad1c4fc44b94p+2, 0x1.16ffe405f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.434a040304efp+9, 0x1.392aebfe2e075p+1, 0x1.1ff2f0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4664a096b5d6ap+9, 0x1.b55a3100162a4p+1, 0x1.7a361a02fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46e548e33e629p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47c2c24ec87cbp+9, 0x1.2677b9af1a16ep+2, 0x1.bbcd1217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a8dc39d06973p+9, 0x1.8aecf626f4294p+2, 0x1.15f62085f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4350476e239ep+9, 0x1.39292d5a17875p+1, 0x1.1de620be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.466d5fd5215c3p+9, 0x1.b5eddcc40d2a4p+1, 0x1.79bcf482fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46eed3ff10fdp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47ce89a821694p+9, 0x1.268289d34906ep+2, 0x1.ba45fe17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4a9d8fa6df305p+9, 0x1.8b080d6bc1994p+2, 0x1.14ed8005f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43568ad0537fcp+9, 0x1.392771e9f0275p+1, 0x1.1bd960be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46762207a0294p+9, 0x1.b68119da6c2a4p+1, 0x1.77ff7a02fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.46f85f1ae3977p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47da5170341a4p+9, 0x1.268d50708be6ep+2, 0x1.b8c09e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4aad5cc620f06p+9, 0x1.8b230ae719994p+2, 0x1.13e60285f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.435cce29a4fa5p+9, 0x1.3925b9adc1475p+1, 0x1.19cca0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.467ee72bfb8dfp+9, 0x1.b713697bc48a5p+1, 0x1.74fd5002fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4701ea36b631ep+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47e619a69f012p+9, 0x1.26980d918306ep+2, 0x1.b73cf017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4abd2af9c3c88p+9, 0x1.8b3deeb56ef94p+2, 0x1.12dfa885f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4363117a2873fp+9, 0x1.392404a57e675p+1, 0x1.17bfd0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4687af3d73ca3p+9, 0x1.b7a44ce8deca5p+1, 0x1.70b6b802fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.470b755288cc6p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47f1e24b00fc2p+9, 0x1.26a2c140cd26ep+2, 0x1.b5baf617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4accfa40c0ccfp+9, 0x1.8b58b8f32cb94p+2, 0x1.11da7205f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.436954c1ee52ap+9, 0x1.392252d134075p+1, 0x1.15b310be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46907a34c0209p+9, 0x1.b8334553d72a5p+1, 0x1.6b2b9b42fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4715006e5b66dp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.47fdab5cf9564p+9, 0x1.26ad6b890c26fp+2, 0x1.b43ab017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4adcca9a12352p+9, 0x1.8b7369bcbf694p+2, 0x1.10d65d85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.436f980106fcap+9, 0x1.3920a430d8c75p+1, 0x1.13a650be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.469948080e9aap+9, 0x1.b8bfd3ffc4ca5p+1, 0x1.645bc6c2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.471e8b8a2e014p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.480974dc27c76p+9, 0x1.26b80c74dba6fp+2, 0x1.b2bc1c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4aec9c04b35b8p+9, 0x1.8b8e012e96b94p+2, 0x1.0fd36d05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4375db3782d8p+9, 0x1.391ef8c46fc75p+1, 0x1.119990be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46a218ab045cp+9, 0x1.b9497a1ed06a5p+1, 0x1.5c477342fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.472816a6009bbp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48153ec82c74p+9, 0x1.26c2a40edd86fp+2, 0x1.b13f3a17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4afc6e7fa0bdbp+9, 0x1.8ba87f651f394p+2, 0x1.0ed19e85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.437c1e65724aep+9, 0x1.391d508bfc275p+1, 0x1.0f8cc0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46aaec0ebd4bbp+9, 0x1.b9cfb8f2e20a6p+1, 0x1.52eeb602fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4731a1c1d3362p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48210920a7ed8p+9, 0x1.26cd3261b3a6fp+2, 0x1.afc40c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b0c4209d7fc6p+9, 0x1.8bc2e47cc8994p+2, 0x1.0dd0f485f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4382618ae5bb7p+9, 0x1.391bab8777a75p+1, 0x1.0d8010be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46b3c221cc64bp+9, 0x1.ba5211aeb54a6p+1, 0x1.48514982fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.473b2cdda5d09p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.482cd3e53b322p+9, 0x1.26d7b777f9a6fp+2, 0x1.ae4a9217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b1c16a257db7p+9, 0x1.8bdd3091fdd94p+2, 0x1.0cd16c85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4388a4a7ed8fcp+9, 0x1.391a09b6e8875p+1, 0x1.0b7340be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46bc9ad03b685p+9, 0x1.bad00595f74a6p+1, 0x1.3c6f6142fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4744b7f9786bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48389f1587accp+9, 0x1.26e2335c52f6fp+2, 0x1.acd2cc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b2bec482041cp+9, 0x1.8bf763c12ea94p+2, 0x1.0bd30805f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.438ee7bc9a2ep+9, 0x1.39186b1a4ba75p+1, 0x1.096680be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46c576038b34fp+9, 0x1.bb4915d7dfaa6p+1, 0x1.2f490002fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.474e43154b057p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48446ab12f353p+9, 0x1.26eca6195b36fp+2, 0x1.ab5cb617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b3bc2fa32396p+9, 0x1.8c117e26c7995p+2, 0x1.0ad5c705f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43952ac8fbfc5p+9, 0x1.3916cfb19de75p+1, 0x1.0759c0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46ce53a2b3595p+9, 0x1.bbbcc3b8b18a6p+1, 0x1.20de0742fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4757ce311d9ffp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.485036b7d40fep+9, 0x1.26f70fb9b446fp+2, 0x1.a9e85617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b4b9ab78fef7p+9, 0x1.8c2b7fdf36c95p+2, 0x1.09d9a905f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.439b6dcd2360cp+9, 0x1.3915377ce5875p+1, 0x1.054cf0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46d7339222901p+9, 0x1.bc2a9069f32a7p+1, 0x1.112e7cc2fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4761594cf03a6p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.485c032918ee2p+9, 0x1.27017047fce6fp+2, 0x1.a875a617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b5b737f3cb43p+9, 0x1.8c456906ea595p+2, 0x1.08deae05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43a1b0c920c18p+9, 0x1.3913a27c22875p+1, 0x1.034030be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46e015b3be482p+9, 0x1.bc91fd2ece6a7p+1, 0x1.003a7f42fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.476ae468c2d4dp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4867d004a0eep+9, 0x1.270bc7ced6f6fp+2, 0x1.a704ac17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b6b4d503cfbp+9, 0x1.8c5f39ba50695p+2, 0x1.07e4d585f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43a7f3bd0484cp+9, 0x1.391210af4b875p+1, 0x1.013370be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.46e8f9e6e30edp+9, 0x1.bcf28b394fea7p+1, 0x1.dc040d05f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.47746f84956f4p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48739d4a0f9a7p+9, 0x1.27161658dfa6fp+2, 0x1.a5956417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b7b2829965a6p+9, 0x1.8c78f215d7195p+2, 0x1.06ec2105f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43ae36a8df108p+9, 0x1.391082166d075p+1, 0x1.fe4d617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.46f1e00864344p+9, 0x1.bd4bbbcb78aa7p+1, 0x1.b5096705f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.477dfaa06809bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.487f6af908eb1p+9, 0x1.27205bf0b746fp+2, 0x1.a427d017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b8b040a4f8bfp+9, 0x1.8c929235e9695p+2, 0x1.05f48f85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43b4798cc0cbp+9, 0x1.390ef6b17da75p+1, 0x1.fa33c17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.46fac7f28c1d1p+9, 0x1.bd9d101920aa7p+1, 0x1.8b861385f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.478785bc3aa42p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.488b391131445p+9, 0x1.272a98a0fc96fp+2, 0x1.a2bbee17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4b9ae0f1706c5p+9, 0x1.8cac1a36f7095p+2, 0x1.04fe2085f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43babc68ba1a5p+9, 0x1.390d6e8083a75p+1, 0x1.f61a417d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4703b17d1bf9ep+9, 0x1.bde60960b54a7p+1, 0x1.5f79fd85f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.479110d80d3eap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.489707922d776p+9, 0x1.2734cc745306fp+2, 0x1.a151c017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4baabede01fb5p+9, 0x1.8cc58a356fa95p+2, 0x1.0408d505f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43c0ff3cdb64ap+9, 0x1.390be98375a75p+1, 0x1.f200a17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.470c9c7d4bfd8p+9, 0x1.be2628dbfa2a7p+1, 0x1.30e4c085f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.479a9bf3dfd91p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48a2d67ba2c26p+9, 0x1.273ef7755316fp+2, 0x1.9fe94617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4bba9dcf0e5bfp+9, 0x1.8cdee24dbcb95p+2, 0x1.0314ad05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43c74209351p+9, 0x1.390a67ba60275p+1, 0x1.ede7217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.471588c5cb411p+9, 0x1.be5cefc115ea7p+1, 0x1.ff926c0be826dp-18, H2O_REGION3G_PT },
+	{ 0x1.47a4270fb2738p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48aea5cd36cffp+9, 0x1.274919aea4e6fp+2, 0x1.9e827c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4bca7dc3a0d42p+9, 0x1.8cf8229c4f795p+2, 0x1.0221a785f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43cd84cdd7829p+9, 0x1.3908e9253ce75p+1, 0x1.e9cdc17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.471e7626bfc18p+9, 0x1.be89df50e6ea7p+1, 0x1.9863c40be826dp-18, H2O_REGION3G_PT },
+	{ 0x1.47adb22b850dfp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48ba75868fb7dp+9, 0x1.2753332ae0f6fp+2, 0x1.9d1d6617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4bda5ebac5cd1p+9, 0x1.8d114b3d94795p+2, 0x1.012fc505f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43d3c78ad3228p+9, 0x1.39076dc40be75p+1, 0x1.e5b4217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4727646dc67e7p+9, 0x1.beac78bfceaa8p+1, 0x1.2c243b0be826dp-18, H2O_REGION3G_PT },
+	{ 0x1.47b73d4757a86p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48c645a753fe4p+9, 0x1.275d43f4aab6fp+2, 0x1.9bba0617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4bea40b38ad3p+9, 0x1.8d2a5c4df8495p+2, 0x1.003f0605f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43da0a403855fp+9, 0x1.3905f596cd275p+1, 0x1.e19aa17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47305365f34a4p+9, 0x1.bec43d4e0c2a8p+1, 0x1.75c3da17d04dbp-19, H2O_REGION3G_PT },
+	{ 0x1.47c0c8632a42dp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48d2162f2a947p+9, 0x1.27674c169f56fp+2, 0x1.9a585617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4bfa23acfe954p+9, 0x1.8d4355e9ec295p+2, 0x1.fe9ed40be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43e04cee1783p+9, 0x1.3904809d80a75p+1, 0x1.dd81017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.473942d7d102dp+9, 0x1.bed0ae2ed80a8p+1, 0x1.1539042fa09b6p-20, H2O_REGION3G_PT },
+	{ 0x1.47ca537efcdd4p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48dde71dbad84p+9, 0x1.27714b9b6246fp+2, 0x1.98f85a17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c0a07a630e66p+9, 0x1.8d5c382dd9895p+2, 0x1.fcc1e20be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43e68f94810fdp+9, 0x1.39030ed826675p+1, 0x1.d967a17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47423289614edp+9, 0x1.bed14ca4366a8p+1, 0x1.cd85105f4136bp-21, H2O_REGION3G_PT },
+	{ 0x1.47d3de9acf77cp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48e9b872ac948p+9, 0x1.277b428d90b6fp+2, 0x1.979a1217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c19ec9e32bbep+9, 0x1.8d75033631a95p+2, 0x1.fae7370be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43ecd23385628p+9, 0x1.3901a046be675p+1, 0x1.d54e017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.474b223e1ce98p+9, 0x1.bec599e32b4a8p+1, 0x1.724bd417d04dbp-19, H2O_REGION3G_PT },
+	{ 0x1.47dd69b6a2123p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.48f58a2da800bp+9, 0x1.278530f7c7d6fp+2, 0x1.963d7e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c29d294162e8p+9, 0x1.8d8db71f5f895p+2, 0x1.f90ed20be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43f314cb34e13p+9, 0x1.390034e94bc75p+1, 0x1.d134817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.475411b6f3602p+9, 0x1.bead1728fb2a8p+1, 0x1.3ea3a70be826dp-18, H2O_REGION3G_PT },
+	{ 0x1.47e6f4d274acap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49015c4e55c1p+9, 0x1.278f16e4aca6fp+2, 0x1.94e29c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c39b986ee7ap+9, 0x1.8da65405d2d95p+2, 0x1.f738b20be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43f9575b9ff21p+9, 0x1.38feccbfc8475p+1, 0x1.cd1ae17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.475d00b24b382p+9, 0x1.be8745ab338a7p+1, 0x1.c9560d0be826dp-18, H2O_REGION3G_PT },
+	{ 0x1.47f07fee47471p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.490d2ed45ee6ap+9, 0x1.2798f45ed936fp+2, 0x1.93896c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c49a175cffd5p+9, 0x1.8dbeda05f8295p+2, 0x1.f564d90be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.43ff99e4d6fb3p+9, 0x1.38fd67ca37075p+1, 0x1.c901617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4765eeec01d7ep+9, 0x1.be53a6ab586a7p+1, 0x1.2c8c8105f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.47fa0b0a19e18p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.491901bf6cef5p+9, 0x1.27a2c970f286fp+2, 0x1.9231f017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c598a5fd03a7p+9, 0x1.8dd7493c3f295p+2, 0x1.f393470be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4405dc66ea62bp+9, 0x1.38fc06089b275p+1, 0x1.c4e7e17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.476edc1d6bab9p+9, 0x1.be11bb5d1f6a7p+1, 0x1.76f66b85f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.48039625ec7bfp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4924d50f29c5dp+9, 0x1.27ac962592a6fp+2, 0x1.90dc2817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c69744405d69p+9, 0x1.8defa1c512d95p+2, 0x1.f1c3fb0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.440c1ee1ea8ecp+9, 0x1.38faa77aee675p+1, 0x1.c0ce417d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4777c7fd53eecp+9, 0x1.bdc104fd49ca7p+1, 0x1.c3f18685f4137p-17, H2O_REGION3G_PT },
+	{ 0x1.480d2141bf166p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4930a8c33fc17p+9, 0x1.27b65a875e96fp+2, 0x1.8f881217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c795f218899ep+9, 0x1.8e07e3bce1595p+2, 0x1.eff6f50be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44126155e7e57p+9, 0x1.38f94c2137075p+1, 0x1.bcb4e17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4780b23ffcd6ap+9, 0x1.bd6104c8860a7p+1, 0x1.09bea142fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4816ac5d91b0ep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.493c7cdb59a68p+9, 0x1.27c016a0f1f6fp+2, 0x1.8e35ae17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c894af7716fbp+9, 0x1.8e200f401be95p+2, 0x1.ee2c340be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4418a3c2f2ccfp+9, 0x1.38f7f3fb71e75p+1, 0x1.b89b417d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47899a971f91ap+9, 0x1.bcf13bf6c94a7p+1, 0x1.32c8bd02fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.48203779644b5p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4948515722a5fp+9, 0x1.27c9ca7cf036fp+2, 0x1.8ce50217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4c9937c4da669p+9, 0x1.8e38246b2d895p+2, 0x1.ec63bb0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.441ee6291bab6p+9, 0x1.38f69f09a2275p+1, 0x1.b481c17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.479280b1ec2f4p+9, 0x1.bc712bc1caaa7p+1, 0x1.5d178302fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.4829c29536e5cp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49542636465dap+9, 0x1.27d37625f1d6fp+2, 0x1.8b960417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4ca92588deb01p+9, 0x1.8e50235a82c95p+2, 0x1.ea9d870be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4425288872e6fp+9, 0x1.38f54d4bbe675p+1, 0x1.b068217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.479b643d09a91p+9, 0x1.bbe05565a2aa6p+1, 0x1.88aad002fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.48334db109803p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.495ffb7870d7fp+9, 0x1.27dd19a6a086fp+2, 0x1.8a48ba17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4cb914429aa0dp+9, 0x1.8e680c2a8b595p+2, 0x1.e8d99b0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.442b6ae108e5ap+9, 0x1.38f3fec1d0075p+1, 0x1.ac4ea17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47a444e295eeep+9, 0x1.bb3e3a1cb12a6p+1, 0x1.b5829082fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.483cd8ccdc1aap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.496bd11d4e8c7p+9, 0x1.27e6b5099336fp+2, 0x1.88fd2617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4cc903f12bb0ap+9, 0x1.8e7fdef7b3c95p+2, 0x1.e717f30be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4431ad32ee0dap+9, 0x1.38f2b36bd3e75p+1, 0x1.a835217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47ad224a25d9dp+9, 0x1.ba8a5b1d0d2a6p+1, 0x1.e39f1f82fa09bp-16, H2O_REGION3G_PT },
+	{ 0x1.484663e8aeb51p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4977a7248c5f2p+9, 0x1.27f048596d56fp+2, 0x1.87b34217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4cd8f493b07a6p+9, 0x1.8e979bde6bc95p+2, 0x1.e558920be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4437ef7e32c51p+9, 0x1.38f16b49cd275p+1, 0x1.a41b817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47b5fc18c526ep+9, 0x1.b9c439a8d3ca6p+1, 0x1.097ffe417d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.484fef04814f9p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49837d8dd7a0fp+9, 0x1.27f9d3a0cf36fp+2, 0x1.866b1417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4ce8e62948bc2p+9, 0x1.8eaf42fb1fe96p+2, 0x1.e39b770be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.443e31c2e7722p+9, 0x1.38f0265bb5875p+1, 0x1.a002217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47bed1f0f69bcp+9, 0x1.b8eb56f32e0a5p+1, 0x1.21d2b2a17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.48597a2053eap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.498f5458de0fap+9, 0x1.280356ea5606fp+2, 0x1.85249617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4cf8d8b11557p+9, 0x1.8ec6d46a3e496p+2, 0x1.e1e0a30be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.444474011c7aep+9, 0x1.38eee4a193475p+1, 0x1.9be8817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47c7a372b3cacp+9, 0x1.b7ff343966aa5p+1, 0x1.3ac7b3c17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.4863053c26847p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.499b2b854dd5ap+9, 0x1.280cd240a3a6fp+2, 0x1.83dfcc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d08cc2a384f4p+9, 0x1.8ede504831e96p+2, 0x1.e028150be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.444ab638e2458p+9, 0x1.38eda61b60275p+1, 0x1.97cf017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47d0703b6d429p+9, 0x1.b6ff52b4028a5p+1, 0x1.545f07217d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.486c9057f91eep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49a70312d58a4p+9, 0x1.281645ae56d6fp+2, 0x1.829cb417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d18c093d4cc2p+9, 0x1.8ef5b6b16d996p+2, 0x1.de71cc0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4450f86a49381p+9, 0x1.38ec6ac922675p+1, 0x1.93b5617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47d937e60a75dp+9, 0x1.b5eb33a2c6ca4p+1, 0x1.6e9894e17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.48761b73cbb95p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49b2db0124319p+9, 0x1.281fb13e0fe6fp+2, 0x1.815b5417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d28b5ed0f183p+9, 0x1.8f0d07c25ac96p+2, 0x1.dcbdcb0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44573a9561b8cp+9, 0x1.38eb32aad6e75p+1, 0x1.8f9c017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47e1fa0ae9e03p+9, 0x1.b4c258395faa4p+1, 0x1.897462417d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.487fa68f9e53cp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49beb34fe93c7p+9, 0x1.282914fa6a76fp+2, 0x1.801ba417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d38ac350ca0fp+9, 0x1.8f24439769296p+2, 0x1.db0c100be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.445d7cba3c2dbp+9, 0x1.38e9fdc07da75p+1, 0x1.8b82617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47eab63fe0c88p+9, 0x1.b38441b8284a3p+1, 0x1.a4f26ce17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.488931ab70ee3p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49ca8bfed4886p+9, 0x1.283270ee0d16fp+2, 0x1.7edda817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d48a36af3f71p+9, 0x1.8f3b6a4d05496p+2, 0x1.d95c9a0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4463bed8e8fdp+9, 0x1.38e8cc0a16a75p+1, 0x1.8768c17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47f36c183b7d7p+9, 0x1.b2307152d32a3p+1, 0x1.c112cae17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.4892bcc74388bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49d6650d965ffp+9, 0x1.283bc52391d6fp+2, 0x1.7da15e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d589b8decce5p+9, 0x1.8f527bffa0696p+2, 0x1.d7af6a0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.446a00f1788cdp+9, 0x1.38e79d87a1e75p+1, 0x1.834f617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.47fc1b24bd258p+9, 0x1.b0c66847e9ca2p+1, 0x1.ddd553e17d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.489c47e316232p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49e23e7bdf7a4p+9, 0x1.284511a59a96fp+2, 0x1.7c66c617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d68949d1ffdbp+9, 0x1.8f6978cba3f96p+2, 0x1.d604820be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44704303fb434p+9, 0x1.38e672391f675p+1, 0x1.7f35c17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4804c2f39fdd6p+9, 0x1.af45a7d1298a2p+1, 0x1.fb3a36017d04ep-15, H2O_REGION3G_PT },
+	{ 0x1.48a5d2fee8bd9p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49ee184960fb5p+9, 0x1.284e567ec616fp+2, 0x1.7b2de417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d788e97b77f2p+9, 0x1.8f8060cd7e196p+2, 0x1.d45be00be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4476851081867p+9, 0x1.38e54a1e8f275p+1, 0x1.7b1c417d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.480d631094b02p+9, 0x1.adadb1266e8a1p+1, 0x1.0ca0a730be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48af5e1abb58p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.49f9f275cc73ep+9, 0x1.285793b9b316fp+2, 0x1.79f6b217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d88897cde6fbp+9, 0x1.8f973421a0096p+2, 0x1.d2b5830be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.447cc7171bbc8p+9, 0x1.38e42537f4475p+1, 0x1.7702c17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4815fb04c3896p+9, 0x1.abfe0587874ap+1, 0x1.1bf561a0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48b8e9368df27p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a05cd00d3e17p+9, 0x1.2860c9610696fp+2, 0x1.78c13617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4d98854bc10fbp+9, 0x1.8fadf2e474c96p+2, 0x1.d1116d0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44830917da4bap+9, 0x1.38e3038548875p+1, 0x1.72e9417d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.481e8a56cb5ep+9, 0x1.aa36262a8deap+1, 0x1.2b9b40a0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48c27452608cep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a11a7ea29ae8p+9, 0x1.2869f77f5786fp+2, 0x1.778d6c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4da882038cc27p+9, 0x1.8fc49d326a796p+2, 0x1.cf6f9c0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44894b12cd99ep+9, 0x1.38e1e50692275p+1, 0x1.6ecfa17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4827108ac1fa7p+9, 0x1.a855944a6269fp+1, 0x1.3b923b00be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48cbff6e33275p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a1d833180b2p+9, 0x1.28731e1f4e06fp+2, 0x1.765b5617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4db87fa3700e6p+9, 0x1.8fdb3327ef396p+2, 0x1.cdd0130be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.448f8d08060d7p+9, 0x1.38e0c9bbce075p+1, 0x1.6ab6217d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.482f8d22341b2p+9, 0x1.a65bd1233329ep+1, 0x1.4bda50c0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48d58a8a05c1cp+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a295ed68c3p+9, 0x1.287c3d4b8296fp+2, 0x1.752af017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4dc87e2a9a9d1p+9, 0x1.8ff1b4e171296p+2, 0x1.cc32d00be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4495cef7940c7p+9, 0x1.38dfb1a4f9075p+1, 0x1.669c817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4837ff9c256efp+9, 0x1.a4485dea77c9ep+1, 0x1.5c738de0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48df15a5d85c4p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a353ad8ffd92p+9, 0x1.2885550e98a6fp+2, 0x1.73fc4217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4dd87d983d3b3p+9, 0x1.9008227b5b496p+2, 0x1.ca97d20be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.449c10e187fcfp+9, 0x1.38de9cc219675p+1, 0x1.6283017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.484067751085dp+9, 0x1.a21abbe39ee9dp+1, 0x1.6d5df0e0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48e8a0c1aaf6bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a4117388fcacp+9, 0x1.288e65733216fp+2, 0x1.72cf4417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4de87deb89d87p+9, 0x1.901e7c1220696p+2, 0x1.c8ff1b0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44a252c5f2452p+9, 0x1.38dd8b132c075p+1, 0x1.5e69817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.4848c426e6fecp+9, 0x1.9fd26c3c2dc9cp+1, 0x1.7e9968f0be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48f22bdd7d912p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a4cf3f4f08f5p+9, 0x1.28976e83ea86fp+2, 0x1.71a3fa17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4df87f23b387dp+9, 0x1.9034c1c228696p+2, 0x1.c768aa0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.44a894a4e34b2p+9, 0x1.38dc7c9830e75p+1, 0x1.5a50017d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.485115291128ap+9, 0x1.9d6ef03a16c9bp+1, 0x1.90261250be827p-14, H2O_REGION3G_PT },
+	{ 0x1.48fbb6f9502b9p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4a58d10dd71ddp+9, 0x1.28a0704b5f26fp+2, 0x1.707a6217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4e08813fee7f3p+9, 0x1.904af3a7e7a96p+2, 0x1.c5d47f0be826dp-18, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.423c8c756defp+9, 0x1.3981c78461a76p+1, 0x1.7817e0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44f19588cd91ap+9, 0x1.b6664e8fe1ea4p+1, 0x1.906064417d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.454aeb36de716p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.45c9f5a5bbd7ap+9, 0x1.2481422cc1b6ep+2, 0x1.01e2af0be826dp-18, H2O_REGION3I_PT },
+	{ 0x1.47eabb15bb2cbp+9, 0x1.85fa9b6189c92p+2, 0x1.469ccf85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4242d19d42805p+9, 0x1.397f7f268ac76p+1, 0x1.760b20be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44fa5a23f9681p+9, 0x1.b5381ad9aa4a4p+1, 0x1.755b58617d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.45547652b10bdp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.45d5a8e5d21cdp+9, 0x1.248dd33c5bf6ep+2, 0x1.00fa9a0be826dp-18, H2O_REGION3I_PT },
+	{ 0x1.47fa54781b3c7p+9, 0x1.861a708a3e292p+2, 0x1.45634985f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.424916b9671cbp+9, 0x1.397d39fca9476p+1, 0x1.73fe60be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.450318b3df0a3p+9, 0x1.b41ec3a72d2a4p+1, 0x1.5af89ce17d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.455e016e83a64p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.45e15ca697164p+9, 0x1.249a58fc3f16ep+2, 0x1.00135d0be826dp-18, H2O_REGION3I_PT },
+	{ 0x1.4809ef2072af9p+9, 0x1.863a272310792p+2, 0x1.442ae685f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.424f5bc9ec2a5p+9, 0x1.397af806bd276p+1, 0x1.71f190be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.450bd1a34de74p+9, 0x1.b319ca397e0a3p+1, 0x1.41381a617d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.45678c8a5640bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.45ed10e796efdp+9, 0x1.24a6d3770396ep+2, 0x1.fe59f817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48198b0d88918p+9, 0x1.8659bf4871f92p+2, 0x1.42f3a705f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4255a0cee20f6p+9, 0x1.3978b944bd076p+1, 0x1.6fe4c0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4514855a8c7e4p+9, 0x1.b228afc66c0a3p+1, 0x1.2819e8217d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.457117a628db2p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.45f8c5a85e41ep+9, 0x1.24b342b74b56ep+2, 0x1.fc8ee617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4829283e2510fp+9, 0x1.86793916c7692p+2, 0x1.41bd8a05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.425be5c85931ep+9, 0x1.39767db6b2476p+1, 0x1.6dd800be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.451d343f5820bp+9, 0x1.b14af58b1f8a2p+1, 0x1.0f9df9217d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.457aa2c1fb759p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46047ae87a11bp+9, 0x1.24bfa6c7b9c6ep+2, 0x1.fac58817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4838c6b1117f5p+9, 0x1.869894aa86b92p+2, 0x1.40889005f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42622ab661f8p+9, 0x1.3974455c99c76p+1, 0x1.6bcb40be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4525deb4e5267p+9, 0x1.b0801cbe872a2p+1, 0x1.ef888f42fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.45842dddce101p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.461030a777d17p+9, 0x1.24cbffb2e8f6ep+2, 0x1.f8fddc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4848666518518p+9, 0x1.86b7d22019593p+2, 0x1.3f54b985f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42686f990cc7ep+9, 0x1.3972103673876p+1, 0x1.69be80be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.452e851bdeb88p+9, 0x1.afc7a69d354a2p+1, 0x1.c119bbc2fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.458db8f9a0aa8p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.461be6e4e55fep+9, 0x1.24d84d837c56ep+2, 0x1.f737e417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48580759051f5p+9, 0x1.86d6f193eef93p+2, 0x1.3e220585f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.426eb4706a07ap+9, 0x1.396fde4442a76p+1, 0x1.67b1b0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.453727d266fc2p+9, 0x1.af211462102a2p+1, 0x1.93ef7d02fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.459744157344fp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46279da05108bp+9, 0x1.24e490441116ep+2, 0x1.f573a217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4867a98ba4a3cp+9, 0x1.86f5f32274293p+2, 0x1.3cf07585f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4274f93c8a1d7p+9, 0x1.396daf8600e76p+1, 0x1.65a500be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.453fc7341706bp+9, 0x1.ae8be7464baa1p+1, 0x1.6809df02fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.45a0cf3145df6p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.463354d949844p+9, 0x1.24f0c7ff4786ep+2, 0x1.f3b10e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48774cfbc4bcep+9, 0x1.8714d6e817093p+2, 0x1.3bc00885f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.427b3dfd7d6f6p+9, 0x1.396b83fbb1676p+1, 0x1.639830be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45486399fed5p+9, 0x1.ae07a08673ea1p+1, 0x1.3d68be42fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.45aa5a4d1879dp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.463f0c8f5df7cp+9, 0x1.24fcf4bfc186ep+2, 0x1.f1f03017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4886f1a8346bep+9, 0x1.87339d0144293p+2, 0x1.3a90be05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.428182b354639p+9, 0x1.39695ba557476p+1, 0x1.618b70be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4550fd5aa55c7p+9, 0x1.ad93c1573eca1p+1, 0x1.140c04c2fa09bp-16, H2O_REGION3L_PT },
+	{ 0x1.45b3e568eb144p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.464ac4c21df54p+9, 0x1.250916901ab6ep+2, 0x1.f0310417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4896978fc3d5p+9, 0x1.8752458a6cc93p+2, 0x1.39629705f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4287c75e1f603p+9, 0x1.39673682ef676p+1, 0x1.5f7eb0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.455994ca0862dp+9, 0x1.ad2fcafc082a1p+1, 0x1.d7e7d705f4137p-17, H2O_REGION3L_PT },
+	{ 0x1.45bd7084bdaebp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46567d71197b7p+9, 0x1.25152d7af686ep+2, 0x1.ee738c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48a63eb1443fcp+9, 0x1.8770d09ffbe93p+2, 0x1.38359305f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.428e0bfdeecb6p+9, 0x1.3965149479c76p+1, 0x1.5d71f0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45622a399cc5bp+9, 0x1.acdb3ea45f2a1p+1, 0x1.8a43d685f4137p-17, H2O_REGION3L_PT },
+	{ 0x1.45c6fba090493p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4662369be0f5fp+9, 0x1.2521398af226ep+2, 0x1.ecb7c617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48b5e70b8816ap+9, 0x1.878f3e5e5e193p+2, 0x1.3709b285f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42945092d30b4p+9, 0x1.3962f5d9f3476p+1, 0x1.5b6520be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.456abdf84e23cp+9, 0x1.ac959d92866a1p+1, 0x1.3f350d85f4137p-17, H2O_REGION3L_PT },
+	{ 0x1.45d086bc62e3ap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.466df042053d1p+9, 0x1.252d3acaac56ep+2, 0x1.eafdb417d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48c5909d62e73p+9, 0x1.87ad8ee204993p+2, 0x1.35def485f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.429a951cdc85ep+9, 0x1.3960da5365476p+1, 0x1.595860be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.457350527f267p+9, 0x1.ac5e68ffb1ca1p+1, 0x1.ed5d880be826dp-18, H2O_REGION3L_PT },
+	{ 0x1.45da11d8357e1p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.4679aa631795ep+9, 0x1.25393144ca16ep+2, 0x1.e9455817d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48d53b65a9624p+9, 0x1.87cbc2475a693p+2, 0x1.34b55a85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42a0d99c1ba18p+9, 0x1.395ec200c3476p+1, 0x1.574ba0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.457be19209625p+9, 0x1.ac352221142a1p+1, 0x1.6162040be826dp-18, H2O_REGION3L_PT },
+	{ 0x1.45e39cf408188p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.468564fea9b27p+9, 0x1.25451d03e256ep+2, 0x1.e78eaa17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48e4e763315bap+9, 0x1.87e9d8aacda93p+2, 0x1.338ce285f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42a71e10a0c42p+9, 0x1.395cace219c76p+1, 0x1.553ee0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.458471fe3d3eep+9, 0x1.ac194a37440a1p+1, 0x1.b506c417d04dbp-19, H2O_REGION3L_PT },
+	{ 0x1.45ed280fdab2fp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.469120144db14p+9, 0x1.2550fe129d36ep+2, 0x1.e5d9b217d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.48f49494d1ca4p+9, 0x1.8807d228ce093p+2, 0x1.32658e05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42ad627a7c54p+9, 0x1.395a9af75f676p+1, 0x1.533220be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.458d01dbe230ep+9, 0x1.ac0a627ad90a1p+1, 0x1.651c902fa09b6p-20, H2O_REGION3L_PT },
+	{ 0x1.45f6b32bad4d6p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.469cdba3961dfp+9, 0x1.255cd47b9656ep+2, 0x1.e4266c17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.490442f962c84p+9, 0x1.8825aeddc8193p+2, 0x1.313f5d05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42b3a6d9beb73p+9, 0x1.39588c4097476p+1, 0x1.512550be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4595916d36916p+9, 0x1.ac07ec222eea1p+1, 0x1.3ba0105f4136bp-21, H2O_REGION3L_PT },
+	{ 0x1.46003e477fe7dp+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46a897ac15f0cp+9, 0x1.2568a0496c76ep+2, 0x1.e274dc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4913f28fbd92dp+9, 0x1.88436ee628693p+2, 0x1.301a4f05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42b9eb2e7853dp+9, 0x1.395680bdc4876p+1, 0x1.4f1890be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.459e20f1ef925p+9, 0x1.ac116870248a1p+1, 0x1.3ac86017d04dbp-19, H2O_REGION3L_PT },
+	{ 0x1.4609c96352825p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46b4542d608ebp+9, 0x1.25746186c176ep+2, 0x1.e0c4fc17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4923a356bc8a3p+9, 0x1.8861125e5d193p+2, 0x1.2ef66385f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42c02f78b9901p+9, 0x1.3954786ee0e75p+1, 0x1.4d0bd0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45a6b0a7397aep+9, 0x1.ac265894364a1p+1, 0x1.0fd81c0be826dp-18, H2O_REGION3L_PT },
+	{ 0x1.4613547f251ccp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46c0112709c9ap+9, 0x1.2580183e3286ep+2, 0x1.df16d017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4933554d3b31dp+9, 0x1.887e9962d5d93p+2, 0x1.2dd39c05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42c673b892d2p+9, 0x1.39527353f2a75p+1, 0x1.4aff00be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45af40c7b753p+9, 0x1.ac463dd0b34a1p+1, 0x1.7d61210be826dp-18, H2O_REGION3L_PT },
+	{ 0x1.461cdf9af7b73p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46cbce98a5e02p+9, 0x1.258bc47a6186ep+2, 0x1.dd6a5617d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4943087216302p+9, 0x1.889c040fff393p+2, 0x1.2cb1f785f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42ccb7ee147fdp+9, 0x1.3950716cf6a75p+1, 0x1.48f250be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45b7d18b832dap+9, 0x1.ac70995c80ca1p+1, 0x1.e5d8d20be826dp-18, H2O_REGION3L_PT },
+	{ 0x1.46266ab6ca51ap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46d78c81c97dap+9, 0x1.25976645ed36ep+2, 0x1.dbbf9017d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.4952bcc42b4edp+9, 0x1.88b9528247593p+2, 0x1.2b917505f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42d2fc194effap+9, 0x1.394e72b9ece75p+1, 0x1.46e570be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.45c063282dfdp+9, 0x1.aca4ec75636a1p+1, 0x1.24a88b85f4137p-17, H2O_REGION3L_PT },
+	{ 0x1.462ff5d29cec1p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3H_PT },
+	{ 0x1.46e34ae209ba5p+9, 0x1.25a2fdab75e6ep+2, 0x1.da167e17d04dbp-19, H2O_REGION3I_PT },
+	{ 0x1.49627242597aap+9, 0x1.88d684d619393p+2, 0x1.2a721705f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.419fbbffeae93p+9, 0x1.39bee9a117a76p+1, 0x1.ab5710be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.440926e330ab7p+9, 0x1.f40dcc198aabcp+1, 0x1.4077b8e05f413p-13, H2O_REGION3L_PT },
+	{ 0x1.444a62838770dp+9, 0x1.b603c42d5daa4p+1, 0x1.797c6e0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.445c557f4d5c3p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.4469b28255eb8p+9, 0x1.f9cb63e1a12bep+1, 0x1.4eca482fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44a61d0ec7477p+9, 0x1.2338420bf1a6dp+2, 0x1.19a0fc0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46666ca020906p+9, 0x1.82b6b8eb17091p+2, 0x1.66ac7c05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41a60260c00d8p+9, 0x1.39bc513095676p+1, 0x1.a94a40be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44132729d5054p+9, 0x1.f0351e32be6bap+1, 0x1.35c04ab05f413p-13, H2O_REGION3L_PT },
+	{ 0x1.445325262c302p+9, 0x1.b5defc1e676a4p+1, 0x1.77eece0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4465e09b1ff6ap+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.4473d02d4b129p+9, 0x1.f9c339e9fd2bep+1, 0x1.4e89982fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44b1c325e67a1p+9, 0x1.2345fb617cd6dp+2, 0x1.18a3a70be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.4675e4930b3f6p+9, 0x1.82d9ae3844e91p+2, 0x1.65568805f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41ac48b44b43bp+9, 0x1.39b9bbf402476p+1, 0x1.a73d80be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.441d13beea83fp+9, 0x1.ec7dae22190b9p+1, 0x1.2b316ad05f413p-13, H2O_REGION3L_PT },
+	{ 0x1.445be70c7eb75p+9, 0x1.b5ba5ae3ebaa4p+1, 0x1.7661310be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.446f6bb6f2911p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.447dedae7397ap+9, 0x1.f9bb117f842bep+1, 0x1.4e4b302fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44bd69c98e376p+9, 0x1.2353a85db596dp+2, 0x1.17a72b0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46855debeec74p+9, 0x1.82fc822ed5d91p+2, 0x1.6401b705f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41b28efa9cf1dp+9, 0x1.39b729eb61676p+1, 0x1.a530b0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4426ed4ca3847p+9, 0x1.e8e6fd1faeeb7p+1, 0x1.20cb20605f413p-13, H2O_REGION3L_PT },
+	{ 0x1.4464a83745d5ap+9, 0x1.b595e07df3ca4p+1, 0x1.74d3920be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4478f6d2c52b8p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44880b05d76c3p+9, 0x1.f9b2ea9419abep+1, 0x1.4e0f002fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44c910f9400b7p+9, 0x1.2361490b3c36dp+2, 0x1.16ab8b0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.4694d8a975c59p+9, 0x1.831f34eb3b191p+2, 0x1.62ae0a05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41b8d533c57ep+9, 0x1.39b49b16b5e76p+1, 0x1.a32400be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4430b47aa9456p+9, 0x1.e5708c66600b6p+1, 0x1.168d63905f413p-13, H2O_REGION3L_PT },
+	{ 0x1.446d68a7485a8p+9, 0x1.b5718cec7caa4p+1, 0x1.7345f40be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.448281ee97c6p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.449228337e398p+9, 0x1.f9aac519b3ebep+1, 0x1.4dd5182fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44d4b8b47def2p+9, 0x1.236edd74b106dp+2, 0x1.15b0c20be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46a454ca4bfb2p+9, 0x1.8341c689e1391p+2, 0x1.615b7f05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41bf1b5fd54e7p+9, 0x1.39b20f75fca76p+1, 0x1.a11740be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.443a69ee1bf1fp+9, 0x1.e219dd34f14b5p+1, 0x1.0c783bd05f413p-13, H2O_REGION3L_PT },
+	{ 0x1.4476285d4d155p+9, 0x1.b54d602f832a4p+1, 0x1.71b8550be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.448c0d0a6a607p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.449c45376f60fp+9, 0x1.f9a2a102686bep+1, 0x1.4d9d602fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44e060faca482p+9, 0x1.237c65a4b2c6dp+2, 0x1.14b6d40be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46b3d24d1e4bdp+9, 0x1.8364372736591p+2, 0x1.600a1785f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41c5617edcc94p+9, 0x1.39af870932876p+1, 0x1.9f0a70be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44440e4992c39p+9, 0x1.dee270be824b4p+1, 0x1.028ba2d05f413p-13, H2O_REGION3L_PT },
+	{ 0x1.447ee75a1ad56p+9, 0x1.b5295a47074a4p+1, 0x1.702ab50be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.449598263cfaep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44a66211b1fcap+9, 0x1.f99a7e40880bep+1, 0x1.4d67d42fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44ec09cba7e8ep+9, 0x1.2389e1a5e1c6dp+2, 0x1.13bdbf0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46c351309abeap+9, 0x1.838686dfa8991p+2, 0x1.5eb9d385f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41cba790ec548p+9, 0x1.39ad01d05dc76p+1, 0x1.9cfdb0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.444da22d1bb1bp+9, 0x1.dbc9c8425b2b2p+1, 0x1.f18f3740be827p-14, H2O_REGION3L_PT },
+	{ 0x1.4487a59e786ap+9, 0x1.b5057b330f4a4p+1, 0x1.6e9d170be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.449f23420f955p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44b07ec24ce0ap+9, 0x1.f9925cc6572bep+1, 0x1.4d347c2fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.44f7b3269a10ap+9, 0x1.23975182db36dp+2, 0x1.12c5840be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46d2d173707dbp+9, 0x1.83a8b5cfa4891p+2, 0x1.5d6ab205f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41d1ed9614566p+9, 0x1.39aa7fcb7b476p+1, 0x1.9af0f0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.445726363bbdcp+9, 0x1.d8cf64f9bc4b1p+1, 0x1.de5849f0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.4490632b2ca2ap+9, 0x1.b4e1c2f391ca4p+1, 0x1.6d0f780be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44a8ae5de22fcp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44ba9b49469abp+9, 0x1.f98a3c8677ebep+1, 0x1.4d03442fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45035d0b246b5p+9, 0x1.23a4b54640f6dp+2, 0x1.11ce230be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46e253144fd63p+9, 0x1.83cac41398491p+2, 0x1.5c1cb405f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41d8338e6535p+9, 0x1.39a800fa8b076p+1, 0x1.98e420be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44609affeed0ep+9, 0x1.d5f2c81dd66bp+1, 0x1.cb728600be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44992000fe4e8p+9, 0x1.b4be3188982a4p+1, 0x1.6b81da0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44b23979b4ca3p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44c4b7a6a5742p+9, 0x1.f9821d7379abep+1, 0x1.4cd4342fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.450f0778cb11cp+9, 0x1.23b20cfab4e6dp+2, 0x1.10d79a0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.46f1d611ea387p+9, 0x1.83ecb1c7f3891p+2, 0x1.5acfd905f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41de7979ef568p+9, 0x1.39a5855d8d076p+1, 0x1.96d760be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.446a0122a7bb9p+9, 0x1.d33372eaac2afp+1, 0x1.b8dddec0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44a1dc20b43d1p+9, 0x1.b49ac6f21c2a4p+1, 0x1.69f43a0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44bbc4958764ap+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44ced3da6f717p+9, 0x1.f979ff801aabep+1, 0x1.4ca7302fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.451ab26f1289ap+9, 0x1.23bf58aacf86dp+2, 0x1.0fe1ec0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.47015a6af237fp+9, 0x1.840e7f091fb92p+2, 0x1.59842105f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41e4bf58c321p+9, 0x1.39a30cf481476p+1, 0x1.94caa0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4473593450442p+9, 0x1.d090e69a846aep+1, 0x1.a69a5700be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44aa978b153dap+9, 0x1.b477833020ea4p+1, 0x1.68669d0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44c54fb159ff2p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44d8efe4aa534p+9, 0x1.f971e29f5acbep+1, 0x1.4c7c542fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45265ded7fc52p+9, 0x1.23cc986138f6dp+2, 0x1.0eed160be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.4710e01e1b8b2p+9, 0x1.84302bf38fa92p+2, 0x1.58398c85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41eb052af0faap+9, 0x1.39a097bf6ae76p+1, 0x1.92bdd0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.447ca3c8491ddp+9, 0x1.ce0aa466a5cadp+1, 0x1.94a7f760be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44b35240e81f9p+9, 0x1.b4546642a66a4p+1, 0x1.66d8fd0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44cedacd2c999p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44e30bc55b97ap+9, 0x1.f969c6c41aabep+1, 0x1.4c53802fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.453209f398239p+9, 0x1.23d9cc288b46dp+2, 0x1.0df91b0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.4720672a1b0bcp+9, 0x1.8451b8a3acc92p+2, 0x1.56f01a85f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41f14af089499p+9, 0x1.399e25be43a76p+1, 0x1.90b100be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4485e16f69e03p+9, 0x1.cba02d88ca8acp+1, 0x1.8306bab0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44bc0c42f3b24p+9, 0x1.b4317029a66a4p+1, 0x1.654b5e0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44d865e8ff34p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44ed277c88797p+9, 0x1.f961abe198abep+1, 0x1.4c2cc02fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.453db680e170dp+9, 0x1.23e6f40b6856dp+2, 0x1.0d05fa0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.472fef8da6b69p+9, 0x1.84732535e8592p+2, 0x1.55a7cc05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41f790a99c73ep+9, 0x1.399bb6f10ea76p+1, 0x1.8ea450be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.448f12b801177p+9, 0x1.c951033c626abp+1, 0x1.71b692e0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44c4c591fec4fp+9, 0x1.b40ea0e52a4a4p+1, 0x1.63bdc00be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44e1f104d1ce7p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.44f7430a35f24p+9, 0x1.f95991eb132bep+1, 0x1.4c07fc2fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45496394e1e5ap+9, 0x1.23f410146ee6dp+2, 0x1.0c13b20be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.473f794775ab6p+9, 0x1.849471c6ad592p+2, 0x1.5460a005f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41fdd6563adfbp+9, 0x1.39994b57cf076p+1, 0x1.8c9790be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4498382dd4382p+9, 0x1.c71ca6bbc3eabp+1, 0x1.60b79ff0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44cd7e2ed0271p+9, 0x1.b3ebf8752eea3p+1, 0x1.6230210be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44eb7c20a468ep+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.45015e6e68ba5p+9, 0x1.f95178d3de6bdp+1, 0x1.4be53c2fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.4555112f20278p+9, 0x1.2401204e3c26ep+2, 0x1.0b22430be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.474f0456402d3p+9, 0x1.84b59e726d092p+2, 0x1.531a9805f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42041bf674f33p+9, 0x1.3996e2f281a76p+1, 0x1.8a8ad0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44a1525a1fa79p+9, 0x1.c5029940b2aaap+1, 0x1.5009c6d0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44d6361a2ea8p+9, 0x1.b3c976d9ae0a3p+1, 0x1.60a2820be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44f5073c77035p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.450b79a92549p+9, 0x1.f949608f968bdp+1, 0x1.4bc4842fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.4560bf4f2348ap+9, 0x1.240e24c37516ep+2, 0x1.0a31ad0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.475e90b8bfa23p+9, 0x1.84d6ab5590d92p+2, 0x1.51d5b305f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.420a618a5b148p+9, 0x1.39947dc123676p+1, 0x1.887df0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44aa61c396b56p+9, 0x1.c3025c060eaa9p+1, 0x1.3fad1170be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44deed54e117p+9, 0x1.b3a71c12b10a3p+1, 0x1.5f14e40be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.44fe9258499dcp+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.451594ba6fd64p+9, 0x1.f9414911beabdp+1, 0x1.4ba5b82fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.456c6df472c83p+9, 0x1.241b1d7eb6e6ep+2, 0x1.0941f20be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.476e1e6dae938p+9, 0x1.84f7988c88792p+2, 0x1.5091f105f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4210a711fda9bp+9, 0x1.39921bc3ba876p+1, 0x1.867140be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44b366ee63a13p+9, 0x1.c11b7047448a8p+1, 0x1.2fa17fe0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44e7a3dfae438p+9, 0x1.b384e82034ca3p+1, 0x1.5d87450be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.45081d741c384p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.451fafa24c5a1p+9, 0x1.f939324e3acbdp+1, 0x1.4b88e82fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45781d1e96921p+9, 0x1.24280a8a9ec6ep+2, 0x1.0853110be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.477dad73c8ad7p+9, 0x1.85186633c2092p+2, 0x1.4f4f5205f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4216ec8d6d18fp+9, 0x1.398fbcfa43e76p+1, 0x1.846470be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44bc625c279d7p+9, 0x1.bf4d573a3c6a8p+1, 0x1.1fe70980be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44f059bb5cfcep+9, 0x1.b362db02330a3p+1, 0x1.5bf9a60be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4511a88feed2bp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.4529ca60be8e7p+9, 0x1.f9311c38c64bdp+1, 0x1.4b6e082fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.4583cccd16fedp+9, 0x1.2434ebf1d026ep+2, 0x1.0765080be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.478d3dc9cabf7p+9, 0x1.85391467aba92p+2, 0x1.4e0dd585f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.421d31fcb9c86p+9, 0x1.398d6164bf876p+1, 0x1.8257c0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44c5548bfab32p+9, 0x1.bd97922199ca7p+1, 0x1.107db2a0be827p-14, H2O_REGION3L_PT },
+	{ 0x1.44f90ee8b4126p+9, 0x1.b340f4b8b52a3p+1, 0x1.5a6c080be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.451b33abc16d2p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.4533e4f5c9ee9p+9, 0x1.f92906c570ebdp+1, 0x1.4b550c2fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.458f7cff7cd3fp+9, 0x1.2441c1bee836ep+2, 0x1.0677d90be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.479ccf6e72bc1p+9, 0x1.8559a344b1e92p+2, 0x1.4ccd7d05f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4223775ff41e3p+9, 0x1.398b09032d676p+1, 0x1.804af0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44ce3dfa6bff7p+9, 0x1.bbf9a22b71aa6p+1, 0x1.01658a50be827p-14, H2O_REGION3L_PT },
+	{ 0x1.4501c3687a537p+9, 0x1.b31f3543b1ca3p+1, 0x1.58de690be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4524bec794079p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.453dff6171b88p+9, 0x1.f920f1e853cbdp+1, 0x1.4b3df42fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.459b2db55143ap+9, 0x1.244e8bfc85b6ep+2, 0x1.058b840be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.47ac62607fb8fp+9, 0x1.857a12e742e92p+2, 0x1.4b8e4785f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4229bcb72c806p+9, 0x1.3988b3d58d876p+1, 0x1.7e3e30be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44d71f218158cp+9, 0x1.ba7308a0050a6p+1, 0x1.e53cfbc17d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.450a773b768f5p+9, 0x1.b2fd9ca3356a3p+1, 0x1.5750ca0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.452e49e366a2p+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.454819a3b8ed6p+9, 0x1.f918dd95a10bdp+1, 0x1.4b28b82fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45a6deee1decdp+9, 0x1.245b4ab54c16ep+2, 0x1.04a0090be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.47bbf69eb1eedp+9, 0x1.859a636bccc92p+2, 0x1.4a503485f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4230020273552p+9, 0x1.398661dbe3076p+1, 0x1.7c3170be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44dff878b7bf4p+9, 0x1.b90346ad65ca5p+1, 0x1.c85124a17d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.45132a626f958p+9, 0x1.b2dc2ad7338a3p+1, 0x1.55c32b0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4537d4ff393c7p+9, 0x1.dd2b6f222d0b3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.455233bca251ep+9, 0x1.f910c9c1ad2bdp+1, 0x1.4b15642fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45b290a96cdb6p+9, 0x1.2467fdf3d886ep+2, 0x1.03b5660be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.47cb8c27cab99p+9, 0x1.85ba94eebda92p+2, 0x1.49134585f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.42364741d902ap+9, 0x1.398413162ac76p+1, 0x1.7a24a0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.44e8ca7502e52p+9, 0x1.b7a9dd95b10a5p+1, 0x1.ac079ae17d04ep-15, H2O_REGION3L_PT },
+	{ 0x1.451bdcde2c354p+9, 0x1.b2badfdfb26a3p+1, 0x1.54358c0be826dp-18, H2O_REGION3M_PT },
+	{ 0x1.4541601b0bd6fp+9, 0x1.dd2b6f2229eb3p+1, 0x1.12f0be826d695p-30, H2O_REGION3N_PT },
+	{ 0x1.455c4dac306efp+9, 0x1.f908b660ef0bdp+1, 0x1.4b03e02fa09b6p-20, H2O_REGION3O_PT },
+	{ 0x1.45be42e6c887ep+9, 0x1.2474a5c2c9c6ep+2, 0x1.02cb9e0be826dp-18, H2O_REGION3P_PT },
+	{ 0x1.47db22fa8c983p+9, 0x1.85daa78c80892p+2, 0x1.47d77905f4137p-17, H2O_REGION3J_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.412554e3d3574p+9, 0x1.39f40f7bc4df4p+1, 0x1.bc50f0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42f597348e7cdp+9, 0x1.4929b1a2328fdp+1, 0x1.0ac4c50be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43973dd6c6fdep+9, 0x1.a10f639de4fbcp+1, 0x1.9ec0ff0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43a23ce0c2988p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43b13cb697942p+9, 0x1.142a57671c6dfp+2, 0x1.586aee17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.446d955c08172p+9, 0x1.59e84871e182p+2, 0x1.2fad7e85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4539e8b6e87a5p+9, 0x1.7ff1ea8e06ab1p+2, 0x1.6e968305f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.412b742526c74p+9, 0x1.39f14aae6e628p+1, 0x1.ba6a90be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42fc0262e683bp+9, 0x1.490f06d499f8ep+1, 0x1.09db320be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.439f5fcd95767p+9, 0x1.a0e5f610ff9fep+1, 0x1.9c9cfe0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43ab8ae8afef1p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43bc01f2d5333p+9, 0x1.1432e56bdfb97p+2, 0x1.5323d017d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.447b12e606634p+9, 0x1.5a06a4150ff4ep+2, 0x1.2e93be05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4548e2056e876p+9, 0x1.80169079bdf69p+2, 0x1.6d44fd85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41319358a7e03p+9, 0x1.39ee88ec8d907p+1, 0x1.b88440be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.43026d0c1f23ep+9, 0x1.48f4736c20204p+1, 0x1.08f19d0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43a780f59506bp+9, 0x1.a0bcbf67727f1p+1, 0x1.9a78fe0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43b4d8f09d45ap+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43c6c7847bf79p+9, 0x1.143b51b1b884ep+2, 0x1.4de39617d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.4488919f1cb69p+9, 0x1.5a24e37fd415bp+2, 0x1.2d79fd05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4557dcc1d9ad4p+9, 0x1.803b14a43d03bp+2, 0x1.6bf47f05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4137b27e65d52p+9, 0x1.39ebca3622691p+1, 0x1.b69dd0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4308d730ad271p+9, 0x1.48d9f768cb6fp+1, 0x1.08080a0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43afa14fd7aefp+9, 0x1.a093bfa12d92cp+1, 0x1.9854fe0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43be26f88a9c4p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43d18d6a3af65p+9, 0x1.14439c64d281ap+2, 0x1.48aa4017d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.4496118631508p+9, 0x1.5a4306b23118fp+2, 0x1.2c603c85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4566d8ead8eap+9, 0x1.805f7727e1d27p+2, 0x1.6aa50805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.413dd1966fd92p+9, 0x1.39e90e8b2cec6p+1, 0x1.b4b770be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.430f40d105571p+9, 0x1.48bf92ca9f19bp+1, 0x1.071e780be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43b7c0dd6f6f3p+9, 0x1.a06af6be3dadp+1, 0x1.9630fe0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43c7750077f2dp+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43dc53a2c2fd8p+9, 0x1.144bc5b132eaap+2, 0x1.4377c217d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44a3929a2a70ap+9, 0x1.5a610dac25647p+2, 0x1.2b467c05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4575d67f1c42fp+9, 0x1.8083b81f025f9p+2, 0x1.69569785f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4143f0a0d51f4p+9, 0x1.39e655ebb04edp+1, 0x1.b2d110be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4315a9ed9c7dcp+9, 0x1.48a5459197ebcp+1, 0x1.0634e30be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43bfdf9f6e47bp+9, 0x1.a04264be9c64dp+1, 0x1.940cfd0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43d0c30865496p+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43e71a2cc692bp+9, 0x1.1453cdc2853cbp+2, 0x1.3e4c0e17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44b114d9ee567p+9, 0x1.5a7ef86dac296p+2, 0x1.2a2cbc05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4584d57d54c45p+9, 0x1.80a7d7a3fcab1p+2, 0x1.68092f05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.414a0f9da4daap+9, 0x1.39e3a057a95bfp+1, 0x1.b0eaa0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.431c1286e764fp+9, 0x1.488b0fbdaf7c3p+1, 0x1.054b500be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43c7fd96e6389p+9, 0x1.a01a09a24ceebp+1, 0x1.91e8fd0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43da111052ap+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43f1e106f9ef7p+9, 0x1.145bb4c450189p+2, 0x1.39271e17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44be984463414p+9, 0x1.5a9cc6f6cbd0cp+2, 0x1.2912fb85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4593d5e43481ap+9, 0x1.80cbd5d1237d2p+2, 0x1.66bccd05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41502e8cee3e5p+9, 0x1.39e0edcf14df4p+1, 0x1.af0440be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.43227a9d5ad65p+9, 0x1.4870f14ef29dp+1, 0x1.0461bc0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43d01ac4e942p+9, 0x1.9ff1e56948e19p+1, 0x1.8fc4fd0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43e35f183ff69p+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.43fca83012ffep+9, 0x1.14637ae1d201ap+2, 0x1.3408ec17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44cc1cd86f70ap+9, 0x1.5aba794781261p+2, 0x1.27f93b05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45a2d7b26e953p+9, 0x1.80efb2c0d4d5bp+2, 0x1.65717205f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41564d6ec07d5p+9, 0x1.39de3e51fc763p+1, 0x1.ad1de0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4328e2316b9bdp+9, 0x1.4856ea4557b0bp+1, 0x1.0378280be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43d8372a89641p+9, 0x1.9fc9f81399dbp+1, 0x1.8da0fc0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43ecad202d4d3p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.44076fa6c95fep+9, 0x1.146b20460e2f9p+2, 0x1.2ef16a17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44d9a294f924p+9, 0x1.5ad80f5fcc295p+2, 0x1.26df7a05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45b1dae6b7209p+9, 0x1.81136e8d6b806p+2, 0x1.64271e05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.415c6c432acadp+9, 0x1.39db91e059b7ep+1, 0x1.ab3770be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.432f49438e7f3p+9, 0x1.483cfaa0deb74p+1, 0x1.028e950be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43e052c8d89fp+9, 0x1.9fa241a1363d7p+1, 0x1.8b7cfc0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43f5fb281aa3cp+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.44123769d658cp+9, 0x1.1472a51bd7c69p+2, 0x1.29e09217d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44e72978e69adp+9, 0x1.5af5893fb00f1p+2, 0x1.25c5ba05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45c0df7fc34c7p+9, 0x1.813709513bdf9p+2, 0x1.62ddd105f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41628b0a3c59ep+9, 0x1.39d8e87a296fap+1, 0x1.a95110be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4335afd4384a3p+9, 0x1.48232261914e4p+1, 0x1.01a5010be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43e86da0e8f2ep+9, 0x1.9f7ac2122472p+1, 0x1.8958fc0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.43ff493007fa5p+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.441cff77f4df6p+9, 0x1.147a098db6989p+2, 0x1.24d65617d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.44f4b1831e14ap+9, 0x1.5b12e6e7266e4p+2, 0x1.24abf905f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45cfe57c49486p+9, 0x1.815a8326a58d8p+2, 0x1.61958b85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4168a9c4045d8p+9, 0x1.39d6421f7206ap+1, 0x1.a76ac0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.433c15e3ddc6cp+9, 0x1.4809618762a39p+1, 0x1.00bb6e0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43f087b3cc5fep+9, 0x1.9f53796664789p+1, 0x1.8734fc0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.44089737f550fp+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.4427c7cfe1914p+9, 0x1.14814dc605989p+2, 0x1.1fd2b217d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.45023ab285d0cp+9, 0x1.5b302856374a2p+2, 0x1.23923805f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45deecdb004b4p+9, 0x1.817ddc27fcecap+2, 0x1.604e4c85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.416ec8709208dp+9, 0x1.39d39ed030484p+1, 0x1.a58450be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.43427b72f3be9p+9, 0x1.47efb8125c54dp+1, 0x1.ffa3b617d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.43f8a10294e63p+9, 0x1.9f2c679df31cap+1, 0x1.8510fb0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.4411e53fe2a78p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.443290705ab2cp+9, 0x1.148871eee2d3bp+2, 0x1.1ad59817d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.450fc506040edp+9, 0x1.5b4d4d8cdc39cp+2, 0x1.22787805f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45edf59aa092dp+9, 0x1.81a1146f9cc89p+2, 0x1.5f081585f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4174e70ff48eep+9, 0x1.39d0fe8c64349p+1, 0x1.a39df0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4348e081eefb8p+9, 0x1.47d626027b2d7p+1, 0x1.fdd08c17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4400b98e5485fp+9, 0x1.9f058cb8d05e5p+1, 0x1.82ecfa0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.441b3347cffe1p+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.443d5958202ccp+9, 0x1.148f76322c3cbp+2, 0x1.15df0817d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.451d507c7f0e3p+9, 0x1.5b6a568b16d74p+2, 0x1.215eb785f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.45fcffb9e363fp+9, 0x1.81c42c17de526p+2, 0x1.5dc2e485f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.417b05a23b22cp+9, 0x1.39ce615414349p+1, 0x1.a1b790be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.434f451144476p+9, 0x1.47bcab57bbf8fp+1, 0x1.fbfd6417d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4408d1581d3f4p+9, 0x1.9edee8b6ff72p+1, 0x1.80c8fb0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.4424814fbd54bp+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.44482285f38a2p+9, 0x1.14965ab98c7e5p+2, 0x1.10eeee17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.452add14dd0e5p+9, 0x1.5b874350e8bdp+2, 0x1.2044f705f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.460c0b37830a9p+9, 0x1.81e7233b1f8a3p+2, 0x1.5c7ebb85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4181242774f7ap+9, 0x1.39cbc72733763p+1, 0x1.9fd130be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4355a921686bfp+9, 0x1.47a3481221ebdp+1, 0x1.fa2a3e17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4410e86101125p+9, 0x1.9eb87b987d234p+1, 0x1.7ea4fb0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.442dcf57aaab4p+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.4452ebf897f5cp+9, 0x1.149d1fae7492p+2, 0x1.0c054c17d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.45386ace044ebp+9, 0x1.5ba413de51eafp+2, 0x1.1f2b3685f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.461b18123ad9ep+9, 0x1.8209f9f3b19dep+2, 0x1.5b3b9985f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4187429fb1407p+9, 0x1.39c93005cb97p+1, 0x1.9dead0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.435c0cb2d033p+9, 0x1.4789fc31b03a9p+1, 0x1.f8571617d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4418feaa11ff4p+9, 0x1.9e92455d4ca68p+1, 0x1.7c80fa0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.44371d5f9801ep+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.445db5aed2384p+9, 0x1.14a3c53a1ef48p+2, 0x1.07221017d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.4545f9a6db0edp+9, 0x1.5bc0c83350c6dp+2, 0x1.1e117585f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.462a2648c72bdp+9, 0x1.822cb05bf427bp+2, 0x1.59f97e05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.418d610aff305p+9, 0x1.39c69befdc97p+1, 0x1.9c0470be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.43626fc5f0667p+9, 0x1.4770c7b6607c3p+1, 0x1.f683ee17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4421143462064p+9, 0x1.9e6c46056ac76p+1, 0x1.7a5cf90be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.44406b6785587p+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.44687fa768b5ep+9, 0x1.14aa4b85846dfp+2, 0x1.02453817d04dbp-19, H2O_REGION3W_PT },
+	{ 0x1.4553899e478e2p+9, 0x1.5bdd604fe550bp+2, 0x1.1cf7b585f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.463935d9e561ap+9, 0x1.824f468e4058fp+2, 0x1.58b86985f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41937f696dfa6p+9, 0x1.39c40ae5600d3p+1, 0x1.9a1e00be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.4368d25b3dcffp+9, 0x1.4757aaa035e54p+1, 0x1.f4b0ca17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4429290103277p+9, 0x1.9e467d90d785bp+1, 0x1.7838f90be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.4449b96f72afp+9, 0x1.dd2b6f222c48p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.447349e1236bfp+9, 0x1.14b0b2b97281ap+2, 0x1.fadd682fa09b6p-20, H2O_REGION3W_PT },
+	{ 0x1.45611ab3300c1p+9, 0x1.5bf9dc341122cp+2, 0x1.1bddf505f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.464846c453e3ap+9, 0x1.8271bca4ec2e4p+2, 0x1.57785c85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41999dbb0cd1ap+9, 0x1.39c17ce65c628p+1, 0x1.9837a0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.436f34732d397p+9, 0x1.473ea4ef3075ap+1, 0x1.f2dda217d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.44313d110762fp+9, 0x1.9e20ebff994aap+1, 0x1.7614f80be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.445307776005ap+9, 0x1.dd2b6f2229138p+1, 0x1.12f0be826d695p-30, H2O_REGION3V_PT },
+	{ 0x1.447e145acbef2p+9, 0x1.14b6fafe71c9dp+2, 0x1.f13d042fa09b6p-20, H2O_REGION3W_PT },
+	{ 0x1.456eace47ac82p+9, 0x1.5c163bdfd2a2cp+2, 0x1.1ac43485f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.46575906d2211p+9, 0x1.829412ba540d7p+2, 0x1.56395685f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4116e38f570b5p+9, 0x1.39fb36c137f74p+1, 0x1.39da817d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.42e670e9b479p+9, 0x1.496e7c85a4e3dp+1, 0x1.768e3c2fa09b6p-20, H2O_REGION3Q_PT },
+	{ 0x1.43840b507eaf7p+9, 0x1.a17a96a598636p+1, 0x1.24680017d04dbp-19, H2O_REGION3U_PT },
+	{ 0x1.438c49ba5e354p+9, 0x1.dd2b6f222b2bap+1, 0x1.12f0be826d695p-30, H2O_REGION3Y_PT },
+	{ 0x1.4397d5d144f7ap+9, 0x1.1413cd7fa42d7p+2, 0x1.f280085f4136bp-21, H2O_REGION3Z_PT },
+	{ 0x1.444dc743d0e11p+9, 0x1.5999f0fcb9af3p+2, 0x1.aa7ca617d04dbp-19, H2O_REGION3X_PT },
+	{ 0x1.45169bbc0986p+9, 0x1.7f9358526a258p+2, 0x1.01679f0be826dp-18, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.411a7febbee5fp+9, 0x1.39f98fc5509e3p+1, 0x1.3912e17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.42ea3ac26ed77p+9, 0x1.495e9c404e8acp+1, 0x1.75ce9c2fa09b6p-20, H2O_REGION3Q_PT },
+	{ 0x1.4388d85f48869p+9, 0x1.a161ce73b2c79p+1, 0x1.23873217d04dbp-19, H2O_REGION3U_PT },
+	{ 0x1.4391c683f74e1p+9, 0x1.dd2b6f222b2bap+1, 0x1.12f0be826d695p-30, H2O_REGION3Y_PT },
+	{ 0x1.439e2f5c6557dp+9, 0x1.141910b09333p+2, 0x1.ee1ba85f4136bp-21, H2O_REGION3Z_PT },
+	{ 0x1.4455ba2a61f4bp+9, 0x1.59ac065926084p+2, 0x1.a9957e17d04dbp-19, H2O_REGION3X_PT },
+	{ 0x1.451f6e3a3a85ep+9, 0x1.7fa92cb0691ffp+2, 0x1.00dbff0be826dp-18, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.411e1c43497ccp+9, 0x1.39f7e9d87d97bp+1, 0x1.384b617d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.42ee046c6bff4p+9, 0x1.494ec41e04a08p+1, 0x1.750ef82fa09b6p-20, H2O_REGION3Q_PT },
+	{ 0x1.438da5251d0e6p+9, 0x1.a1491958db92ep+1, 0x1.22a66617d04dbp-19, H2O_REGION3U_PT },
+	{ 0x1.4397434d9066ep+9, 0x1.dd2b6f222a899p+1, 0x1.12f0be826d695p-30, H2O_REGION3Y_PT },
+	{ 0x1.43a4890681fafp+9, 0x1.141e47f6b9dadp+2, 0x1.e9bab05f4136bp-21, H2O_REGION3Z_PT },
+	{ 0x1.445dad7b6cb5dp+9, 0x1.59be11e4f039cp+2, 0x1.a8ae5417d04dbp-19, H2O_REGION3X_PT },
+	{ 0x1.45284138f3d41p+9, 0x1.7fbef535c39dap+2, 0x1.00509e0be826dp-18, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4121b895f9eddp+9, 0x1.39f644fac5931p+1, 0x1.3783e17d04dadp-23, H2O_REGION3C_PT },
+	{ 0x1.42f1cde7c3e4fp+9, 0x1.493ef41eb8269p+1, 0x1.744f542fa09b6p-20, H2O_REGION3Q_PT },
+	{ 0x1.439271a2347a6p+9, 0x1.a130775504209p+1, 0x1.21c59817d04dbp-19, H2O_REGION3U_PT },
+	{ 0x1.439cc017297fbp+9, 0x1.dd2b6f222b2bap+1, 0x1.12f0be826d695p-30, H2O_REGION3Y_PT },
+	{ 0x1.43aae2cf54b6p+9, 0x1.1423735b4a80fp+2, 0x1.e55d105f4136bp-21, H2O_REGION3Z_PT },
+	{ 0x1.4465a136b75a1p+9, 0x1.59d013a01c5bcp+2, 0x1.a7c72a17d04dbp-19, H2O_REGION3X_PT },
+	{ 0x1.453114b7efb06p+9, 0x1.7fd4b1e7dcdd3p+2, 0x1.ff8afa17d04dbp-19, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40ed513701f7bp+9, 0x1.3a0e28b949a8fp+1, 0x1.4ce580be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42bac711750cfp+9, 0x1.4a23f8375ce8p+1, 0x1.8c633017d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.434cb1f978f9cp+9, 0x1.a2979c66ac7e5p+1, 0x1.38ec960be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.434cb1f9ea819p+9, 0x1.e2d44da961edbp+1, 0x1.66895402fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.434ec61ff8df1p+9, 0x1.13d519e0b981dp+2, 0x1.1c108817d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.43f264592a2ccp+9, 0x1.58cb139fd4ee3p+2, 0x1.c407710be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44b1312879dbfp+9, 0x1.7e999a154efc3p+2, 0x1.10e72185f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40f283a6065c9p+9, 0x1.3a0bb73171c2fp+1, 0x1.4bbc30be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42c03da4c52e9p+9, 0x1.4a0c9e3da787p+1, 0x1.8b45b217d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.43539f4220721p+9, 0x1.a272c32ede78cp+1, 0x1.379daf0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.4354af6348002p+9, 0x1.e2290f4e6fea1p+1, 0x1.6f01f102fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.4357e7250d57dp+9, 0x1.13dd6dd539518p+2, 0x1.18ae6417d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.43fdcda572b56p+9, 0x1.58e5b57b888afp+2, 0x1.c2af100be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44bddac71a7b6p+9, 0x1.7eb9c250316bfp+2, 0x1.10130505f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40f7b60ab0d16p+9, 0x1.3a0947daecb87p+1, 0x1.4a9300be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42c5b3d528cb4p+9, 0x1.49f5551d0965bp+1, 0x1.8a283417d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.435a8beeadf08p+9, 0x1.a24e117e28f55p+1, 0x1.364ec70be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.435ca9f734e8cp+9, 0x1.e179adcf0ce22p+1, 0x1.7811b142fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.43610870b1087p+9, 0x1.13e5a8496b80bp+2, 0x1.15500a17d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.440937d360472p+9, 0x1.590043048e862p+2, 0x1.c156af0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44ca85762f8ebp+9, 0x1.7ed9d18a331f3p+2, 0x1.0f3f7185f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40fce8650aa01p+9, 0x1.3a06dab5be508p+1, 0x1.4969c0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42cb29a2e742ap+9, 0x1.49de1cd582844p+1, 0x1.890ab417d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.436177ffc8e8ap+9, 0x1.a22987548bf4p+1, 0x1.34ffe00be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.4364a1a42a623p+9, 0x1.e0c5dedaa989ep+1, 0x1.81c55a42fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.436a2a020be14p+9, 0x1.13edc959c5a82p+2, 0x1.11f57217d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.4414a2e246b1cp+9, 0x1.591abc3ae4fc6p+2, 0x1.bffe4f0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44d73134e53dcp+9, 0x1.7ef9c7d368e1fp+2, 0x1.0e6c6605f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41021ab51d12ap+9, 0x1.3a046fc1ea51ep+1, 0x1.484080be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42d09f0e47f42p+9, 0x1.49c6f5671e373p+1, 0x1.87ed3417d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.4368637618cep+9, 0x1.a20524b203addp+1, 0x1.33b0f90be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.436c965766c16p+9, 0x1.e00d51cebbfb8p+1, 0x1.8c2ada82fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.43734bd846c38p+9, 0x1.13f5d12293d4dp+2, 0x1.0e9e9417d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.44200ed179c4fp+9, 0x1.5935211e8bedap+2, 0x1.bea5ed0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44e3de026838bp+9, 0x1.7f19a53bed2a4p+2, 0x1.0d99e285f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.41074cfaf1732p+9, 0x1.3a0206ff61a11p+1, 0x1.471740be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42d61417923f9p+9, 0x1.49afded1cd63p+1, 0x1.86cfb617d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.436f4e5245142p+9, 0x1.a1e0e9969b778p+1, 0x1.3262120be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.437487fcd2c33p+9, 0x1.df4faf1576e48p+1, 0x1.9751bd42fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.437c6df28b806p+9, 0x1.13fdbfc003dcdp+2, 0x1.0b4b6e17d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.442b7ba04d506p+9, 0x1.594f71af8359ep+2, 0x1.bd4d8d0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44f08bdde5b81p+9, 0x1.7f3969d3e018dp+2, 0x1.0cc7e785f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.410c7f36910b6p+9, 0x1.39ffa06e3359ap+1, 0x1.45ee10be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42db88bf0d847p+9, 0x1.4998d91597958p+1, 0x1.85b23a17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.43763894f52ecp+9, 0x1.a1bcd6024bc34p+1, 0x1.31132b0be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.437c767ee415fp+9, 0x1.de8c9768bc9cep+1, 0x1.a34ae902fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.4385905004d7dp+9, 0x1.1405954e1827p+2, 0x1.07fc0017d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.4436e94e1523cp+9, 0x1.5969adedcb413p+2, 0x1.bbf52d0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.44fd3ac68b7d1p+9, 0x1.7f5915ab5496p+2, 0x1.0bf67585f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4111b16805257p+9, 0x1.39fd3c0e5bb4ap+1, 0x1.44c4d0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42e0fd0501226p+9, 0x1.4981e4327ccebp+1, 0x1.8494ba17d04dbp-19, H2O_REGION3Q_PT },
+	{ 0x1.437d223ed0915p+9, 0x1.a198e9f514912p+1, 0x1.2fc4430be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.438461c67cdbp+9, 0x1.ddc3a30d480e1p+1, 0x1.b02979c2fa09bp-16, H2O_REGION3Y_PT },
+	{ 0x1.438eb2efde76ep+9, 0x1.140d51e8c3fecp+2, 0x1.04b03c17d04dbp-19, H2O_REGION3Z_PT },
+	{ 0x1.444257da250ecp+9, 0x1.5983d5d963a38p+2, 0x1.ba9ccb0be826dp-18, H2O_REGION3X_PT },
+	{ 0x1.4509eabb87d11p+9, 0x1.7f78a8d268deep+2, 0x1.0b258b85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40e618d28672ep+9, 0x1.3a123a7000d6bp+1, 0x1.229582fa09b5ap-24, H2O_REGION3C_PT },
+	{ 0x1.42b32f6ec45a3p+9, 0x1.4a4ad2982a18cp+1, 0x1.5607b85f4136bp-21, H2O_REGION3Q_PT },
+	{ 0x1.434193c5fef36p+9, 0x1.e3e7e3271fa43p+1, 0x1.2890e60be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.434217d929903p+9, 0x1.13c7140f673cdp+2, 0x1.f1dd50be826d7p-22, H2O_REGION3Z_PT },
+	{ 0x1.43e28b5bcbb94p+9, 0x1.589ec169f08bep+2, 0x1.85e0382fa09b6p-20, H2O_REGION3X_PT },
+	{ 0x1.449f9b76174d8p+9, 0x1.7e6414eb075c7p+2, 0x1.d6c4e42fa09b6p-20, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40e880f640c41p+9, 0x1.3a1116ce40383p+1, 0x1.221f82fa09b5ap-24, H2O_REGION3C_PT },
+	{ 0x1.42b5b764fbe72p+9, 0x1.4a3ff33c2bb46p+1, 0x1.5596485f4136bp-21, H2O_REGION3Q_PT },
+	{ 0x1.434549177534ap+9, 0x1.e39bf1457cf58p+1, 0x1.2b87340be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.434651e14fbdcp+9, 0x1.13cb063b939a2p+2, 0x1.ef2760be826d7p-22, H2O_REGION3Z_PT },
+	{ 0x1.43e7d37f9b5a7p+9, 0x1.58ab28d00f782p+2, 0x1.8557682fa09b6p-20, H2O_REGION3X_PT },
+	{ 0x1.44a577cc246fbp+9, 0x1.7e730f8d2101p+2, 0x1.d61b902fa09b6p-20, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40eae917bef6fp+9, 0x1.3a0ff3a4e48aap+1, 0x1.21a982fa09b5ap-24, H2O_REGION3C_PT },
+	{ 0x1.42b83f45df1b3p+9, 0x1.4a35177d21fbfp+1, 0x1.5524e05f4136bp-21, H2O_REGION3Q_PT },
+	{ 0x1.4348fdd3eeb51p+9, 0x1.e34f3b2a67c3p+1, 0x1.2e94f20be826dp-18, H2O_REGION3U_PT },
+	{ 0x1.434a8bf8f165ep+9, 0x1.13cef2e25e05cp+2, 0x1.ec72e0be826d7p-22, H2O_REGION3Z_PT },
+	{ 0x1.43ed1bd415dedp+9, 0x1.58b78bda7484p+2, 0x1.84ce9c2fa09b6p-20, H2O_REGION3X_PT },
+	{ 0x1.44ab545cf701bp+9, 0x1.7e8204caf6b45p+2, 0x1.d5726c2fa09b6p-20, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fdc62d388d63p+9, 0x1.3a9a1762ebd63p+1, 0x1.1db2105f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4199e3a9627a2p+9, 0x1.4f46d59402fcap+1, 0x1.4a46300be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.419d59065f332p+9, 0x1.fc4f475f42d67p+1, 0x1.47a1b242fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41a0b677877c2p+9, 0x1.52e96e51eb51fp+2, 0x1.7b72fd85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.421eee46526a8p+9, 0x1.7776d989a0ecbp+2, 0x1.cfa55805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fe2a915923edp+9, 0x1.3a969b5bf1e54p+1, 0x1.1cade05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41a0937a7e6d2p+9, 0x1.4f268b7daaa9ap+1, 0x1.494c490be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41a77c4b1ff16p+9, 0x1.fbcec75dcc0d7p+1, 0x1.487d47c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41ae3b386988dp+9, 0x1.530e878c125f7p+2, 0x1.7a458c85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.422de84740109p+9, 0x1.77a42bc46468p+2, 0x1.ce013f05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fe8ef45d13ebp+9, 0x1.3a9322845bdd5p+1, 0x1.1ba9b85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41a742a6be58cp+9, 0x1.4f0659e05c823p+1, 0x1.4852630be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41b19cffcc16ep+9, 0x1.fb4dee8e870d2p+1, 0x1.49672802fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41bbc1741f438p+9, 0x1.5333834104009p+2, 0x1.79181b05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.423ce416f858cp+9, 0x1.77d154e9565fp+2, 0x1.cc5e4505f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fef35645618fp+9, 0x1.3a8facdc2379fp+1, 0x1.1aa5885f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41adf12e9f305p+9, 0x1.4ee640bc15642p+1, 0x1.47587c0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41bbbb229e396p+9, 0x1.faccb730e7068p+1, 0x1.4a602942fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41c949297b3acp+9, 0x1.53586170c0354p+2, 0x1.77eaa985f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.424be1b3d7b9cp+9, 0x1.77fe5514a970cp+2, 0x1.cabc6c05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3ff57b7131109p+9, 0x1.3a8c3a634598ep+1, 0x1.19a1505f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41b49f129de71p+9, 0x1.4ec64010d871ap+1, 0x1.465e960be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41c5d6b1b392ep+9, 0x1.fa4b1b2e8939bp+1, 0x1.4b6915c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41d6d2574ffd2p+9, 0x1.537d221b46fdap+2, 0x1.76bd3885f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.425ae11c3bca2p+9, 0x1.782b2c6289f7fp+2, 0x1.c91bb205f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3ffbc16c72688p+9, 0x1.3a88cb19cba0cp+1, 0x1.189d205f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41bb4c5337705p+9, 0x1.4ea657dea2887p+1, 0x1.4564af0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41cfefab0a48cp+9, 0x1.f9c9141d146cdp+1, 0x1.4c82e242fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41e45cfc70193p+9, 0x1.53a1c5409d0cfp+2, 0x1.758fc685f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4269e24e83405p+9, 0x1.7857daef2c24dp+2, 0x1.c77c1805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.400207562a63ep+9, 0x1.3a855effac2bp+1, 0x1.1798f05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41c1f8f0e8bf5p+9, 0x1.4e86882579ed1p+1, 0x1.446ac90be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41da060c7fbf1p+9, 0x1.f9469b349384ap+1, 0x1.4dae80c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41f1e917ae1dbp+9, 0x1.53c64ae0b8fc7p+2, 0x1.74625585f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4278e5490df29p+9, 0x1.788460d6c1055p+2, 0x1.c5dd9e05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40084d2e6945ap+9, 0x1.3a81f614ea59cp+1, 0x1.1694c05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41c8a4ec2ec77p+9, 0x1.4e66d0e55538dp+1, 0x1.4370e20be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41e419d3cebaap+9, 0x1.f8c3a94653baep+1, 0x1.4eeceb02fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.41ff76a7dc99p+9, 0x1.53eab2fba5c41p+2, 0x1.7334e405f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4287ea0a3cd71p+9, 0x1.78b0be3578167p+2, 0x1.c4404405f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.400e92f53f50cp+9, 0x1.3a7e9059894f4p+1, 0x1.1590905f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41cf5045867bep+9, 0x1.4e47321e3ab03p+1, 0x1.4276fc0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41ee2afe8d547p+9, 0x1.f84036bc6422bp+1, 0x1.503f4542fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.420d05abce19fp+9, 0x1.540efd9159fd1p+2, 0x1.72077285f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4296f0907203dp+9, 0x1.78dcf32783f73p+2, 0x1.c2a40a05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4014d8aabcc85p+9, 0x1.3a7b2dcd82c71p+1, 0x1.148c605f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41d5fafd6ccffp+9, 0x1.4e27abd02a531p+1, 0x1.417d150be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.41f8398a2aea9p+9, 0x1.f7bc3b8aa3555p+1, 0x1.51a6c042fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.421a9622552efp+9, 0x1.54332aa1da5adp+2, 0x1.70da0105f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42a5f8da10aecp+9, 0x1.7908ffc912936p+2, 0x1.c108f005f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.401b1e4ef1ef4p+9, 0x1.3a77ce70e027fp+1, 0x1.1388305f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41dca5145eb6fp+9, 0x1.4e083dfb20ff5p+1, 0x1.40832e0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42024573edc4bp+9, 0x1.f737af2bc5f14p+1, 0x1.5324a542fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4228280a4466ap+9, 0x1.54573a2d286e6p+2, 0x1.6fac9005f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42b502e57d2d9p+9, 0x1.7934e436581b4p+2, 0x1.bf6ef505f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.402163e1ef08bp+9, 0x1.3a7472439b2d4p+1, 0x1.1284085f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41e34e8ad9242p+9, 0x1.4de8e89f21d72p+1, 0x1.3f89480be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.420c4eb8f0a98p+9, 0x1.f6b28897242d9p+1, 0x1.54ba5102fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4235bb626e4fbp+9, 0x1.547b2c333df35p+2, 0x1.6e7f1e05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42c40eb11cf5fp+9, 0x1.7960a08b840bbp+2, 0x1.bdd61a85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4027a963c457ap+9, 0x1.3a711945ad92bp+1, 0x1.117fd05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41e9f761590adp+9, 0x1.4dc9abbc29b84p+1, 0x1.3e8f610be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42165556203fep+9, 0x1.f62cbe34b7a18p+1, 0x1.56692e42fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42435029a5789p+9, 0x1.549f00b422bf4p+2, 0x1.6d51ac85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42d31c3b569d6p+9, 0x1.798c34e4c5e19p+2, 0x1.bc3e6005f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.402deed4821efp+9, 0x1.3a6dc37727036p+1, 0x1.107ba05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41f09f985b5e4p+9, 0x1.4daa87523bc5p+1, 0x1.3d957a0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4220594838336p+9, 0x1.f5a645d479f6ep+1, 0x1.5832d882fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4250e65ebc7p+9, 0x1.54c2b7afd08dap+2, 0x1.6c243b85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42e22b8291d93p+9, 0x1.79b7a15e51cd2p+2, 0x1.baa7c505f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4034343438a1dp+9, 0x1.3a6a70d7faf66p+1, 0x1.0f77705f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41f747305d11cp+9, 0x1.4d8b7b6154db1p+1, 0x1.3c9b940be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.422a5a8bc02b7p+9, 0x1.f51f14a2a480dp+1, 0x1.5a18fc82fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.425e7e0085c48p+9, 0x1.54e6512648efap+2, 0x1.6af6ca05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.42f13c85377ebp+9, 0x1.79e2e61455ba2p+2, 0x1.b9124a05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.403a7982f8233p+9, 0x1.3a6721682c8dep+1, 0x1.0e73405f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41fdee29db189p+9, 0x1.4d6c87e9781cbp+1, 0x1.3ba1ae0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4234591d0887dp+9, 0x1.f4971f1c4dd56p+1, 0x1.5c1d8042fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.426c170dd404ap+9, 0x1.5509cd178f078p+2, 0x1.69c95805f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43004f41b182fp+9, 0x1.7a0e032302b69p+2, 0x1.b77def05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4040bec0d0e61p+9, 0x1.3a63d527bbc9ep+1, 0x1.0d6f105f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.420494855266p+9, 0x1.4d4daceaa589fp+1, 0x1.3aa7c70be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.423e54f826e24p+9, 0x1.f40e58fe65dfep+1, 0x1.5e425002fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4279b18579bf1p+9, 0x1.552d2b839fb2fp+2, 0x1.689be705f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.430f63b66afaep+9, 0x1.7a38f8a68cf2bp+2, 0x1.b5eab405f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.404703edd32d7p+9, 0x1.3a608c16aeeefp+1, 0x1.0c6ae05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.420b3a433fed6p+9, 0x1.4d2eea64d6de4p+1, 0x1.39ade00be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42484e18f2397p+9, 0x1.f384b5377c721p+1, 0x1.60897382fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42874d6649826p+9, 0x1.55506c6a7c832p+2, 0x1.676e7585f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.431e79e1d01b7p+9, 0x1.7a63c6bb1f381p+2, 0x1.b4589905f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.404d490a0f3c6p+9, 0x1.3a5d4634fc965p+1, 0x1.0b66b05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4211df6420a1ep+9, 0x1.4d10405815806p+1, 0x1.38b3fa0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4252447afed35p+9, 0x1.f2fa25dd75c5dp+1, 0x1.62f560c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4294eaaf15dd2p+9, 0x1.55738fcc23e6fp+2, 0x1.66410485f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.432d91c24e393p+9, 0x1.7a8e6d7cef47fp+2, 0x1.b2c79d05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40538e159555fp+9, 0x1.3a5a0382a4bffp+1, 0x1.0a62785f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.421883e87176ep+9, 0x1.4cf1aec45e4e2p+1, 0x1.37ba130be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.425c381999eadp+9, 0x1.f26e9c1309e46p+1, 0x1.65887582fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42a2895eb15ep+9, 0x1.559695a8944d3p+2, 0x1.65139385f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.433cab5653c8cp+9, 0x1.7ab8ed082e307p+2, 0x1.b137c185f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4059d31075bdp+9, 0x1.3a56c3ffb0d2ap+1, 0x1.095e505f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.421f27d0af5fbp+9, 0x1.4cd335a9a7e0bp+1, 0x1.36c02d0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.426628efc4d65p+9, 0x1.f1e207f6f9213p+1, 0x1.68457182fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42b02973ee937p+9, 0x1.55b97dffd2695p+2, 0x1.63e62185f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.434bc69c505eap+9, 0x1.7ae345790b6e6p+2, 0x1.afa90605f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.406017fac0b4bp+9, 0x1.3a5387ac17679p+1, 0x1.085a205f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4225cb1d574f7p+9, 0x1.4cb4d50801e35p+1, 0x1.35c6460be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.427016f82fd85p+9, 0x1.f154589460e26p+1, 0x1.6b2f2802fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42bdcaeda00c2p+9, 0x1.55dc48d1dcaa3p+2, 0x1.62b8b005f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.435ae392b4af1p+9, 0x1.7b0d76ebb67ebp+2, 0x1.ae1b6a05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40665cd4867ffp+9, 0x1.3a504e87dec35p+1, 0x1.0755f05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.422c6dcee6399p+9, 0x1.4c968cdf62ef4p+1, 0x1.34cc600be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.427a022d34a02p+9, 0x1.f0c57bc40826ep+1, 0x1.6e48dbc2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42cb6dca9856bp+9, 0x1.55fef61eafed8p+2, 0x1.618b3f05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.436a0237f28e5p+9, 0x1.7b37817c606f5p+2, 0x1.ac8eee05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.406ca19dd761dp+9, 0x1.3a4d189303c39p+1, 0x1.0651c05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.42330fe5d9115p+9, 0x1.4c785d2fcb049p+1, 0x1.33d2790be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4283ea88d02ddp+9, 0x1.f0355e129af49p+1, 0x1.7195ec42fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42d91209aa01ap+9, 0x1.562185e650e6bp+2, 0x1.605dcd85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4379228a7cf05p+9, 0x1.7b6165473d708p+2, 0x1.ab039185f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4072e656c39d5p+9, 0x1.3a49e5cd898aap+1, 0x1.054d905f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4239b162acc9fp+9, 0x1.4c5a45f93d457p+1, 0x1.32d8930be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.428dd0049c329p+9, 0x1.efa3eaad20dc7p+1, 0x1.751a0c42fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42e6b7a9a79bap+9, 0x1.5643f828bae26p+2, 0x1.5f305b85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43884488c7e91p+9, 0x1.7b8b22687b6e1p+2, 0x1.a9795585f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40792aff5b758p+9, 0x1.3a46b63769d3fp+1, 0x1.0449585f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.42405245de56cp+9, 0x1.4c3c473bb9b1fp+1, 0x1.31deab0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4297b299c80d5p+9, 0x1.ef110b37eb348p+1, 0x1.78d93402fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.42f45ea963b33p+9, 0x1.56664ce5f425p+2, 0x1.5e02ea85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4397683148ac5p+9, 0x1.7bb4b8fc4b75fp+2, 0x1.a7f03905f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.407f6f97af2d5p+9, 0x1.3a4389d0aae41p+1, 0x1.0345285f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4246f28feaab1p+9, 0x1.4c1e60f73a057p+1, 0x1.30e4c50be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42a1924110f5bp+9, 0x1.ee7ca7acc281fp+1, 0x1.7cd7edc2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43020707b0d71p+9, 0x1.5688841df347ep+2, 0x1.5cd57905f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43a68d82758dbp+9, 0x1.7bde291ede963p+2, 0x1.a6683c85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.4085b41fcf07dp+9, 0x1.3a40609946767p+1, 0x1.0241005f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.424d92414eba1p+9, 0x1.4c00932bc4849p+1, 0x1.2feadf0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42ab6ef2b97a4p+9, 0x1.ede6a6421c9b1p+1, 0x1.811b04c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.430fb0c36195ap+9, 0x1.56aa9dd0c1b1cp+2, 0x1.5ba80785f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43b5b47ac600bp+9, 0x1.7c0772ec68ff1p+2, 0x1.a4e16005f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.408bf897cb47fp+9, 0x1.3a3d3a9145f1ep+1, 0x1.013cd05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4254315a87771p+9, 0x1.4be2ddd95c519p+1, 0x1.2ef0f80be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42b548a680803p+9, 0x1.ed4eeb2ea0bb4p+1, 0x1.85a79dc2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.431d5bdb487dap+9, 0x1.56cc99fe5aaf3p+2, 0x1.5a7a9605f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43c4dd18b298dp+9, 0x1.7c309681157ap+2, 0x1.a35ba305f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40923cffb430dp+9, 0x1.3a3a17b8a311dp+1, 0x1.0038a05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.425acfdc11d57p+9, 0x1.4bc540fff8059p+1, 0x1.2df7120be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42bf1f53970e3p+9, 0x1.ecb55886fd2eep+1, 0x1.8a837d02fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.432b084e381dap+9, 0x1.56ee78a6bfd16p+2, 0x1.594d2505f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43d4075ab5093p+9, 0x1.7c5993f919c86p+2, 0x1.a1d70605f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.409881579a057p+9, 0x1.3a36f80f5ab41p+1, 0x1.fe68e0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42616dc66ac86p+9, 0x1.4ba7bc9fa1077p+1, 0x1.2cfd2b0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42c8f2f09568fp+9, 0x1.ec19ce08722fp+1, 0x1.8fb4d442fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4338b61b03043p+9, 0x1.571039c9ef872p+2, 0x1.581fb385f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43e3333f4825p+9, 0x1.7c826b70a3d61p+2, 0x1.a0538905f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.409ec59f8d08cp+9, 0x1.3a33db95731d2p+1, 0x1.fc6070be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42680b1a0f434p+9, 0x1.4b8a50b84df07p+1, 0x1.2c03440be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42d2c3736f1e6p+9, 0x1.eb7c28debc2ddp+1, 0x1.95429702fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.434665407bcp+9, 0x1.5731dd67e83f7p+2, 0x1.56f24205f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.43f260c4e7df3p+9, 0x1.7cab1d03e7d33p+2, 0x1.9ed12b85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40a509d79d7dcp+9, 0x1.3a30c24ae92abp+1, 0x1.fa5810be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.426ea7d77c394p+9, 0x1.4b6cfd4a0504fp+1, 0x1.2b095d0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42dc90d165e9p+9, 0x1.eadc4363e5859p+1, 0x1.9b344682fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.435415bd74df8p+9, 0x1.57536380aead9p+2, 0x1.55c4d085f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.44018fea114abp+9, 0x1.7cd3a8cf121a7p+2, 0x1.9d4fee85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40ab4dffdba79p+9, 0x1.3a2dac2fbfffp+1, 0x1.f84fb0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.427543ff2e9dbp+9, 0x1.4b4fc254c6451p+1, 0x1.2a0f770be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42e65afefb4aep+9, 0x1.ea39f4e1a3027p+1, 0x1.a1921b42fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.4361c790c0f16p+9, 0x1.5774cc1441407p+2, 0x1.54975f05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.4410c0ad429a2p+9, 0x1.7cfc0eee586d3p+2, 0x1.9bcfd085f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40b1921857c93p+9, 0x1.3a2a9943f155ap+1, 0x1.f64750be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.427bdf91a363ep+9, 0x1.4b329fd88e8e8p+1, 0x1.2915900be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42f021efe0e92p+9, 0x1.e9951134097b6p+1, 0x1.a8652402fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.436f7ab932844p+9, 0x1.579617229cd5cp+2, 0x1.5369ed85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.441ff30cfb203p+9, 0x1.7d244f7de726p+2, 0x1.9a50d385f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40b7d62122258p+9, 0x1.3a27898783731p+1, 0x1.f43ef0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42827a8f577f1p+9, 0x1.4b1595d561039p+1, 0x1.281baa0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.42f9e596e70b1p+9, 0x1.e8ed68829122p+1, 0x1.afb75d42fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.437d2f359c26ap+9, 0x1.57b744abc620fp+2, 0x1.523c7c85f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.442f2707bb4f4p+9, 0x1.7d4c6a99f4066p+2, 0x1.98d2f585f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40be1a1a4affbp+9, 0x1.3a247cfa7335p+1, 0x1.f23690be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.428914f8c7e29p+9, 0x1.4af8a44b3da43p+1, 0x1.2721c30be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4303a5e5e9aeep+9, 0x1.e842c6d99cc8fp+1, 0x1.b793e502fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.438ae504d0673p+9, 0x1.57d854afb9ffcp+2, 0x1.510f0b05f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.443e5c9c04b9cp+9, 0x1.7d74605ea9d7bp+2, 0x1.97563805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40c45e03e29abp+9, 0x1.3a21739cbd793p+1, 0x1.f02e30be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.428faece7181bp+9, 0x1.4adbcb3a1e2bep+1, 0x1.2627dc0be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.430d62cdbb932p+9, 0x1.e794f3b8923b6p+1, 0x1.c006c8c2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43989c25a1d48p+9, 0x1.57f9472e78722p+2, 0x1.4fe19985f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.444d93c85a11cp+9, 0x1.7d9c30e83e5b7p+2, 0x1.95da9985f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40caa1ddf9397p+9, 0x1.3a1e6d6e6ba67p+1, 0x1.ee25e0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42964810d14fap+9, 0x1.4abf0aa20c016p+1, 0x1.252df60be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.43171c3e0efabp+9, 0x1.e6e3b19dd4708p+1, 0x1.c91d7542fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43a65496e2fd2p+9, 0x1.581a1c2801782p+2, 0x1.4eb42805f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.445ccc8b3f296p+9, 0x1.7dc3dc52e10e6p+2, 0x1.94601b85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40d0e5a89f1f1p+9, 0x1.3a1b6a6f77784p+1, 0x1.ec1d80be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.429ce0c0643fcp+9, 0x1.4aa2628300e04p+1, 0x1.2434100be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4320d2255c205p+9, 0x1.e62ebd7b591fbp+1, 0x1.d2e6d742fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43b40e57666fap+9, 0x1.583ad39c5834p+2, 0x1.4d86b685f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.446c06e338f29p+9, 0x1.7deb62bac48fbp+2, 0x1.92e6bd85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40d72963e48e9p+9, 0x1.3a186a9fe0ee9p+1, 0x1.ea1520be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42a378dda7455p+9, 0x1.4a85d2dcfcc87p+1, 0x1.233a290be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.432a8470c4e26p+9, 0x1.e575ce206c16ap+1, 0x1.dd736882fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43c1c965febabp+9, 0x1.585b6d8b79837p+2, 0x1.4c594585f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.447b42cecd7f3p+9, 0x1.7e12c43c13a8fp+2, 0x1.916e7f05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.40dd6d0fd9cafp+9, 0x1.3a156dffa8096p+1, 0x1.e80cb0be826d7p-22, H2O_REGION3C_PT },
+	{ 0x1.42aa106917539p+9, 0x1.4a695bb002dc3p+1, 0x1.2240430be826dp-18, H2O_REGION3Q_PT },
+	{ 0x1.4334330bf56f9p+9, 0x1.e4b8938a7048p+1, 0x1.e8d59cc2fa09bp-16, H2O_REGION3U_PT },
+	{ 0x1.43cf85c17e6cep+9, 0x1.587be9f566f7ap+2, 0x1.4b2bd405f4137p-17, H2O_REGION3X_PT },
+	{ 0x1.448a804c8400cp+9, 0x1.7e3a00f305ac9p+2, 0x1.8ff76005f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f3163f53c404p+9, 0x1.3afdc266aee19p+1, 0x1.3f10885f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.408574a79af25p+9, 0x1.04d84e8f398bcp+2, 0x1.43f64582fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.4089d8e3cf40cp+9, 0x1.726568fc6857bp+2, 0x1.03a67602fa09bp-16, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f37bac516ee1p+9, 0x1.3af9e6caccbecp+1, 0x1.3e05305f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.408ff45cede7p+9, 0x1.04996cd8f0123p+2, 0x1.43ff4942fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.4098c165c92a7p+9, 0x1.7297b7bb73ad7p+2, 0x1.02beecc2fa09bp-16, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f3e118111851p+9, 0x1.3af60e6d1a768p+1, 0x1.3cf9e05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.409a718a5461bp+9, 0x1.045a88f68de28p+2, 0x1.440ca8c2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40a7abee1fcd2p+9, 0x1.72c9d997e93a2p+2, 0x1.01d7f8c2fa09bp-16, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f4468293cba5p+9, 0x1.3af2394d9e3efp+1, 0x1.3bee905f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40a4ec2fb8007p+9, 0x1.041ba20fae3d8p+2, 0x1.441e7442fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40b6987b04ab8p+9, 0x1.72fbceaec13edp+2, 0x1.00f19a02fa09bp-16, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f4abebda943p+9, 0x1.3aee676c5818p+1, 0x1.3ae3405f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40af644cf9abap+9, 0x1.03dcb7422d036p+2, 0x1.4434d742fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40c5870aaa72cp+9, 0x1.732d971cf3fc9p+2, 0x1.000bd042fa09bp-16, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f51153e67d45p+9, 0x1.3aea98c944e6bp+1, 0x1.39d7e85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40b9d9e1f1318p+9, 0x1.039dc7a3aae84p+2, 0x1.44501ec2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40d4779b44fa9p+9, 0x1.735f32ff750bep+2, 0x1.fe4d3805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f576bab89236p+9, 0x1.3ae6cd6467c61p+1, 0x1.38cc985f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40c44cee6cf37p+9, 0x1.035ed24074649p+2, 0x1.44705602fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40e36a2b0944ep+9, 0x1.7390a2733e3b4p+2, 0x1.fc83f985f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f5dc2051de56p+9, 0x1.3ae3053dc0b61p+1, 0x1.37c1485f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40cebd72317d9p+9, 0x1.031fd619cbd06p+2, 0x1.4495d182fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.40f25eb82d7e6p+9, 0x1.73c1e5954195bp+2, 0x1.fabbe605f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f64184b36cf8p+9, 0x1.3adf40554980ap+1, 0x1.36b5f85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40d92b6cf9216p+9, 0x1.02e0d225118bbp+2, 0x1.44c0bec2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41015540e8fddp+9, 0x1.73f2fc827a775p+2, 0x1.f8f4fc85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f6a6e7de496dp+9, 0x1.3adb7eab085bep+1, 0x1.35aaa85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40e396de73731p+9, 0x1.02a1c54f61794p+2, 0x1.44f163c2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41104dc37444ap+9, 0x1.7423e757df938p+2, 0x1.f72f3d05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f70c49d37f08p+9, 0x1.3ad7c03f0062dp+1, 0x1.349f505f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40edffc644f66p+9, 0x1.0262ae7626588p+2, 0x1.4527ef02fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.411f483e08febp+9, 0x1.7454a6326482ep+2, 0x1.f56aa905f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f771aa94191cp+9, 0x1.3ad4051128446p+1, 0x1.3394005f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.40f86624067cfp+9, 0x1.02238c6d4e4dep+2, 0x1.4564af82fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.412e44aee2023p+9, 0x1.7485392f0314p+2, 0x1.f3a73e85f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f7d70a2122fcp+9, 0x1.3ad04d2186369p+1, 0x1.3288a85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4102c9f744c48p+9, 0x1.01e45df933db8p+2, 0x1.45a7f382fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.413d43143b4fep+9, 0x1.74b5a06ab06ccp+2, 0x1.f1e4ff05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f83c687ba7fap+9, 0x1.3acc987014035p+1, 0x1.317d585f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.410d2b3f7fd67p+9, 0x1.01a521d055538p+2, 0x1.45f1f2c2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.414c436c5212ep+9, 0x1.74e5dc026340cp+2, 0x1.f023ea05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f8a1c5a4b367p+9, 0x1.3ac8e6fcde16dp+1, 0x1.3072005f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.411789fc2a78fp+9, 0x1.0165d69b54d85p+2, 0x1.464307c2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.415b45b564a0cp+9, 0x1.7515ec1312438p+2, 0x1.ee63ff05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f907219d5098p+9, 0x1.3ac538c7d804ep+1, 0x1.2f66b05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4121e62ca9a03p+9, 0x1.01267af14b5aap+2, 0x1.469b8d02fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.416a49edb2798p+9, 0x1.7545d0b9b5b61p+2, 0x1.eca53f05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f96c7c668adep+9, 0x1.3ac18dd10803ap+1, 0x1.2e5b605f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.412c3fd053b9bp+9, 0x1.00e70d5a62c23p+2, 0x1.46fbccc2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.417950137c47ap+9, 0x1.75758a1342be6p+2, 0x1.eae7a905f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3f9d1d6016d8cp+9, 0x1.3abde6186e13p+1, 0x1.2d50105f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.413696e670126p+9, 0x1.00a78c4acd16dp+2, 0x1.47643342fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.4188582503ep+9, 0x1.75a5183cb01p+2, 0x1.e92b3e05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fa372e6f03f5p+9, 0x1.3aba419e03fcfp+1, 0x1.2c44b85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4140eb6e3608ep+9, 0x1.0067f6253af2ap+2, 0x1.47d52242fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.419762208c41fp+9, 0x1.75d47b52f5ebfp+2, 0x1.e76ffd05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fa9c85b0596ap+9, 0x1.3ab6a061d312ap+1, 0x1.2b39685f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.414b3d66cc592p+9, 0x1.00284938669d4p+2, 0x1.484ef842fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41a66e0459974p+9, 0x1.7603b37309785p+2, 0x1.e5b5e605f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fb01dbc6793fp+9, 0x1.3ab30263d51dfp+1, 0x1.2a2e105f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41558ccf484ebp+9, 0x1.ffd10778c2173p+1, 0x1.48d234c2fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41b57bceb1342p+9, 0x1.7632c0b9e1688p+2, 0x1.e3fcf985f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fb6730b26ec6p+9, 0x1.3aaf67a40a1edp+1, 0x1.2922c05f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.415fd9a6acdb4p+9, 0x1.ff5147a9cf69ep+1, 0x1.495f5042fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41c48b7dd9973p+9, 0x1.7661a344778b2p+2, 0x1.e2453805f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fbcc84754551p+9, 0x1.3aabd022784b7p+1, 0x1.2817705f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.416a23ebe9c53p+9, 0x1.fed14f17b299fp+1, 0x1.49f6b782fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41d39d101a69ap+9, 0x1.76905b2fbdeb2p+2, 0x1.e08ea105f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fc31d7100834p+9, 0x1.3aa83bdf16529p+1, 0x1.270c185f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.41746b9dda9dp+9, 0x1.fe5119a25f1b1p+1, 0x1.4a98fb42fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41e2b083bc7eep+9, 0x1.76bee898afe4ap+2, 0x1.ded93405f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fc972883c2cp+9, 0x1.3aa4aad9ea6a7p+1, 0x1.2600c85f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.417eb0bb45b28p+9, 0x1.fdd0a2f94b28bp+1, 0x1.4b46c102fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.41f1c5d709d5p+9, 0x1.76ed4b9c3f829p+2, 0x1.dd24f185f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3fcfc78d18048p+9, 0x1.3aa11d12f177ep+1, 0x1.24f5785f4136bp-21, H2O_REGION3C_PT },
+	{ 0x1.4188f342db1bp+9, 0x1.fd4fe68ae6cb9p+1, 0x1.4c007d82fa09bp-16, H2O_REGION3S_PT },
+	{ 0x1.4200dd084d945p+9, 0x1.771b845766938p+2, 0x1.db71da05f4137p-17, H2O_REGION3R_PT },
+	{ INFINITY, 0, 0, H2O_REGION3K_PT },
+	{ 0x1.3d546684a1e37p+9, 0x1.3c40231fe2736p+1, 0x1.2e2d330be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3d54668503bb1p+9, 0x1.178cc9163a3b4p+2, 0x1.072080d85f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d641ebe9b443p+9, 0x1.3c344e11bb376p+1, 0x1.2c35b60be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3d7030f4ec246p+9, 0x1.16e7a132f3905p+2, 0x1.0645da405f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d73d66204818p+9, 0x1.3c288ccc392ecp+1, 0x1.2a3e390be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3d8beaf9ade1dp+9, 0x1.164301a22c7d6p+2, 0x1.056ed8185f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d838d6fd95ap+9, 0x1.3c1cdf4f59d5cp+1, 0x1.2846bd0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3da794a0d64c9p+9, 0x1.159ee813a4b35p+2, 0x1.049b8f805f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d9343e9158c3p+9, 0x1.3c11459b1d2c7p+1, 0x1.264f3f0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3dc32df7b7dd4p+9, 0x1.14fb5226c5308p+2, 0x1.03cc1b005f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3da2f9ceb4d69p+9, 0x1.3c05bfaf84749p+1, 0x1.2457c20be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3ddeb70b688c2p+9, 0x1.14583d6a8ea6ap+2, 0x1.030097c85f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3db2af21b2f7bp+9, 0x1.3bfa4d8c8e6c6p+1, 0x1.2260450be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3dfa2fe8c030cp+9, 0x1.13b5a75b42558p+2, 0x1.023925385f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3dc263e30bae1p+9, 0x1.3beeef323c55ap+1, 0x1.2068c80be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e15989c569fep+9, 0x1.13138d606b16ap+2, 0x1.0175e4285f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3dd21813bab84p+9, 0x1.3be3a4a08cee9p+1, 0x1.1e714b0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e30f13281a3dp+9, 0x1.1271ecca70d82p+2, 0x1.00b6faf05f413p-13, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3de1cbb4bbd4cp+9, 0x1.3bd86dd780371p+1, 0x1.1c79ce0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e4c39b752aaap+9, 0x1.11d0c2d1b1409p+2, 0x1.fff92900be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3df17ec70ac21p+9, 0x1.3bcd4ad718b3p+1, 0x1.1a82510be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e67723694639p+9, 0x1.11300c92355b9p+2, 0x1.fe8db9d0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e01314ba33edp+9, 0x1.3bc23b9f529cbp+1, 0x1.188ad40be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e829abbc7ee1p+9, 0x1.108fc70a27689p+2, 0x1.fd2c1040be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e10e34381097p+9, 0x1.3bb740303077ep+1, 0x1.1693560be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3e9db35221e19p+9, 0x1.0fefef1657ff7p+2, 0x1.fbd49850be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e2094af9fe08p+9, 0x1.3bac5889b2449p+1, 0x1.149bd90be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3eb8bc0486fccp+9, 0x1.0f50816ed4cedp+2, 0x1.fa87d130be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e304590fb829p+9, 0x1.3ba184abd57efp+1, 0x1.12a45d0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3ed3b4dd887ep+9, 0x1.0eb17aa306a5ap+2, 0x1.f9463ce0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e3ff5e88fae1p+9, 0x1.3b96c4969deccp+1, 0x1.10ace00be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3eee9de76019p+9, 0x1.0e12d715eda97p+2, 0x1.f8107590be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e4fa5b75821ap+9, 0x1.3b8c184a090a4p+1, 0x1.0eb5630be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f09772beb8c9p+9, 0x1.0d7492f8fcdadp+2, 0x1.f6e71bd0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e5f54fe509bcp+9, 0x1.3b817fc616d75p+1, 0x1.0cbde50be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f2440b4a7b59p+9, 0x1.0cd6aa4700ea3p+2, 0x1.f5caea50be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e6f03be74dafp+9, 0x1.3b76fb0ac895ep+1, 0x1.0ac6680be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f3efa8aab202p+9, 0x1.0c3918becc954p+2, 0x1.f4bca7a0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e7eb1f8c09dcp+9, 0x1.3b6c8a181e45fp+1, 0x1.08ceeb0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f59a4b6a0117p+9, 0x1.0b9bd9dbeeb0dp+2, 0x1.f3bd3410be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e8e5fae2fa2cp+9, 0x1.3b622cee1421ep+1, 0x1.06d76f0be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f743f40bdd72p+9, 0x1.0afee8d0256f2p+2, 0x1.f2cd86e0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3e9e0cdfbda85p+9, 0x1.3b57e38cb1b5p+1, 0x1.04dff10be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3f8eca30c171dp+9, 0x1.0a62407a7112fp+2, 0x1.f1eeb6b0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3eadb98e666d3p+9, 0x1.3b4dadf3ee321p+1, 0x1.02e8740be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3fa9458de55aap+9, 0x1.09c5db5ecd3d4p+2, 0x1.f121f7b0be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3ebd65bb25afbp+9, 0x1.3b438c23d1247p+1, 0x1.00f0f70be826dp-18, H2O_REGION3C_PT },
+	{ 0x1.3fc3b15ed877p+9, 0x1.0929b39ad3f6ap+2, 0x1.f0689b30be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3ecd1166f72e8p+9, 0x1.3b397e1c56c67p+1, 0x1.fdf2f417d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.3fde0da9b3eb2p+9, 0x1.088dc2daed8c2p+2, 0x1.efc42270be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3edcbc92d6a82p+9, 0x1.3b2f83dd7dd62p+1, 0x1.fa03fa17d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.3ff85a73efd93p+9, 0x1.07f2024beb28cp+2, 0x1.ef363570be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3eec673fbfdbp+9, 0x1.3b259d674a194p+1, 0x1.f6150017d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.401297c256b24p+9, 0x1.07566a8d0b0e1p+2, 0x1.eec0b810be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3efc116eae85cp+9, 0x1.3b1bcab9b90cp+1, 0x1.f2260617d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.402cc598f7234p+9, 0x1.06baf39df1571p+2, 0x1.ee65b990be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3f0bbb209e66ep+9, 0x1.3b120bd4cbf03p+1, 0x1.ee370c17d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.4046e3fb14373p+9, 0x1.061f94cbe05a5p+2, 0x1.ee279e80be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3f1b64568b3cfp+9, 0x1.3b0860b880423p+1, 0x1.ea481217d04dbp-19, H2O_REGION3C_PT },
+	{ 0x1.4060f2eb139b6p+9, 0x1.05844499d2383p+2, 0x1.ee090460be827p-14, H2O_REGION3S_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.37b2729ce90a3p+9, 0x1.3a41a86f4dffdp+2, 0x1.3e5372c05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.37d19e15cb51ep+9, 0x1.397987278158bp+2, 0x1.3ce1dfe05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.37f0b5b50f0cdp+9, 0x1.38b24dacc80bdp+2, 0x1.3b73b8385f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.380fb991b2076p+9, 0x1.37ebf9da310f3p+2, 0x1.3a08f3b85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.382ea9c27b9b7p+9, 0x1.3726898f70672p+2, 0x1.38a18b305f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.384d865dfd265p+9, 0x1.3661fab0f34fep+2, 0x1.373d77485f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.386c4f7a9280bp+9, 0x1.359e4b27fb565p+2, 0x1.35dcb0b05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.388b052e62794p+9, 0x1.34db78e1d697bp+2, 0x1.347f31305f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.38a9a78f5f3b8p+9, 0x1.341981d05fac1p+2, 0x1.3324f0d85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.38c836b346c34p+9, 0x1.335863e96c16ep+2, 0x1.31cde9d05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.38e6b2afa341bp+9, 0x1.32981d270f127p+2, 0x1.307a15f05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.39051b99cb891p+9, 0x1.31d8ab8702f5fp+2, 0x1.2f296f185f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.39237186e3697p+9, 0x1.311a0d0afa7ebp+2, 0x1.2ddbeec05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3941b48bdc158p+9, 0x1.305c3fb821872p+2, 0x1.2c9190905f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.395fe4bd747acp+9, 0x1.2f9f41972d68ap+2, 0x1.2b4a4e285f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.397e0230399b5p+9, 0x1.2ee310b3fd345p+2, 0x1.2a0622985f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.399c0cf886de4p+9, 0x1.2e27ab1dd6d2p+2, 0x1.28c509a05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.39ba052a8665fp+9, 0x1.2d6d0ee6cfc57p+2, 0x1.2786fdf05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.39d7eada31577p+9, 0x1.2cb33a23e8e7ap+2, 0x1.264bfae05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.39f5be1b5024ap+9, 0x1.2bfa2aecad5d1p+2, 0x1.2513fcd85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3a137f017accbp+9, 0x1.2b41df5b6fb4cp+2, 0x1.23df00c85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3a312da01922bp+9, 0x1.2a8a558c72675p+2, 0x1.22ad01c85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3a4eca0a62fecp+9, 0x1.29d38b9e6b894p+2, 0x1.217dfca05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3a6c5453607c5p+9, 0x1.291d7fb1d8234p+2, 0x1.2051efe05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3a89cc8dea274p+9, 0x1.28682fe8cbad3p+2, 0x1.1f28d7185f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3aa732cca9243p+9, 0x1.27b39a6736a0dp+2, 0x1.1e02b2005f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3ac48722175fdp+9, 0x1.26ffbd520626cp+2, 0x1.1cdf7d605f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3ae1c9a07fa7fp+9, 0x1.264c96cf63196p+2, 0x1.1bbf38305f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3afefa59fdcadp+9, 0x1.259a25060ed0ep+2, 0x1.1aa1e1305f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3b1c19607ea64p+9, 0x1.24e8661d99544p+2, 0x1.198777e85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3b3926c5c03c2p+9, 0x1.2437583dcde6p+2, 0x1.186ffc205f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3b56229b51b84p+9, 0x1.2386f98e22b73p+2, 0x1.175b6dc05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3b730cf29369p+9, 0x1.22d74836548cp+2, 0x1.1649cdc05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3b8fe5dcb6c21p+9, 0x1.2228425ce476cp+2, 0x1.153b1db05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3bacad6abe438p+9, 0x1.2179e627d8086p+2, 0x1.142f5f785f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3bc963ad7d694p+9, 0x1.20cc31bb87b35p+2, 0x1.132693d05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3be608b59881ap+9, 0x1.201f233aa8e1p+2, 0x1.1220c0985f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c029c938483cp+9, 0x1.1f72b8c5ece71p+2, 0x1.111de7405f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c1f1f5786dc6p+9, 0x1.1ec6f07b531d3p+2, 0x1.101e0dc85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c3b9111b5297p+9, 0x1.1e1bc875e7f5ep+2, 0x1.0f2138185f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c57f1d1f4ef3p+9, 0x1.1d713eccec3a9p+2, 0x1.0e276c785f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c7441a7fb37dp+9, 0x1.1cc75193d50bbp+2, 0x1.0d30b3385f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3c9080a34c331p+9, 0x1.1c1dfed96c2e7p+2, 0x1.0c3d12285f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3cacaed33abfbp+9, 0x1.1b7544a6b703p+2, 0x1.0b4c94285f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3cc8cc46e7d9p+9, 0x1.1acd20ff5d3afp+2, 0x1.0a5f41905f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3ce4d90d420eap+9, 0x1.1a2591dfd68cep+2, 0x1.097527405f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d00d53504cep+9, 0x1.197e953d7d9c5p+2, 0x1.088e50f05f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d1cc0ccb7adcp+9, 0x1.18d82904ecf03p+2, 0x1.07aacc385f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT },
+	{ 0x1.3d389be2ad8f8p+9, 0x1.18324b19bc27ap+2, 0x1.06caa9b85f413p-13, H2O_REGION3C_PT },
+	{ INFINITY, 0, 0, H2O_REGION3T_PT }
+};
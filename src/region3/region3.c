@@ -10,9 +10,14 @@
 #include <assert.h>
 
 #include "consts.h"
+#include "h2o.h"
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3.h"
+#endif
+
 /* Based on IF97-Rev, s. 8: Equations for Region 1 */
 
 /* coefficient table; n[0] added for convenience, n[1] is for ln */
@@ -76,7 +81,7 @@ static double h2o_region3_phi_deltatau(double delta, double tau, int deltader, i
 {
 	double sum;
 
-	sum = twoarg_poly_value(delta, tau,
+	sum = TWOARG_POLY_VALUE(region3, delta, tau,
 			&I[1], Ipows, 0, 12, deltader,
 			&J[1], Jpows, 0, 15, tauder,
 			&n[1], 40-1);
@@ -102,6 +107,27 @@ static double h2o_region3_phi_deltatau(double delta, double tau, int deltader, i
 	return sum;
 }
 
+/* all the derivatives at once; d1 is wrt delta, d2 wrt tau */
+/* the n[1] * ln(delta) term, not covered by the polynomial */
+static void h2o_region3_phi_add_log(double delta, double lndelta,
+		struct twoarg_derivs* phi)
+{
+	phi->val += n[1] * lndelta;
+	phi->d1 += n[1] / delta;
+	phi->d11 -= n[1] / pow2(delta);
+}
+
+static void h2o_region3_phi_derivs(double delta, double tau,
+		struct twoarg_derivs* phi)
+{
+	TWOARG_POLY_DERIVS(region3, delta, tau,
+			&I[1], Ipows, 0, 12,
+			&J[1], Jpows, 0, 15,
+			&n[1], 40-1, phi);
+
+	h2o_region3_phi_add_log(delta, log(delta), phi);
+}
+
 double h2o_region3_p_rhoT(double rho, double T)
 {
 	double delta = rho / rhocrit;
@@ -127,10 +153,11 @@ double h2o_region3_s_rhoT(double rho, double T)
 	double delta = rho / rhocrit;
 	double tau = Tcrit / T;
 
-	double phitau = h2o_region3_phi_deltatau(delta, tau, 0, 1);
-	double phi = h2o_region3_phi_deltatau(delta, tau, 0, 0);
+	struct twoarg_derivs phi;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
 
-	return (tau * phitau - phi) * R;
+	return (tau * phi.d2 - phi.val) * R;
 }
 
 double h2o_region3_h_rhoT(double rho, double T)
@@ -138,10 +165,11 @@ double h2o_region3_h_rhoT(double rho, double T)
 	double delta = rho / rhocrit;
 	double tau = Tcrit / T;
 
-	double phidelta = h2o_region3_phi_deltatau(delta, tau, 1, 0);
-	double phitau = h2o_region3_phi_deltatau(delta, tau, 0, 1);
+	struct twoarg_derivs phi;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
 
-	return (tau * phitau + delta * phidelta) * R * T;
+	return (tau * phi.d2 + delta * phi.d1) * R * T;
 }
 
 double h2o_region3_cv_rhoT(double rho, double T)
@@ -159,10 +187,15 @@ double h2o_region3_cp_rhoT(double rho, double T)
 	double delta = rho / rhocrit;
 	double tau = Tcrit / T;
 
-	double phitautau = h2o_region3_phi_deltatau(delta, tau, 0, 2);
-	double phidelta = h2o_region3_phi_deltatau(delta, tau, 1, 0);
-	double phideltatau = h2o_region3_phi_deltatau(delta, tau, 1, 1);
-	double phideltadelta = h2o_region3_phi_deltatau(delta, tau, 2, 0);
+	struct twoarg_derivs phi;
+
+	double phitautau, phidelta, phideltatau, phideltadelta;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
+	phitautau = phi.d22;
+	phidelta = phi.d1;
+	phideltatau = phi.d12;
+	phideltadelta = phi.d11;
 
 	return (-pow2(tau) * phitautau +
 		(
@@ -177,10 +210,15 @@ double h2o_region3_w_rhoT(double rho, double T)
 	double delta = rho / rhocrit;
 	double tau = Tcrit / T;
 
-	double phitautau = h2o_region3_phi_deltatau(delta, tau, 0, 2);
-	double phidelta = h2o_region3_phi_deltatau(delta, tau, 1, 0);
-	double phideltatau = h2o_region3_phi_deltatau(delta, tau, 1, 1);
-	double phideltadelta = h2o_region3_phi_deltatau(delta, tau, 2, 0);
+	struct twoarg_derivs phi;
+
+	double phitautau, phidelta, phideltatau, phideltadelta;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
+	phitautau = phi.d22;
+	phidelta = phi.d1;
+	phideltatau = phi.d12;
+	phideltadelta = phi.d11;
 
 	return sqrt(
 			(
@@ -192,3 +230,109 @@ double h2o_region3_w_rhoT(double rho, double T)
 			)
 			* R * T * 1E3);
 }
+
+static void h2o_region3_props_from_phi(double rho, double T,
+		double delta, double tau, const struct twoarg_derivs* phi,
+		struct h2o_props* out)
+{
+	double cpsubexpr = pow2(delta * (phi->d1 - tau * phi->d12));
+
+	out->p = delta * phi->d1 * rho * R * T * 1E-3;
+	out->T = T;
+	out->rho = rho;
+	out->v = 1 / rho;
+	out->u = tau * phi->d2 * R * T;
+	out->s = (tau * phi->d2 - phi->val) * R;
+	out->h = (tau * phi->d2 + delta * phi->d1) * R * T;
+	out->cv = -pow2(tau) * phi->d22 * R;
+	out->cp = (-pow2(tau) * phi->d22 +
+		(
+			cpsubexpr
+			/ delta / (2 * phi->d1 + delta * phi->d11)
+		)
+		) * R;
+	out->w = sqrt(
+			(
+				delta * (2 * phi->d1 + delta * phi->d11) -
+				(
+					cpsubexpr
+					/ pow2(tau) / phi->d22
+				)
+			)
+			* R * T * 1E3);
+}
+
+void h2o_region3_props_rhoT(double rho, double T, struct h2o_props* out)
+{
+	double delta = rho / rhocrit;
+	double tau = Tcrit / T;
+
+	struct twoarg_derivs phi;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
+	h2o_region3_props_from_phi(rho, T, delta, tau, &phi, out);
+}
+
+/* props plus the first derivatives of p, for the Newton solvers */
+void h2o_region3_props_derivs_rhoT(double rho, double T,
+		struct h2o_props* out, double* dpdrho, double* dpdT)
+{
+	double delta = rho / rhocrit;
+	double tau = Tcrit / T;
+
+	struct twoarg_derivs phi;
+
+	h2o_region3_phi_derivs(delta, tau, &phi);
+	h2o_region3_props_from_phi(rho, T, delta, tau, &phi, out);
+
+	*dpdrho = delta * (2 * phi.d1 + delta * phi.d11) * R * T * 1E-3;
+	*dpdT = delta * (phi.d1 - tau * phi.d12) * rho * R * 1E-3;
+}
+
+static XMATH_ALWAYS_INLINE void h2o_region3_props_rhoT_n_impl(
+		size_t count, const double rho[],
+		const double T[], struct h2o_props* out)
+{
+	double x1[XMATH_BLOCK], x2[XMATH_BLOCK], lndelta[XMATH_BLOCK];
+	struct twoarg_derivs phi[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			x1[i] = rho[i] / rhocrit;
+			x2[i] = Tcrit / T[i];
+			lndelta[i] = x1[i];
+		}
+		/* pad the block, so that the log loop can be vectorized */
+		for (; i < XMATH_BLOCK; ++i)
+			lndelta[i] = 1;
+		for (i = 0; i < XMATH_BLOCK; ++i)
+			lndelta[i] = xmath_log(lndelta[i]);
+
+		TWOARG_POLY_DERIVS_N(region3, block, x1, x2,
+				&I[1], Ipows, 0, 12,
+				&J[1], Jpows, 0, 15,
+				&n[1], 40-1, phi);
+
+		for (i = 0; i < block; ++i)
+		{
+			h2o_region3_phi_add_log(x1[i], lndelta[i], &phi[i]);
+			h2o_region3_props_from_phi(rho[i], T[i], x1[i], x2[i],
+					&phi[i], &out[i]);
+		}
+
+		rho += block;
+		T += block;
+		out += block;
+		count -= block;
+	}
+}
+
+XMATH_DISPATCH_VOID(h2o_region3_props_rhoT_n,
+		(size_t count, const double rho[],
+		const double T[], struct h2o_props* out),
+		(count, rho, T, out))
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3Tphb.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -75,7 +79,7 @@ double h2o_region3b_T_ph(double p, double h)
 	double pi = p / pstar;
 	double eta = h / hstar;
 
-	return twoarg_poly_value(pi + 0.298, eta - 0.720,
+	return TWOARG_POLY_VALUE(region3Tphb, pi + 0.298, eta - 0.720,
 			I, Ipows, 8, 14, 0,
 			J, Jpows, 0, 10, 0,
 			n, 33) * Tstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3Tpsb.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -71,7 +75,7 @@ double h2o_region3b_T_ps(double p, double s)
 	double pi = p / pstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(pi + 0.760, sigma - 0.818,
+	return TWOARG_POLY_VALUE(region3Tpsb, pi + 0.760, sigma - 0.818,
 			I, Ipows, 7, 17, 0,
 			J, Jpows, 0, 9, 0,
 			n, 28) * Tstar;
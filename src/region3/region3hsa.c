@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3hsa.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -76,7 +80,7 @@ double h2o_region3a_p_hs(double h, double s)
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(eta - 1.01, sigma - 0.75,
+	return TWOARG_POLY_VALUE(region3hsa, eta - 1.01, sigma - 0.75,
 			I, Ipows, 0, 17, 0,
 			J, Jpows, 0, 16, 0,
 			n, 33) * pstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3hsb.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -77,7 +81,7 @@ double h2o_region3b_p_hs(double h, double s)
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	return pstar / twoarg_poly_value(eta - 0.681, sigma - 0.792,
+	return pstar / TWOARG_POLY_VALUE(region3hsb, eta - 0.681, sigma - 0.792,
 			I, Ipows, 9, 17, 0,
 			J, Jpows, 0, 14, 0,
 			n, 35);
@@ -12,6 +12,7 @@
 #include "consts.h"
 #include "region3.h"
 #include "region4.h"
+#include "stats.h"
 #include "xmath.h"
 
 /* Supplementary Release on Backward Equations for Specific Volume
@@ -19,7 +20,7 @@
  * for Region 3 of the IAPWS Industrial Formulation 1997 for the
  * Thermodynamic Properties of Water and Steam */
 
-enum h2o_region3_subregion_pT h2o_region3_subregion_pT(double p, double T)
+enum h2o_region3_subregion_pT h2o_region3_subregion_pT_exact(double p, double T)
 {
 	if (p > 40)
 	{
@@ -143,6 +144,110 @@ enum h2o_region3_subregion_pT h2o_region3_subregion_pT(double p, double T)
 	}
 }
 
+/* The subregion boundaries crossing each pressure bin, fitted linearly
+ * (see tools/region3tabgen.c). T is compared with the fit, and only
+ * if it is closer to it than the fit error, the boundary functions are
+ * evaluated. */
+
+/* p from pmin (exclusive) to pmax (inclusive) in uniform bins */
+struct pTtab_segment
+{
+	double pmax, pmin, pstep;
+	int first, bins;
+};
+
+/* the last cut of a bin has T0 = INFINITY */
+struct pTtab_cut
+{
+	double T0, dTdp, Terr;
+	enum h2o_region3_subregion_pT below;
+};
+
+#include "pTtab.h"
+
+enum h2o_region3_subregion_pT h2o_region3_subregion_pT(double p, double T)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_SUBREGION_PT);
+
+	const struct pTtab_segment* seg = pTtab_segments;
+	const struct pTtab_cut* cut;
+	double dp;
+	int bin, first;
+
+	while (!(p > seg->pmin))
+	{
+		if (++seg == &pTtab_segments[PTTAB_SEGMENTS])
+			return h2o_region3_subregion_pT_exact(p, T);
+	}
+
+	bin = (p - seg->pmin) / seg->pstep;
+	if (bin >= seg->bins)
+		bin = seg->bins - 1;
+	first = pTtab_bins[seg->first + bin];
+	if (first == -1)
+		return h2o_region3_subregion_pT_exact(p, T);
+
+	dp = p - (seg->pmin + bin * seg->pstep);
+	for (cut = &pTtab_cuts[first]; ; ++cut)
+	{
+		double Tb = cut->T0 + cut->dTdp * dp;
+
+		if (T < Tb - cut->Terr)
+			return cut->below;
+		else if (T <= Tb + cut->Terr)
+			return h2o_region3_subregion_pT_exact(p, T);
+	}
+}
+
+/* Like h2o_region3_subregion_pT(), and set box to the open rectangle
+ * { pmin, pmax, Tmin, Tmax } around (p, T) where the subregion is
+ * the same, or to NaN if it is not known. */
+enum h2o_region3_subregion_pT h2o_region3_subregion_pT_box(double p,
+		double T, double box[4])
+{
+	const struct pTtab_segment* seg = pTtab_segments;
+	const struct pTtab_cut* cut;
+	double dp, pa;
+	int bin, first;
+
+	box[0] = box[1] = box[2] = box[3] = NAN;
+
+	while (!(p > seg->pmin))
+	{
+		if (++seg == &pTtab_segments[PTTAB_SEGMENTS])
+			return h2o_region3_subregion_pT_exact(p, T);
+	}
+
+	bin = (p - seg->pmin) / seg->pstep;
+	if (bin >= seg->bins)
+		bin = seg->bins - 1;
+	first = pTtab_bins[seg->first + bin];
+	if (first == -1)
+		return h2o_region3_subregion_pT_exact(p, T);
+
+	pa = seg->pmin + bin * seg->pstep;
+	dp = p - pa;
+	for (cut = &pTtab_cuts[first]; ; ++cut)
+	{
+		double Tb = cut->T0 + cut->dTdp * dp;
+
+		if (T < Tb - cut->Terr)
+		{
+			/* between the fits over the whole bin */
+			box[0] = pa;
+			box[1] = fmin(pa + seg->pstep, seg->pmax);
+			box[2] = cut == &pTtab_cuts[first] ? -INFINITY
+				: cut[-1].T0 + fmax(cut[-1].dTdp * seg->pstep, 0)
+					+ cut[-1].Terr;
+			box[3] = cut->T0 + fmin(cut->dTdp * seg->pstep, 0)
+				- cut->Terr;
+			return cut->below;
+		}
+		else if (T <= Tb + cut->Terr)
+			return h2o_region3_subregion_pT_exact(p, T);
+	}
+}
+
 typedef double (*twoarg_func_t)(double, double);
 
 /* this function intends to make compiler happy. */
@@ -156,10 +261,18 @@ static double impossible_happened(double a, double b)
 }
 
 double h2o_region3_v_pT(double p, double T)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_V_PT);
+
+	return h2o_region3_v_pT_subregion(p, T, h2o_region3_subregion_pT(p, T));
+}
+
+double h2o_region3_v_pT_subregion(double p, double T,
+		enum h2o_region3_subregion_pT subregion)
 {
 	twoarg_func_t v_getter;
 
-	switch (h2o_region3_subregion_pT(p, T))
+	switch (subregion)
 	{
 		case H2O_REGION3A_PT:
 			v_getter = &h2o_region3a_v_pT;
@@ -245,3 +358,46 @@ double h2o_region3_v_pT(double p, double T)
 
 	return v_getter(p, T);
 }
+
+void h2o_region3_v_pT_n(size_t count, const double p[], const double T[],
+		double v[])
+{
+	enum h2o_region3_subregion_pT sub[XMATH_BLOCK];
+	int order[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int start[H2O_REGION3_PT_MAX] = { 0 };
+		int i, k;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		for (i = 0; i < block; ++i)
+		{
+			sub[i] = h2o_region3_subregion_pT(p[i], T[i]);
+			++start[sub[i]];
+		}
+
+		/* sort the points by subregion (counting sort), so that
+		 * the same equation is evaluated for a run of them */
+		for (k = 0, i = 0; k < H2O_REGION3_PT_MAX; ++k)
+		{
+			int n = start[k];
+
+			start[k] = i;
+			i += n;
+		}
+		for (i = 0; i < block; ++i)
+			order[start[sub[i]]++] = i;
+
+		for (k = 0; k < block; ++k)
+		{
+			i = order[k];
+			v[i] = h2o_region3_v_pT_subregion(p[i], T[i], sub[i]);
+		}
+
+		p += block;
+		T += block;
+		v += block;
+		count -= block;
+	}
+}
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3psath.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -56,7 +60,7 @@ double h2o_region3_psat_h(double h)
 {
 	double eta = h / hstar;
 
-	return twoarg_poly_value(eta - 1.02, eta - 0.608,
+	return TWOARG_POLY_VALUE(region3psath, eta - 1.02, eta - 0.608,
 			I, Ipows, 0, 11, 0,
 			J, Jpows, 0, 9, 0,
 			n, 14) * pstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3psats.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -54,7 +58,7 @@ double h2o_region3_psat_s(double s)
 {
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(sigma - 1.03, sigma - 0.699,
+	return TWOARG_POLY_VALUE(region3psats, sigma - 1.03, sigma - 0.699,
 			I, Ipows, 0, 8, 0,
 			J, Jpows, 0, 9, 0,
 			n, 10) * pstar;
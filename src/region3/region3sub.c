@@ -11,9 +11,12 @@
 
 #include "consts.h"
 #include "region3.h"
+#include "stats.h"
 
 enum h2o_region3_subregion h2o_region3_subregion_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_SUBREGION_PH);
+
 	if (h <= h2o_region3_b3ab_h_p(p))
 		return H2O_REGION3A;
 	else
@@ -22,6 +25,8 @@ enum h2o_region3_subregion h2o_region3_subregion_ph(double p, double h)
 
 enum h2o_region3_subregion h2o_region3_subregion_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_SUBREGION_PS);
+
 	if (s <= scrit)
 		return H2O_REGION3A;
 	else
@@ -30,6 +35,8 @@ enum h2o_region3_subregion h2o_region3_subregion_ps(double p, double s)
 
 enum h2o_region3_subregion h2o_region3_subregion_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_SUBREGION_HS);
+
 	if (s <= scrit)
 		return H2O_REGION3A;
 	else
@@ -50,6 +57,7 @@ static double impossible_happened(double a, double b)
 
 double h2o_region3_T_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_T_PH);
 	twoarg_func_t T_getter;
 
 	switch (h2o_region3_subregion_ph(p, h))
@@ -69,6 +77,7 @@ double h2o_region3_T_ph(double p, double h)
 
 double h2o_region3_v_ph(double p, double h)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_V_PH);
 	twoarg_func_t v_getter;
 
 	switch (h2o_region3_subregion_ph(p, h))
@@ -88,6 +97,7 @@ double h2o_region3_v_ph(double p, double h)
 
 double h2o_region3_T_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_T_PS);
 	twoarg_func_t T_getter;
 
 	switch (h2o_region3_subregion_ps(p, s))
@@ -107,6 +117,7 @@ double h2o_region3_T_ps(double p, double s)
 
 double h2o_region3_v_ps(double p, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_V_PS);
 	twoarg_func_t v_getter;
 
 	switch (h2o_region3_subregion_ps(p, s))
@@ -126,6 +137,7 @@ double h2o_region3_v_ps(double p, double s)
 
 double h2o_region3_p_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION3_P_HS);
 	twoarg_func_t p_getter;
 
 	switch (h2o_region3_subregion_hs(h, s))
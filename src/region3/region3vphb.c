@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3vphb.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -70,7 +74,7 @@ double h2o_region3b_v_ph(double p, double h)
 	double pi = p / pstar;
 	double eta = h / hstar;
 
-	return twoarg_poly_value(pi + 0.0661, eta - 0.720,
+	return TWOARG_POLY_VALUE(region3vphb, pi + 0.0661, eta - 0.720,
 			I, Ipows, 7, 10, 0,
 			J, Jpows, 0, 10, 0,
 			n, 30) * vstar;
@@ -10,6 +10,10 @@
 #include "region3.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region3vpsb.h"
+#endif
+
 /* Revised Supplementary Release on Backward Equations for the Functions
  * T(p,h), v(p,h) and T(p,s), v(p,s) for Region 3 of the IAPWS Industrial
  * Formulation 1997 for the Thermodynamic Properties of Water and Steam
@@ -73,7 +77,7 @@ double h2o_region3b_v_ps(double p, double s)
 	double pi = p / pstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(pi + 0.298, sigma - 0.816,
+	return TWOARG_POLY_VALUE(region3vpsb, pi + 0.298, sigma - 0.816,
 			I, Ipows, 7, 10, 0,
 			J, Jpows, 0, 8, 0,
 			n, 31) * vstar;
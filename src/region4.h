@@ -13,8 +13,15 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
+struct h2o_props; /* see h2o.h */
+struct h2o_sat; /* see h2o.h */
+
 double h2o_region4_p_T(double T);
+void h2o_region4_p_T_n(size_t count, const double T[], double p[]);
 double h2o_region4_T_p(double p);
+double h2o_region4_dpdT_T(double T);
 
 double h2o_region4_v_Tx(double T, double x);
 double h2o_region4_u_Tx(double T, double x);
@@ -23,9 +30,22 @@ double h2o_region4_h_Tx(double T, double x);
 double h2o_region4_cp_Tx(double T, double x);
 double h2o_region4_cv_Tx(double T, double x);
 double h2o_region4_w_Tx(double T, double x);
+void h2o_region4_props_Tx(double T, double x,
+		struct h2o_props* out);
+void h2o_region4_props_Tx_n(size_t count, const double T[],
+		const double x[], struct h2o_props* out);
+void h2o_region4_props_sat_x(const struct h2o_sat* sat, double x,
+		struct h2o_props* out);
+void h2o_region4_sat_T(double T, struct h2o_sat* out);
+void h2o_region4_sat_p(double p, struct h2o_sat* out);
+void h2o_region4_sat_derivs_T(double T, struct h2o_sat* out,
+		double dvdp[2], double dvdT[2]);
+void h2o_region4_sat_approx_T(double T, struct h2o_sat* out);
+void h2o_region4_sat_approx_p(double p, struct h2o_sat* out);
 
 double h2o_region4_x_Ts(double T, double s);
 double h2o_region4_x_Th(double T, double h);
+double h2o_region4_x_Tv(double T, double v);
 double h2o_region4_T_hs(double h, double s);
 
 #ifdef __cplusplus
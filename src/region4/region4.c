@@ -8,10 +8,12 @@
 #endif
 
 #include "consts.h"
+#include "h2o.h"
 #include "region1.h"
 #include "region2.h"
 #include "region3.h"
 #include "region4.h"
+#include "stats.h"
 #include "xmath.h"
 
 /* Based on IF97-Rev, s. 8: Equations for Region 4 */
@@ -32,7 +34,7 @@ static const double n[] = {
 };
 
 /* 8.1 The Saturation-Pressure Equation (Basic Equation) */
-double h2o_region4_p_T(double T) /* p [MPa] = f(T [K]) */
+static inline double region4_p_T(double T) /* p [MPa] = f(T [K]) */
 {
 	double theta = T + n[9] / (T - n[10]);
 
@@ -50,9 +52,47 @@ double h2o_region4_p_T(double T) /* p [MPa] = f(T [K]) */
 	return retqu;
 }
 
+double h2o_region4_p_T(double T)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_P_T);
+
+	return region4_p_T(T);
+}
+
+/* not dispatched, so that the results are exactly the same
+ * as of h2o_region4_p_T() and the boundaries agree */
+void h2o_region4_p_T_n(size_t count, const double T[], double p[])
+{
+	size_t i;
+
+	for (i = 0; i < count; ++i)
+		p[i] = region4_p_T(T[i]);
+}
+
+/* dpsat/dT [MPa/K], differentiating the quadratic in beta = p^0.25
+ * the above solves */
+double h2o_region4_dpdT_T(double T)
+{
+	double theta = T + n[9] / (T - n[10]);
+	double beta = sqrt(sqrt(h2o_region4_p_T(T)));
+
+	double A = quadr_value(n[0], n[1], n[2], theta);
+	double B = quadr_value(n[3], n[4], n[5], theta);
+	double dA = 2 * n[0] * theta + n[1];
+	double dB = 2 * n[3] * theta + n[4];
+	double dC = 2 * n[6] * theta + n[7];
+
+	double dbeta = -(dA * pow2(beta) + dB * beta + dC)
+		/ (2 * A * beta + B);
+	double dtheta = 1 - n[9] / pow2(T - n[10]);
+
+	return 4 * pow2(beta) * beta * dbeta * dtheta;
+}
+
 /* 8.2 The Saturation-Temperature Equation (Backward Equation) */
 double h2o_region4_T_p(double p) /* T [K] = f(p [MPa]) */
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_T_P);
 	double beta = pow(p, 0.25);
 
 	double E = quadr_value(n[0], n[3], n[6], beta);
@@ -128,59 +168,84 @@ static enum h2o_region4_subregion h2o_region4_subregion_T(double T)
 		return H2O_REGION4_3YZ;
 }
 
-double h2o_region4_v_Tx(double T, double x)
+static void region4_v_funcs(double T,
+		twoarg_func_t* water_func, twoarg_func_t* steam_func)
 {
-	twoarg_func_t water_func, steam_func;
-
 	switch (h2o_region4_subregion_T(T))
 	{
 		case H2O_REGION4_12META:
-			water_func = h2o_region1_v_pT;
-			steam_func = h2o_region2_meta_v_pT;
+			*water_func = h2o_region1_v_pT;
+			*steam_func = h2o_region2_meta_v_pT;
 			break;
 		case H2O_REGION4_12:
-			water_func = h2o_region1_v_pT;
-			steam_func = h2o_region2_v_pT;
+			*water_func = h2o_region1_v_pT;
+			*steam_func = h2o_region2_v_pT;
 			break;
 		case H2O_REGION4_3CT:
-			water_func = h2o_region3c_v_pT;
-			steam_func = h2o_region3t_v_pT;
+			*water_func = h2o_region3c_v_pT;
+			*steam_func = h2o_region3t_v_pT;
 			break;
 		case H2O_REGION4_3ST:
-			water_func = h2o_region3s_v_pT;
-			steam_func = h2o_region3t_v_pT;
+			*water_func = h2o_region3s_v_pT;
+			*steam_func = h2o_region3t_v_pT;
 			break;
 		case H2O_REGION4_3RS:
-			water_func = h2o_region3s_v_pT;
-			steam_func = h2o_region3r_v_pT;
+			*water_func = h2o_region3s_v_pT;
+			*steam_func = h2o_region3r_v_pT;
 			break;
 		case H2O_REGION4_3UX:
-			water_func = h2o_region3u_v_pT;
-			steam_func = h2o_region3x_v_pT;
+			*water_func = h2o_region3u_v_pT;
+			*steam_func = h2o_region3x_v_pT;
 			break;
 		case H2O_REGION4_3UZ:
-			water_func = h2o_region3u_v_pT;
-			steam_func = h2o_region3z_v_pT;
+			*water_func = h2o_region3u_v_pT;
+			*steam_func = h2o_region3z_v_pT;
 			break;
 		case H2O_REGION4_3YZ:
-			water_func = h2o_region3y_v_pT;
-			steam_func = h2o_region3z_v_pT;
+			*water_func = h2o_region3y_v_pT;
+			*steam_func = h2o_region3z_v_pT;
 			break;
 	}
+}
+
+double h2o_region4_v_Tx(double T, double x)
+{
+	twoarg_func_t water_func, steam_func;
+
+	region4_v_funcs(T, &water_func, &steam_func);
 
 	return region4_interp(water_func, steam_func, T, x);
 }
 
+/* saturated volumes for a known p = psat(T) */
+static double sat_region3_v1_pT(double p, double T)
+{
+	twoarg_func_t water_func, steam_func;
+
+	region4_v_funcs(T, &water_func, &steam_func);
+
+	return water_func(p, T);
+}
+
+static double sat_region3_v2_pT(double p, double T)
+{
+	twoarg_func_t water_func, steam_func;
+
+	region4_v_funcs(T, &water_func, &steam_func);
+
+	return steam_func(p, T);
+}
+
 static double sat_region3_u1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_u_rhoT(1/v, T);
 }
 
 static double sat_region3_u2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_u_rhoT(1/v, T);
 }
@@ -209,86 +274,98 @@ double h2o_region4_u_Tx(double T, double x)
 
 static double sat_region3_s1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_s_rhoT(1/v, T);
 }
 
 static double sat_region3_s2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_s_rhoT(1/v, T);
 }
 
-double h2o_region4_s_Tx(double T, double x)
+static void region4_s_funcs(double T,
+		twoarg_func_t* water_func, twoarg_func_t* steam_func)
 {
-	twoarg_func_t water_func, steam_func;
-
 	switch (h2o_region4_subregion_T(T))
 	{
 		case H2O_REGION4_12META:
-			water_func = h2o_region1_s_pT;
-			steam_func = h2o_region2_meta_s_pT;
+			*water_func = h2o_region1_s_pT;
+			*steam_func = h2o_region2_meta_s_pT;
 			break;
 		case H2O_REGION4_12:
-			water_func = h2o_region1_s_pT;
-			steam_func = h2o_region2_s_pT;
+			*water_func = h2o_region1_s_pT;
+			*steam_func = h2o_region2_s_pT;
 			break;
 		default:
-			water_func = sat_region3_s1_pT;
-			steam_func = sat_region3_s2_pT;
+			*water_func = sat_region3_s1_pT;
+			*steam_func = sat_region3_s2_pT;
 	}
+}
+
+double h2o_region4_s_Tx(double T, double x)
+{
+	twoarg_func_t water_func, steam_func;
+
+	region4_s_funcs(T, &water_func, &steam_func);
 
 	return region4_interp(water_func, steam_func, T, x);
 }
 
 static double sat_region3_h1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_h_rhoT(1/v, T);
 }
 
 static double sat_region3_h2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_h_rhoT(1/v, T);
 }
 
-double h2o_region4_h_Tx(double T, double x)
+static void region4_h_funcs(double T,
+		twoarg_func_t* water_func, twoarg_func_t* steam_func)
 {
-	twoarg_func_t water_func, steam_func;
-
 	switch (h2o_region4_subregion_T(T))
 	{
 		case H2O_REGION4_12META:
-			water_func = h2o_region1_h_pT;
-			steam_func = h2o_region2_meta_h_pT;
+			*water_func = h2o_region1_h_pT;
+			*steam_func = h2o_region2_meta_h_pT;
 			break;
 		case H2O_REGION4_12:
-			water_func = h2o_region1_h_pT;
-			steam_func = h2o_region2_h_pT;
+			*water_func = h2o_region1_h_pT;
+			*steam_func = h2o_region2_h_pT;
 			break;
 		default:
-			water_func = sat_region3_h1_pT;
-			steam_func = sat_region3_h2_pT;
+			*water_func = sat_region3_h1_pT;
+			*steam_func = sat_region3_h2_pT;
 	}
+}
+
+double h2o_region4_h_Tx(double T, double x)
+{
+	twoarg_func_t water_func, steam_func;
+
+	region4_h_funcs(T, &water_func, &steam_func);
 
 	return region4_interp(water_func, steam_func, T, x);
 }
 
 static double sat_region3_cp1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_cp_rhoT(1/v, T);
 }
 
 static double sat_region3_cp2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_cp_rhoT(1/v, T);
 }
@@ -317,14 +394,14 @@ double h2o_region4_cp_Tx(double T, double x)
 
 static double sat_region3_cv1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_cv_rhoT(1/v, T);
 }
 
 static double sat_region3_cv2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_cv_rhoT(1/v, T);
 }
@@ -353,14 +430,14 @@ double h2o_region4_cv_Tx(double T, double x)
 
 static double sat_region3_w1_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 0);
+	double v = sat_region3_v1_pT(p, T);
 
 	return h2o_region3_w_rhoT(1/v, T);
 }
 
 static double sat_region3_w2_pT(double p, double T)
 {
-	double v = h2o_region4_v_Tx(T, 1);
+	double v = sat_region3_v2_pT(p, T);
 
 	return h2o_region3_w_rhoT(1/v, T);
 }
@@ -387,18 +464,263 @@ double h2o_region4_w_Tx(double T, double x)
 	return region4_interp(water_func, steam_func, T, x);
 }
 
+static void sat_region3_water_props(double p, double T,
+		struct h2o_props* out)
+{
+	double v = sat_region3_v1_pT(p, T);
+
+	h2o_region3_props_rhoT(1/v, T, out);
+}
+
+static void sat_region3_steam_props(double p, double T,
+		struct h2o_props* out)
+{
+	double v = sat_region3_v2_pT(p, T);
+
+	h2o_region3_props_rhoT(1/v, T, out);
+}
+
+typedef void (*props_func_t)(double, double, struct h2o_props*);
+
+/* Both saturated phases at (p, T), p being psat(T) */
+static void region4_sat_pT(double p, double T, struct h2o_sat* out)
+{
+	props_func_t water_func, steam_func;
+
+	switch (h2o_region4_subregion_T(T))
+	{
+		case H2O_REGION4_12META:
+			water_func = h2o_region1_props_pT;
+			steam_func = h2o_region2_meta_props_pT;
+			break;
+		case H2O_REGION4_12:
+			water_func = h2o_region1_props_pT;
+			steam_func = h2o_region2_props_pT;
+			break;
+		default:
+			water_func = sat_region3_water_props;
+			steam_func = sat_region3_steam_props;
+	}
+
+	water_func(p, T, &out->liquid);
+	steam_func(p, T, &out->vapour);
+
+	out->p = out->liquid.p = out->vapour.p = p;
+	out->T = out->liquid.T = out->vapour.T = T;
+	out->liquid.x = 0;
+	out->vapour.x = 1;
+}
+
+/* Region 3 phases with dv/dp and dv/dT instead of dp/drho and dp/dT */
+static void sat_region3_props_derivs(double v, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT)
+{
+	double dpdrho, dpdT;
+
+	h2o_region3_props_derivs_rhoT(1/v, T, out, &dpdrho, &dpdT);
+	*dvdp = -pow2(v) / dpdrho;
+	*dvdT = pow2(v) * dpdT / dpdrho;
+}
+
+/* Like h2o_region4_sat_T(), with the derivatives of v of both phases
+ * wrt (p, T) off the saturation line: [0] for liquid, [1] for vapour */
+void h2o_region4_sat_derivs_T(double T, struct h2o_sat* out,
+		double dvdp[2], double dvdT[2])
+{
+	double p = h2o_region4_p_T(T);
+
+	switch (h2o_region4_subregion_T(T))
+	{
+		case H2O_REGION4_12META:
+			h2o_region1_props_derivs_pT(p, T, &out->liquid,
+					&dvdp[0], &dvdT[0]);
+			h2o_region2_meta_props_derivs_pT(p, T, &out->vapour,
+					&dvdp[1], &dvdT[1]);
+			break;
+		case H2O_REGION4_12:
+			h2o_region1_props_derivs_pT(p, T, &out->liquid,
+					&dvdp[0], &dvdT[0]);
+			h2o_region2_props_derivs_pT(p, T, &out->vapour,
+					&dvdp[1], &dvdT[1]);
+			break;
+		default:
+			sat_region3_props_derivs(sat_region3_v1_pT(p, T), T,
+					&out->liquid, &dvdp[0], &dvdT[0]);
+			sat_region3_props_derivs(sat_region3_v2_pT(p, T), T,
+					&out->vapour, &dvdp[1], &dvdT[1]);
+	}
+
+	out->p = out->liquid.p = out->vapour.p = p;
+	out->T = out->liquid.T = out->vapour.T = T;
+	out->liquid.x = 0;
+	out->vapour.x = 1;
+}
+
+void h2o_region4_sat_T(double T, struct h2o_sat* out)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_SAT_T);
+
+	region4_sat_pT(h2o_region4_p_T(T), T, out);
+}
+
+void h2o_region4_sat_p(double p, struct h2o_sat* out)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_SAT_P);
+
+	region4_sat_pT(p, h2o_region4_T_p(p), out);
+}
+
+/* same interpolation as in region4_interp() */
+static void region4_mix(const struct h2o_props* water,
+		const struct h2o_props* steam, double x, struct h2o_props* out)
+{
+	if (x == 0)
+		*out = *water;
+	else if (x == 1)
+		*out = *steam;
+	else
+	{
+		out->v = water->v + (steam->v - water->v) * x;
+		out->u = water->u + (steam->u - water->u) * x;
+		out->h = water->h + (steam->h - water->h) * x;
+		out->s = water->s + (steam->s - water->s) * x;
+		out->cp = water->cp + (steam->cp - water->cp) * x;
+		out->cv = water->cv + (steam->cv - water->cv) * x;
+		out->w = water->w + (steam->w - water->w) * x;
+
+		out->p = water->p;
+		out->T = water->T;
+		out->rho = 1 / out->v;
+	}
+}
+
+void h2o_region4_props_Tx(double T, double x, struct h2o_props* out)
+{
+	struct h2o_sat sat;
+
+	h2o_region4_sat_T(T, &sat);
+	region4_mix(&sat.liquid, &sat.vapour, x, out);
+}
+
+/* like h2o_region4_props_Tx(), with the saturated phases given */
+void h2o_region4_props_sat_x(const struct h2o_sat* sat, double x,
+		struct h2o_props* out)
+{
+	region4_mix(&sat->liquid, &sat->vapour, x, out);
+}
+
+typedef void (*batch_props_func_t)(size_t, const double[], const double[],
+		struct h2o_props*);
+
+/* The saturated phases come from the batch Region 1 and 2 functions,
+ * called once per subregion over the points gathered from the block.
+ * The Region 3 part of the line is computed point by point. */
+void h2o_region4_props_Tx_n(size_t count, const double T[],
+		const double x[], struct h2o_props* out)
+{
+	double p[XMATH_BLOCK], sp[XMATH_BLOCK], sT[XMATH_BLOCK];
+	int si[XMATH_BLOCK];
+	struct h2o_props water[XMATH_BLOCK], steam[XMATH_BLOCK];
+	struct h2o_props sw[XMATH_BLOCK], ss[XMATH_BLOCK];
+
+	while (count > 0)
+	{
+		int i, j, scount;
+		enum h2o_region4_subregion sub;
+		int block = count < XMATH_BLOCK ? count : XMATH_BLOCK;
+
+		h2o_region4_p_T_n(block, T, p);
+
+		for (sub = H2O_REGION4_12META; sub <= H2O_REGION4_12; ++sub)
+		{
+			batch_props_func_t steam_func = sub == H2O_REGION4_12META
+				? h2o_region2_meta_props_pT_n : h2o_region2_props_pT_n;
+
+			scount = 0;
+			for (i = 0; i < block; ++i)
+			{
+				if (h2o_region4_subregion_T(T[i]) == sub)
+				{
+					sp[scount] = p[i];
+					sT[scount] = T[i];
+					si[scount] = i;
+					++scount;
+				}
+			}
+			if (!scount)
+				continue;
+
+			h2o_region1_props_pT_n(scount, sp, sT, sw);
+			steam_func(scount, sp, sT, ss);
+
+			for (j = 0; j < scount; ++j)
+			{
+				water[si[j]] = sw[j];
+				steam[si[j]] = ss[j];
+			}
+		}
+
+		for (i = 0; i < block; ++i)
+		{
+			if (h2o_region4_subregion_T(T[i]) > H2O_REGION4_12)
+			{
+				sat_region3_water_props(p[i], T[i], &water[i]);
+				sat_region3_steam_props(p[i], T[i], &steam[i]);
+			}
+
+			water[i].p = steam[i].p = p[i];
+			water[i].T = steam[i].T = T[i];
+			water[i].x = 0;
+			steam[i].x = 1;
+
+			region4_mix(&water[i], &steam[i], x[i], &out[i]);
+		}
+
+		T += block;
+		x += block;
+		out += block;
+		count -= block;
+	}
+}
+
 double h2o_region4_x_Ts(double T, double s)
 {
-	double s1 = h2o_region4_s_Tx(T, 0);
-	double s2 = h2o_region4_s_Tx(T, 1);
+	twoarg_func_t water_func, steam_func;
+	double p, s1, s2;
+
+	region4_s_funcs(T, &water_func, &steam_func);
+
+	p = h2o_region4_p_T(T);
+	s1 = water_func(p, T);
+	s2 = steam_func(p, T);
 
 	return (s - s1) / (s2 - s1);
 }
 
+double h2o_region4_x_Tv(double T, double v)
+{
+	twoarg_func_t water_func, steam_func;
+	double p, v1, v2;
+
+	region4_v_funcs(T, &water_func, &steam_func);
+
+	p = h2o_region4_p_T(T);
+	v1 = water_func(p, T);
+	v2 = steam_func(p, T);
+
+	return (v - v1) / (v2 - v1);
+}
+
 double h2o_region4_x_Th(double T, double h)
 {
-	double h1 = h2o_region4_h_Tx(T, 0);
-	double h2 = h2o_region4_h_Tx(T, 1);
+	twoarg_func_t water_func, steam_func;
+	double p, h1, h2;
+
+	region4_h_funcs(T, &water_func, &steam_func);
+
+	p = h2o_region4_p_T(T);
+	h1 = water_func(p, T);
+	h2 = steam_func(p, T);
 
 	return (h - h1) / (h2 - h1);
 }
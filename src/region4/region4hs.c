@@ -8,8 +8,13 @@
 #endif
 
 #include "region4.h"
+#include "stats.h"
 #include "xmath.h"
 
+#ifdef H2O_GENERATED_POLY
+#	include "gen/region4hs.h"
+#endif
+
 /* Supplementary Release on Backward Equations p(h,s) for Region 3, Equations as
  * a Function of h and s for the Region Boundaries, and an Equation Tsat(h,s)
  * for Region 4 of the IAPWS Industrial Formulation 1997 for the Thermodynamic
@@ -76,10 +81,11 @@ static const double sstar = 9.2; /* [kJ/kgK] */
 
 double h2o_region4_T_hs(double h, double s)
 {
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_T_HS);
 	double eta = h / hstar;
 	double sigma = s / sstar;
 
-	return twoarg_poly_value(eta - 0.119, sigma - 1.07,
+	return TWOARG_POLY_VALUE(region4hs, eta - 0.119, sigma - 1.07,
 			I, Ipows, 0, 15, 0,
 			J, Jpows, 0, 17, 0,
 			n, 36) * Tstar;
@@ -0,0 +1,119 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "consts.h"
+#include "h2o.h"
+#include "region4.h"
+#include "stats.h"
+#include "xmath.h"
+
+#include <math.h>
+
+/* Saturation line interpolated from the tables emitted
+ * by tools/sattabgen.c */
+
+enum sattab_column
+{
+	SATTAB_LNP,
+	SATTAB_RHO1,
+	SATTAB_LNRHO2,
+	SATTAB_U1,
+	SATTAB_U2,
+	SATTAB_H1,
+	SATTAB_H2,
+	SATTAB_S1,
+	SATTAB_S2,
+
+	SATTAB_COLUMNS
+};
+
+/* T from Tmin (exclusive) to Tmax (inclusive) with a uniform step */
+struct sattab_segment
+{
+	double Tmax, Tmin, Tstep;
+	int first, nodes;
+};
+
+#include "sattab.h"
+
+static double sattab_T_p(double p)
+{
+	double w[4];
+	int base = xmath_lagrange4_weights(
+			(sqrt(sqrt(p)) - sattab_bmin) / sattab_bstep, SATTAB_P_NODES, w);
+	const double* f = &sattab_p[base];
+	double T = w[0] * f[0] + w[1] * f[1] + w[2] * f[2] + w[3] * f[3];
+
+	/* clamp the interpolation overshoot at the ends */
+	if (T > Tcrit)
+		T = Tcrit;
+	else if (T < Tmin)
+		T = Tmin;
+
+	return T;
+}
+
+/* p is NaN if it is to be interpolated as well */
+static void sattab_sat_pT(double p, double T, struct h2o_sat* out)
+{
+	const struct sattab_segment* seg = sattab_segments;
+	const double (*f)[SATTAB_COLUMNS];
+	double cols[SATTAB_COLUMNS];
+	double w[4];
+	int base, i;
+
+	while (T > seg->Tmax && seg < &sattab_segments[SATTAB_SEGMENTS - 1])
+		++seg;
+
+	base = xmath_lagrange4_weights((T - seg->Tmin) / seg->Tstep,
+			seg->nodes, w);
+	f = &sattab_T[seg->first + base];
+
+	for (i = 0; i < SATTAB_COLUMNS; ++i)
+		cols[i] = w[0] * f[0][i] + w[1] * f[1][i]
+			+ w[2] * f[2][i] + w[3] * f[3][i];
+
+	if (isnan(p))
+		p = exp(cols[SATTAB_LNP]);
+
+	out->p = out->liquid.p = out->vapour.p = p;
+	out->T = out->liquid.T = out->vapour.T = T;
+	out->liquid.x = 0;
+	out->vapour.x = 1;
+
+	out->liquid.rho = cols[SATTAB_RHO1];
+	out->vapour.rho = exp(cols[SATTAB_LNRHO2]);
+	out->liquid.v = 1 / out->liquid.rho;
+	out->vapour.v = 1 / out->vapour.rho;
+	out->liquid.u = cols[SATTAB_U1];
+	out->vapour.u = cols[SATTAB_U2];
+	out->liquid.h = cols[SATTAB_H1];
+	out->vapour.h = cols[SATTAB_H2];
+	out->liquid.s = cols[SATTAB_S1];
+	out->vapour.s = cols[SATTAB_S2];
+
+	/* those diverge at the critical point, so they are not tabulated */
+	out->liquid.cp = out->vapour.cp = NAN;
+	out->liquid.cv = out->vapour.cv = NAN;
+	out->liquid.w = out->vapour.w = NAN;
+}
+
+void h2o_region4_sat_approx_T(double T, struct h2o_sat* out)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_SAT_APPROX_T);
+
+	sattab_sat_pT(NAN, T, out);
+}
+
+void h2o_region4_sat_approx_p(double p, struct h2o_sat* out)
+{
+	H2O_STATS_SCOPE(H2O_STATS_REGION4_SAT_APPROX_P);
+
+	sattab_sat_pT(p, sattab_T_p(p), out);
+}
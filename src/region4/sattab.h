@@ -0,0 +1,4413 @@
+/* generated by h2o-sattabgen, do not edit */
+
+#define SATTAB_SEGMENTS 8
+#define SATTAB_P_NODES 1025
+
+/* Tmax, Tmin, Tstep, first node, node count */
+static const struct sattab_segment sattab_segments[SATTAB_SEGMENTS] = {
+	{ 0x1.2413226c79348p+9, 0x1.1126666666666p+8, 0x1.383816891517bp+0, 0, 256 },
+	{ 0x1.3793333333333p+9, 0x1.2413226c79348p+9, 0x1.3cf4dfeb4d1f8p-1, 256, 64 },
+	{ 0x1.3d545a1cac083p+9, 0x1.3793333333333p+9, 0x1.7c2b12f5e4632p-2, 320, 32 },
+	{ 0x1.407b020c49ba6p+9, 0x1.3d545a1cac083p+9, 0x1.a056ad389e084p-3, 352, 32 },
+	{ 0x1.4193333333333p+9, 0x1.407b020c49ba6p+9, 0x1.213afee07cb5bp-4, 384, 32 },
+	{ 0x1.433ddde101623p+9, 0x1.4193333333333p+9, 0x1.ab806e053198dp-8, 416, 512 },
+	{ 0x1.434cb1f9ea6abp+9, 0x1.433ddde101623p+9, 0x1.e20b4a4a38e39p-10, 928, 64 },
+	{ 0x1.438c49ba5e354p+9, 0x1.434cb1f9ea6abp+9, 0x1.005fc151cddbbp-8, 992, 128 }
+};
+
+/* ln(psat), rho', ln(rho''), u', u'', h', h'', s', s'' = f(Tmin + i * Tstep) */
+static const double sattab_T[1120][SATTAB_COLUMNS] = {
+	{ -7.4000655787365801, 999.79306550632941, -5.3284959903602074,
+		-0.042199165172567749, 2374.9418165941497, -0.041587825988143048,
+		2500.9296939177993, -0.00015454959194317305, 9.1558108062719299 },
+	{ -7.3118786361842032, 999.86269362171811, -5.2447311674288919,
+		5.1018820625808052, 2376.619744473629, 5.1025497160215183,
+		2503.1659889348321, 0.018635979605753632, 9.1233049051794417 },
+	{ -7.2245714531426293, 999.90625852570827, -5.1618248498143862,
+		10.241162112082677, 2378.2969938503288, 10.241890645029875,
+		2505.4013785529323, 0.037325706772051735, 9.0911666097580497 },
+	{ -7.1381316804932231, 999.9248180616579, -5.079764807379834,
+		15.376121971119305, 2379.9735324329836, 15.376916265431021,
+		2507.6358208918682, 0.055917263674817468, 9.059390455329746 },
+	{ -7.0525471936462605, 999.91935530511273, -4.9985390307927986,
+		20.507189926246053, 2381.6493274008903, 20.508055198335953,
+		2509.8692732368713, 0.074413057392771806, 9.0279710761420446 },
+	{ -6.9678060883092963, 999.89078501260315, -4.9181357273284014,
+		25.634747639412634, 2383.3243453745172, 25.63568945895782,
+		2512.1016920047214, 0.09281529605889341, 8.9969032033970677 },
+	{ -6.8838966762128244, 999.83995946099139, -4.8385433166297815,
+		30.759135539736306, 2384.9985523876585, 30.760159849163657,
+		2514.3330327114932, 0.11112601159560445, 8.9661816632666529 },
+	{ -6.8008074808124483, 999.7676737373921, -4.7597504264450707,
+		35.880657606906048, 2386.6719138610933, 35.881770741675282,
+		2516.5632499419071, 0.12934707979217466, 8.9358013749020273 },
+	{ -6.7185272329842975, 999.67467053367454, -4.6817458883576215,
+		40.999585614105882, 2388.3443945777099, 41.000794323807568,
+		2518.7922973202708, 0.1474802380337496, 8.9057573484454764 },
+	{ -6.6370448667284148, 999.56164449414803, -4.6045187335241797,
+		46.116162890715778, 2390.0159586590507, 46.117474361002166,
+		2521.020127482936, 0.16552710095515275, 8.8760446830505106 },
+	{ -6.5563495148927409, 999.4292461601774, -4.5280581884336319,
+		51.230607658359432, 2391.686569543212, 51.232029533725871,
+		2523.2466920522265, 0.18348917426094516, 8.8466585649159466 },
+	{ -6.4764305049288726, 999.27808555106776, -4.4523536706974625,
+		56.34311598783313, 2393.356189964064, 56.344656395267499,
+		2525.47194161179, 0.20136786692491584, 8.8175942653388528 },
+	{ -6.3972773546888835, 999.10873541663807, -4.3773947848812087,
+		61.453864419201629, 2395.0247819317237, 61.455531992719131,
+		2527.6958256833077, 0.21916450195754397, 8.7888471387902811 },
+	{ -6.3188797682716116, 998.92173419335234, -4.3031713183853002,
+		66.563012282594215, 2396.6923067142261, 66.564816188674328,
+		2529.9182927045067, 0.23688032590791583, 8.7604126210173483 },
+	{ -6.2412276319250743, 998.71758869267921, -4.2296732373819017,
+		71.670703753114978, 2398.358724820333, 71.672653717057457,
+		2532.1392900084084, 0.2545165172474767, 8.7322862271744359 },
+	{ -6.1643110100110308, 998.4967765475003, -4.156890682813791,
+		76.777069669520898, 2400.0239959834207, 76.779176002736847,
+		2534.3587638037629, 0.27207419376568942, 8.7044635499860341 },
+	{ -6.0881201410364874, 998.25974843980384, -4.0848139664600316,
+		81.882229143082085, 2401.6880791463809, 81.884502771336599,
+		2536.5766591565857, 0.28955441909282192, 8.6769402579430555 },
+	{ -6.0126454337562185, 998.00693013058969, -4.013433567072501,
+		86.986290980074301, 2403.3509324474735, 86.98874347269583,
+		2538.7929199727532, 0.30695820845160632, 8.6497120935343332 },
+	{ -5.9378774633494604, 997.73872431083043, -3.942740126586425,
+		92.089354938793136, 2405.0125132070602, 92.091998538865198,
+		2541.0074889815619, 0.32428653372786231, 8.6227748715143324 },
+	{ -5.8638069676735292, 997.45551229047146, -3.8727244464076476,
+		97.191512839639614, 2406.672777915187, 97.19436049518967,
+		2543.220307720248, 0.34154032793967903, 8.5961244772082868 },
+	{ -5.7904248435961492, 997.15765554075665, -3.8033774837784291,
+		102.29284954480414, 2408.3316822198954, 102.29591494100426,
+		2545.4313165193144, 0.35872048917563087, 8.5697568648550977 },
+	{ -5.7177221434081336, 996.84549710368287, -3.7346903482233884,
+		107.39344382223537, 2409.9891809162632, 107.39674141462862,
+		2547.6404544886932, 0.37582788406432127, 8.5436680559886842 },
+	{ -5.6456900713172402, 996.51936288100308, -3.6666542980764394,
+		112.49336910695715, 2411.6452279360778, 112.49691415572359,
+		2549.8476595046227, 0.39286335083035151, 8.5178541378578956 },
+	{ -5.5743199800239589, 996.17956281400075, -3.5992607370894429,
+		117.59269417137236, 2413.2997763380927, 117.59650277664771,
+		2552.0528681972155, 0.40982770198551161, 8.4923112618850816 },
+	{ -5.5036033673792506, 995.82639196414573, -3.5325012111226388,
+		122.6914837148838, 2414.9527782988112, 122.69557285314369,
+		2554.2560159386449, 0.42672172669824426, 8.4670356421631734 },
+	{ -5.4335318731243243, 995.46013150376416, -3.4663674049169182,
+		127.78979888204242, 2416.6041851037539, 127.79418644356464,
+		2556.4570368319064, 0.44354619287957309, 8.4420235539911239 },
+	{ -5.3640972757119272, 995.08104962497066, -3.4008511389474552,
+		132.88769771740417, 2418.2539471391547, 132.8924025448207,
+		2558.6558637001194, 0.46030184901918991, 8.4172713324473563 },
+	{ -5.2952914892086618, 994.68940237429945, -3.3359443663582025,
+		137.9852355643711, 2419.9020138840301, 137.99027749232133,
+		2560.8524280762995, 0.47698942580150622, 8.3927753710007416 },
+	{ -5.2271065602774263, 994.28543441977308, -3.2716391699763854,
+		143.08246541449495, 2421.5483339025982, 143.08786531039107,
+		2563.0466601935859, 0.49360963752805298, 8.3685321201586831 },
+	{ -5.1595346652389962, 993.86937975648232, -3.2079277594060365,
+		148.17943821300241, 2423.1928548369979, 148.1852180189174,
+		2565.2384889758882, 0.51016318336952804, 8.3445380861516902 },
+	{ -5.09256810721162, 993.44146235618302, -3.1448024681994626,
+		153.2762031256494, 2424.8355234002815, 153.28238590133765,
+		2567.4278420289165, 0.5266507484680415, 8.3207898296538474 },
+	{ -5.0261993133273482, 993.00189676588138, -3.0822557511054085,
+		158.3728077714683, 2426.4762853696448, 158.37941773852805,
+		2569.6146456315732, 0.54307300490782096, 8.2972839645385132 },
+	{ -4.9604208320236847, 992.55088865991479, -3.0202801813925353,
+		163.4692984254346, 2428.1150855798874, 163.47636101262182,
+		2571.7988247277076, 0.55943061257035065, 8.274017156668581 },
+	{ -4.8952253304091089, 992.08863534960608, -2.9588684482468084,
+		168.56572019465679, 2429.7518679170635, 168.57326208435791,
+		2573.9803029181926, 0.57572421988822031, 8.2509861227205725 },
+	{ -4.8306055917009028, 991.6153262541842, -2.8980133542412658,
+		173.66211717127487, 2431.3865753123291, 173.67016634714767,
+		2576.1590024533425, 0.59195446451014277, 8.228187629041841 },
+	{ -4.7665545127336975, 991.13114333632211, -2.8377078128766313,
+		178.75853256489265, 2433.0191497359674, 178.76711836068145,
+		2578.334844225667, 0.60812197388819278, 8.2056184905401715 },
+	{ -4.7030651015370726, 990.63626150533059, -2.7779448461911578,
+		183.85500881706679, 2434.6495321915959, 183.86416196659999,
+		2580.5077477629598, 0.62422736579703253, 8.1832755696050228 },
+	{ -4.6401304749805083, 990.13084899075511, -2.718717582438047,
+		188.95158770006907, 2436.2776627105582, 188.96134038844525,
+		2582.6776312217462, 0.64027124879366748, 8.1611557750596972 },
+	{ -4.577743856484024, 989.61506768889058, -2.660019253828831,
+		194.04831040191291, 2437.9034803464974, 194.05869631788067,
+		2584.8444113810965, 0.65625422262533784, 8.139256061143648 },
+	{ -4.5158985737927404, 989.08907348447065, -2.6018431943410136,
+		199.14521759937472, 2439.5269231701463, 199.15627198891349,
+		2587.0080036368395, 0.67217687859215025, 8.1175734265243094 },
+	{ -4.4545880568136473, 988.55301654961011, -2.5441828375882989,
+		204.24234952057608, 2441.1479282643272, 204.25410924168131,
+		2589.168321996196, 0.68803979987033292, 8.0961049133376086 },
+	{ -4.3938058355128726, 988.00704162186082, -2.4870317147517649,
+		209.33974599848761, 2442.7664317192061, 209.35224957716571,
+		2591.3252790728702, 0.70384356180125351, 8.0748476062565775 },
+	{ -4.3335455378716796, 987.45128826310474, -2.4303834525702621,
+		214.43744651657516, 2444.382368627816, 214.45073420405257,
+		2593.4787860826423, 0.71958873215072117, 8.0537986315873038 },
+	{ -4.2738008878995526, 986.88589110082614, -2.3742317713884469,
+		219.53549024764507, 2445.995673081884, 219.54960407879454,
+		2595.6287528394914, 0.73527587134251005, 8.0329551563915551 },
+	{ -4.2145657037026139, 986.31098005318165, -2.3185704832607561,
+		224.63391608684731, 2447.6062781679948, 224.64889993983476,
+		2597.7750877523108, 0.75090553266961091, 8.012314387635465 },
+	{ -4.1558338956057419, 985.72668053915731, -2.2633934901097232,
+		229.73276267966281, 2449.2141159641337, 229.74866233681831,
+		2599.9176978222476, 0.7664782624862353, 7.9918735713635893 },
+	{ -4.0975994643267466, 985.13311367498807, -2.2086947819370635,
+		234.83206844560223, 2450.8191175366546, 234.8489316555162,
+		2602.0564886407474, 0.78199460038323032, 7.9716299918977676 },
+	{ -4.039856499200944, 984.53039645791341, -2.1544684350858989,
+		239.93187159827221, 2452.4212129376979, 239.94974813911998,
+		2604.191364388319, 0.79745507934922044, 7.9515809710600918 },
+	{ -3.9825991764545972, 983.9186419382437, -2.1007086105526382,
+		245.03221016236506, 2454.0203312031358, 245.05115190646092,
+		2606.3222278341163, 0.81286022591952922, 7.931723867419497 },
+	{ -3.9258217575256262, 983.29795938063296, -2.0474095523469495,
+		250.13312198806787, 2455.6164003510576, 250.15318296764963,
+		2608.4489803363676, 0.82821056031458595, 7.9120560755613205 },
+	{ -3.8695185874300857, 982.6684544153776, -1.9945655858983535,
+		255.23464476333535, 2457.2093473808727, 255.25588123758064,
+		2610.5715218437163, 0.84350659656941596, 7.8925750253792675 },
+	{ -3.8136840931729337, 982.03022918048259, -1.9421711165079947,
+		260.336816024386, 2458.7990982730721, 260.35928654766076,
+		2612.6897508975444, 0.85874884265548013, 7.8732781813892849 },
+	{ -3.7583127822015796, 981.38338245518867, -1.8902206278440985,
+		265.43967316477182, 2460.3855779896876, 265.46343865611055,
+		2614.8035646353192, 0.87393780059605275, 7.8541630420647284 },
+	{ -3.7033992409009224, 980.72800978556836, -1.8387086804798296,
+		270.54325344329436, 2461.9687104755144, 270.56837725711284,
+		2616.9128587950245, 0.88907396657610793, 7.8352271391923578 },
+	{ -3.6489381331283504, 980.0642036027848, -1.7876299104720494,
+		275.6475939910186, 2463.5484186601343, 275.67414198905806,
+		2619.0175277207372, 0.90415783104757996, 7.8164680372485735 },
+	{ -3.5949241987875067, 979.39205333452469, -1.7369790279797599,
+		280.75273181760042, 2465.1246244607896, 280.7807724421026,
+		2621.1174643693889, 0.91918987883070513, 7.7978833327954327 },
+	{ -3.5413522524394394, 978.7116455100944, -1.6867508159208602,
+		285.85870381711231, 2466.6972487861658, 285.88830816522398,
+		2623.2125603187801, 0.93417058921209817, 7.7794706538959364 },
+	{ -3.488217181949882, 978.02306385961731, -1.6369401286659386,
+		290.96554677352577, 2468.2662115410844, 290.99678867293204,
+		2625.3027057768531, 0.94910043604008831, 7.7612276595479894 },
+	{ -3.4355139471714833, 977.32638940774234, -1.587541890767906,
+		296.07329736597728, 2469.8314316322057, 296.10625345176175,
+		2627.3877895923156, 0.96397988781774246, 7.7431520391366861 },
+	{ -3.3832375786597888, 976.6217005622367, -1.5385510957262263,
+		301.18199217394601, 2471.3928269747248, 301.21674196667641,
+		2629.4676992666, 0.97880940779399406, 7.7252415119042874 },
+	{ -3.3313831764217934, 975.90907319780683, -1.4899628047845475,
+		306.29166768242624, 2472.9503145001158, 306.32829366746296,
+		2631.5423209672231, 0.99358945405315813, 7.7074938264374637 },
+	{ -3.2799459086960114, 975.18858073546028, -1.4417721457606125,
+		311.40236028718328, 2474.5038101649507, 311.44094799520929,
+		2633.6115395425454, 1.0083204796031322, 7.6899067601712821 },
+	{ -3.228921010762952, 974.46029421770606, -1.3939743119072894,
+		316.51410630015346, 2476.0532289608109, 316.5547443889231,
+		2635.6752385379605, 1.0230029324624781, 7.6724781189094617 },
+	{ -3.1783037837849983, 973.72428237985957, -1.3465645608036561,
+		321.62694195504724, 2477.5984849253027, 321.66972229235159,
+		2637.7333002135142, 1.0376372557465665, 7.6552057363603483 },
+	{ -3.1280895936746718, 972.98061171769314, -1.2995382132750462,
+		326.74090341319777, 2479.1394911542066, 326.78592116104375,
+		2639.7856055629636, 1.0522238877529499, 7.6380874736881763 },
+	{ -3.0782738699902987, 972.22934655167637, -1.2528906523409828,
+		331.85602676968307, 2480.6761598147368, 331.90338046968435,
+		2641.8320343342602, 1.0667632620460381, 7.6211212190790532 },
+	{ -3.0288521048582204, 971.4705490879993, -1.2066173221900705,
+		336.97234805976422, 2482.2084021599353, 337.0221397197397,
+		2643.8724650514496, 1.0812558075412197, 7.6043048873211765 },
+	{ -2.9798198519205505, 970.70427947658823, -1.1607137271807246,
+		342.08990326563583, 2483.7361285441875, 342.14223844741542,
+		2645.9067750379691, 1.095701948588429, 7.5876364193988142 },
+	{ -2.931172725307706, 969.93059586628578, -1.1151754308668795,
+		347.20872832352643, 2485.2592484398224, 347.26371623195848,
+		2647.9348404412954, 1.1101021050552851, 7.5711137820994292 },
+	{ -2.8829063986348369, 969.14955445736655, -1.0699980550476766,
+		352.32885913113853, 2486.777670454805, 352.38661270429822,
+		2649.9565362589124, 1.1244566924097648, 7.5547349676335251 },
+	{ -2.8350166040213325, 968.36120955154263, -1.0251772788401852,
+		357.45033155544621, 2488.2913023514852, 357.51096755604101,
+		2651.9717363655677, 1.1387661218024867, 7.5384979932666631 },
+	{ -2.7874991311326998, 967.56561359959903, -0.98070883777433249,
+		362.57318144083951, 2489.8000510663501, 362.63682054880917,
+		2653.9803135417251, 1.1530308001485732, 7.5224009009630723 },
+	{ -2.7403498262439987, 966.76281724679961, -0.93658852290908601,
+		367.69744461762082, 2491.3038227307557, 367.76421152392948,
+		2655.9821395031699, 1.1672511302091253, 7.5064417570403705 },
+	{ -2.6935645913241713, 965.95286937617527, -0.89281217996908258,
+		372.82315691084636, 2492.8025226925856, 372.89318041246304,
+		2657.9770849316965, 1.1814275106722851, 7.4906186518348381 },
+	{ -2.6471393831405559, 965.13581714982661, -0.84937570850085919,
+		377.95035414949933, 2494.296055538774, 378.02376724556564,
+		2659.9650195067752, 1.19556033623387, 7.4749296993767116 },
+	{ -2.6010702123829352, 964.31170604832209, -0.80627506104787228,
+		383.07907217599723, 2495.7843251186277, 383.15601216517859,
+		2661.9458119381225, 1.2096499976775841, 7.4593730370749274 },
+	{ -2.5553531428064646, 963.48057990832388, -0.76350624234350573,
+		388.20934685601321, 2497.2672345678916, 388.28995543503169,
+		2663.9193299990739, 1.2236968819547729, 7.443946825410805 },
+	{ -2.5099842903929011, 962.6424809584978, -0.721065308521324,
+		393.34121408860125, 2498.7446863334585, 393.42563745194803,
+		2665.8854405606398, 1.23770137226369, 7.4286492476400969 },
+	{ -2.4649598225295275, 961.79744985382513, -0.67894836634181321,
+		398.47470981661678, 2500.2165821986682, 398.56309875744165,
+		2667.8440096261506, 1.2516638481282689, 7.4134785095028644 },
+	{ -2.4202759572052184, 960.94552570837652, -0.6371515724348813,
+		403.60987003741644, 2501.6828233090778, 403.70238004959248,
+		2669.79490236635, 1.2655846854763726, 7.3984328389406517 },
+	{ -2.3759289622230884, 960.08674612662492, -0.59567113255741,
+		408.74673081382571, 2503.1433101986331, 408.84352219518877,
+		2671.7379831548224, 1.2794642567174839, 7.3835104858203735 },
+	{ -2.3319151544292152, 959.22114723337813, -0.55450330086517763,
+		413.88532828535892, 2504.5979428161309, 413.9865662421181,
+		2673.6731156036153, 1.2933029308198254, 7.3687097216644188 },
+	{ -2.28823089895698, 958.34876370238476, -0.51364437919853601,
+		419.02569867967736, 2506.0466205518696, 419.13155343199793,
+		2675.6001625989215, 1.3071010733868726, 7.3540288393864186 },
+	{ -2.2448726084864541, 957.46962878367776, -0.47309071638111133,
+		424.16787832427434, 2507.4892422643802, 424.27852521302987,
+		2677.518986336675, 1.3208590467332353, 7.3394661530321326 },
+	{ -2.2018367425184597, 956.58377432971611, -0.43283870753099524,
+		429.31190365837631, 2508.9257063071304, 429.42752325307134,
+		2679.4294483579165, 1.3345772099599147, 7.3250199975249597 },
+	{ -2.1591198066628032, 955.69123082036913, -0.39288479338377486,
+		434.45781124503327, 2510.3559105550785, 434.57858945289519,
+		2681.3314095837791, 1.3482559190288466, 7.3106887284155189 },
+	{ -2.1167183519403308, 954.79202738680465, -0.35322545962689184,
+		439.6056377834085, 2511.7797524309717, 439.73176595964867,
+		2683.224730349938, 1.3618955268367967, 7.2964707216348783 },
+	{ -2.0746289740982791, 953.88619183431672, -0.31385723624467293,
+		444.755420121231, 2513.197128931256, 444.88709518047631,
+		2685.1092704403795, 1.3754963832885183, 7.2823643732508145 },
+	{ -2.0328483129386812, 952.97375066414497, -0.27477669687363127,
+		449.90719526741799, 2514.6079366514914, 450.04461979631259,
+		2686.9848891203233, 1.3890588353691842, 7.268368099226767 },
+	{ -1.9913730516593031, 952.05472909431876, -0.23598045816740371,
+		455.06100040484307, 2516.0120718111343, 455.20438277582258,
+		2688.8514451681476, 1.402583227216093, 7.2544803351828895 },
+	{ -1.9501999162068877, 951.12915107957269, -0.19746517917095602,
+		460.2168729032461, 2517.4094302775839, 460.36642738948507,
+		2690.7087969061722, 1.4160699001895891, 7.2406995361588793 },
+	{ -1.9093256746422349, 950.19703933036169, -0.15922756070348379,
+		465.37485033227091, 2518.7999075893545, 465.53079722380647,
+		2692.5568022301322, 1.4295191929432383, 7.2270241763780332 },
+	{ -1.8687471365168964, 949.2584153310155, -0.12126434474966771,
+		470.53497047462668, 2520.1833989782635, 470.69753619565961,
+		2694.3953186371982, 1.4429314414932148, 7.2134527490122053 },
+	{ -1.8284611522610765, 948.31329935705662, -0.083572313858786204,
+		475.69727133935493, 2521.5597993905135, 475.86668856673276,
+		2696.224203252405, 1.4563069792868963, 7.1999837659472616 },
+	{ -1.7884646125825014, 947.36171049172663, -0.046148290551353784,
+		480.8617911751997, 2522.9290035065542, 481.03829895808434,
+		2698.0433128533327, 1.4696461372706697, 7.18661575754862 },
+	{ -1.7487544478759112, 946.40366664172541, -0.008989136732870464,
+		486.02856848407407, 2524.290905759608, 486.21241236479847,
+		2699.8525038929088, 1.4829492439569356, 7.1733472724265779 },
+	{ -1.7093276276429319, 945.43918455221456, 0.027908246885630848,
+		491.19764203461096, 2525.6454003527529, 491.38907417072943,
+		2701.6516325202051, 1.4962166254903122, 7.1601768772010956 },
+	{ -1.6701811599220102, 944.46827982108823, 0.064546921360601681,
+		496.36905087579663, 2526.9923812744519, 496.56833016333343,
+		2703.440554599089, 1.5094486057130356, 7.1471031562657119 },
+	{ -1.6313120907282246, 943.49096691255284, 0.10092991008278705,
+		501.5428343506735, 2528.3317423124395, 501.75022654857696,
+		2705.2191257246241, 1.5226455062295514, 7.1341247115503661 },
+	{ -1.5927175035026093, 942.50725917002035, 0.13706019933821606,
+		506.71903211011846, 2529.6633770658614, 506.93480996592513,
+		2706.9872012371115, 1.5358076464703152, 7.1212401622828363 },
+	{ -1.5543945185708763, 941.51716882835126, 0.17294073886349504,
+		511.89768412667752, 2530.9871789555718, 512.12212750339552,
+		2708.7446362336477, 1.5489353437547795, 7.1084481447486176 },
+	{ -1.5163402926111993, 940.52070702545552, 0.20857444239574,
+		517.07883070846935, 2532.3030412325334, 517.31222671268677,
+		2710.4912855771431, 1.562028913353612, 7.0957473120490411 },
+	{ -1.4785520181309004, 939.51788381327128, 0.24396418821728891,
+		522.26251251313238, 2533.6108569842063, 522.50515562436055,
+		2712.2270039026803, 1.5750886685500907, 7.0831363338574578 },
+	{ -1.4410269229517845, 938.50870816814574, 0.27911281969541252,
+		527.44877056183839, 2534.910519138889, 527.70096276309846,
+		2713.9516456211709, 1.588114920700757, 7.0706138961733735 },
+	{ -1.4037622697039458, 937.49318800062622, 0.31402314581715896,
+		532.63764625334727, 2536.2019204679391, 532.89969716301016,
+		2715.6650649202297, 1.6011079792952756, 7.0581787010744561 },
+	{ -1.366755355327822, 936.47133016467671, 0.34869794171948998,
+		537.82918137811384, 2537.4849535858179, 538.10140838300424,
+		2717.3671157622261, 1.614068152015538, 7.0458294664663015 },
+	{ -1.3300035105843309, 935.44314046634099, 0.38313994921479522,
+		543.02341813244209, 2538.7595109479244, 543.30614652221891,
+		2719.0576518794737, 1.6269957447940224, 7.0335649258299595 },
+	{ -1.2935040995728493, 934.40862367185503, 0.41735187731194179,
+		548.22039913268316, 2540.0254848461777, 548.51396223550603,
+		2720.7365267665282, 1.6398910618714033, 7.021383827967175 },
+	{ -1.2572545192569495, 933.36778351523515, 0.45133640273282516,
+		553.42016742948579, 2541.2827674023315, 553.72490674898484,
+		2722.4035936695891, 1.6527544058534649, 7.0092849367434118 },
+	{ -1.2212521989976159, 932.32062270533447, 0.48509617042459757,
+		558.62276652208232, 2542.5312505589891, 558.93903187564001,
+		2724.0587055729884, 1.6655860777672646, 6.9972670308286418 },
+	{ -1.185494600093854, 931.26714293240229, 0.51863379406750565,
+		563.82824037263413, 2543.770826068333, 564.15639003100011,
+		2725.7017151828036, 1.6783863771166438, 6.985328903436046 },
+	{ -1.1499792153304829, 930.20734487413154, 0.55195185657842205,
+		569.03663342061395, 2545.0013854785493, 569.37703424886251,
+		2727.3324749075869, 1.6911556019370326, 6.9734693620586654 },
+	{ -1.1147035685329889, 929.14122820122145, 0.58505291061001485,
+		574.24799059724558, 2546.2228201179896, 574.60101819709757,
+		2728.9508368362872, 1.7038940488496084, 6.9616872282042053 },
+	{ -1.0796652141292817, 928.06879158246204, 0.61793947904555724,
+		579.46235733998947, 2547.4350210770604, 579.8283961935133,
+		2730.556652713376, 1.7166020131147994, 6.949981337128083 },
+	{ -1.0448617367181832, 926.9900326893395, 0.65061405548935569,
+		584.67977960708913, 2548.6378791878974, 585.05922322180061,
+		2732.1497739112724, 1.7292797886851858, 6.938350537564939 },
+	{ -1.0102907506445398, 925.90494820017909, 0.68307910475271272,
+		589.90030389216679, 2549.8312850018551, 590.29355494754725,
+		2733.7300514001231, 1.7419276682577673, 6.9267936914588129 },
+	{ -0.97594989958082057, 924.81353380382666, 0.71533706333536429,
+		595.12397723888478, 2551.0151287648641, 595.53144773434008,
+		2735.297335715034, 1.754545943325666, 6.9153096736922048 },
+	{ -0.9418368561150593, 923.71578420288665, 0.74739033990231596,
+		600.35084725567083, 2552.189300390718, 600.7729586599495,
+		2736.8514769208459, 1.7671349042292617, 6.9038973718142662 },
+	{ -0.90794932134499717, 922.61169311650076, 0.77924131575600686,
+		605.58096213050885, 2553.353689432367, 606.01814553260567,
+		2738.3923245745796, 1.7796948402067734, 6.8925556857684205 },
+	{ -0.87428502447834022, 921.50125328269939, 0.8108923453036545,
+		610.81437064580746, 2554.508185051267, 611.26706690737592,
+		2739.9197276856421, 1.7922260394443408, 6.8812835276196269 },
+	{ -0.84084172243898991, 920.38445646030857, 0.84234575651969812,
+		616.0511221933391, 2555.6526759849171, 616.51978210263735,
+		2741.4335346739649, 1.8047287891255734, 6.8700798212816814 },
+	{ -0.80761719947914856, 919.2612934304293, 0.87360385140319174,
+		621.29126678926912, 2556.7870505126302, 621.77635121666663,
+		2742.9335933261805, 1.8172033754806562, 6.8589435022448013 },
+	{ -0.77460926679713049, 918.13175399749207, 0.90466890643008824,
+		626.53485508927304, 2557.9111964196723, 627.0368351443459,
+		2744.4197507500007, 1.8296500838349885, 6.847873517303813 },
+	{ -0.7418157621608602, 916.99582698988434, 0.9355431730001843,
+		631.78193840374422, 2559.0250009598622, 632.30129559398881,
+		2745.8918533269625, 1.8420691986573834, 6.8368688242873459 },
+	{ -0.70923454953688758, 915.85350026015897, 0.96622887787865419,
+		637.03256871311032, 2560.1283508167353, 637.56979510430426,
+		2747.3497466636759, 1.8544610036078866, 6.8259283917882838 },
+	{ -0.67686351872482431, 914.70476068482651, 0.99672822363203017,
+		642.28679868324912, 2561.2211320634256, 642.8423970614939,
+		2748.7932755417951, 1.8668257815851808, 6.8150511988959073 },
+	{ -0.6447005849971138, 913.54959416373015, 1.0270433890584754,
+		647.54468168103188, 2562.3032301213379, 648.11916571650863,
+		2750.2222838668217, 1.8791638147736784, 6.8042362349299781 },
+	{ -0.61274368874404972, 912.38798561901046, 1.0571765296122027,
+		652.80627178997702, 2563.3745297177852, 653.40016620245137,
+		2751.6366146159821, 1.8914753846902359, 6.7934824991772231 },
+	{ -0.58099079512391205, 911.2199189936523, 1.0871297778219333,
+		658.0716238260469, 2564.4349148426891, 658.68546455215846,
+		2753.0361097853206, 1.903760772230606, 6.7827890006304701 },
+	{ -0.5494398937181687, 910.04537724962427, 1.1169052437032319,
+		663.3407933535758, 2565.4842687044916, 663.97512771595154,
+		2754.4206103362085, 1.9160202577155878, 6.7721547577308261 },
+	{ -0.5180889981916057, 908.86434236560854, 1.1465050151646294,
+		668.61383670135115, 2566.5224736854007, 669.26922357958108,
+		2755.7899561414483, 1.9282541209369339, 6.7615787981132183 },
+	{ -0.48693614595734641, 907.67679533431453, 1.1759311584073826,
+		673.89081097884957, 2567.5494112961201, 674.56782098236647,
+		2757.1439859311581, 1.9404626412030328, 6.7510601583556111 },
+	{ -0.45597939784665797, 906.48271615938643, 1.2051857183187547,
+		679.17177409264445, 2568.5649621301873, 679.87098973555089,
+		2758.4825372386313, 1.9526460973844053, 6.7405978837322644 },
+	{ -0.42521683778343, 905.28208385189271, 1.2342707188587745,
+		684.45678476298338, 2569.5690058180453, 685.17880064087001,
+		2759.8054463463186, 1.9648047679590117, 6.7301910279712356 },
+	{ -0.39464657246328744, 904.07487642640615, 1.2631881634403179,
+		689.74590254055909, 2570.5614209809987, 690.49132550936179,
+		2761.1125482321459, 1.9769389310574428, 6.7198386530164864 },
+	{ -0.36426673103722634, 902.86107089666507, 1.291940035302493,
+		695.03918782347898, 2571.5420851851618, 695.80863718042247,
+		2762.4036765163069, 1.9890488645079916, 6.709539828794834 },
+	{ -0.33407546479973838, 901.64064327081871, 1.3205282978772068,
+		700.33670187443647, 2572.5108748955445, 701.13080954111558,
+		2763.6786634087102, 2.0011348458816429, 6.6992936329879731 },
+	{ -0.30407094688127578, 900.41356854624269, 1.3489548951489558,
+		705.63850683811381, 2573.467665430368, 706.45791754576396,
+		2764.9373396572287, 2.0131971525370154, 6.689099150809799 },
+	{ -0.27425137194503885, 899.17982070394112, 1.3772217520077492,
+		710.94466575881052, 2574.4123309157558, 711.79003723582275,
+		2766.1795344968973, 2.0252360616652894, 6.6789554747892206 },
+	{ -0.24461495588801166, 897.93937270250831, 1.4053307745951662,
+		716.25524259832002, 2575.3447442408728, 717.12724576005701,
+		2767.4050756001898, 2.0372518503351396, 6.6688617045586094 },
+	{ -0.21515993554613816, 896.69219647166324, 1.4332838506435934,
+		721.57030225406572, 2576.2647770136414, 722.46962139503682,
+		2768.613789028504, 2.0492447955377138, 6.6588169466480691 },
+	{ -0.18588456840360049, 895.43826290533389, 1.4610828498086459,
+		726.88991057750832, 2577.1722995171008, 727.81724356596681,
+		2769.8054991849594, 2.0612151742316946, 6.6488203142855538 },
+	{ -0.15678713230610486, 894.1775418543084, 1.4887296239948553,
+		732.21413439284436, 2578.0671806665127, 733.17019286786785,
+		2770.980028768603, 2.0731632633884689, 6.6388709272029738 },
+	{ -0.1278659251781491, 892.91000211842061, 1.5162260076746628,
+		737.54304151600024, 2578.9492879672625, 738.52855108712208,
+		2772.1371987301072, 2.0850893400374373, 6.6289679114482958 },
+	{ -0.099119264744142607, 891.63561143827746, 1.5435738182008856,
+		742.87670077394398, 2579.8184874736239, 743.89240122340414,
+		2773.2768282290117, 2.0969936813115058, 6.6191103992036142 },
+	{ -0.070545488253371855, 890.35433648652076, 1.5707748561127228,
+		748.21518202433788, 2580.6746437484439, 749.26182751202339,
+		2774.3987345925711, 2.1088765644928036, 6.6092975286092006 },
+	{ -0.042142952208716306, 889.06614285859916, 1.5978309054354989,
+		753.55855617553277, 2581.5176198237705, 754.63691544668188,
+		2775.5027332762288, 2.1207382670586394, 6.5995284435934591 },
+	{ -0.013910032099062766, 887.77099506306104, 1.6247437339742958,
+		758.90689520693184, 2582.3472771624424, 760.01775180268044,
+		2776.5886378257201, 2.1325790667277564, 6.5898022937086029 },
+	{ 0.014154877864661027, 886.46885651133675, 1.65151509360172,
+		764.26027218974377, 2583.1634756206622, 765.40442466058994,
+		2777.6562598408041, 2.1443992415069175, 6.5801182339719952 },
+	{ 0.042053365009870849, 885.15968950700847, 1.6781467205399954,
+		769.61876130813721, 2583.9660734115232, 770.79702343041129,
+		2778.705408940576, 2.1561990697378643, 6.5704754247128845 },
+	{ 0.069786998459203775, 883.84345523455261, 1.7046403356376763,
+		774.98243788082016, 2584.7549270695054, 776.19563887624122,
+		2779.7358927303394, 2.1679788301446763, 6.5608730314243795 },
+	{ 0.097357329383931657, 882.52011374753943, 1.7309976446412372,
+		780.35137838307139, 2585.529891415847, 781.60036314148363,
+		2780.7475167699176, 2.17973880188161, 6.5513102246202948 },
+	{ 0.12476589125400395, 881.18962395626897, 1.7572203384619083,
+		785.72566046922771, 2586.2908195247942, 787.01128977460576,
+		2781.7400845433444, 2.1914792645814067, 6.5417861796966648 },
+	{ 0.15201420008474889, 879.85194361483616, 1.7833100934380564,
+		791.10536299567787, 2587.037562690618, 792.42851375549844,
+		2782.7133974298022, 2.2032004984041835, 6.5323000767974628 },
+	{ 0.17910375468028375, 878.50702930759076, 1.809268571593484,
+		796.49056604435782, 2587.7699703953303, 797.8521315224375,
+		2783.6672546756572, 2.2149027840868891, 6.5228511006842451 },
+	{ 0.20603603687371291, 877.1548364349884, 1.8350974208920694,
+		801.88135094679353, 2588.487890276996, 803.28224099969623,
+		2784.6014533674402, 2.226586402993421, 6.5134384406091943 },
+	{ 0.2328125117641611, 875.7953191987973, 1.860798275489155,
+		807.27780030871031, 2589.1911680985049, 808.7189416258293,
+		2785.5157884055775, 2.2382516371654408, 6.5040612901911823 },
+	{ 0.25943462795068456, 874.42843058664221, 1.8863727559801302,
+		812.67999803523583, 2589.8796477166857, 814.16233438266579,
+		2786.4100524786559, 2.2498987693739387, 6.4947188472942683 },
+	{ 0.28590381776314816, 873.05412235586164, 1.9118224696467123,
+		818.08802935672838, 2590.5531710515902, 819.61252182503938,
+		2787.2840360380014, 2.2615280831716014, 6.4854103139081527 },
+	{ 0.31222149749005468, 871.67234501664132, 1.9371490107013571,
+		823.50198085526154, 2591.2115780557938, 825.06960811129647,
+		2788.1375272723126, 2.2731398629460671, 6.4761348960300262 },
+	{ 0.33838906760347037, 870.28304781440772, 1.9623539605304123,
+		828.92194049179375, 2591.8547066835081, 830.53369903461567,
+		2788.9703120820586, 2.2847343939740821, 6.4668918035471421 },
+	{ 0.36440791298102104, 868.88617871143754, 1.9874388879364828,
+		834.34799763406693, 2592.4823928593164, 836.00490205518224,
+		2789.7821740533636, 2.296311962476687, 6.4576802501195694 },
+	{ 0.39027940312505133, 867.48168436765275, 2.0124053493806051,
+		839.7802430852596, 2593.0944704462995, 841.48332633325401,
+		2790.5728944310458, 2.3078728556754391, 6.4484994530624009 },
+	{ 0.41600489237897814, 866.06951012056481, 2.0372548892248026,
+		845.21876911343645, 2593.6907712133284, 846.96908276316401,
+		2791.3422520904746, 2.3194173618497853, 6.4393486332267837 },
+	{ 0.4415857201409159, 864.6495999643339, 2.0619890399756491,
+		850.66366948183872, 2594.2711248012774, 852.46228400830682,
+		2792.090023507903, 2.3309457703956342, 6.4302270148790308 },
+	{ 0.46702321107459155, 863.22189652788143, 2.086609322529422,
+		856.11503948005679, 2594.8353586878725, 857.96304453715959,
+		2792.8159827288732, 2.3424583718852325, 6.4211338255771064 },
+	{ 0.4923186753176263, 861.78634105203992, 2.1111172464195169,
+		861.57297595612124, 2595.3832981509354, 863.47148066037948,
+		2793.5199013343408, 2.3539554581283975, 6.4120682960437607 },
+	{ 0.51747340868719738, 860.34287336566354, 2.1355143100667231,
+		867.03757734957867, 2595.9147662297, 868.98771056904559,
+		2794.2015484040821, 2.3654373222352194, 6.4030296600355241 },
+	{ 0.54248869288319745, 858.89143186066656, 2.1598020010331052,
+		872.50894372557639, 2596.4295836839196, 874.5118543740831,
+		2794.8606904769758, 2.3769042586802986, 6.3940171542068125 },
+	{ 0.56736579568884804, 857.43195346592756, 2.1839817962800478,
+		877.98717681004166, 2596.9275689504648, 880.04403414695616,
+		2795.4970915077415, 2.3883565633686561, 6.3850300179684014 },
+	{ 0.59210597116889152, 855.96437362000017, 2.208055162431239,
+		883.47238002597749, 2597.4085380970637, 885.58437396166164,
+		2796.1105128196687, 2.3997945337033588, 6.3760674933394252 },
+	{ 0.61671045986539452, 854.48862624257333, 2.2320235560412538,
+		888.96465853096436, 2597.872304772884, 891.13299993811984,
+		2796.7007130529055, 2.4112184686550284, 6.3671288247921893 },
+	{ 0.64118048899115665, 853.00464370460691, 2.2558884238703723,
+		894.46411925591053, 2598.3186801556139, 896.69004028701227,
+		2797.2674481078338, 2.4226286688332981, 6.3582132590889788 },
+	{ 0.66551727262085703, 851.51235679708384, 2.2796512031664116,
+		899.97087094513074, 2598.747472894695, 902.25562535615586,
+		2797.8104710830848, 2.4340254365603728, 6.3493200451101188 },
+	{ 0.68972201187992332, 850.01169469829256, 2.3033133219542137,
+		905.48502419780789, 2599.1584890503786, 907.82988767847428,
+		2798.3295322077115, 2.4454090759467717, 6.3404484336725089 },
+	{ 0.71379589513118058, 848.50258493957176, 2.3268761993334777,
+		911.00669151093473, 2599.5515320282379, 913.41296202167632,
+		2798.8243787670549, 2.4567798929694504, 6.3315976773379044 },
+	{ 0.73774009815938191, 846.98495336942688, 2.3503412457856947,
+		916.53598732379612, 2599.9264025088137, 919.00498543970593,
+		2799.2947550218428, 2.4681381955523793, 6.3227670302101782 },
+	{ 0.76155578435356552, 845.45872411593257, 2.373709863490761,
+		922.07302806407745, 2600.2828983720142, 924.60609732606588,
+		2799.7404021200477, 2.4794842936497559, 6.3139557477209296 },
+	{ 0.78524410488737861, 843.92381954733196, 2.3969834466540481,
+		927.61793219569722, 2600.6208146159502, 930.21643946911888,
+		2800.1610580010438, 2.4908184993320002, 6.3051630864026595 },
+	{ 0.80880619889738625, 842.38016023072748, 2.4201633818445725,
+		933.17082026844662, 2600.939943269846, 935.83615610946015,
+		2800.5564572916114, 2.5021411268747005, 6.2963883036489241 },
+	{ 0.83224319365938193, 840.82766488876518, 2.4432510483448917,
+		938.73181496953976, 2601.240073300683, 941.46539399948028,
+		2800.9263311933364, 2.5134524928506639, 6.2876306574608281 },
+	{ 0.85555620476279515, 839.26625035420295, 2.4662478185134296,
+		944.30104117717894, 2601.5209905132606, 947.10430246523151,
+		2801.2704073609889, 2.5247529162252822, 6.2788894061792346 },
+	{ 0.87874633628319321, 837.69583152224175, 2.489155058159815,
+		949.87862601623749, 2601.7824774433266, 952.75303347071417,
+		2801.5884097714284, 2.5360427184553611, 6.2701638082021853 },
+	{ 0.90181468095298722, 836.11632130051044, 2.5119741269339162,
+		955.46469891618949, 2602.0243132434753, 958.41174168472639,
+		2801.8800585826561, 2.547322223591665, 6.2614531216869675 },
+	{ 0.92476232033030747, 834.52763055656146, 2.5347063787290951,
+		961.05939167139604, 2602.2462735614972, 964.08058455040009,
+		2802.1450699826119, 2.5585917583853388, 6.2527566042364073 },
+	{ 0.94759032496618556, 832.92966806275365, 2.5573531621003593,
+		966.66283850388788, 2602.448130410894, 969.75972235757945,
+		2802.3831560273416, 2.5698516523984734, 6.2440735125689075 },
+	{ 0.97029975457002327, 831.32234043838059, 2.5799158206979094,
+		972.27517612877125, 2602.6296520332771, 975.4493183181836,
+		2802.5940244682056, 2.5811022381190081, 6.2354031021719356 },
+	{ 0.99289165817341596, 829.70555208889209, 2.6023956937166459,
+		977.89654382241076, 2602.7906027523727, 981.14953864472579,
+		2802.7773785677637, 2.5923438510802583, 6.2267446269385447 },
+	{ 1.015367074292395, 828.07920514204909, 2.6247941163621822,
+		983.52708349353793, 2602.9307428194056, 986.86055263215178,
+		2802.9329169040848, 2.6035768299852933, 6.218097338786742 },
+	{ 1.0377270310881199, 826.44319938085846, 2.6471124203338472,
+		989.16693975744386, 2603.0498282496046, 992.58253274318042,
+		2803.0603331631528, 2.6148015168364669, 6.2094604872614312 },
+	{ 1.0599725465260734, 824.7974321731092, 2.6693519343251664,
+		994.81626001343136, 2603.1476106496402, 998.31565469733619,
+		2803.1593159191616, 2.626018257070367, 6.2008333191188081 },
+	{ 1.0821046285338094, 823.14179839732594, 2.6915139845422686,
+		1000.4751945256993, 2603.2238370357904, 1004.0600975638718,
+		2803.2295484024662, 2.6372273996985069, 6.1922150778931098 },
+	{ 1.1041242751572971, 821.47619036495541, 2.7135998952406597,
+		1006.1438965078592, 2603.2782496426621, 1009.8160438587981,
+		2803.2707082549946, 2.6484292974540731, 6.1836050034456616 },
+	{ 1.1260324747159476, 819.80049773858229, 2.7356109892808016,
+		1011.822522211264, 2603.3105857223313, 1015.5836796462335,
+		2803.2824672729839, 2.6596243069450454, 6.1750023314962634 },
+	{ 1.1478302059562793, 818.11460744596752, 2.7575485887027846,
+		1017.5112310173914, 2603.3205773337572, 1021.3631946443277,
+		2803.2644911369007, 2.6708127888141062, 6.1664062931370109 },
+	{ 1.1695184382044164, 816.41840358968568, 2.7794140153206151,
+		1023.2101855344617, 2603.3079511223928, 1027.1547823359806,
+		2803.2164391284741, 2.6819951079056139, 6.1578161143286696 },
+	{ 1.1910981315173399, 814.71176735213305, 2.8012085913363096,
+		1028.9195516985701, 2603.2724280898888, 1032.9586400846524,
+		2803.1379638347748, 2.6931716334401559, 6.14923101537984 },
+	{ 1.2125702368330131, 812.994576895661, 2.8229336399741896,
+		1034.6394988795441, 2603.2137233538633, 1038.7749692555121,
+		2803.0287108393354, 2.7043427391969908, 6.140650210409194 },
+	{ 1.2339356961194148, 811.26670725758709, 2.8445904861356612,
+		1040.3701999918044, 2603.1315458977015, 1044.6039753422338,
+		2802.8883184003312, 2.7155088037048696, 6.1320729067911053 },
+	{ 1.2551954425225609, 809.5280302398063, 2.8661804570747806,
+		1046.1118316105064, 2603.0255983103734, 1050.4458680997482,
+		2802.7164171158588, 2.726670210441704, 6.1234983045850342 },
+	{ 1.2763504005135218, 807.77841429272951, 2.8877048830948122,
+		1051.8645740932423, 2602.8955765163087, 1056.3008616832708,
+		2802.5126295764289, 2.7378273480435356, 6.1149255959492042 },
+	{ 1.2974014860345147, 806.01772439326089, 2.9091650982660582,
+		1057.628611707614, 2602.7411694954012, 1062.1691747939483,
+		2802.2765700047967, 2.7489806105233305, 6.1063539645390295 },
+	{ 1.3183496066441616, 804.24582191649426, 2.9305624411652276,
+		1063.4041327650023, 2602.5620589931546, 1068.0510308314974,
+		2802.0078438832666, 2.760130397500149, 6.0977825848908216 },
+	{ 1.3391956616619203, 802.46256450082092, 2.9518982556365008,
+		1069.1913297608735, 2602.3579192211573, 1073.9466580542096,
+		2801.7060475687149, 2.7712771144392487, 6.0892106217915121 },
+	{ 1.3599405423117505, 800.66780590611177, 2.9731738915745178,
+		1074.9903995219699, 2602.1284165479415, 1079.8562897467257,
+		2801.3707678955229, 2.7824211729036987, 6.0806372296349354 },
+	{ 1.3805851318651345, 798.86139586461286, 2.9943907057295585,
+		1080.8015433607723, 2601.8732091804286, 1085.780164396012,
+		2801.0015817667127, 2.7935629908181689, 6.0720615517654775 },
+	{ 1.4011303057834454, 797.04317992421102, 3.0155500625350466,
+		1086.624967237633, 2601.5919468361008, 1091.7185258759821,
+		2800.5980557335665, 2.8047029927455149, 6.0634827198098016 },
+	{ 1.4215769318597531, 795.21299928367682, 3.0366533349576157,
+		1092.4608819309892, 2601.2842704061168, 1097.6716236412435,
+		2800.1597455640695, 2.8158416101768911, 6.0548998529974778 },
+	{ 1.4419258703601638, 793.3706906194991, 3.0577019053699952,
+		1098.3095032160988, 2600.9498116095892, 1103.6397129304582,
+		2799.6861958005265, 2.8269792818360777, 6.0463120574713383 },
+	{ 1.462177974164677, 791.5160859039139, 3.078697166446843,
+		1104.1710520527665, 2600.5881926392449, 1109.6230549798527,
+		2799.1769393067379, 2.8381164539988282, 6.0377184255884426 },
+	{ 1.482334088907765, 789.64901221370201, 3.0996405220839454,
+		1110.0457547825338, 2600.1990257987268, 1115.6219172474207,
+		2798.6314968051188, 2.8492535808280008, 6.0291180352124645 },
+	{ 1.5023950531185633, 787.7692915293344, 3.1205333883408124,
+		1115.9338433358528, 2599.7819131318429, 1121.6365736484038,
+		2798.0493764042499, 2.8603911247253437, 6.0205099489985967 },
+	{ 1.5223616983609496, 785.87674052403941, 3.1413771944072479,
+		1121.8355554497759, 2599.3364460439666, 1127.6673048026641,
+		2797.4300731172052, 2.8715295567008035, 6.0118932136716063 },
+	{ 1.5422348493733928, 783.97117034233156, 3.1621733835939585,
+		1127.7511348967018, 2598.8622049159794, 1133.7143982945663,
+		2796.7730683712252, 2.8826693567602519, 6.0032668592982983 },
+	{ 1.5620153242087951, 782.05238636758122, 3.1829234143477771,
+		1133.6808317247912, 2598.3587587109873, 1139.7781489460756,
+		2796.0778295091277, 2.8938110143126372, 5.9946298985550612 },
+	{ 1.581703934374338, 780.12018797816143, 3.203628761291843,
+		1139.6249025106315, 2597.8256645741353, 1145.8588591037301,
+		2795.3438092829615, 2.9049550285975134, 5.9859813259915411 },
+	{ 1.6013014849714129, 778.17436829173562, 3.2242909162911912,
+		1145.5836106248025, 2597.2624674258736, 1151.956838940258,
+		2794.570445340411, 2.9161019091340101, 5.9773201172913746 },
+	{ 1.6208087748357636, 776.21471389725411, 3.2449113895443933,
+		1151.557226510995, 2596.6686995489149, 1158.0724067715757,
+		2793.7571597043798, 2.9272521761923209, 5.9686452285307849 },
+	{ 1.6402265966778744, 774.24100457423344, 3.2654917107017658,
+		1157.5460279793642, 2596.043880169263, 1164.205889389978,
+		2792.9033582462939, 2.9384063612888096, 5.9599555954360106 },
+	{ 1.6595557372237546, 772.25301299890202, 3.2860334300109471,
+		1163.5503005148357, 2595.3875150315539, 1170.3576224143414,
+		2792.0084301535312, 2.9495650077059197, 5.951250132640312 },
+	{ 1.6787969773561737, 770.25050443684381, 3.3065381194905923,
+		1169.5703376010849, 2594.6990959690447, 1176.5279506582037,
+		2791.0717473914901, 2.9607286710380483, 5.9425277329414081 },
+	{ 1.6979510922564314, 768.2332364217657, 3.3270073741330686,
+		1175.6064410609531, 2593.9781004684837, 1182.7172285166062,
+		2790.0926641606729, 2.971897919764634, 5.9337872665600191 },
+	{ 1.7170188515468565, 766.20095842007015, 3.3474428131372878,
+		1181.6589214140852, 2593.2239912301516, 1188.9258203726336,
+		2789.0705163492398, 2.9830733358517212, 5.9250275804002319 },
+	{ 1.7360010194339928, 764.15341148094683, 3.3678460811726483,
+		1187.7280982525692, 2592.4362157232877, 1195.1541010245819,
+		2788.0046209813941, 2.9942555153832733, 5.9162474973122974 },
+	{ 1.7548983548527699, 762.09032787173408, 3.3882188496756118,
+		1193.8143006354367, 2591.6142057370826, 1201.4024561347783,
+		2786.8942756619012, 3.0054450692236223, 5.9074458153582707 },
+	{ 1.7737116116115843, 760.01143069835905, 3.4085628181801173,
+		1199.9178675028234, 2590.757376927445, 1207.6712827010228,
+		2785.7387580171057, 3.0166426237123316, 5.8986213070810987 },
+	{ 1.7924415385385613, 757.91643351070388, 3.4288797156836504,
+		1206.0391481107063, 2589.8651283596514, 1213.9609895517538,
+		2784.5373251326423, 3.0278488213929733, 5.8897727187773574 },
+	{ 1.8110888796290598, 755.80503989279907, 3.4491713020506842,
+		1212.1785024870785, 2588.9368420469441, 1220.2719978659923,
+		2783.2892129880302, 3.0390643217771727, 5.8808987697738662 },
+	{ 1.8296543741945437, 753.67694303780024, 3.4694393694554901,
+		1218.3363019104861, 2587.9718824851457, 1226.6047417192028,
+		2781.9936358882942, 3.0502898021454539, 5.8719981517083575 },
+	{ 1.8481387570130032, 751.53182530773256, 3.489685743866604,
+		1224.5129294118972, 2586.9695961832558, 1232.9596686562538,
+		2780.6497858926632, 3.0615259583864063, 5.8630695278140905 },
+	{ 1.8665427584810426, 749.3693577780225, 3.5099122865753745,
+		1230.7087803008817, 2585.9293111899369, 1239.3372402927014,
+		2779.2568322402944, 3.0727735058757943, 5.8541115322082682 },
+	{ 1.8848671047677814, 747.18919976686004, 3.5301208957713173,
+		1236.9242627171366, 2584.850336615752, 1245.7379329456751,
+		2777.8139207729387, 3.0840331803972529, 5.8451227691839405 },
+	{ 1.9031125179707762, 744.99099834940193, 3.55031350816733,
+		1243.1597982084909, 2583.7319621509259, 1252.1622382957737,
+		2776.320173354321, 3.0953057391064513, 5.8361018125048769 },
+	{ 1.9212797162740787, 742.77438785680556, 3.5704921006780279,
+		1249.4158223365484, 2582.5734575783245, 1258.6106640814162,
+		2774.7746872859293, 3.1065919615406035, 5.8270472047027795 },
+	{ 1.9393694141086293, 740.53898935998086, 3.5906586921548582,
+		1255.6927853112852, 2581.3740722812513, 1265.0837348272682,
+		2773.176534718782, 3.1178926506755085, 5.8179574563759324 },
+	{ 1.9573823223152127, 738.28441013780264, 3.6108153451820284,
+		1261.9911526560263, 2580.1330347455969, 1271.5819926085103,
+		2771.5247620606469, 3.1292086340325018, 5.808831045488315 },
+	{ 1.975319148310104, 736.010243129321, 3.6309641679375653,
+		1268.311405904439, 2578.8495520557085, 1278.1059978529292,
+		2769.818389378001, 3.1405407648380446, 5.7996664166678178 },
+	{ 1.9931805962536695, 733.71606636918023, 3.6511073161243481,
+		1274.6540433313703, 2577.5228093833171, 1284.6563301830665,
+		2768.056409791956, 3.1518899232390889, 5.790461980502168 },
+	{ 2.0109673672221389, 731.40144240506208, 3.671246994976372,
+		1281.0195807197133, 2576.1519694686781, 1291.2335893010118,
+		2766.2377888671513, 3.1632570175778945, 5.7812161128307658 },
+	{ 2.0286801593827541, 729.06591769541694, 3.691385461345932,
+		1287.4085521657894, 2574.7361720930007, 1297.8383959188075,
+		2764.3614639925186, 3.1746429857306109, 5.7719271540305233 },
+	{ 2.0463196681725715, 726.70902198502904, 3.7115250258780179,
+		1293.8215109263065, 2573.2745335410491, 1304.4713927380283,
+		2762.4263437525974, 3.1860487965148936, 5.7625934082934309 },
+	{ 2.0638865864811664, 724.33026765509476, 3.7316680552787393,
+		1300.2590303104389, 2571.7661460527306, 1311.1332454826452,
+		2760.4313072879404, 3.1974754511726986, 5.7532131428933351 },
+	{ 2.0813816048375302, 721.92914904338454, 3.7518169746852323,
+		1306.7217046213896, 2570.2100772622475, 1317.8246439901684,
+		2758.3752036429323, 3.2089239849358573, 5.7437845874391513 },
+	{ 2.0988054116014578, 719.50514172869691, 3.7719742701451562,
+		1313.2101501526781, 2568.6053696233107, 1324.5463033670176,
+		2756.2568510991518, 3.2203954686835536, 5.7343059331113686 },
+	{ 2.1161586931597083, 717.05770177221279, 3.7921424912145834,
+		1319.7250062454236, 2566.9510398186612, 1331.2989652151907,
+		2754.0750364921814, 3.231891010702677, 5.7247753318784369 },
+	{ 2.1334421341273346, 714.58626490637459, 3.812324253683971,
+		1326.2669364143408, 2565.2460781520012, 1338.0833989388509,
+		2751.8285145095251, 3.2434117585645019, 5.715190895689215 },
+	{ 2.1506564175544796, 712.09024565966058, 3.832522242442594,
+		1332.8366295516194, 2563.4894479202717, 1344.9004031410445,
+		2749.5160069671151, 3.2549589011337288, 5.7055506956374415 },
+	{ 2.1678022251390465, 709.56903640289329, 3.8527392144929018,
+		1339.4348012198345, 2561.6800847638983, 1351.7508071228826,
+		2747.1362020614979, 3.2665336707293409, 5.695852761093577 },
+	{ 2.1848802374456526, 707.0220062996558, 3.8729780021271711,
+		1346.0621950472453, 2559.8168959925483, 1358.6354724999137,
+		2744.6877535946846, 3.2781373454605651, 5.6860950787992675 },
+	{ 2.2018911341313259, 704.44850013981363, 3.8932415162800242,
+		1352.7195842414271, 2557.8987598835565, 1365.5552949532228,
+		2742.1692801681797, 3.2897712517657145, 5.6762755919189463 },
+	{ 2.2188355941782927, 701.84783703110611, 3.9135327500713175,
+		1359.4077732402816, 2555.9245249500955, 1372.5112061361333,
+		2739.57936434258, 3.301436767187012, 5.6663921990430151 },
+	{ 2.2357142961345562, 699.21930891927911, 3.9338547825557315,
+		1366.1275995229887, 2553.8930091756929, 1379.5041757612159,
+		2736.9165517585925, 3.3131353234205942, 5.6564427531361199 },
+	{ 2.2525279183626026, 696.56217890218875, 3.9542107826961947,
+		1372.8799356075087, 2551.8029992116385, 1386.535213896703,
+		2734.1793502151877, 3.3248684096877814, 5.6464250604240629 },
+	{ 2.2692771392969191, 693.87567929786701, 3.9746040135803336,
+		1379.6656912659175, 2549.6532495333345, 1393.6053735064745,
+		2731.3662287000666, 3.3366375764817273, 5.636336879211937 },
+	{ 2.2859626377109117, 691.15900942053554, 3.9950378369006119,
+		1386.4858159940848, 2547.4424815514444, 1400.7157532735107,
+		2728.4756163673082, 3.348444439752464, 5.6261759186257878 },
+	{ 2.3025850929939056, 688.41133301230002, 4.0155157177208585,
+		1393.3413017780997, 2545.1693826732871, 1407.8675007531244,
+		2725.5059014566064, 3.3602906856034029, 5.6159398372693676 },
+	{ 2.3025850929939087, 688.41133301230013, 4.0155199696749824,
+		1393.3413017781006, 2545.1368146521381, 1407.8675007531253,
+		2725.4725666544832, 3.3602906856034038, 5.6158898740346972 },
+	{ 2.3109985270637279, 687.00450716728244, 4.0259339193933066,
+		1396.8349150674173, 2543.9502369817551, 1411.5138424391178,
+		2723.9255851072289, 3.3663193114960297, 5.6106496248280946 },
+	{ 2.3193959827626673, 685.5893494962952, 4.0363610675914172,
+		1400.3380459197354, 2542.7460807931325, 1415.1713129282136,
+		2722.356504771662, 3.3723587748818855, 5.605387274734988 },
+	{ 2.3277775492585611, 684.1657386371578, 4.0468019598920328,
+		1403.85083816315, 2541.5240884533623, 1418.8400784877972,
+		2720.7650166376884, 3.3784093196201304, 5.6001023608308325 },
+	{ 2.3361433158200171, 682.73355017717449, 4.0572571547574148,
+		1407.3734391502314, 2540.2839951408214, 1422.520309426922,
+		2719.1508032412316, 3.3844711954254851, 5.5947944077478544 },
+	{ 2.3444933718272334, 681.29265650355148, 4.0677272240171787,
+		1410.9059999054227, 2539.0255285340413, 1426.2121802624918,
+		2717.5135383014549, 3.3905446581197332, 5.5894629271233729 },
+	{ 2.3528278067830994, 679.84292664245038, 4.0782127534215347,
+		1414.4486752824041, 2537.7484084857692, 1429.9158698964309,
+		2715.8528863408246, 3.3966299699003377, 5.5841074170224285 },
+	{ 2.3611467103245043, 678.3842260859434, 4.0887143432208735,
+		1418.0016241320452, 2536.4523466817682, 1433.6315618045446,
+		2714.168502287519, 3.4027273996272305, 5.5787273613341108 },
+	{ 2.3694501722339112, 676.91641660605467, 4.099232608772879,
+		1421.5650094817961, 2535.1370462838713, 1437.3594442379881,
+		2712.4600310596506, 3.4088372231292472, 5.5733222291408362 },
+	{ 2.3777382824512028, 675.43935605510876, 4.1097681811783087,
+		1425.1389987273039, 2533.8022015567972, 1441.0997104382252,
+		2710.7271071307437, 3.4149597235314975, 5.5678914740598655 },
+	{ 2.3860111310858039, 673.95289815156048, 4.1203217079465846,
+		1428.7237638371328, 2532.4474974783047, 1444.8525588664374,
+		2708.9693540760049, 3.4210951916052124, 5.5624345335564414 },
+	{ 2.3942688084290658, 672.4568922504435, 4.1308938536923767,
+		1432.319481571498, 2531.0726093322078, 1448.6181934483923,
+		2707.186384098874, 3.4272439261415695, 5.5569508282279232 },
+	{ 2.4025114049669742, 670.95118309761267, 4.141485300864459,
+		1435.926333715975, 2529.6772022838136, 1452.3968238358318,
+		2705.377797537376, 3.4334062343511507, 5.5514397610582957 },
+	{ 2.4107390113931273, 669.43561056691431, 4.1520967505080328,
+		1439.5445073311648, 2528.2609309373552, 1456.1886656854747,
+		2703.5431823498002, 3.4395824322906869, 5.5459007166424907 },
+	{ 2.4189517186220946, 667.91000937941442, 4.1627289230619855,
+		1443.1741950194169, 2526.8234388749638, 1459.993940956846,
+		2701.6821135792384, 3.4457728453189325, 5.5403330603799024 },
+	{ 2.427149617803035, 666.37420880383706, 4.1733825591921807,
+		1446.8155952096365, 2525.3643581768274, 1463.8128782300839,
+		2699.7941527966036, 3.4519778085834267, 5.5347361376367568 },
+	{ 2.4353328003337174, 664.82803233737036, 4.1840584206624216,
+		1450.4689124613783, 2523.8833089220889, 1467.6457130450594,
+		2697.8788475216552, 3.4581976675401478, 5.529109272876684 },
+	{ 2.443501357874867, 663.27129736601728, 4.1947572912443558,
+		1454.134357789366, 2522.3798986701213, 1471.4926882630848,
+		2695.9357306216643, 3.4644327785079922, 5.5234517687591653 },
+	{ 2.4516553823648999, 661.70381480367837, 4.2054799776678804,
+		1457.8121490096908, 2520.8537219218265, 1475.3540544526106,
+		2693.9643196873585, 3.4706835092601724, 5.517762905205446 },
+	{ 2.4597949660350515, 660.12538870925039, 4.2162273106135819,
+		1461.5025111089299, 2519.3043595605805, 1479.2300703003066,
+		2691.9641163857568, 3.4769502396546237, 5.5120419384315014 },
+	{ 2.4679202014249175, 658.53581588095869, 4.2270001457488124,
+		1465.2056766374892, 2517.7313782725105, 1483.1210030489992,
+		2689.9346057896023, 3.4832333623055973, 5.5062880999477981 },
+	{ 2.4760311813983686, 656.93488542735054, 4.2377993648089287,
+		1468.9218861285217, 2516.134329945824, 1487.0271289639786,
+		2687.8752556831196, 3.4895332832987176, 5.5005005955256596 },
+	{ 2.4841279991599956, 655.32237831435066, 4.248625876725721,
+		1472.6513885437516, 2514.5127510488014, 1490.9487338292031,
+		2685.785515843701, 3.4958504229517038, 5.494678604129744 },
+	{ 2.49221074827194, 653.6980668878532, 4.2594806188044823,
+		1476.3944417476152, 2512.8661619862701, 1494.8861134749839,
+		2683.664817299411, 3.5021852166231331, 5.4888212768167586 },
+	{ 2.5002795226712391, 652.06171437153614, 4.270364557951825,
+		1480.1513130110823, 2511.1940664342692, 1498.8395743387296,
+		2681.5125715620024, 3.5085381155714868, 5.4829277356000921 },
+	{ 2.508334416687676, 650.41307433960822, 4.281278691956163,
+		1483.9222795466046, 2509.4959506526347, 1502.8094340603932,
+		2679.3281698352293, 3.5149095878669292, 5.4769970722802643 },
+	{ 2.5163755250621471, 648.75189016433239, 4.2922240508228784,
+		1487.7076290755938, 2507.7712827753239, 1506.7960221142496,
+		2677.1109821983223, 3.5213001193580884, 5.4710283472411945 },
+	{ 2.5244029429656267, 647.07789443845991, 4.3032016981665207,
+		1491.5076604298415, 2506.0195120782087, 1510.7996804786385,
+		2674.8603567643768, 3.5277102146962278, 5.465020588212119 },
+	{ 2.532416766018609, 645.39080837271285, 4.314212732661951,
+		1495.3226841882056, 2504.2400682242851, 1514.8207643452347,
+		2672.5756188136975, 3.5341403984189781, 5.458972788995486 },
+	{ 2.5404170903112799, 643.69034116877867, 4.3252582895574356,
+		1499.1530233500889, 2502.432360485901, 1518.859642869611,
+		2670.2560699017049, 3.5405912160961224, 5.4528839081603513 },
+	{ 2.5484040124242466, 641.97618936849972, 4.3363395422517543,
+		1502.999014046801, 2500.5957769440479, 1522.9166999644433,
+		2667.9009869415481, 3.5470632355392673, 5.4467528677018224 },
+	{ 2.5563776294499565, 640.24803618015858, 4.34745770393834,
+		1506.8610062923226, 2498.7296836644305, 1526.9923351371242,
+		2665.5096212611888, 3.553557048077848, 5.4405785516663343 },
+	{ 2.5643380390148347, 638.505550783025, 4.3586140293193294,
+		1510.7393647744575, 2496.8334238502011, 1531.0869643730543,
+		2663.0811976349105, 3.5600732699031044, 5.4343598047429476 },
+	{ 2.5722853393021414, 636.74838761173987, 4.3698098163926113,
+		1514.6344696876236, 2494.9063169712035, 1535.2010210661119,
+		2660.6149132891605, 3.5666125434820253, 5.4280954308207354 },
+	{ 2.5802196290756418, 634.97618562237915, 4.3810464083152896,
+		1518.5467176082586, 2492.947657869573, 1539.334956997573,
+		2658.1099368826517, 3.5731755390428703, 5.421784191512355 },
+	{ 2.5881410077040536, 633.18856754239016, 4.3923251953470448,
+		1522.4765224136704, 2490.9567158415466, 1543.4892433645794,
+		2655.5654074606477, 3.5797629561335471, 5.4154248046439282 },
+	{ 2.5960495751864072, 631.38513910714653, 4.403647616877401,
+		1526.4243162451883, 2488.9327336953006, 1547.6643718593034,
+		2652.980433383304, 3.5863755252542333, 5.4090159427112274 },
+	{ 2.6039454321783104, 629.56548828611926, 4.4150151635410175,
+		1530.3905505159892, 2486.8749267846001, 1551.8608557994578,
+		2650.3540912279254, 3.5930140095647669, 5.4025562313021638 },
+	{ 2.6118286800191992, 627.72918450224915, 4.4264293794255067,
+		1534.3756969642718, 2484.7824820180995, 1556.0792313111199,
+		2647.6854246650369, 3.5996792066678616, 5.3960442474856194 },
+	{ 2.6196994207605848, 625.87577784876589, 4.4378918643766143,
+		1538.3802487515586, 2482.654556844017, 1560.3200585639181,
+		2644.9734433080525, 3.6063719504676595, 5.3894785181665377 },
+	{ 2.6275577571954556, 624.00479830782001, 4.4494042764062351,
+		1542.4047216063202, 2480.4902782098789, 1564.5839230590655,
+		2642.2171215362691, 3.6130931131038899, 5.3828575184069667 },
+	{ 2.6354037928888028, 622.11575497649665, 4.4609683342088573,
+		1546.449655012357, 2478.2887414969946, 1568.8714369699308,
+		2639.4153972908921, 3.619843606960544, 5.3761796697128705 },
+	{ 2.6432376322094404, 620.20813530583837, 4.4725858197928536,
+		1550.5156134412975, 2476.0490094292618, 1573.1832405347795,
+		2636.567170843713, 3.6266243867479138, 5.3694433382862421 },
+	{ 2.6510593803630678, 618.28140435952992, 4.4842585812332061,
+		1554.6031876281443, 2473.770110955857, 1577.5200035008502,
+		2633.6713035380112, 3.6334364516561002, 5.3626468332421222 },
+	{ 2.6588691434268741, 616.33500409947771, 4.4959885355536127,
+		1558.7129958882499, 2471.4510401070911, 1581.8824266183892,
+		2630.7266165009219, 3.6402808475771575, 5.35578840478939 },
+	{ 2.6666670283855578, 614.36835270627205, 4.507777671745604,
+		1562.84568547409, 2469.0907548229347, 1586.2712431832119,
+		2627.7318893267607, 3.6471586693930385, 5.3488662423748732 },
+	{ 2.6744531431690501, 612.38084394321299, 4.519628053934027,
+		1567.0019339691744, 2466.6881757532392, 1590.6872206253227,
+		2624.6858587302791, 3.6540710633247859, 5.3418784727891895 },
+	{ 2.6822275966920066, 610.3718465736622, 4.5315418246986496,
+		1571.1824507162935, 2464.2421850287315, 1595.1311621409457,
+		2621.5872171687861, 3.6610192293381534, 5.334823158232938 },
+	{ 2.689990498895118, 608.34070384175095, 4.5435212085623347,
+		1575.387978276721, 2461.7516250017793, 1599.6039083647095,
+		2618.4346114320892, 3.6680044235999025, 5.3276982943417295 },
+	{ 2.6977419607885951, 606.28673302798506, 4.5555685156582619,
+		1579.6192939158709, 2459.2152969553358, 1604.1063390775721,
+		2615.2266411984069, 3.6750279609771588, 5.320501808167311 },
+	{ 2.7054820944977971, 604.2092250917666, 4.5676861455886542,
+		1583.8772111111991, 2456.6319597787801, 1608.6393749463048,
+		2611.9618575548147, 3.6820912175726264, 5.3132315561127612 },
+	{ 2.713211013311323, 602.10744441351551, 4.5798765914897643,
+		1588.162581076172, 2454.0003286086749, 1613.203979288362,
+		2608.6387614799514, 3.6891956332853173, 5.3058853218182955 },
+	{ 2.7209288317317317, 599.9806286505667, 4.592142444318835,
+		1592.4762942945465, 2451.3190734324035, 1617.8011598562941,
+		2605.2558022866269, 3.6963427143869918, 5.2984608139942297 },
+	{ 2.7286356655291892, 597.82798872137494, 4.6044863973807519,
+		1596.8192820573108, 2448.5868176521931, 1622.4319706339261,
+		2601.8113760214183, 3.703534036101519, 5.2909556641966455 },
+	{ 2.7363316317982207, 595.64870893341185, 4.6169112511134589,
+		1601.1925179944724, 2445.802136606821, 1627.0975136362815,
+		2598.3038238181175, 3.7107712451739761, 5.2833674245411144 },
+	{ 2.7440168490180366, 593.44194727130093, 4.6294199181541469,
+		1605.5970195926343, 2442.9635560475476, 1631.7989407038967,
+		2594.7314302009345, 3.7180560624143042, 5.2756935653481483 },
+	{ 2.7516914371166683, 591.20683586203177, 4.6420154287096285,
+		1610.0338496880765, 2440.0695505647045, 1636.5374552808676,
+		2591.0924213332682, 3.7253902851983112, 5.2679314727141513 },
+	{ 2.7593555175393432, 588.94248163535542, 4.6547009362574885,
+		1614.5041179242373, 2437.1185419605576, 1641.3143141650364,
+		2587.3849632068682, 3.7327757899074085, 5.2600784459998788 },
+	{ 2.7670092133217254, 586.64796719752849, 4.6674797236079222,
+		1619.0089821610904, 2434.1088975633024, 1646.1308292172312,
+		2583.6071597652503, 3.7402145342862179, 5.2521316952270682 },
+	{ 2.774652649168317, 584.3223519372591, 4.6803552093583471,
+		1623.5496498231021, 2431.0389284767675, 1650.9883690155355,
+		2579.7570509549719, 3.7477085596958042, 5.2440883383735342 },
+	{ 2.7822859515369354, 581.96467338375601, 4.6933309547783466,
+		1628.1273791702386, 2427.906887758917, 1655.8883604381958,
+		2575.8326106964846, 3.7552599932366393, 5.2359453985539659 },
+	{ 2.7899092487297863, 579.57394883578797, 4.7064106711652647,
+		1632.7434804761526, 2424.7109685218161, 1660.8322901583404,
+		2571.8317447658505, 3.762871049714875, 5.2276998010731957 },
+	{ 2.7975226709921635, 577.14917728224214, 4.7195982277170003,
+		1637.3993170954973, 2421.4493019441652, 1665.8217060312907,
+		2567.7522885766775, 3.7705440334218432, 5.2193483703355428 },
+	{ 2.8051263506196853, 574.68934163363303, 4.7328976599733057,
+		1642.0963064009381, 2418.1199551864679, 1670.8582183537283,
+		2563.5920048503899, 3.7782813396945119, 5.2108878265921366 },
+	{ 2.8051263506196897, 574.67039802319402, 4.7327953378226377,
+		1642.1260242660371, 2418.143773394725, 1670.8888843366612,
+		2563.630708833351, 3.7783235589074762, 5.2109515717869339 },
+	{ 2.8096817865918418, 573.1743191088791, 4.7408235759869868,
+		1644.9663534844799, 2416.1144528711338, 1673.9361952928991,
+		2561.0966801578629, 3.7830009366707023, 5.205825443282297 },
+	{ 2.814233796238014, 571.66213901456968, 4.7489038862826192,
+		1647.8252209172401, 2414.054503512682, 1677.0041470339306,
+		2558.5260670284829, 3.7877077528438545, 5.2006477102154793 },
+	{ 2.8187824092599065, 570.13452042144024, 4.7570313320172568,
+		1650.701882779133, 2411.9659334741064, 1680.0921935799524,
+		2555.9214183347563, 3.7924427710010655, 5.1954229513697561 },
+	{ 2.8233276556780953, 568.59183747021825, 4.7652051406489546,
+		1653.5959194099523, 2409.8489874265638, 1683.2000689600179,
+		2553.2830833786852, 3.7972052998040153, 5.1901519399584934 },
+	{ 2.8278695658440882, 567.03407645256209, 4.7734266141692503,
+		1656.5073452122208, 2407.703020177421, 1686.3278912032281,
+		2550.6103042960622, 3.8019953767974268, 5.1848335475920377 },
+	{ 2.8324081704531952, 565.46089081231662, 4.7816977822277131,
+		1659.4365465341189, 2405.527066030359, 1689.4761131494433,
+		2547.9019269823698, 3.8068136638850634, 5.1794659757164707 },
+	{ 2.8369435005582493, 563.87170996978966, 4.790020666089065,
+		1662.3841598549077, 2403.3201539390193, 1692.6454180048368,
+		2545.1567939480024, 3.8116612429569949, 5.1740474312961346 },
+	{ 2.8414755875842665, 562.26584852568931, 4.7983969903126003,
+		1665.3509499033757, 2401.0814335765785, 1695.8366125076666,
+		2542.3739010605909, 3.8165394116049081, 5.1685763933300306 },
+	{ 2.8460044633441131, 560.64259167698503, 4.8068281830231019,
+		1668.337714575438, 2398.810177540166, 1699.0505422061879,
+		2539.5523999696748, 3.8214495238888895, 5.1630516143586984 },
+	{ 2.8505301600553219, 559.0012497586406, 4.8153155301419801,
+		1671.3452244366056, 2396.5057159486141, 1702.288036571452,
+		2536.6915165884134, 3.8263928891340191, 5.1574719796468882 },
+	{ 2.8550527103582248, 557.34118389147818, 4.8238603808877869,
+		1674.3741944957269, 2394.1673471459594, 1705.5498825899519,
+		2533.7904401741807, 3.8313707248244984, 5.1518363181462687 },
+	{ 2.8595721473353644, 555.66180876547651, 4.8324643327571186,
+		1677.4252814511167, 2391.7942557328365, 1708.8368212893524,
+		2530.8482218457957, 3.8363841521678972, 5.1461432314480984 },
+	{ 2.8640885045325808, 553.96257968715406, 4.8411293506829027,
+		1680.4990984140841, 2389.3854582232748, 1712.149560373246,
+		2527.8637076743562, 3.8414342209176637, 5.1403909828756422 },
+	{ 2.8686018159816835, 552.2429705375614, 4.8498577975857975,
+		1683.596239680804, 2386.9397871248871, 1715.4887964629806,
+		2524.8355196066836, 3.846521951005168, 5.134577468267163 },
+	{ 2.8731121162251849, 550.50244808955426, 4.8586523741659722,
+		1686.717309480036, 2384.4559152928196, 1718.8552415195547,
+		2521.7620863380002, 3.8516483808154449, 5.1287002709732787 },
+	{ 2.8776194403430382, 548.74044673464334, 4.867515985865726,
+		1689.8629501986165, 2381.9324134391318, 1722.2496493334704,
+		2518.6417151342921, 3.8568146145836493, 5.1227567849175637 },
+	{ 2.8821238239818769, 546.95634635270835, 4.8764515734449585,
+		1693.0338670634562, 2379.3678251586043, 1725.6728392394027,
+		2515.4726850980956, 3.8620218638651371, 5.1167443722148667 },
+	{ 2.8866253033868632, 545.14945495347911, 4.8854619568057629,
+		1696.2308474959109, 2376.7607374693675, 1729.1257152976978,
+		2512.2533345884353, 3.8672714801034873, 5.1106605093162667 },
+	{ 2.8911239154366442, 543.31899686745874, 4.8945497443829593,
+		1699.4547743033429, 2374.1098230876032, 1732.6092800338558,
+		2508.9821134303479, 3.872564976908289, 5.1045028728445958 },
+	{ 2.8956196976816457, 541.46410665503117, 4.9037173483917869,
+		1702.7066325513367, 2371.413835510426, 1736.1246424472331,
+		2505.6575766831702, 3.877904041788121, 5.0982693271919306 },
+	{ 2.9001126883862556, 539.58382850024577, 4.9129671191294051,
+		1705.9875104057037, 2368.6715498468234, 1739.6730204193577,
+		2502.2783114962549, 3.8832905378273663, 5.0919578010200226 },
+	{ 2.9046029265754028, 537.67712061572365, 4.9223015746750569,
+		1709.2985944985521, 2365.8816590058977, 1743.2557379115431,
+		2498.8428091895239, 3.8887264962363486, 5.0855660741775246 },
+	{ 2.9090904520860756, 535.74286406338808, 4.9317236664923563,
+		1712.6411605048522, 2363.0426515356403, 1746.874217481321,
+		2495.3493152108576, 3.8942141009226354, 5.0790915302162691 },
+	{ 2.9135753056245188, 533.77987535428315, 4.9412370000006618,
+		1716.0165596596037, 2360.1527079358762, 1750.5299687060804,
+		2491.7957024389384, 3.8997556663017772, 5.072530950095806 },
+	{ 2.9180575288299098, 531.78692219871402, 4.9508459333091963,
+		1719.4262019341604, 2357.2096512943017, 1754.2245731081716,
+		2488.179411873859, 3.9053536095439103, 5.0658804192460769 },
+	{ 2.9225371643454747, 529.76274181237432, 4.9605555106794501,
+		1722.8715365496298, 2354.2109735464674, 1757.9596661544379,
+		2484.4974866313569, 3.9110104183822969, 5.0591353892841315 },
+	{ 2.9270142558981078, 527.70606122915706, 4.9703712427189704,
+		1726.3540304525097, 2351.1539334511294, 1761.7369168673692,
+		2480.7466940193945, 3.916728615519613, 5.0522908838993166 },
+	{ 2.9314888483879162, 525.61561911679416, 4.9802988052541739,
+		1729.8751453247621, 2348.0356943595643, 1765.5580055489836,
+		2476.9236960733806, 3.9225107205769447, 5.0453417820921427 },
+	{ 2.9359609879890893, 523.49018863174251, 4.990343770390929,
+		1733.4363136520249, 2344.8534496574002, 1769.4246000850958,
+		2473.0252043257756, 3.9283592104477236, 5.0382830725672569 },
+	{ 2.9404307222640651, 521.32860088287941, 5.0005114867074125,
+		1737.0389143342657, 2341.6044808687038, 1773.3383312723886,
+		2469.0480513869288, 3.9342764788509479, 5.0311099693235324 },
+	{ 2.9448981002931496, 519.1297685993502, 5.010807183155106,
+		1740.6842482877057, 2338.2861119764348, 1777.300767589051,
+		2464.9891350561143, 3.9402647958176047, 5.0238178178046367 },
+	{ 2.9448981002931496, 519.12977138462406, 5.0108071831551024,
+		1740.6842452301544, 2338.286111976437, 1777.3007645749528,
+		2464.9891350561165, 3.9402647906904247, 5.0238178178046411 },
+	{ 2.9473433288665065, 517.90791852776272, 5.0165009721036453,
+		1742.7007299491072, 2336.438671701063, 1779.4934937448231,
+		2462.7307983605606, 3.9435778131935608, 5.0197726858234111 },
+	{ 2.9497878746985431, 516.67366908853364, 5.0222357134898994,
+		1744.7314334947241, 2334.5691026045392, 1781.7023626090727,
+		2460.4464183278483, 3.9469145426509225, 5.0156895686154117 },
+	{ 2.9522317465223309, 515.42654140661057, 5.0280124521261671,
+		1746.7769069941719, 2332.6768732807968, 1783.9279729098716,
+		2458.1353783544905, 3.9502759215894709, 5.0115675363609462 },
+	{ 2.9546749532547563, 514.16618626638865, 5.0338323358753403,
+		1748.8375576130097, 2330.7614024537756, 1786.1707870944952,
+		2455.7970023297421, 3.9536626521456548, 5.0074055649949143 },
+	{ 2.9571175040072917, 512.89227035507008, 5.0396966304351212,
+		1750.9137766387323, 2328.8220517109717, 1788.4312544132438,
+		2453.4305459116804, 3.9570754108770312, 5.0032025224262613 },
+	{ 2.9595594080975984, 511.60443337954473, 5.0456067269177822,
+		1753.0059866465983, 2326.8581215931326, 1790.7098577883264,
+		2451.0351919337913, 3.9605149279510763, 4.9989571615397885 },
+	{ 2.9620006750621921, 510.30227699968106, 5.0515641413818484,
+		1755.1146537450165, 2324.8688514798332, 1793.0071263339212,
+		2448.6100504680767, 3.9639820077940335, 4.9946681207886767 },
+	{ 2.9644413146701054, 508.98536604666828, 5.05757050653538,
+		1757.2402863602674, 2322.8534232103698, 1795.3236345432074,
+		2446.1541634572827, 3.9674775271689047, 4.9903339321858011 },
+	{ 2.9668813369377571, 507.65323319233573, 5.0636275569635885,
+		1759.3834302602636, 2320.8109678382748, 1797.659997690095,
+		2443.6665131679656, 3.9710024269452031, 4.9859530354332122 },
+	{ 2.9693207521451823, 506.30538331904387, 5.0697371102874147,
+		1761.5446639321131, 2318.7405744071139, 1800.0168675296843,
+		2441.1460330949681, 3.9745577044630331, 4.9815237959337697 },
+	{ 2.9717595708536129, 504.94129622988493, 5.0759010474883821,
+		1763.7245958037508, 2316.6412992248138, 1802.394929802233,
+		2438.5916194517376, 3.9781444089949578, 4.9770445236438343 },
+	{ 2.974197803924767, 503.56042743287878, 5.0821212961105031,
+		1765.9238636000823, 2314.5121738671451, 1804.7949038582749,
+		2436.0021410866607, 3.9817636407972805, 4.9725134892735348 },
+	{ 2.976635462541839, 502.16220719937786, 5.088399820063084,
+		1768.143135614428, 2312.3522101128169, 1807.2175442123109,
+		2433.3764456391782, 3.9854165533873323, 4.9679289343245587 },
+	{ 2.9790725582325508, 500.74603826102816, 5.0947386192587141,
+		1770.3831134967936, 2310.1604002258409, 1809.6636436474967,
+		2430.7133600176917, 3.9891043583822348, 4.9632890719138665 },
+	{ 2.9815091028943397, 499.31129252847518, 5.1011397413282786,
+		1772.6445361418246, 2307.9357114592531, 1812.1340374691199,
+		2428.0116838472968, 3.9928283322027398, 4.9585920762659024 },
+	{ 2.9839451088220552, 497.85730716746895, 5.1076053062425215,
+		1774.928184312188, 2305.6770743216985, 1814.629608551922,
+		2425.2701753539263, 3.9965898240340803, 4.9538360600883937 },
+	{ 2.9863805887383901, 496.38338029238088, 5.1141375429675771,
+		1777.2348857179743, 2303.3833649650874, 1817.1512929071421,
+		2422.4875301482066, 4.0003902645777716, 4.9490190406545258 },
+	{ 2.9888155558274425, 494.88876645320545, 5.1207388354821424,
+		1779.5655203644251, 2301.0533829267274, 1819.7000855845672,
+		2419.6623544360468, 4.0042311752822073, 4.9441388971160638 },
+	{ 2.9912500237716442, 493.3726720098793, 5.1274117738018301,
+		1781.9210260730401, 2298.685826289644, 1822.2770468167187,
+		2416.7931351871539, 4.0081141778955862, 4.9391933231640568 },
+	{ 2.9936840067926838, 491.83425041252775, 5.1341592043238737,
+		1784.3024041631259, 2296.2792669961927, 1824.8833083948441,
+		2413.8782105989885, 4.0120410043228096, 4.9341797804153442 },
+	{ 2.99611751969675, 490.27259734009402, 5.1409842730184376,
+		1786.7107253552356, 2293.832129465442, 1827.5200803428222,
+		2410.9157446848176, 4.0160135068934713, 4.9290954586495683 },
+	{ 2.9985505779247172, 488.68674559446413, 5.1478904549163351,
+		1789.1471360199109, 2291.3426757391903, 1830.1886580195662,
+		2407.9037098887079, 4.0200336692530341, 4.9239372490947613 },
+	{ 3.0009831976079799, 487.07565960271683, 5.1548815640512968,
+		1791.6128649450852, 2288.8090000738407, 1832.8904298343798,
+		2404.8398812399159, 4.0241036181744096, 4.918701736289683 },
+	{ 3.0034153956305478, 485.43822934674427, 5.1619617394958626,
+		1794.1092308349164, 2286.2290352060077, 1835.6268858031428,
+		2401.7218447066598, 4.0282256366547937, 4.913385212649132 },
+	{ 3.0058471896984189, 483.77326351897244, 5.1691354052786922,
+		1796.6376507774528, 2283.6005714942162, 1838.3996272024981,
+		2398.5470211526808, 4.032402178705869, 4.9079837178231882 },
+	{ 3.008278598417117, 482.07948169663729, 5.1764072045698892,
+		1799.1996499291258, 2280.9212888797847, 1841.2103775942628,
+		2395.3127057655838, 4.0366358862653087, 4.902493102479947 },
+	{ 3.0107096413785865, 480.35550533818633, 5.1837819112937655,
+		1801.7968726564843, 2278.1888002487581, 1844.0609954888412,
+		2392.0161211751401, 4.040929608647037, 4.8969091135149219 },
+	{ 3.0131403392588783, 478.59984743198299, 5.1912643249343216,
+		1804.431095351044, 2275.4007034799656, 1846.9534888952808,
+		2388.6544809152265, 4.045286424909003, 4.8912274952225756 },
+	{ 3.0155707139280605, 476.81090065420625, 5.198859156386467,
+		1807.1042411115563, 2272.5546384055879, 1849.8900319870413,
+		2385.2250586147379, 4.0497096694835646, 4.8854440989893373 },
+	{ 3.0180007885743518, 474.98692387763361, 5.2065709139644127,
+		1809.8183965117951, 2269.6483442465096, 1852.8729841415263,
+		2381.7252575190373, 4.0542029614589943, 4.8795549928773267 },
+	{ 3.0204305878446167, 473.12602672777518, 5.2144037988484602,
+		1812.5758308416914, 2266.6797129485885, 1855.9049117933953,
+		2378.1526748030115, 4.0587702381912711, 4.8735565623092247 },
+	{ 3.0204305878446216, 473.12602672778081, 5.2144038601220899,
+		1812.5758308416923, 2266.679682849393, 1855.904911793396,
+		2378.1526384915501, 4.058770238191272, 4.8735565046933198 },
+	{ 3.0212745190556523, 472.47063326478604, 5.2171593354869223,
+		1813.5441995326398, 2265.6307996384085, 1856.9700172874684,
+		2376.8909081244146, 4.060374769300827, 4.8714414365082002 },
+	{ 3.0221184213447363, 471.81044733052647, 5.2199265903395284,
+		1814.5181964142366, 2264.5757804992813, 1858.0414915935924,
+		2375.622092692824, 4.0619889323995366, 4.8693159043593033 },
+	{ 3.0229622958887572, 471.14537469642033, 5.2227090488009829,
+		1815.4979350079782, 2263.5129421420643, 1859.1194631406649,
+		2374.3441680864153, 4.0636129245913137, 4.8671767052789274 },
+	{ 3.0238061438927306, 470.4753181139663, 5.2255086020957489,
+		1816.4835325460497, 2262.4413529137569, 1860.2040645600889,
+		2373.0560180441794, 4.065246949446129, 4.8650220789385212 },
+	{ 3.0246499665909874, 469.80017715573916, 5.2283262243646735,
+		1817.4751101660577, 2261.36053130134, 1861.2954329043337,
+		2371.7570698242466, 4.0668912173385987, 4.862851128190834 },
+	{ 3.0254937652482758, 469.11984803843319, 5.2311623711633786,
+		1818.4727931267439, 2260.2702506598457, 1862.3937098884758,
+		2370.4470583366938, 4.0685459458227129, 4.8606634441601075 },
+	{ 3.0263375411609688, 468.43422342617362, 5.2340172350326588,
+		1819.4767110468028, 2259.1704138495083, 1863.4990421571622,
+		2369.1258747981383, 4.0702113600462821, 4.8584588658574939 },
+	{ 3.0271812956583477, 467.74319221241313, 5.2368909063631159,
+		1820.48699816884, 2258.0609742294891, 1864.6115815791347,
+		2367.7934714149724, 4.0718876932086587, 4.8562373289281195 },
+	{ 3.028025030103918, 467.04663927968903, 5.2397834713025908,
+		1821.5037936492774, 2256.9418874947569, 1865.7314855704353,
+		2366.4498033308314, 4.073575187063228, 4.8539987736440278 },
+	{ 3.0288687458967676, 466.34444523770924, 5.2426950678729209,
+		1822.5272418739175, 2255.8130840081963, 1866.8589174460847,
+		2365.0947953244304, 4.0752740924641815, 4.8517430922189559 },
+	{ 3.0297124444730934, 465.63648614275536, 5.2456259145441368,
+		1823.5574927961404, 2254.6744546581313, 1867.9940467971599,
+		2363.7283248311437, 4.0769846699526031, 4.849470102033929 },
+	{ 3.0305561273076638, 464.9226332032315, 5.2485763209137737,
+		1824.5947022923997, 2253.5258455184676, 1869.1370498878339,
+		2362.3502155800952, 4.0787071903728895, 4.8471795356933569 },
+	{ 3.031399795915489, 464.20275248081606, 5.2515466870543399,
+		1825.6390325251386, 2252.3670580957332, 1870.2881100619684,
+		2360.960237961559, 4.080441935502864, 4.8448710417349679 },
+	{ 3.0322434518534869, 463.47670459999887, 5.2545374959833069,
+		1826.6906522988102, 2251.1978529782027, 1871.4474181441849,
+		2359.5581134861359, 4.0821891986733849, 4.8425441918019612 },
+	{ 3.0330870967222734, 462.7443444843492, 5.2575493022727748,
+		1827.7497373893639, 2250.0179554051674, 1872.6151728146174,
+		2358.1435215471506, 4.0839492853442234, 4.8401984914386027 },
+	{ 3.0339307321680198, 462.00552114258005, 5.2605827188194345,
+		1828.8164708218037, 2248.8270617621861, 1873.7915809302021,
+		2356.7161072872286, 4.0857225135930983, 4.8378333926083501 },
+	{ 3.034774359884481, 461.2600775320318, 5.2636384031086623,
+		1829.8910430654444, 2247.6248463446473, 1874.9768577600973,
+		2355.2754897766763, 4.0875092144663592, 4.8354483066801839 },
+	{ 3.0356179816150162, 460.50785052904286, 5.266717043826139,
+		1830.9736521144644, 2246.410967967553, 1876.1712271003119,
+		2353.8212699957799, 4.0893097321362166, 4.8330426170808582 },
+	{ 3.0364615991548054, 459.74867103384037, 5.2698193483452425,
+		1832.0645034232223, 2245.1850761591404, 1877.3749212345317,
+		2352.3530383059606, 4.0911244238124613, 4.8306156911168578 },
+	{ 3.0373052143531805, 458.98236422695811, 5.2729460313880718,
+		1833.1638096774966, 2243.9468167892333, 1878.5881807201984,
+		2350.8703812313533, 4.092953659376426, 4.8281668906865765 },
+	{ 3.0381488291160301, 458.20874997002414, 5.2760978050035217,
+		1834.2717904092387, 2242.6958370593484, 1879.8112540071086,
+		2349.3728874641683, 4.0947978207496387, 4.8256955817485219 },
+	{ 3.0389924454084039, 457.42764329901854, 5.2792753699051325,
+		1835.3886715116244, 2241.4317898313225, 1881.0443969480416,
+		2347.8601530670257, 4.0966573010932104, 4.823201142506079 },
+	{ 3.0398360652571865, 456.63885487904338, 5.2824794081399071,
+		1836.5146847991966, 2240.1543373066784, 1882.2878723551569,
+		2346.3317858881674, 4.0985325040833667, 4.8206829703366019 },
+	{ 3.0406796907540143, 455.84219116302916, 5.2857105770209989,
+		1837.6500678972454, 2238.8631540880401, 1883.5419499055322,
+		2344.7874092282432, 4.1004238437457632, 4.8181404875285461 },
+	{ 3.0415233240582782, 455.03745379719373, 5.2889695042281302,
+		1838.7950649666584, 2237.5579296684091, 1884.8069069380033,
+		2343.2266648148084, 4.1023317457090789, 4.8155731459175728 },
+	{ 3.0423669674003357, 454.22443751480318, 5.292256783970144,
+		1839.9499291052157, 2236.2383703990822, 1886.083031044534,
+		2341.649215146479, 4.1042566513086731, 4.8129804305215407 },
+	{ 3.0432106230849101, 453.4029253124001, 5.2955729740981443,
+		1841.1149277640075, 2234.9042009900063, 1887.3706258969453,
+		2340.0547452722431, 4.1061990268195245, 4.8103618622795796 },
+	{ 3.0440542934946584, 452.57267905280025, 5.2989185940586276,
+		1842.2903532426615, 2233.5551655961358, 1888.6700225344835,
+		2338.4429640710478, 4.1081593813342003, 4.8077169999996689 },
+	{ 3.0448979810939938, 451.73342270849838, 5.3022941235816665,
+		1843.4765413663029, 2232.1910285407889, 1889.9815994644282,
+		2336.8136050935705, 4.1101382985754906, 4.8050454416137711 },
+	{ 3.0457416884331105, 450.8848141454406, 5.3057000020048388,
+		1844.6739029169671, 2230.8115747242041, 1891.3058165239686,
+		2335.1664270246833, 4.1121364904434445, 4.8023468248340642 },
+	{ 3.0465854181522656, 450.02639951267497, 5.30913662814236,
+		1845.8829744480254, 2229.4166097614666, 1892.6432696876041,
+		2333.5012138201282, 4.114154883609765, 4.79962082729568 },
+	{ 3.0465854181522634, 449.64012430473645, 5.3087346546146241,
+		1846.3108839540007, 2229.6163929997242, 1893.1022719202388,
+		2333.740301485971, 4.1148826706956818, 4.7999965256446897 },
+	{ 3.0466633623868664, 449.6635921248897, 5.3094824242542842,
+		1846.3087927882111, 2229.2736548033795, 1893.1038133939016,
+		2333.3305497177953, 4.1148756220583804, 4.7993426008927722 },
+	{ 3.0467413068379288, 449.67689343320313, 5.3101176769593836,
+		1846.317960939173, 2228.9868169148058, 1893.1174356720708,
+		2332.9877182186056, 4.1148877246214726, 4.7987938686259684 },
+	{ 3.0468192515076553, 449.68075312334952, 5.3106605473201807,
+		1846.3375870308582, 2228.7458846903328, 1893.1422780865287,
+		2332.6998357519851, 4.1149176148366449, 4.7983315022315765 },
+	{ 3.046897196398251, 449.67584991351174, 5.3111280920305086,
+		1846.3669206724776, 2228.5423880283729, 1893.1775350735452,
+		2332.4567594802884, 4.114964016087213, 4.7979395538830909 },
+	{ 3.0469751415119353, 449.66281906549261, 5.311534739278521,
+		1846.4052594612795, 2228.3691598854612, 1893.2224528768857,
+		2332.2499085983627, 4.1150257335478413, 4.7976045341127076 },
+	{ 3.0470530868509438, 449.6422549623249, 5.311892672717053,
+		1846.4519461409618, 2228.2201466890538, 1893.2763264303735,
+		2332.0720365491352, 4.1151016493155952, 4.7973150525932695 },
+	{ 3.0471310324175085, 449.61471354942057, 5.3122121595237992,
+		1846.5063659102013, 2228.0902461146134, 1893.338496412433,
+		2331.9170362740974, 4.1151907178020677, 4.7970615112371311 },
+	{ 3.0472089782138698, 449.5807146445614, 5.3125018307216969,
+		1846.5679438754005, 2227.9751683010463, 1893.4083464647915,
+		2331.7797737131641, 4.1152919613757222, 4.7968358419679804 },
+	{ 3.0472869242422767, 449.54074412191773, 5.3127689207552793,
+		1846.6361426420985, 2227.8713171210825, 1893.4853005680604,
+		2331.6559454431322, 4.1154044662442812, 4.7966312826187805 },
+	{ 3.0473648705049752, 449.49525597550695, 5.3130194723048341,
+		1846.7104600387904, 2227.7756885980712, 1893.5688205663587,
+		2331.5419569305418, 4.1155273785659947, 4.7964421853568862 },
+	{ 3.0474428170042489, 449.4446742673357, 5.3132585114437072,
+		1846.7904269678677, 2227.6857839764002, 1893.658403834298,
+		2331.4348183852735, 4.1156599007801553, 4.7962638528579227 },
+	{ 3.0475207637423689, 449.38939496559215, 5.3134901974888997,
+		1846.8756053773095, 2227.5995353136423, 1893.7535810786144,
+		2331.332055642386, 4.1158012881456605, 4.7960923981564481 },
+	{ 3.0475987107216018, 449.32978767798568, 5.3137179512549224,
+		1846.9655863479575, 2227.5152417712793, 1893.8539142681423,
+		2331.23163387571, 4.1159508454783742, 4.795924624701267 },
+	{ 3.0476766579442387, 449.26619728532228, 5.3139445648674304,
+		1847.0599882904583, 2227.4315150488956, 1893.9589946851509,
+		2331.1318922721312, 4.1161079240769407, 4.7957579236612116 },
+	{ 3.0477546054125786, 449.19894548033136, 5.3141722958241013,
+		1847.1584552467161, 2227.3472326352589, 1894.0684410918848,
+		2331.0314880722131, 4.1162719188279011, 4.7955901859664349 },
+	{ 3.0478325531289232, 449.128332216449, 5.3144029475918515,
+		1847.2606552903917, 2227.261497744501, 1894.1818980059945,
+		2330.9293486181759, 4.1164422654806572, 4.7954197269433143 },
+	{ 3.0479105010955818, 449.05463707133828, 5.3146379386901108,
+		1847.3662790213032, 2227.1736049719957, 1894.2990340789113,
+		2330.8246302509351, 4.1166184380832513, 4.7952452217185604 },
+	{ 3.047988449314873, 448.97812052950314, 5.3148783619197593,
+		1847.4750381492297, 2227.0830108474383, 1894.4195405719254,
+		2330.7166830699853, 4.1167999465711471, 4.7950656498400672 },
+	{ 3.0480663977891171, 448.89902518843593, 5.3151250351533426,
+		1847.5866641616162, 2226.9893085826288, 1894.5431299238201,
+		2330.6050207142716, 4.1169863344994813, 4.794880247789794 },
+	{ 3.0481443465206621, 448.8175768923499, 5.3153785448933659,
+		1847.7009070714782, 2226.8922064149924, 1894.6695344057587,
+		2330.4892944465169, 4.1171771769123566, 4.7946884682601727 },
+	{ 3.0482222955118332, 448.73398579759129, 5.3156392836274682,
+		1847.8175342404036, 2226.7915090355755, 1894.7985048577505,
+		2330.3692709288061, 4.1173720783404049, 4.7944899452313718 },
+	{ 3.0483002447650045, 448.64844737337933, 5.3159074818621948,
+		1847.9363292729872, 2226.6871016633213, 1894.9298095025597,
+		2330.2448131648571, 4.1175706709202453, 4.7942844640247442 },
+	{ 3.0483781942825035, 448.56114334167529, 5.3161832355826553,
+		1848.057090978409, 2226.5789363941381, 1895.0632328323211,
+		2330.1158641643115, 4.1177726126284764, 4.7940719356336485 },
+	{ 3.0484561440667153, 448.47224255949999, 5.3164665297866236,
+		1848.1796323955052, 2226.4670205021266, 1895.1985745637205,
+		2329.9824329429916, 4.11797758562395, 4.7938523747248851 },
+	{ 3.0485340941200092, 448.3819018470615, 5.3167572586366765,
+		1848.3037798776081, 2226.3514064225715, 1895.3356486577502,
+		2329.8445825355752, 4.1181852946918776, 4.7936258808023764 },
+	{ 3.048612044444766, 448.29026676485262, 5.3170552427067701,
+		1848.4293722337302, 2226.2321831797663, 1895.4742824001407,
+		2329.7024197371938, 4.1183954657839479, 4.7933926220876524 },
+	{ 3.0486899950433748, 448.19747234261973, 5.3173602437245675,
+		1848.556259922952, 2226.1094690598998, 1895.6143155391117,
+		2329.5560863349883, 4.1186078446490395, 4.7931528217416846 },
+	{ 3.0487679459182409, 448.1036437630496, 5.3176719771576755,
+		1848.684304298677, 2225.9834053559084, 1895.7555994767611,
+		2329.4057516224825, 4.1188221955488133, 4.7929067461026245 },
+	{ 3.048845897071756, 448.00889700285836, 5.3179901229401461,
+		1848.8133768999621, 2225.8541510367595, 1895.89799651102,
+		2329.2516060203166, 4.1190383000534636, 4.7926546946622022 },
+	{ 3.0489238485063579, 447.9133394338852, 5.3183143345983561,
+		1848.9433587871199, 2225.7218782123027, 1896.0413791251458,
+		2329.0938556491392, 4.11925595591274, 4.7923969915385287 },
+	{ 3.0490018002244503, 447.81707038636489, 5.3186442469917505,
+		1849.0741399189319, 2225.5867682865578, 1896.1856293218661,
+		2328.9327177264722, 4.1194749759977958, 4.7921339782438475 },
+	{ 3.0490797522284638, 447.7201816769113, 5.3189794828642105,
+		1849.2056185689755, 2225.4490087019426, 1896.330637999454,
+		2328.76841667093, 4.1196951873095307, 4.7918660075640496 },
+	{ 3.0491577045208498, 447.62275810315668, 5.3193196583651199,
+		1849.3377007786821, 2225.3087901955219, 1896.4763043671469,
+		2328.6011808193002, 4.1199164300493996, 4.791593438401418 },
+	{ 3.0492356571040475, 447.52487790713855, 5.319664387682451,
+		1849.4702998450384, 2225.1663044963416, 1896.622535397657,
+		2328.4312396716473, 4.1201385567490911, 4.7913166314473035 },
+	{ 3.0493136099805196, 447.42661320936696, 5.3200132869115855,
+		1849.6033358405321, 2225.0217424024499, 1896.7692453142126,
+		2328.2588215909327, 4.1203614314550627, 4.7910359455692095 },
+	{ 3.0493915631527275, 447.32803041525409, 5.3203659772623713,
+		1849.7367351637897, 2224.8752921866608, 1896.9163551104082,
+		2328.0841518961674, 4.1205849289651626, 4.790751734816415 },
+	{ 3.0494695166231489, 447.22919059573979, 5.3207220876979608,
+		1849.8704301186269, 2224.7271382845156, 1897.0637921004629,
+		2327.9074512934103, 4.1208089341135974, 4.7904643459566429 },
+	{ 3.0495474703942587, 447.13014984359933, 5.3210812570822368,
+		1850.0043585200019, 2224.5774602263341, 1897.2114894982028,
+		2327.7289345989666, 4.1210333411015787, 4.7901741164719827 },
+	{ 3.0496254244685579, 447.03095960698425, 5.3214431359061845,
+		1850.1384633251821, 2224.4264317783964, 1897.3593860230228,
+		2327.5488097129401, 4.1212580528707985, 4.7898813729483205 },
+	{ 3.0497033788485317, 446.93166700159281, 5.321807387649538,
+		1850.2726922884215, 2224.2742202652398, 1897.5074255309307,
+		2327.3672768096067, 4.1214829805168582, 4.7895864298055084 },
+	{ 3.0497813335366928, 446.83231510277989, 5.322173689832618,
+		1850.4069976379014, 2224.1209860458775, 1897.655556669408,
+		2327.1845277120256, 4.1217080427405071, 4.789289588317124 },
+	{ 3.0498592885355746, 446.73294321897026, 5.3225417347995041,
+		1850.5413357733346, 2223.9668821234227, 1897.8037325542996,
+		2327.0007454263491, 4.1219331653339824, 4.7889911358811421 },
+	{ 3.0499372438476819, 446.63358714725268, 5.3229112302717798,
+		1850.6756669831827, 2223.8120538686908, 1897.9519104676722,
+		2326.8161038125295, 4.1221582807006438, 4.7886913455049651 },
+	{ 3.0500151994755562, 446.53427941271588, 5.3232818997093689,
+		1850.8099551800108, 2223.6566388396709, 1898.1000515750125,
+		2326.6307673697706, 4.1223833274054256, 4.7883904754706998 },
+	{ 3.0500931554217381, 446.43504949212775, 5.3236534825029187,
+		1850.944167652902, 2223.5007666846454, 1898.2481206606662,
+		2326.4448911220634, 4.1226082497542613, 4.7880887691576799 },
+	{ 3.0501711116887837, 446.3359240231926, 5.3240257340266632,
+		1851.0782748361169, 2223.3445591146869, 1898.3960858805692,
+		2326.2586205867269, 4.1228329974010833, 4.7877864549953371 },
+	{ 3.0502490682792502, 446.23692700018717, 5.3243984255713315,
+		1851.2122500925384, 2223.1881299357765, 1898.5439185308016,
+		2326.0720918142579, 4.1230575249799335, 4.7874837465280562 },
+	{ 3.0503270251957151, 446.13807995696197, 5.3247713441781821,
+		1851.346069511294, 2223.0315851300984, 1898.6915928312683,
+		2325.8854314869873, 4.1232817917611673, 4.7871808425723446 },
+	{ 3.0504049824407513, 446.03940213785114, 5.3251442923884085,
+		1851.4797117186072, 2222.8750229793991, 1898.8390857234513,
+		2325.6987570680276, 4.1235057613300761, 4.7868779274529167 },
+	{ 3.0504829400169466, 445.94091065764172, 5.3255170879247293,
+		1851.613157700795, 2222.7185342221424, 1898.9863766811936,
+		2325.5121769905973, 4.1237294012861936, 4.7865751713021423 },
+	{ 3.0505608979268968, 445.84262065089462, 5.3258895633155996,
+		1851.7463906391226, 2222.5622022392108, 1899.1334475340693,
+		2325.3257908814467, 4.1239526829626882, 4.786272730412942 },
+	{ 3.0506388561732107, 445.7445454116646, 5.3262615654741881,
+		1851.8793957550788, 2222.4061032621598, 1899.2802823019429,
+		2325.1396898112071, 4.1241755811634757, 4.7859707476338729 },
+	{ 3.05071681475851, 445.64669652394468, 5.3266329552406129,
+		1852.0121601661292, 2222.2503065997844, 1899.4268670406373,
+		2324.9539565665732, 4.1243980739181101, 4.7856693527984282 },
+	{ 3.0507947736854102, 445.54908398351256, 5.3270036068955049,
+		1852.1446727508321, 2222.0948748790411, 1899.5731896976624,
+		2324.7686659395995, 4.1246201422525894, 4.7853686631810639 },
+	{ 3.0508727329565515, 445.45171631192937, 5.3273734076534582,
+		1852.276924022661, 2221.9398642959918, 1899.7192399771939,
+		2324.5838850289106, 4.1248417699749345, 4.7850687839718695 },
+	{ 3.05095069257457, 445.3546006628352, 5.3277422571397661,
+		1852.408906012429, 2221.785324875173, 1899.8650092142489,
+		2324.3996735509195, 4.1250629434753669, 4.7847698087668107 },
+	{ 3.0510286525421284, 445.25774292144229, 5.3281100668584811,
+		1852.5406121580822, 2221.6313007333033, 1900.0104902567261,
+		2324.2160841561658, 4.1252836515390277, 4.78447182006592 },
+	{ 3.0511066128618833, 445.16114779720755, 5.3284767596533564,
+		1852.6720372022098, 2221.4778303466587, 1900.1556773556931,
+		2324.0331627499631, 4.1255038851717707, 4.7841748897781233 },
+	{ 3.0511845735365033, 445.06481891061111, 5.3288422691683168,
+		1852.8031770959205, 2221.3249468186909, 1900.3005660624679,
+		2323.8509488132722, 4.1257236374367938, 4.783879079726332 },
+	{ 3.0512625345686804, 444.96875887403536, 5.3292065393089105,
+		1852.9340289093527, 2221.1726781472717, 1900.4451531327566,
+		2323.6694757230498, 4.1259429033025139, 4.783584442151585 },
+	{ 3.0513404959610906, 444.87296936731417, 5.3295695237073337,
+		1853.0645907480402, 2221.0210474902178, 1900.5894364371036,
+		2323.4887710704793, 4.1261616795004024, 4.7832910202137588 },
+	{ 3.0514184577164487, 444.77745120838472, 5.3299311851956972,
+		1853.1948616746356, 2220.8700734267532, 1900.7334148770119,
+		2323.3088569742695, 4.1263799643919228, 4.7829988484844472 },
+	{ 3.0514964198374575, 444.68220441896784, 5.3302914952857225,
+		1853.3248416363408, 2220.7197702159042, 1900.8770883071704,
+		2323.1297503902201, 4.1265977578451309, 4.7827079534338592 },
+	{ 3.0515743823268346, 444.58722828619688, 5.3306504336604492,
+		1853.4545313964618, 2220.5701480488892, 1901.0204574621207,
+		2322.9514634135471, 4.1268150611183376, 4.782418353906265 },
+	{ 3.0516523451873141, 444.49252141990559, 5.3310079876765313,
+		1853.5839324711485, 2220.4212132963739, 1901.1635238884273,
+		2322.7740035750071, 4.1270318767525183, 4.7821300615856099 },
+	{ 3.0517303084216358, 444.39808180621554, 5.331364151879435,
+		1853.7130470699844, 2220.2729687493379, 1901.3062898809651,
+		2322.5973741293155, 4.1272482084702986, 4.7818430814489341 },
+	{ 3.0518082720325435, 444.30390685745004, 5.3317189275318944,
+		1853.8418780406826, 2220.12541385338, 1901.4487584236263,
+		2322.4215743356804, 4.127464061081918, 4.7815574122073574 },
+	{ 3.0518862360228032, 444.20999345886037, 5.3320723221574129,
+		1853.9704288174153, 2219.9785449356123, 1901.5909331338787,
+		2322.2465997294039, 4.1276794403973351, 4.781273046732931 },
+	{ 3.0519642003951892, 444.11633801203453, 5.3324243490974057,
+		1854.0987033726665, 2219.8323554248095, 1901.7328182111148,
+		2322.0724423853858, 4.127894353144355, 4.7809899724727121 },
+	{ 3.0520421651524572, 444.02293647551301, 5.332775027083791,
+		1854.2267061722587, 2219.6868360638859, 1901.8744183883664,
+		2321.8990911723945, 4.1281088068921266, 4.7807081718482802 },
+	{ 3.0521201302974235, 443.92978440276681, 5.3331243798284422,
+		1854.3544421333245, 2219.541975114063, 1902.0157388872096,
+		2321.7265319973712, 4.1283228099796485, 4.7804276226395466 },
+	{ 3.052198095832876, 443.83687697736792, 5.3334724356254473,
+		1854.4819165852653, 2219.3977585526773, 1902.1567853758331,
+		2321.5547480420769, 4.1285363714493633, 4.7801482983564627 },
+	{ 3.0522760617616211, 443.74420904605506, 5.3338192269713245,
+		1854.6091352332119, 2219.2541702620811, 1902.2975639297827,
+		2321.383719989064, 4.1287495009849708, 4.7798701685939307 },
+	{ 3.0523540280864783, 443.65177514945003, 5.3341647901997682,
+		1854.7361041238828, 2219.1111922113669, 1902.4380809953029,
+		2321.2134262390264, 4.1289622088533653, 4.7795931993731209 },
+	{ 3.0524319948102789, 443.55956955077892, 5.3345091651322187,
+		1854.8628296138461, 2218.9688046302053, 1902.5783433552199,
+		2321.0438431186903, 4.129174505850612, 4.7793173534678974 },
+	{ 3.0525099619358662, 443.46758626259015, 5.3348523947435051,
+		1854.989318339886, 2218.8269861752688, 1902.718358097078,
+		2320.8749450798095, 4.1293864032515053, 4.7790425907172205 },
+	{ 3.0525879294660951, 443.37581907173359, 5.335194524842823,
+		1855.115577191267, 2218.6857140889661, 1902.8581325833368,
+		2320.7067048889453, 4.1295979127624109, 4.7787688683230733 },
+	{ 3.0526658974038141, 443.28426156255972, 5.3355356037691966,
+		1855.241613284091, 2218.544964351061, 1902.9976744237824,
+		2320.5390938087135, 4.1298090464775647, 4.7784961411349229 },
+	{ 3.0527438657518999, 443.19290713878542, 5.3358756821025102,
+		1855.3674339369868, 2218.4047118225194, 1903.1369914493607,
+		2320.3720817697094, 4.1300198168377316, 4.7782243619195297 },
+	{ 3.0528218345132387, 443.10174904361673, 5.3362148123878272,
+		1855.4930466488772, 2218.2649303827752, 1903.2760916882792,
+		2320.2056375345587, 4.1302302365923413, 4.7779534816183737 },
+	{ 3.0528998036907211, 443.01078037873197, 5.3365530488741069,
+		1855.6184590778371, 2218.1255930598336, 1903.4149833432227,
+		2320.0397288533768, 4.1304403187634859, 4.7776834495915619 },
+	{ 3.0529777732872487, 442.91999412181445, 5.3368904472664713,
+		1855.7436790217187, 2217.9866721536514, 1903.5536747704921,
+		2319.8743226111792, 4.1306500766129473, 4.7774142138490667 },
+	{ 3.0530557433057317, 442.82938314305522, 5.3372270644917048,
+		1855.8687143998213, 2217.8481393529382, 1903.692174460266,
+		2319.7093849674111, 4.1308595236109689, 4.7771457212695942 },
+	{ 3.0531337137491015, 442.73894022050575, 5.3375629584770019,
+		1855.9935732358667, 2217.7099658453685, 1903.8304910182533,
+		2319.5448814875876, 4.131068673407257, 4.7768779178070169 },
+	{ 3.0532116846202895, 442.64865805432385, 5.3378981879402456,
+		1856.1182636421663, 2217.5721224220692, 1903.9686331486221,
+		2319.3807772680784, 4.1312775398040342, 4.7766107486860774 },
+	{ 3.0532896559222444, 442.55852928017896, 5.3382328121934206,
+		1856.2427938047554, 2217.4345795755753, 1904.1066096379643,
+		2319.2170370530757, 4.1314861367306985, 4.7763441585857569 },
+	{ 3.0533676276579187, 442.46854648164225, 5.338566890956856,
+		1856.3671719696861, 2217.2973075923946, 1904.2444293405204,
+		2319.0536253451082, 4.1316944782204699, 4.776078091812531 },
+	{ 3.0534455998302779, 442.37870220185329, 5.3389004841853556,
+		1856.4914064300215, 2217.1602766396654, 1904.3821011641226,
+		2318.8905065084846, 4.1319025783882273, 4.7758124924625083 },
+	{ 3.0535235724423191, 442.2889889544241, 5.3392336519052277,
+		1856.6155055136926, 2217.0234568463825, 1904.5196340571083,
+		2318.7276448662437, 4.1321104514098401, 4.7755473045733732 },
+	{ 3.0536015454970111, 442.19939923338222, 5.3395664540604795,
+		1856.7394775725656, 2216.8868183800787, 1904.6570369964968,
+		2318.5650047916606, 4.1323181115034995, 4.7752824722677607 },
+	{ 3.0536795189973618, 442.10992552277628, 5.3398989503712722,
+		1856.8633309716799, 2216.7503315173876, 1904.7943189763575,
+		2318.4025507924371, 4.1325255729113968, 4.7750179398851698 },
+	{ 3.0537574929463864, 442.02056030546021, 5.3402312002004484,
+		1856.9870740795341, 2216.6139667106081, 1904.9314889973025,
+		2318.2402475901104, 4.1327328498831521, 4.7747536521063383 },
+	{ 3.0538354673471106, 441.93129607126627, 5.3405632624297628,
+		1857.1107152589414, 2216.4776946494162, 1905.0685560566274,
+		2318.0780601936599, 4.1329399566602234, 4.7744895540685199 },
+	{ 3.0539134422025551, 441.84212532469479, 5.340895195344924,
+		1857.2342628585611, 2216.3414863182215, 1905.2055291390934,
+		2317.9159539678976, 4.1331469074614695, 4.7742255914725726 },
+	{ 3.0539914175157823, 441.75304059221725, 5.3412270565301645,
+		1857.3577252047066, 2216.2053130487425, 1905.3424172081043,
+		2317.7538946961558, 4.1333537164691663, 4.7739617106811023 },
+	{ 3.0540693932898435, 441.6640344287253, 5.3415589027691972,
+		1857.4811105942113, 2216.0691465694372, 1905.4792291979657,
+		2317.5918486392002, 4.1335603978168471, 4.7736978588106584 },
+	{ 3.054147369527799, 441.57509942400111, 5.3418907899555164,
+		1857.6044272872175, 2215.9329590502566, 1905.615974006033,
+		2317.4297825885674, 4.1337669655769895, 4.7734339838152007 },
+	{ 3.0542253462327471, 441.48622820855599, 5.34222277301002,
+		1857.7276835006501, 2215.7967231437524, 1905.7526604856921,
+		2317.2676639155329, 4.1339734337498859, 4.7731700345627024 },
+	{ 3.0543033234077681, 441.39741345885614, 5.3425549058045751,
+		1857.8508874024344, 2215.6604120232605, 1905.8892974400355,
+		2317.1054606165903, 4.1341798162537566, 4.7729059609062618 },
+	{ 3.0543813010559684, 441.30864790267719, 5.3428872410939174,
+		1857.9740471055234, 2215.5239994168778, 1906.0258936153989,
+		2316.943141353901, 4.1343861269145785, 4.7726417137473609 },
+	{ 3.0544592791804588, 441.21992432371076, 5.3432198304530631,
+		1858.0971706627129, 2215.3874596387282, 1906.1624576957213,
+		2316.7806754925086, 4.1345923794571986, 4.7723772450940034 },
+	{ 3.0545372577843697, 441.13123556608349, 5.3435527242215306,
+		1858.2202660616697, 2215.2507676168411, 1906.2989982971305,
+		2316.6180331335031, 4.1347985874968805, 4.7721125081125368 },
+	{ 3.054615236870839, 441.04257453847225, 5.3438859714528055,
+		1858.3433412202946, 2215.1138989183842, 1906.4355239629115,
+		2316.455185144026, 4.1350047645313435, 4.7718474571744993 },
+	{ 3.0546932164430221, 440.95393421797496, 5.3442196198700183,
+		1858.466403982427, 2214.9768297718501, 1906.5720431588095,
+		2316.2921031836313, 4.1352109239334371, 4.7715820478977413 },
+	{ 3.0547711965040705, 440.86530765370918, 5.3445537158261844,
+		1858.5894621137816, 2214.839537086913, 1906.7085642686206,
+		2316.1287597278779, 4.1354170789442062, 4.7713162371832443 },
+	{ 3.054849177057172, 440.77668797029651, 5.3448883042707331,
+		1858.7125232981105, 2214.7019984712051, 1906.8450955899825,
+		2315.9651280882249, 4.1356232426663162, 4.7710499832460984 },
+	{ 3.0549271581055022, 440.68806837088113, 5.345223428719005,
+		1858.835595133784, 2214.5641922455698, 1906.9816453306623,
+		2315.8011824301252, 4.1358294280581944, 4.7707832456436785 },
+	{ 3.0550051396522719, 440.59944214016895, 5.3455591312283186,
+		1858.9586851303989, 2214.4260974560711, 1907.1182216048217,
+		2315.6368977872303, 4.1360356479282512, 4.7705159852977275 },
+	{ 3.0550831217006742, 440.51080264707122, 5.3458954523760722,
+		1859.0818007058037, 2214.2876938849845, 1907.2548324297916,
+		2315.4722500743924, 4.1362419149297711, 4.7702481645145376 },
+	{ 3.0551611042539539, 440.4221433474745, 5.3462324312445952,
+		1859.2049491830521, 2214.1489620583925, 1907.3914857227103,
+		2315.307216096608, 4.1364482415557022, 4.7699797469987812 },
+	{ 3.055239087315325, 440.33345778633208, 5.3465701054065073,
+		1859.3281377879523, 2214.0098832535891, 1907.5281892978519,
+		2315.1417735577297, 4.1366546401344477, 4.7697106978669792 },
+	{ 3.0553170708880524, 440.24473960011272, 5.3469085109171219,
+		1859.4513736463925, 2213.8704395028985, 1907.6649508636692,
+		2314.9759010649054, 4.1368611228253078, 4.7694409836542668 },
+	{ 3.055395054975389, 440.15598251882153, 5.347247682307394,
+		1859.5746637820628, 2213.7306135972822, 1907.8017780203168,
+		2314.8095781327597, 4.1370677016145363, 4.7691705723207685 },
+	{ 3.0554730395806069, 440.06718036782172, 5.3475876525815984,
+		1859.6980151143575, 2213.5903890875625, 1907.9386782573106,
+		2314.6427851847325, 4.1372743883117842, 4.7688994332535026 },
+	{ 3.0555510247069892, 439.97832706976902, 5.3479284532176861,
+		1859.8214344562366, 2213.4497502843074, 1908.0756589511896,
+		2314.4755035528237, 4.1374811945463943, 4.7686275372658029 },
+	{ 3.0556290103578339, 439.88941664613264, 5.3482701141702007,
+		1859.944928512502, 2213.3086822564528, 1908.2127273635981,
+		2314.3077154758271, 4.1376881317644587, 4.7683548565943621 },
+	{ 3.0557069965364514, 439.80044321887539, 5.3486126638760689,
+		1860.0685038778749, 2213.1671708284821, 1908.3498906391676,
+		2314.1394040958453, 4.1378952112255156, 4.7680813648935976 },
+	{ 3.0557849832461752, 439.71140101170289, 5.3489561292628007,
+		1860.1921670355773, 2213.025202576388, 1908.4871558039399,
+		2313.9705534533555, 4.1381024440001042, 4.767807037227743 },
+	{ 3.0558629704903333, 439.62228435153042, 5.3493005357585082,
+		1860.3159243557227, 2212.8827648227862, 1908.6245297635753,
+		2313.801148481256, 4.1383098409669952, 4.7675318500613333 },
+	{ 3.0559409582722736, 439.53308766952358, 5.3496459073047662,
+		1860.4397820940724, 2212.7398456305341, 1908.7620193019568,
+		2313.6311749971419, 4.1385174128110522, 4.7672557812469307 },
+	{ 3.0560189465953611, 439.44380550234303, 5.34999226637124,
+		1860.5637463906128, 2212.5964337955193, 1908.8996310796222,
+		2313.4606196945779, 4.1387251700207779, 4.7669788100112829 },
+	{ 3.0560969354629632, 439.3544324930665, 5.3503396339716325,
+		1860.6878232685592, 2212.4525188387729, 1909.0373716326312,
+		2313.2894701335799, 4.1389331228865949, 4.7667009169402297 },
+	{ 3.0561749248784715, 439.26496339217704, 5.3506880296821944,
+		1860.812018633151, 2212.3080909973046, 1909.1752473712152,
+		2313.1177147295666, 4.1391412814987607, 4.7664220839612303 },
+	{ 3.0562529148452975, 439.1753930583576, 5.351037471661364,
+		1860.9363382707934, 2212.1631412143897, 1909.3132645788035,
+		2312.9453427416515, 4.1393496557458951, 4.7661422943248608 },
+	{ 3.0563309053668419, 439.08571645913787, 5.3513879766700692,
+		1861.0607878483052, 2212.0176611294955, 1909.4514294111725,
+		2312.7723442605238, 4.1395582553136538, 4.7658615325856521 },
+	{ 3.0564088964465368, 438.99592867175602, 5.3517395600951261,
+		1861.1853729118379, 2211.8716430666827, 1909.589747895217,
+		2312.5987101944943, 4.139767089682878, 4.7655797845800709 },
+	{ 3.056486888087826, 438.9060248836085, 5.352092235972318,
+		1861.3100988864892, 2211.7250800231732, 1909.7282259284916,
+		2312.4244322557502, 4.1399761681288902, 4.7652970374048396 },
+	{ 3.0565648802941663, 438.81600039284154, 5.352446017011264,
+		1861.4349710754632, 2211.5779656569912, 1909.8668692782633,
+		2312.2495029455131, 4.1401854997200704, 4.765013279393508 },
+	{ 3.0566428730690083, 438.72585060863327, 5.3528009146206372,
+		1861.5599946598318, 2211.4302942744753, 1910.0056835811977,
+		2312.0739155390238, 4.1403950933173892, 4.7647285000928044 },
+	{ 3.0567208664158572, 438.63557105190745, 5.3531569389361549,
+		1861.685174697642, 2211.2820608163634, 1910.1446743423433,
+		2311.8976640688479, 4.1406049575728892, 4.7644426902363275 },
+	{ 3.0567988603381893, 438.54515735526883, 5.3535140988462153,
+		1861.8105161239951, 2211.1332608450848, 1910.2838469351925,
+		2311.720743309615, 4.1408151009297764, 4.7641558417204788 },
+	{ 3.0568768548395293, 438.45460526354225, 5.3538724020217217,
+		1861.9360237503686, 2210.9838905299362, 1910.4232066008685,
+		2311.5431487602355, 4.1410255316212483, 4.7638679475764825 },
+	{ 3.0569548499233834, 438.36391063369121, 5.3542318549435199,
+		1862.0617022647348, 2210.8339466334642, 1910.5627584482368,
+		2311.3648766275574, 4.1412362576706689, 4.7635790019446418 },
+	{ 3.0570328455933033, 438.27306943520273, 5.3545924629330228,
+		1862.1875562310133, 2210.6834264962586, 1910.7025074532553,
+		2311.1859238081347, 4.1414472868906165, 4.7632890000456447 },
+	{ 3.0571108418528219, 438.18207774992544, 5.3549542301809119,
+		1862.3135900892917, 2210.5323280226762, 1910.8424584591683,
+		2311.0062878711065, 4.1416586268832241, 4.7629979381536067 },
+	{ 3.0571888387055233, 438.09093177231648, 5.3553171597786795,
+		1862.4398081554882, 2210.3806496651882, 1910.982616176082,
+		2310.82596703943, 4.141870285039591, 4.7627058135665647 },
+	{ 3.057266836154966, 437.99962780908118, 5.3556812537479326,
+		1862.5662146216798, 2210.2283904098081, 1911.1229851813077,
+		2310.6449601724194, 4.142082268540304, 4.7624126245789808 },
+	{ 3.057344834204768, 437.90816227946618, 5.3560465130728083,
+		1862.6928135558294, 2210.0755497599903, 1911.263569918975,
+		2310.4632667464434, 4.1422945843549623, 4.7621183704514118 },
+	{ 3.0574228328585051, 437.81653171457157, 5.3564129377293028,
+		1862.8196089024052, 2209.9221277220363, 1911.4043747006972,
+		2310.2808868374455, 4.1425072392432041, 4.7618230513829918 },
+	{ 3.0575008321198256, 437.7247327577237, 5.3567805267187669,
+		1862.9466044820333, 2209.7681247884652, 1911.5454037051256,
+		2310.0978211010192, 4.142720239754083, 4.7615266684801254 },
+	{ 3.0575788319923478, 437.63276216377182, 5.3571492780974026,
+		1863.0738039921666, 2209.6135419233328, 1911.6866609786327,
+		2309.914070754824, 4.1429335922271875, 4.7612292237288347 },
+	{ 3.0576568324797297, 437.540616799036, 5.357519189009218,
+		1863.2012110071605, 2209.4583805458487, 1911.8281504353588,
+		2309.7296375589663, 4.1431473027927508, 4.7609307199639295 },
+	{ 3.0577348335856285, 437.44829364071859, 5.3578902557165815,
+		1863.3288289788463, 2209.3026425151979, 1911.9698758577656,
+		2309.5445237978206, 4.1433613773726021, 4.7606311608404281 },
+	{ 3.0578128353137397, 437.35578977677648, 5.3582624736328039,
+		1863.456661236688, 2209.1463301143131, 1912.1118408967884,
+		2309.3587322606086, 4.1435758216804022, 4.7603305508030482 },
+	{ 3.0578908376677369, 437.26310240509878, 5.3586358373521268,
+		1863.5847109886136, 2208.9894460349838, 1912.2540490726683,
+		2309.1722662235657, 4.1437906412230419, 4.7600288950581806 },
+	{ 3.0579688406513363, 437.17022883338944, 5.3590103406826541,
+		1863.7129813211404, 2208.8319933614507, 1912.3965037750561,
+		2308.9851294303103, 4.1440058413008369, 4.7597261995430644 },
+	{ 3.0580468442682727, 437.07716647836111, 5.3593859766768537,
+		1863.84147520024, 2208.6739755552562, 1912.5392082638912,
+		2308.7973260737122, 4.1442214270089659, 4.7594224708972916 },
+	{ 3.0581248485222616, 436.98391286516568, 5.3597627376620611,
+		1863.9701954719033, 2208.5153964400488, 1912.6821656699824,
+		2308.6088607777083, 4.144437403238423, 4.7591177164342637 },
+	{ 3.0582028534170704, 436.89046562687253, 5.3601406152725666,
+		1864.0991448627115, 2208.3562601856302, 1912.8253789955822,
+		2308.4197385782204, 4.1446537746769572, 4.7588119441112191 },
+	{ 3.0582808589564752, 436.7968225036754, 5.3605196004795301,
+		1864.2283259806925, 2208.1965712930623, 1912.9688511152501,
+		2308.2299649053352, 4.1448705458105213, 4.75850516250126 },
+	{ 3.058358865144243, 436.70298134212561, 5.3608996836208025,
+		1864.3577413161138, 2208.0363345798282, 1913.112584776695,
+		2308.0395455655585, 4.1450877209245771, 4.758197380765484 },
+	{ 3.0584368719841879, 436.60894009455012, 5.3612808544323372,
+		1864.4873932421169, 2207.8755551641971, 1913.2565826013963,
+		2307.848486723115, 4.1453053041051815, 4.7578886086236496 },
+	{ 3.0585148794801, 436.51469681794606, 5.3616631020763341,
+		1864.6172840158997, 2207.7142384512154, 1913.4008470858485,
+		2307.656794883198, 4.1455232992409599, 4.7575788563278678 },
+	{ 3.0585928876358373, 436.42024967350261, 5.3620464151725402,
+		1864.7474157792115, 2207.5523901171291, 1913.545380602066,
+		2307.4644768733433, 4.1457417100239367, 4.7572681346333914 },
+	{ 3.0586708964552307, 436.32559692531964, 5.3624307818254779,
+		1864.8777905597649, 2207.3900160958046, 1913.6901853990446,
+		2307.2715398271989, 4.1459605399519139, 4.7569564547731416 },
+	{ 3.058748905942136, 436.2307369396994, 5.3628161896540192,
+		1865.0084102719579, 2207.2271225640466, 1913.8352636035279,
+		2307.0779911669724, 4.1461797923296828, 4.7566438284301595 },
+	{ 3.0588269161004455, 436.13566818423232, 5.3632026258201773,
+		1865.1392767179098, 2207.0637159272173, 1913.9806172210635,
+		2306.883838586245, 4.1463994702707669, 4.7563302677106787 },
+	{ 3.0589049269340371, 436.04038922647118, 5.3635900770556422,
+		1865.2703915888453, 2206.8998028060355, 1914.1262481374797,
+		2306.6890900342014, 4.1466195766997531, 4.7560157851193576 },
+	{ 3.058982938446817, 435.94489873322959, 5.3639785296904305,
+		1865.4017564658598, 2206.7353900223156, 1914.2721581196631,
+		2306.4937536985854, 4.1468401143535942, 4.7557003935325772 },
+	{ 3.059060950642722, 435.84919546931502, 5.3643679696797086,
+		1865.5333728213425, 2206.5704845855998, 1914.418348817052,
+		2306.2978379897313, 4.1470610857839887, 4.7553841061733868 },
+	{ 3.0591389635256898, 435.75327829645596, 5.3647583826299288,
+		1865.6652420200642, 2206.4050936801232, 1914.564821762802,
+		2306.1013515250006, 4.1472824933592252, 4.7550669365871103 },
+	{ 3.0592169770996671, 435.6571461720319, 5.3651497538250927,
+		1865.7973653206102, 2206.2392246517502, 1914.7115783752633,
+		2305.9043031131737, 4.1475043392666109, 4.7547488986168851 },
+	{ 3.0592949913686258, 435.56079814806918, 5.3655420682526236,
+		1865.9297438764579, 2206.072884995066, 1914.8586199591309,
+		2305.7067017390405, 4.1477266255142764, 4.7544300063795015 },
+	{ 3.0593730063365618, 435.46423336987601, 5.3659353106288012,
+		1866.0623787374411, 2205.9060823407044, 1915.005947706986,
+		2305.5085565482696, 4.1479493539336563, 4.7541102742416994 },
+	{ 3.059451022007484, 435.36745107480078, 5.3663294654229201,
+		1866.1952708511487, 2205.73882444331, 1915.1535627007661,
+		2305.3098768330392, 4.1481725261818561, 4.7537897167976499 },
+	{ 3.0595290383854001, 435.2704505908676, 5.3667245168814164,
+		1866.3284210643496, 2205.5711191694977, 1915.3014659132878,
+		2305.110672017669, 4.1483961437440575, 4.7534683488464484 },
+	{ 3.0596070554743515, 435.17323133565174, 5.3671204490521918,
+		1866.4618301242781, 2205.4029744857553, 1915.4496582095833,
+		2304.9109516441777, 4.1486202079356875, 4.7531461853694905 },
+	{ 3.0596850732783971, 435.07579281474301, 5.3675172458076812,
+		1866.5954986802562, 2205.2343984468994, 1915.5981403486342,
+		2304.7107253585191, 4.1488447199051768, 4.7528232415089189 },
+	{ 3.0597630918016114, 434.97813462038306, 5.3679148908672367,
+		1866.7294272852582, 2205.0653991849449, 1915.746912985014,
+		2304.5100028972988, 4.1490696806365968, 4.7524995325468176 },
+	{ 3.0598411110480654, 434.88025643000753, 5.368313367819197,
+		1866.8636163974063, 2204.8959848980867, 1915.8959766705002,
+		2304.3087940746318, 4.1492950909521911, 4.7521750738846436 },
+	{ 3.0599191310218847, 434.78215800490187, 5.3687126601436326,
+		1866.998066381524, 2204.7261638393547, 1916.0453318556949,
+		2304.1071087686182, 4.1495209515150195, 4.7518498810220535 },
+	{ 3.0599971517271771, 434.68383918865948, 5.3691127512321071,
+		1867.1327775107948, 2204.5559443067564, 1916.1949788917998,
+		2303.9049569095864, 4.149747262831748, 4.7515239695384954 },
+	{ 3.0600751731680922, 434.58529990567359, 5.3695136244095947,
+		1867.267749968393, 2204.3853346323353, 1916.3449180323573,
+		2303.7023484670549, 4.1499740252554282, 4.7511973550728213 },
+	{ 3.0601531953487737, 434.4865401595124, 5.3699152629534943,
+		1867.4029838493052, 2204.2143431726909, 1916.4951494351726,
+		2303.4992934384304, 4.1502012389885765, 4.750870053305583 },
+	{ 3.0602312182734037, 434.38756003150161, 5.3703176501144583,
+		1867.5384791618467, 2204.0429782985702, 1916.6456731639405,
+		2303.2958018366107, 4.15042890408575, 4.7505420799396649 },
+	{ 3.0603092419461673, 434.28835967904888, 5.3707207691345236,
+		1867.6742358295392, 2203.871248385833, 1916.7964891902452,
+		2303.0918836792148, 4.150657020456725, 4.7502134506834199 },
+	{ 3.0603872663712739, 434.1889393340914, 5.3711246032663453,
+		1867.8102536928, 2203.6991618058482, 1916.9475973953538,
+		2302.8875489771476, 4.1508855878693609, 4.7498841812327939 },
+	{ 3.0604652915529567, 434.08929930137668, 5.3715291357912349,
+		1867.9465325108001, 2203.5267269164679, 1917.0989975721993,
+		2302.6828077238561, 4.1511146059527642, 4.7495542872545311 },
+	{ 3.0605433174954455, 433.98943995677371, 5.3719343500362013,
+		1868.0830719633852, 2203.3539520535378, 1917.2506894274484,
+		2302.4776698852147, 4.1513440742005363, 4.749223784370364 },
+	{ 3.0606213442030179, 433.88936174575832, 5.372340229392119,
+		1868.2198716526748, 2203.1808455218184, 1917.4026725831945,
+		2302.2721453887289, 4.1515739919734935, 4.7488926881401312 },
+	{ 3.0606993716799389, 433.78906518156117, 5.3727467573290504,
+		1868.3569311051481, 2203.0074155873203, 1917.5549465791867,
+		2302.066244114405, 4.1518043585032061, 4.7485610140475298 },
+	{ 3.060777399930513, 433.6885508434035, 5.373153917413461,
+		1868.4942497735833, 2202.8336704687199, 1917.7075108749091,
+		2301.859975884543, 4.1520351728952969, 4.7482287774841581 },
+	{ 3.0608554289590475, 433.58781937487828, 5.373561693322932,
+		1868.631827038816, 2202.6596183299921, 1917.8603648514691,
+		2301.6533504549766, 4.1522664341324118, 4.7478959937358249 },
+	{ 3.0609334587698891, 433.48687148213696, 5.3739700688622891,
+		1868.7696622117683, 2202.4852672723619, 1918.0135078137632,
+		2301.4463775054983, 4.1524981410776833, 4.7475626779676183 },
+	{ 3.0610114893673779, 433.3857079320133, 5.3743790279768886,
+		1868.9077545354914, 2202.3106253276569, 1918.1669389926647,
+		2301.2390666319611, 4.1527302924782052, 4.7472288452115752 },
+	{ 3.0610895207558819, 433.28432955033855, 5.3747885547678322,
+		1869.0461031870507, 2202.1357004506976, 1918.3206575470479,
+		2301.0314273372337, 4.1529628869682149, 4.7468945103525462 },
+	{ 3.0611675529398017, 433.18273722007092, 5.3751986335054696,
+		1869.1847072795731, 2201.9605005125477, 1918.4746625659925,
+		2300.8234690231866, 4.1531959230725928, 4.7465596881157062 },
+	{ 3.0612455859235346, 433.08093187946645, 5.3756092486419655,
+		1869.3235658642695, 2201.7850332942389, 1918.6289530709371,
+		2300.6152009832326, 4.1534293992102915, 4.7462243930549191 },
+	{ 3.0613236197115077, 432.97891452013062, 5.376020384824594,
+		1869.462677932632, 2201.6093064801139, 1918.7835280180616,
+		2300.4066323944271, 4.1536633136980692, 4.7458886395404134 },
+	{ 3.0614016543081624, 432.87668618530961, 5.3764320269077697,
+		1869.6020424182386, 2201.4333276517959, 1918.9383863001958,
+		2300.1977723103128, 4.1538976647535799, 4.7455524417476287 },
+	{ 3.0614796897179688, 432.77424796794901, 5.3768441599650538,
+		1869.7416581989842, 2201.257104282201, 1919.0935267492569,
+		2299.9886296538143, 4.1541324504991382, 4.745215813646138 },
+	{ 3.0615577259454123, 432.67160100878294, 5.3772567693003257,
+		1869.8815240991505, 2201.0806437299334, 1919.2489481384482,
+		2299.7792132105901, 4.1543676689652616, 4.7448787689892971 },
+	{ 3.0616357629949742, 432.56874649431626, 5.3776698404580339,
+		1870.0216388916544, 2200.9039532341571, 1919.4046491846866,
+		2299.5695316229562, 4.1546033180944955, 4.7445413213047773 },
+	{ 3.061713800871197, 432.46568565518635, 5.3780833592353021,
+		1870.1620012998749, 2200.7270399085446, 1919.5606285505714,
+		2299.3595933827105, 4.1548393957445162, 4.7442034838833838 },
+	{ 3.0617918395786194, 432.36241976401118, 5.3784973116903974,
+		1870.3026100000118, 2200.549910737016, 1919.7168848469271,
+		2299.1494068260904, 4.1550758996921484, 4.7438652697712218 },
+	{ 3.06186987912178, 432.25895013338146, 5.3789116841523308,
+		1870.4434636233468, 2200.3725725689492, 1919.8734166352424,
+		2298.9389801281009, 4.1553128276372213, 4.7435266917608656 },
+	{ 3.0619479195052808, 432.15527811430019, 5.3793264632316902,
+		1870.5845607579372, 2200.195032113741, 1920.0302224294849,
+		2298.7283212960765, 4.1555501772054484, 4.7431877623813357 },
+	{ 3.0620259607336999, 432.05140509374809, 5.3797416358270631,
+		1870.7258999513717, 2200.017295937595, 1920.1873006990986,
+		2298.5174381658849, 4.1557879459531151, 4.7428484938922173 },
+	{ 3.0621040028116768, 431.9473324931663, 5.380157189135665,
+		1870.8674797124174, 2199.8393704581922, 1920.3446498707533,
+		2298.3063383956246, 4.1560261313699005, 4.7425088982738393 },
+	{ 3.0621820457438309, 431.84306176604082, 5.380573110659121,
+		1871.0092985136894, 2199.6612619417892, 1920.5022683312543,
+		2298.0950294621998, 4.156264730883418, 4.7421689872219863 },
+	{ 3.0622600895348371, 431.73859439645503, 5.3809893882129787,
+		1871.1513547933341, 2199.4829764984602, 1920.6601544293369,
+		2297.8835186556962, 4.1565037418620783, 4.7418287721391366 },
+	{ 3.0623381341893605, 431.63393189659655, 5.3814060099322178,
+		1871.2936469576989, 2199.3045200793076, 1920.8183064785869,
+		2297.6718130760996, 4.1567431616196515, 4.7414882641293961 },
+	{ 3.0624161797120943, 431.52907580509384, 5.381822964278876,
+		1871.436173383298, 2199.1258984726678, 1920.9767227595266,
+		2297.4599196288164, 4.1569829874186155, 4.7411474739915294 },
+	{ 3.0624942261077752, 431.42402768506736, 5.3822402400489491,
+		1871.5789324188877, 2198.9471173006218, 1921.1354015218926,
+		2297.2478450205581, 4.1572232164736915, 4.7408064122126001 },
+	{ 3.0625722733811376, 431.31878912194247, 5.3826578263771578,
+		1871.7219223879658, 2198.7681820166208, 1921.294340987326,
+		2297.0355957565571, 4.1574638459561104, 4.740465088963651 },
+	{ 3.0626503215369336, 431.21336172160767, 5.3830757127432607,
+		1871.8651415907877, 2198.5890979023052, 1921.4535393515675,
+		2296.8231781368199, 4.1577048729970567, 4.7401235140939049 },
+	{ 3.0627283705799444, 431.10774710831839, 5.3834938889774451,
+		1872.0085883067463, 2198.4098700647937, 1921.6129947870261,
+		2296.6105982529425, 4.1579462946917154, 4.7397816971258404 },
+	{ 3.0628064205149799, 431.00194692301056, 5.3839123452654967,
+		1872.1522607961883, 2198.2305034340975, 1921.7727054447571,
+		2296.3978619850727, 4.1581881081023893, 4.7394396472504976 },
+	{ 3.0628844713468517, 430.89596282083988, 5.3843310721525368,
+		1872.2961573032574, 2198.0510027612286, 1921.9326694575416,
+		2296.1849749997032, 4.158430310263344, 4.7390973733240864 },
+	{ 3.0629625230804041, 430.7897964696366, 5.3847500605482628,
+		1872.4402760575274, 2197.8713726155715, 1922.0928849416625,
+		2295.9719427465834, 4.158672898183589, 4.7387548838631997 },
+	{ 3.0630405757205157, 430.68344954777302, 5.3851693017307571,
+		1872.5846152764443, 2197.6916173829668, 1922.2533499995575,
+		2295.7587704564862, 4.1589158688510643, 4.7384121870413933 },
+	{ 3.0631186292720591, 430.57692374214383, 5.3855887873493371,
+		1872.7291731675666, 2197.5117412642689, 1922.4140627222539,
+		2295.5454631395291, 4.1591592192364573, 4.7380692906866058 },
+	{ 3.0631966837399358, 430.47022074624738, 5.3860085094285806,
+		1872.8739479307251, 2197.3317482733182, 1922.5750211917059,
+		2295.3320255828085, 4.1594029462968898, 4.7377262022775248 },
+	{ 3.0632747391290849, 430.36334225828165, 5.3864284603715342,
+		1873.0189377601534, 2197.1516422353425, 1922.7362234831298,
+		2295.118462348541, 4.1596470469795586, 4.7373829289407272 },
+	{ 3.0633527954444553, 430.25628997912935, 5.3868486329619394,
+		1873.1641408467119, 2196.9714267858035, 1922.8976676674065,
+		2294.9047777727351, 4.1598915182255514, 4.737039477448663 },
+	{ 3.0634308526910217, 430.14906561043369, 5.3872690203667899,
+		1873.309555380084, 2196.7911053691255, 1923.0593518134926,
+		2294.6909759637219, 4.1601363569735854, 4.7366958542174178 },
+	{ 3.0635089108737708, 430.0416708526401, 5.3876896161383518,
+		1873.4551795509992, 2196.610681237672, 1923.2212739908205,
+		2294.4770608009812, 4.1603815601637981, 4.7363520653049234 },
+	{ 3.0635869699977238, 429.93410740304029, 5.3881104142164,
+		1873.6010115533436, 2196.4301574505971, 1923.3834322716116,
+		2294.2630359338254, 4.1606271247413931, 4.7360081164089669 },
+	{ 3.0636650300679067, 429.82637695405799, 5.3885314089291549,
+		1873.7470495861805, 2196.2495368733944, 1923.5458247330719,
+		2294.0489047808969, 4.1608730476600577, 4.7356640128664536 },
+	{ 3.0637430910894006, 429.71848119103197, 5.3889525949958523,
+		1873.8932918561579, 2196.0688221765777, 1923.7084494600322,
+		2293.834670528654, 4.1611193258861094, 4.7353197596511034 },
+	{ 3.0638211530672663, 429.61042179055215, 5.3893739675258141,
+		1874.0397365794702, 2195.8880158361417, 1923.8713045470724,
+		2293.6203361319576, 4.1613659564018288, 4.7349753613744054 },
+	{ 3.0638992160066274, 429.5022004185173, 5.3897955220214984,
+		1874.1863819839471, 2195.7071201320209, 1924.0343881008116,
+		2293.4059043122879, 4.161612936209055, 4.7346308222829068 },
+	{ 3.0639772799126064, 429.39381872814874, 5.3902172543771965,
+		1874.3332263113871, 2195.5261371487504, 1924.1976982424587,
+		2293.1913775585654, 4.1618602623331729, 4.734286146259536 },
+	{ 3.064055344790344, 429.28527835831784, 5.3906391608801236,
+		1874.4802678193576, 2195.3450687748796, 1924.361233109769,
+		2292.9767581265114, 4.1621079318261858, 4.7339413368226575 },
+	{ 3.064133410645022, 429.17658093157064, 5.391061238210777,
+		1874.6275047834754, 2195.1639167028061, 1924.5249908595592,
+		2292.7620480384853, 4.1623559417706435, 4.7335963971258854 },
+	{ 3.0642114774818396, 429.06772805239092, 5.3914834834424283,
+		1874.7749354993848, 2194.9826824290112, 1924.6889696698511,
+		2292.5472490838151, 4.1626042892830064, 4.7332513299586303 },
+	{ 3.064289545306019, 428.95872130521849, 5.3919058940406615,
+		1874.9225582849135, 2194.8013672542806, 1924.8531677422443,
+		2292.3323628191001, 4.1628529715173563, 4.7329061377466441 },
+	{ 3.0643676141228013, 428.8495622528788, 5.3923284678628933,
+		1875.0703714819419, 2194.6199722839378, 1925.0175833039575,
+		2292.1173905685368, 4.1631019856685896, 4.7325608225525739 },
+	{ 3.0644456839374383, 428.74025243462029, 5.392751203157129,
+		1875.2183734585694, 2194.4384984284611, 1925.1822146102074,
+		2291.9023334246926, 4.1633513289761446, 4.7322153860772227 },
+	{ 3.0645237547552409, 428.63079336444372, 5.3931740985624552,
+		1875.3665626110201, 2194.2569464032222, 1925.3470599463001,
+		2291.6871922482428, 4.1636009987272438, 4.731869829659189 },
+	{ 3.064601826581514, 428.5211865292294, 5.3935971531058575,
+		1875.5149373657491, 2194.0753167300695, 1925.5121176299299,
+		2291.4719676698983, 4.1638509922605449, 4.7315241542779374 },
+	{ 3.0646798994216025, 428.41143338722662, 5.3940203662021968,
+		1875.6634961812097, 2193.8936097373389, 1925.6773860131361,
+		2291.2566600904543, 4.1641013069691253, 4.7311783605539102 },
+	{ 3.064757973280857, 428.3015353661292, 5.394443737651792,
+		1875.8122375499652, 2193.711825561058, 1925.842863484618,
+		2291.041269682275, 4.1643519403041456, 4.7308324487509106 },
+	{ 3.0648360481646679, 428.19149386146228, 5.3948672676392464,
+		1875.9611600005758, 2193.5299641455103, 1926.0085484717929,
+		2290.8257963899996, 4.1646028897780685, 4.7304864187772493 },
+	{ 3.064914124078459, 428.08131023498947, 5.3952909567316869,
+		1876.1102620993634, 2193.3480252441259, 1926.1744394427642,
+		2290.6102399316519, 4.1648541529676955, 4.7301402701875297 },
+	{ 3.064992201027648, 427.97098581286639, 5.3957148058752926,
+		1876.2595424525782, 2193.1660084212103, 1926.3405349086818,
+		2290.3945998007289, 4.1651057275178802, 4.7297940021859484 },
+	{ 3.0650702790177058, 427.86052188427692, 5.3961388163947612,
+		1876.4089997079002, 2192.9839130521941, 1926.5068334254133,
+		2290.1788752665502, 4.1653576111441071, 4.7294476136268999 },
+	{ 3.0651483580541066, 427.74991969952475, 5.3965629899895768,
+		1876.5586325566087, 2192.8017383255037, 1926.6733335959198,
+		2289.9630653765157, 4.1656098016362364, 4.7291011030185484 },
+	{ 3.0652264381423691, 427.63918046871146, 5.3969873287323216,
+		1876.7084397351357, 2192.6194832434012, 1926.8400340719706,
+		2289.7471689571471, 4.1658622968611532, 4.7287544685244987 },
+	{ 3.0653045192880302, 427.52830536000459, 5.3974118350652986,
+		1876.8584200270195, 2192.4371466236721, 1927.0069335563076,
+		2289.5311846161394, 4.1661150947661287, 4.7284077079670412 },
+	{ 3.0653826014966357, 427.41729549814733, 5.3978365117976095,
+		1877.0085722646077, 2192.2547271010785, 1927.1740308045232,
+		2289.3151107441226, 4.1663681933817669, 4.7280608188299595 },
+	{ 3.0654606847737886, 427.30615196304376, 5.3982613621030531,
+		1877.1588953306723, 2192.0722231283953, 1927.3413246268306,
+		2289.0989455159415, 4.1666215908247555, 4.7277137982605613 },
+	{ 3.0655387691250842, 427.19487578799499, 5.3986863895154533,
+		1877.3093881604661, 2191.8896329787726, 1927.5088138903504,
+		2288.8826868934962, 4.1668752853014226, 4.7273666430741681 },
+	{ 3.0656168545561622, 427.08346795854521, 5.3991115979268072,
+		1877.4600497429828, 2191.7069547466358, 1927.6764975205033,
+		2288.6663326268554, 4.1671292751099038, 4.7270193497558894 },
+	{ 3.0656949410726946, 426.97192941086035, 5.3995369915832843,
+		1877.6108791229017, 2191.5241863497013, 1927.8443745031534,
+		2288.4498802566877, 4.1673835586434889, 4.7266719144644744 },
+	{ 3.0657730286803586, 426.86026103027274, 5.3999625750812879,
+		1877.7618754021876, 2191.3413255309142, 1928.0124438863936,
+		2288.2333271166126, 4.1676381343933659, 4.7263243330360032 },
+	{ 3.0658511173848741, 426.74846365009176, 5.4003883533645407,
+		1877.9130377415174, 2191.1583698599507, 1928.1807047821069,
+		2288.0166703350114, 4.1678930009510982, 4.7259766009867725 },
+	{ 3.0659292071919775, 426.63653805003133, 5.4008143317198023,
+		1878.0643653620448, 2190.9753167353238, 1928.3491563679499,
+		2287.7999068375771, 4.1681481570116539, 4.7256287135173185 },
+	{ 3.066007298107444, 426.52448495498157, 5.4012405157735168,
+		1878.2158575468636, 2190.7921633860747, 1928.517797888956,
+		2287.5830333493559, 4.1684036013759362, 4.7252806655156352 },
+	{ 3.0660853901370615, 426.4123050336222, 5.4016669114871529,
+		1878.3675136425843, 2190.6089068740989, 1928.6866286592926,
+		2287.3660463975502, 4.168659332953486, 4.7249324515615916 },
+	{ 3.0661634832866529, 426.29999889726929, 5.402093525153699,
+		1878.5193330606915, 2190.4255440959005, 1928.8556480637758,
+		2287.1489423136441, 4.1689153507648431, 4.7245840659302916 },
+	{ 3.0662415775620566, 426.18756709839619, 5.4025203633931618,
+		1878.6713152792361, 2190.2420717848522, 1929.0248555597445,
+		2286.9317172361148, 4.1691716539444581, 4.7242355025963381 },
+	{ 3.0663196729691569, 426.07501012964053, 5.4029474331489329,
+		1878.8234598439883, 2190.0584865130063, 1929.194250678356,
+		2286.7143671126282, 4.1694282417426889, 4.7238867552373103 },
+	{ 3.0663977695138476, 425.96232842253619, 5.403374741682569,
+		1878.9757663699613, 2189.8747846936958, 1929.3638330262663,
+		2286.4968877031642, 4.1696851135284252, 4.7235378172386691 },
+	{ 3.066475867202068, 425.84952234622966, 5.4038022965703938,
+		1879.1282345428522, 2189.6909625832704, 1929.5336022872611,
+		2286.2792745821071, 4.1699422687915817, 4.7231886816970512 },
+	{ 3.0665539660397667, 425.736592206409, 5.4042301056978728,
+		1879.2808641203076, 2189.5070162838806, 1929.7035582236499,
+		2286.0615231415936, 4.1701997071452883, 4.7228393414255425 },
+	{ 3.0666320660329367, 425.62353824436838, 5.4046581772563673,
+		1879.4336549330528, 2189.3229417451116, 1929.8737006775348,
+		2285.8436285934854, 4.1704574283278424, 4.722489788956783 },
+	{ 3.0667101671875736, 425.5103606355537, 5.4050865197368738,
+		1879.5866068865587, 2189.1387347671293, 1930.0440295726789,
+		2285.6255859731373, 4.1707154322055962, 4.7221400165488836 },
+	{ 3.0667882695097437, 425.39705948894618, 5.4055151419276672,
+		1879.7397199617901, 2188.9543910018597, 1930.2145449153513,
+		2285.4073901408369, 4.1709737187742446, 4.7217900161877058 },
+	{ 3.0668663730054928, 425.28363484555166, 5.4059440529067659,
+		1879.8929942169693, 2188.7699059567449, 1930.3852467962704,
+		2285.1890357862912, 4.1712322881618897, 4.7214397795938945 },
+	{ 3.0669444776809236, 425.17008667787877, 5.4063732620393097,
+		1880.046429788212, 2188.5852749960882, 1930.5561353913686,
+		2284.9705174302594, 4.1714911406301356, 4.7210892982254622 },
+	{ 3.0670225835421676, 425.05641488878229, 5.40680277897214,
+		1880.2000268908723, 2188.4004933437373, 1930.7272109632656,
+		2284.7518294277725, 4.1717502765764438, 4.7207385632828425 },
+	{ 3.067100690595375, 424.94261931042928, 5.407232613628187,
+		1880.3537858208042, 2188.2155560859323, 1930.8984738627066,
+		2284.532965971543, 4.1720096965362794, 4.7203875657142342 },
+	{ 3.0671787988467334, 424.82869970353556, 5.4076627762024652,
+		1880.5077069552508, 2188.0304581732817, 1931.069924529555,
+		2284.3139210943441, 4.1722694011846952, 4.7200362962193543 },
+	{ 3.0672569083024537, 424.71465575650154, 5.4080932771565005,
+		1880.6617907538744, 2187.8451944235817, 1931.2415634939648,
+		2284.0946886723905, 4.1725293913381085, 4.7196847452547326 },
+	{ 3.0673350189687723, 424.60048708455122, 5.4085241272133224,
+		1880.8160377597951, 2187.6597595243015, 1931.4133913775484,
+		2283.8752624283102, 4.1727896679561054, 4.7193329030383859 },
+	{ 3.0674131308519783, 424.48619322889095, 5.4089553373531611,
+		1880.9704486006269, 2187.4741480347793, 1931.5854088945509,
+		2283.6556359337919, 4.1730502321432441, 4.7189807595539639 },
+	{ 3.067491243958349, 424.3717736560061, 5.4093869188066517,
+		1881.1250239892736, 2187.2883543895809, 1931.7576168527496,
+		2283.4358026135947, 4.1733110851504502, 4.7186283045570496 },
+	{ 3.0675693582942265, 424.25722775686188, 5.4098188830517051,
+		1881.2797647249495, 2187.1023729001163, 1931.9300161546228,
+		2283.2157557474961, 4.1735722283767878, 4.7182755275782036 },
+	{ 3.0676474738659811, 424.14255484634543, 5.4102512418074218,
+		1881.4346716938537, 2186.9161977576669, 1932.1026077981114,
+		2282.9954884739154, 4.1738336633706421, 4.717922417928663 },
+	{ 3.0677255906799905, 424.02775416235727, 5.4106840070282596,
+		1881.5897458702389, 2186.7298230363131, 1932.2753928778441,
+		2282.7749937934186, 4.1740953918315773, 4.7175689647058139 },
+	{ 3.0678037087426846, 423.91282486537523, 5.4111171909000575,
+		1881.7449883170125, 2186.5432426949424, 1932.4483725858074,
+		2282.5542645711243, 4.1743574156114143, 4.7172151567969891 },
+	{ 3.0678818280605076, 423.79776603780005, 5.4115508058339055,
+		1881.9004001865039, 2186.3564505803092, 1932.6215482122573,
+		2282.3332935403655, 4.1746197367155427, 4.7168609828851835 },
+	{ 3.0679599486399503, 423.68257668322553, 5.4119848644616155,
+		1882.055982721391, 2186.1694404293285, 1932.7949211467449,
+		2282.1120733054354, 4.1748823573045586, 4.7165064314533813 },
+	{ 3.0680380704875234, 423.56725572622764, 5.4124193796298341,
+		1882.2117372549735, 2185.9822058720047, 1932.9684928784707,
+		2281.8905963450948, 4.1751452796947639, 4.7161514907900273 },
+	{ 3.0681161936097809, 423.45180201155563, 5.4128543643953009,
+		1882.3676652121792, 2185.794740433842, 1933.1422649974315,
+		2281.6688550154504, 4.1754085063599069, 4.7157961489935554 },
+	{ 3.06819431801329, 423.33621430379281, 5.4132898320189451,
+		1882.5237681100095, 2185.6070375387799, 1933.3162391949227,
+		2281.4468415534711, 4.1756720399319915, 4.7154403939778868 },
+	{ 3.0682724437046542, 423.22049128690526, 5.4137257959610583,
+		1882.6800475581313, 2185.4190905116307, 1933.4904172642562,
+		2281.2245480799011, 4.175935883202305, 4.7150842134769899 },
+	{ 3.0683505706905327, 423.10463156386436, 5.4141622698765994,
+		1882.8365052593724, 2185.2308925804473, 1933.6648011013253,
+		2281.0019666020912, 4.1762000391223166, 4.7147275950493235 },
+	{ 3.0684286989775766, 422.98863365623544, 5.4145992676081613,
+		1882.9931430102458, 2185.0424368800354, 1933.8393927052296,
+		2280.779089018195, 4.1764645108045917, 4.7143705260843998 },
+	{ 3.0685068285725126, 422.87249600375412, 5.4150368031831659,
+		1883.1499627015176, 2184.8537164533745, 1934.0141941789343,
+		2280.5559071188763, 4.1767293015238041, 4.714012993805456 },
+	{ 3.0685849594820587, 422.75621696433114, 5.4154748908058137,
+		1883.3069663183019, 2184.6647242556519, 1934.1892077294135,
+		2280.3324125921176, 4.1769944147169333, 4.7136549852769818 },
+	{ 3.0686630917129913, 422.63979481335639, 5.4159135448541349,
+		1883.4641559408626, 2184.4754531557669, 1934.3644356685711,
+		2280.1085970250269, 4.1772598539846584, 4.7132964874075478 },
+	{ 3.0687412252721118, 422.52322774379428, 5.4163527798735673,
+		1883.6215337446392, 2184.2858959395239, 1934.5398804133199,
+		2279.8844519076492, 4.1775256230914506, 4.7129374869557674 },
+	{ 3.0688193601662466, 422.40651386587388, 5.416792610571675,
+		1883.7791020006669, 2184.0960453123148, 1934.7155444860623,
+		2279.6599686361701, 4.1777917259663075, 4.7125779705353104 },
+	{ 3.0688974964022906, 422.28965120693584, 5.4172330518142795,
+		1883.9368630758011, 2183.9058939010511, 1934.8914305150088,
+		2279.4351385152272, 4.17805816670319, 4.7122179246185176 },
+	{ 3.0689756339871099, 422.17263771122447, 5.417674118617307,
+		1884.0948194330629, 2183.715434258258, 1935.0675412345636,
+		2279.2099527627893, 4.1783249495616266, 4.7118573355440301 },
+	{ 3.0690537729276746, 422.05547123977163, 5.418115826145474,
+		1884.2529736318356, 2183.5246588627488, 1935.2438794856184,
+		2278.9844025109755, 4.1785920789671041, 4.7114961895180727 },
+	{ 3.0691319132309252, 421.93814957065257, 5.4185581897031128,
+		1884.4113283276622, 2183.3335601242129, 1935.4204482153386,
+		2278.7584788115187, 4.1788595595107401, 4.7111344726229945 },
+	{ 3.0692100549038877, 421.82067039855838, 5.419001224732674,
+		1884.5698862728241, 2183.1421303840016, 1935.597250477869,
+		2278.5321726367147, 4.1791273959503075, 4.7107721708187498 },
+	{ 3.0692881979535884, 421.70303133489733, 5.4194449468065731,
+		1884.7286503162834, 2182.9503619191983, 1935.7742894342944,
+		2278.3054748842706, 4.1793955932101783, 4.7104092699504863 },
+	{ 3.0693663423870934, 421.5852299079541, 5.4198893716236025,
+		1884.8876234036288, 2182.7582469444333, 1935.951568352632,
+		2278.0783763794761, 4.1796641563812562, 4.7100457557519269 },
+	{ 3.0694444882115177, 421.46726356293561, 5.4203345150039635,
+		1885.0468085770567, 2182.5657776143921, 1936.129090607848,
+		2277.8508678781955, 4.1799330907209793, 4.7096816138500488 },
+	{ 3.0695226354340086, 421.34912966193974, 5.4207803928835823,
+		1885.20620897553, 2182.3729460266563, 1936.3068596820747,
+		2277.6229400702546, 4.1802024016536405, 4.7093168297703842 },
+	{ 3.0696007840617328, 421.23082548418267, 5.4212270213089884,
+		1885.3658278346181, 2182.1797442243001, 1936.4848791644863,
+		2277.3945835825375, 4.1804720947701171, 4.7089513889418422 },
+	{ 3.0696789341018964, 421.11234822624709, 5.4216744164324817,
+		1885.5256684862479, 2181.9861641982984, 1936.6631527510594,
+		2277.1657889818603, 4.1807421758275112, 4.7085852767012115 },
+	{ 3.0697570855617728, 420.99369500222843, 5.4221225945083154,
+		1885.6857343586978, 2181.7921978894751, 1936.8416842446125,
+		2276.9365467772973, 4.1810126507491505, 4.708218478296784 },
+	{ 3.069835238448626, 420.87486284379031, 5.4225715718851006,
+		1885.8460289765708, 2181.5978371922943, 1937.0204775548157,
+		2276.7068474246926, 4.1812835256245844, 4.7078509788954106 },
+	{ 3.0699133927697773, 420.75584870071589, 5.4230213650032324,
+		1886.0065559602874, 2181.4030739561795, 1937.1995366976887,
+		2276.4766813282399, 4.1815548067087542, 4.7074827635849532 },
+	{ 3.0699915485325868, 420.63664944111156, 5.4234719903890776,
+		1886.1673190259387, 2181.2078999884357, 1937.3788657954647,
+		2276.2460388439627, 4.1818265004217681, 4.7071138173797369 },
+	{ 3.0700697057444404, 420.51726185159464, 5.4239234646501,
+		1886.3283219851446, 2181.0123070566988, 1937.5584690764983,
+		2276.0149102826354, 4.1820986133486961, 4.7067441252250832 },
+	{ 3.0701478644127751, 420.39768263800994, 5.4243758044705155,
+		1886.489568744392, 2180.8162868911172, 1937.7383508745584,
+		2275.7832859123819, 4.182371152238467, 4.7063736720013996 },
+	{ 3.0702260245450543, 420.27790842539628, 5.4248290266057033,
+		1886.6510633050905, 2180.6198311871794, 1937.9185156289568,
+		2275.551155962044, 4.1826441240040078, 4.7060024425294085 },
+	{ 3.0703041861487828, 420.15793575876711, 5.4252831478782602,
+		1886.8128097628323, 2180.4229316076894, 1938.0989678837593,
+		2275.3185106235383, 4.1829175357209998, 4.7056304215738303 },
+	{ 3.0703823492315077, 420.0377611035442, 5.4257381851729276,
+		1886.974812306989, 2180.2255797853327, 1938.2797122873976,
+		2275.0853400549076, 4.1831913946272206, 4.7052575938481622 },
+	{ 3.0704605138007923, 419.91738084559688, 5.4261941554315403,
+		1887.1370752207363, 2180.0277673252208, 1938.4607535927321,
+		2274.851634383353, 4.1834657081226343, 4.704883944019385 },
+	{ 3.07053867986426, 419.7967912925194, 5.4266510756492146,
+		1887.299602879729, 2179.8294858067966, 1938.6420966556452,
+		2274.617383707508, 4.1837404837671421, 4.7045094567115164 },
+	{ 3.0706168474295747, 419.67598867375841, 5.4271089628696645,
+		1887.4623997520373, 2179.6307267862144, 1938.8237464350091,
+		2274.3825781002674, 4.1840157292805102, 4.7041341165100334 },
+	{ 3.0706950165044153, 419.5549691411602, 5.427567834179599,
+		1887.6254703976256, 2179.431481799154, 1939.0057079921576,
+		2274.1472076121386, 4.1842914525415225, 4.7037579079670868 },
+	{ 3.0707731870965329, 419.433728769646, 5.4280277067060814,
+		1887.7888194676898, 2179.2317423621439, 1939.1879864902023,
+		2273.9112622728226, 4.1845676615868603, 4.7033808156039703 },
+	{ 3.0708513592136795, 419.31226355813408, 5.4284885976098387,
+		1887.9524517036975, 2179.0314999759576, 1939.3705871930192,
+		2273.6747320952436, 4.1848443646095044, 4.7030028239173998 },
+	{ 3.0709295328636732, 419.19056942984673, 5.4289505240828824,
+		1888.1163719371541, 2178.8307461267982, 1939.5535154650345,
+		2273.4376070769736, 4.1851215699583637, 4.7026239173817359 },
+	{ 3.0710077080543714, 419.06864223336902, 5.4294135033436071,
+		1888.2805850884604, 2178.6294722887656, 1939.7367767700111,
+		2273.1998772031616, 4.1853992861363576, 4.7022440804535481 },
+	{ 3.0710858847936531, 418.9464777430793, 5.4298775526311802,
+		1888.4450961665966, 2178.4276699267029, 1939.9203766707431,
+		2272.9615324499186, 4.185677521799902, 4.7018632975768924 },
+	{ 3.0711640630894466, 418.82407166017151, 5.4303426892031119,
+		1888.6099102679852, 2178.225330497402, 1940.104320827847,
+		2272.7225627857551, 4.1859562857569896, 4.7014815531855421 },
+	{ 3.0712422429497215, 418.70141961340158, 5.4308089303299782,
+		1888.7750325757797, 2178.0224454522959, 1940.2886149990306,
+		2272.4829581747858, 4.1862355869660295, 4.7010988317079931 },
+	{ 3.0713204243825025, 418.57851715981059, 5.4312762932922123,
+		1888.9404683591595, 2177.8190062390499, 1940.4732650383412,
+		2272.2427085786176, 4.1865154345346305, 4.7007151175703914 },
+	{ 3.0713986073958286, 418.45535978591732, 5.4317447953744331,
+		1889.1062229720503, 2177.6150043044436, 1940.6582768948208,
+		2272.0018039597785, 4.1867958377174839, 4.7003303952018829 },
+	{ 3.0714767919977985, 418.33194290822945, 5.4322144538631898,
+		1889.2723018526267, 2177.4104310954981, 1940.843656611991,
+		2271.7602342830619, 4.1870768059155221, 4.6999446490366976 },
+	{ 3.0715549781965343, 418.20826187438064, 5.4326852860411385,
+		1889.4387105221906, 2177.2052780624249, 1941.0294103266531,
+		2271.5179895190272, 4.1873583486740307, 4.6995578635196109 },
+	{ 3.0716331660002196, 418.08431196405718, 5.4331573091849457,
+		1889.6054545841505, 2176.9995366596872, 1941.2155442678281,
+		2271.2750596452652, 4.1876404756809329, 4.6991700231078966 },
+	{ 3.0717113554170687, 417.96008838994754, 5.4336305405601752,
+		1889.7725397230834, 2176.7931983485778, 1941.4020647557438,
+		2271.0314346494597, 4.1879231967652304, 4.6987811122761114 },
+	{ 3.0717895464553444, 417.83558629891309, 5.4341049974179141,
+		1889.9399717035094, 2176.5862545989389, 1941.588978200539,
+		2270.7871045314355, 4.1882065218949069, 4.6983911155192626 },
+	{ 3.0718677391233484, 417.71080077285336, 5.4345806969908521,
+		1890.107756368983, 2176.3786968911154, 1941.7762911013067,
+		2270.542059305476, 4.1884904611754266, 4.6980000173564305 },
+	{ 3.0719459334294172, 417.58572682982441, 5.4350576564891,
+		1890.2758996409532, 2176.1705167180958, 1941.9640100448694,
+		2270.2962890028698, 4.1887750248478106, 4.6976078023347165 },
+	{ 3.0720241293819459, 417.46035942516761, 5.4355358930976694,
+		1890.4444075175802, 2175.9617055867861, 1942.152141704531,
+		2270.0497836734198, 4.189060223286627, 4.6972144550316024 },
+	{ 3.0721023269893628, 417.33469345261773, 5.4360154239717806,
+		1890.6132860725565, 2175.7522550203721, 1942.3406928388104,
+		2269.8025333882556, 4.1893460669980191, 4.6968199600593072 },
+	{ 3.0721805262601358, 417.20872374550174, 5.436496266233501,
+		1890.7825414539041, 2175.5421565600341, 1942.529670290156,
+		2269.5545282418616, 4.189632566617659, 4.6964243020679586 },
+	{ 3.072258727202795, 417.08244507793631, 5.436978436969051,
+		1890.9521798826381, 2175.3314017662951, 1942.719080983527,
+		2269.3057583536893, 4.1899197329085096, 4.6960274657480827 },
+	{ 3.0723369298258913, 416.95585216581736, 5.4374619532238704,
+		1891.1222076518288, 2175.1199822215394, 1942.9089319253853,
+		2269.0562138711366, 4.1902075767592297, 4.6956294358352491 },
+	{ 3.0724151341380455, 416.82893966826953, 5.4379468320008169,
+		1891.2926311250092, 2174.9078895309167, 1943.0992302019858,
+		2268.8058849706272, 4.1904961091814803, 4.6952301971117372 },
+	{ 3.0724933401478887, 416.70170218903235, 5.4384330902550317,
+		1891.4634567347046, 2174.695115324932, 1943.2899829778078,
+		2268.5547618606834, 4.1907853413074445, 4.6948297344113135 },
+	{ 3.07257154786413, 416.57413427731001, 5.4389207448927319,
+		1891.6346909815884, 2174.4816512600837, 1943.4811974946469,
+		2268.3028347826848, 4.1910752843883978, 4.6944280326204098 },
+	{ 3.07264975729551, 416.44623042946841, 5.4394098127663426,
+		1891.8063404326597, 2174.2674890213193, 1943.6728810696568,
+		2268.0500940137763, 4.1913659497916234, 4.694025076682637 },
+	{ 3.0727279684508226, 416.31798509032024, 5.439900310672166,
+		1891.9784117198778, 2174.0526203232143, 1943.8650410938797,
+		2267.7965298682757, 4.1916573489981008, 4.6936208516009792 },
+	{ 3.0728061813388896, 416.18939265408949, 5.4403922553463619,
+		1892.1509115391761, 2173.8370369120148, 1944.0576850312007,
+		2267.5421327000909, 4.1919494936008359, 4.6932153424415288 },
+	{ 3.0728843959685888, 416.06044746655124, 5.4408856634627796,
+		1892.3238466481214, 2173.6207305667517, 1944.250820415803,
+		2267.2868929040392, 4.1922423953008989, 4.6928085343355557 },
+	{ 3.0729626123488583, 415.93114382553586, 5.4413805516301883,
+		1892.4972238654611, 2173.4036931006326, 1944.444454851712,
+		2267.0308009175042, 4.1925360659066566, 4.6924004124820557 },
+	{ 3.0730408304886576, 415.80147598302193, 5.4418769363878514,
+		1892.6710500688537, 2173.1859163632948, 1944.6385960103207,
+		2266.7738472231013, 4.1928305173299183, 4.6919909621519018 },
+	{ 3.0731190503970258, 415.67143814647102, 5.4423748342046689,
+		1892.845332193436, 2172.967392241258, 1944.8332516288651,
+		2266.516022349218, 4.1931257615835085, 4.6915801686886676 },
+	{ 3.0731972720830121, 415.54102447987395, 5.4428742614739543,
+		1893.0200772307512, 2172.748112660548, 1945.028429509254,
+		2266.2573168731178, 4.193421810779463, 4.6911680175134611 },
+	{ 3.0732754955557464, 415.41022910598986, 5.4433752345132174,
+		1893.1952922263192, 2172.5280695868473, 1945.2241375154508,
+		2265.9977214211272, 4.1937186771248793, 4.6907544941251862 },
+	{ 3.0733537208243797, 415.27904610701188, 5.4438777695588509,
+		1893.3709842789169, 2172.3072550281618, 1945.420383572711,
+		2265.7372266717857, 4.1940163729207303, 4.6903395841054509 },
+	{ 3.073431947898134, 415.14746952686693, 5.444381882765879,
+		1893.5471605382061, 2172.0856610349938, 1945.6171756649751,
+		2265.4758233560538, 4.1943149105577948, 4.6899232731188665 },
+	{ 3.0735101767862658, 415.01549337220013, 5.4448875902034466,
+		1893.723828203573, 2171.8632797026025, 1945.8145218336676,
+		2265.2135022599919, 4.194614302514724, 4.6895055469172124 },
+	{ 3.0735884074980824, 414.88311161424053, 5.4453949078533723,
+		1893.900994522176, 2171.6401031717596, 1946.0124301755473,
+		2264.95025422565, 4.1949145613547101, 4.6890863913408083 },
+	{ 3.073666640042958, 414.7503181905202, 5.4459038516076683,
+		1894.0786667871012, 2171.4161236300197, 1946.2109088407101,
+		2264.6860701525779, 4.1952156997223451, 4.688665792320843 },
+	{ 3.0737448744302829, 414.6171070061323, 5.4464144372647647,
+		1894.2568523360228, 2171.1913333136372, 1946.409966031162,
+		2264.4209410000849, 4.1955177303413498, 4.6882437358828897 },
+	{ 3.0738231106695335, 414.48347193549955, 5.4469266805290051,
+		1894.4355585492897, 2170.9657245078361, 1946.6096099987221,
+		2264.1548577875637, 4.1958206660113326, 4.6878202081473876 },
+	{ 3.0739013487702094, 414.34940682409382, 5.4474405970068389,
+		1894.6147928480914, 2170.7392895487496, 1946.8098490430391,
+		2263.8878115967855, 4.1961245196046582, 4.6873951953332043 },
+	{ 3.0739795887418744, 414.21490549034661, 5.4479562022052823,
+		1894.7945626923474, 2170.5120208242129, 1947.0106915092988,
+		2263.619793572831, 4.1964293040628506, 4.6869686837590647 },
+	{ 3.0740578305941573, 414.07996172677514, 5.4484735115300289,
+		1894.9748755795692, 2170.2839107747391, 1947.2121457869941,
+		2263.3507949252498, 4.1967350323946686, 4.6865406598453392 },
+	{ 3.0741360743366948, 413.94456930202455, 5.4489925402814414,
+		1895.1557390426465, 2170.0549518955422, 1947.4142203075135,
+		2263.0808069304476, 4.197041717672346, 4.6861111101177606 },
+	{ 3.0742143199792142, 413.80872196254688, 5.4495133036548609,
+		1895.3371606479814, 2169.8251367364251, 1947.6169235421121,
+		2262.8098209315517, 4.1973493730283922, 4.6856800212071716 },
+	{ 3.0742925675314972, 413.67241343459608, 5.4500358167376106,
+		1895.5191479933694, 2169.5944579032848, 1947.8202639996077,
+		2262.5378283401938, 4.1976580116519999, 4.6852473798523038 },
+	{ 3.0743708170033512, 413.53563742534953, 5.4505600945059003,
+		1895.7017087068227, 2169.3629080597143, 1948.0242502251044,
+		2262.2648206383956, 4.1979676467870481, 4.6848131729026861 },
+	{ 3.0744490684046526, 413.398387625326, 5.4510861518244598,
+		1895.884850443894, 2169.1304799272025, 1948.2288907970701,
+		2261.9907893788045, 4.1982782917275197, 4.6843773873189996 },
+	{ 3.0745273217453262, 413.26065770969177, 5.4516140034434732,
+		1896.0685808863159, 2168.8971662866784, 1948.4341943258589,
+		2261.7157261865191, 4.1985899598151999, 4.683940010175891 },
+	{ 3.0746055770353582, 413.12244134036575, 5.4521436639981538,
+		1896.2529077396637, 2168.662959978783, 1948.640169451166,
+		2261.4396227594034, 4.1989026644356997, 4.6835010286624605 },
+	{ 3.07468383428479, 412.98373216770221, 5.4526751480053104,
+		1896.4378387316008, 2168.4278539055981, 1948.8468248401011,
+		2261.1624708701302, 4.1992164190154462, 4.6830604300854048 },
+	{ 3.0747620935036961, 412.84452383235634, 5.4532084698622887,
+		1896.6233816098065, 2168.1918410312128, 1949.0541691849469,
+		2260.8842623668429, 4.1995312370181539, 4.6826182018700395 },
+	{ 3.0748403547022414, 412.70480996713616, 5.4537436438463134,
+		1896.8095441399694, 2167.9549143820673, 1949.2622112009462,
+		2260.6049891735624, 4.199847131941417, 4.6821743315609172 },
+	{ 3.0749186178906065, 412.56458419852169, 5.4542806841106195,
+		1896.9963341041853, 2167.7170670489309, 1949.4709596245741,
+		2260.3246432925162, 4.2001641173139612, 4.6817288068254186 },
+	{ 3.0749968830790584, 412.4238401491225, 5.4548196046850839,
+		1897.183759298211, 2167.4782921866181, 1949.6804232105162,
+		2260.0432168037987, 4.2004822066909648, 4.6812816154532175 },
+	{ 3.0750751502779141, 412.28257143927186, 5.4553604194739735,
+		1897.3718275297992, 2167.2385830151338, 1949.8906107298592,
+		2259.760701866724, 4.2008014136511997, 4.6808327453583534 },
+	{ 3.0751534194975241, 412.14077168844756, 5.4559031422531481,
+		1897.5605466171266, 2166.9979328211057, 1950.1015309683701,
+		2259.4770907215047, 4.201121751794382, 4.6803821845818412 },
+	{ 3.0752316907483253, 411.99843451789189, 5.4564477866707586,
+		1897.7499243859261, 2166.7563349574712, 1950.313192723358,
+		2259.1923756888841, 4.2014432347362503, 4.6799299212910599 },
+	{ 3.0753099640408066, 411.85555355232208, 5.4569943662453655,
+		1897.9399686676327, 2166.5137828444394, 1950.5256048016279,
+		2258.9065491712608, 4.2017658761053971, 4.6794759437814948 },
+	{ 3.0753882393855001, 411.71212242131963, 5.4575428943629305,
+		1898.1306872978907, 2166.2702699710389, 1950.7387760178779,
+		2258.6196036545157, 4.2020896895407347, 4.6790202404795522 },
+	{ 3.0754665167930026, 411.56813476187557, 5.4580933842774062,
+		1898.3220881137545, 2166.0257898948312, 1950.952715191592,
+		2258.3315317076635, 4.2024146886866944, 4.678562799941993 },
+	{ 3.0755447962739777, 411.4235842201349, 5.4586458491093293,
+		1898.5141789517734, 2165.7803362426785, 1951.1674311449694,
+		2258.0423259837507, 4.2027408871899725, 4.6781036108573248 },
+	{ 3.0756230778391327, 411.2784644529861, 5.4592003018434774,
+		1898.7069676463095, 2165.5339027119194, 1951.3829327010558,
+		2257.751979221242, 4.2030682986966319, 4.6776426620479121 },
+	{ 3.0757013614992519, 411.13276913052397, 5.4597567553293924,
+		1898.9004620267713, 2165.2864830701405, 1951.5992286807243,
+		2257.4604842437411, 4.2033969368473922, 4.6771799424695422 },
+	{ 3.0757796472651653, 410.98649193777476, 5.4603152222787523,
+		1899.0946699157582, 2165.0380711565335, 1951.816327900626,
+		2257.1678339615837, 4.2037268152744396, 4.6767154412138661 },
+	{ 3.0758579351477673, 410.83962657624454, 5.4608757152653862,
+		1899.289599127399, 2164.788660881924, 1952.0342391713614,
+		2256.8740213718615, 4.2040579475986011, 4.6762491475084236 },
+	{ 3.0759362251580176, 410.69216676680389, 5.4614382467240237,
+		1899.485257464127, 2164.5382462294024, 1952.2529712939463,
+		2256.5790395591657, 4.2043903474238045, 4.6757810507177631 },
+	{ 3.0760145173069202, 410.544106250494, 5.4620028289487959,
+		1899.6816527158578, 2164.2868212551252, 1952.4725330588915,
+		2256.2828816965161, 4.2047240283356926, 4.675311140344883 },
+	{ 3.0760928116055704, 410.3954387914319, 5.4625694740941322,
+		1899.8787926567677, 2164.0343800879073, 1952.6929332426646,
+		2255.9855410448745, 4.2050590038960864, 4.6748394060304319 },
+	{ 3.076171108065104, 410.24615817834882, 5.46313819417185,
+		1900.076685043603, 2163.7809169306784, 1952.9141806058244,
+		2255.6870109548549, 4.2053952876401128, 4.6743658375553654 },
+	{ 3.0762494066967183, 410.09625822658273, 5.4637090010511837,
+		1900.2753376134906, 2163.526426060529, 1953.1362838906125,
+		2255.387284866767, 4.2057328930724305, 4.6738904248409643 },
+	{ 3.0763277075116782, 409.94573277990685, 5.4642819064583472,
+		1900.4747580819756, 2163.2709018289538, 1953.3592518187747,
+		2255.0863563108892, 4.2060718336638807, 4.6734131579492644 },
+	{ 3.0764060105213131, 409.79457571314327, 5.4648569219757173,
+		1900.6749541400443, 2163.0143386622785, 1953.5830930882978,
+		2254.7842189079702, 4.2064121228463849, 4.6729340270837838 },
+	{ 3.0764843157370203, 409.64278093308235, 5.4654340590413932,
+		1900.8759334532353, 2162.7567310619315, 1953.8078163724031,
+		2254.4808663695326, 4.2067537740114096, 4.6724530225899974 },
+	{ 3.0765626231702505, 409.49034238148238, 5.4660133289477084,
+		1901.0777036582222, 2162.498073605213, 1954.0334303157936,
+		2254.1762924987697, 4.2070968005041189, 4.6719701349566805 },
+	{ 3.0766409328325199, 409.33725403630854, 5.4665947428414574,
+		1901.2802723615293, 2162.2383609452086, 1954.2599435332186,
+		2253.8704911904356, 4.207441215621162, 4.6714853548157373 },
+	{ 3.0767192447354272, 409.18350991418254, 5.4671783117241164,
+		1901.4836471367751, 2161.9775878107198, 1954.4873646064284,
+		2253.5634564307461, 4.2077870326059443, 4.6709986729420025 },
+	{ 3.0767975588906138, 409.02910407206082, 5.4677640464493722,
+		1901.6878355228384, 2161.7157490075288, 1954.7157020821421,
+		2253.2551822988635, 4.2081342646454853, 4.6705100802555402 },
+	{ 3.0768758753098027, 408.87403060924657, 5.4683519577246784,
+		1901.8928450216283, 2161.4528394176436, 1954.9449644695853,
+		2252.945662965994, 4.2084829248665807, 4.6700195678202014 },
+	{ 3.0769541940047764, 408.71828366934568, 5.468942056109654,
+		1902.0986830959416, 2161.1888540001601, 1955.1751602381107,
+		2252.6348926963842, 4.2088330263321296, 4.669527126845157 },
+	{ 3.0770325149873856, 408.56185744249518, 5.4695343520165727,
+		1902.3053571669557, 2160.9237877910127, 1955.4062978144163,
+		2252.3228658470266, 4.2091845820368174, 4.6690327486844145 },
+	{ 3.0771108382695402, 408.40474616668877, 5.4701288557090146,
+		1902.5128746128005, 2160.6576359037103, 1955.6383855809556,
+		2252.0095768685005, 4.2095376049046695, 4.668536424838087 },
+	{ 3.0771891638632507, 408.24694413072115, 5.4707255773039982,
+		1902.7212427652262, 2160.3903935282829, 1955.8714318722516,
+		2251.6950203037277, 4.209892107783328, 4.6680381469504564 },
+	{ 3.0772674917805469, 408.08844567503479, 5.4713245267678223,
+		1902.9304689087519, 2160.1220559334124, 1956.1054449739354,
+		2251.3791907904638, 4.210248103442563, 4.6675379068137914 },
+	{ 3.0773458220335659, 407.92924519428209, 5.4719257139198891,
+		1903.1405602777418, 2159.8526184645398, 1956.3404331195077,
+		2251.0620830590556, 4.2106056045692712, 4.6670356963648558 },
+	{ 3.077424154634496, 407.76933713928145, 5.4725291484304242,
+		1903.3515240542645, 2159.5820765450458, 1956.5764044879463,
+		2250.743691933817, 4.2109646237637719, 4.6665315076870133 },
+	{ 3.0775024895956058, 407.60871601867933, 5.4731348398209629,
+		1903.5633673662396, 2159.3104256760289, 1956.8133672016427,
+		2250.4240123327545, 4.2113251735366184, 4.6660253330097747 },
+	{ 3.0775808269292222, 407.44737640091438, 5.4737427974638475,
+		1903.7760972852236, 2159.0376614366014, 1957.0513293239433,
+		2250.1030392678995, 4.2116872663047991, 4.6655171647092901 },
+	{ 3.0776591666477482, 407.28531291656401, 5.4743530305831518,
+		1903.9897208238008, 2158.7637794834623, 1957.2902988562359,
+		2249.780767844788, 4.2120509143872198, 4.6650069953075075 },
+	{ 3.0777375087636782, 407.1225202594801, 5.474965548254862,
+		1904.2042449343401, 2158.4887755508275, 1957.5302837365559,
+		2249.457193262368, 4.2124161300025769, 4.6644948174720051 },
+	{ 3.077815853289541, 406.95899318914053, 5.4755803594045185,
+		1904.4196765063248, 2158.2126454516474, 1957.7712918366044,
+		2249.1323108144124, 4.2127829252647429, 4.6639806240181612 },
+	{ 3.0778942002379632, 406.79472653278975, 5.4761974728107674,
+		1904.6360223639635, 2157.9353850758675, 1958.0133309590981,
+		2248.8061158874539, 4.213151312178657, 4.6634644079059235 },
+	{ 3.0779725496216455, 406.62971518654768, 5.4768168971036255,
+		1904.8532892649641, 2157.6569903913255, 1958.2564088363597,
+		2248.4786039618311, 4.2135213026381928, 4.662946162241389 },
+	{ 3.0780509014533535, 406.46395411820362, 5.4774386407647846,
+		1905.0714838973749, 2157.3774574436243, 1958.5005331268228,
+		2248.1497706115156, 4.2138929084207151, 4.6624258802765288 },
+	{ 3.0781292557459232, 406.29743836816078, 5.4780627121278336,
+		1905.2906128785146, 2157.09678235607, 1958.7457114138015,
+		2247.8196115040264, 4.2142661411852336, 4.6619035554090109 },
+	{ 3.0782076125122799, 406.13016305192099, 5.4786891193793377,
+		1905.5106827521936, 2156.8149613291407, 1958.991951202388,
+		2247.488122399785, 4.2146410124675961, 4.6613791811811858 },
+	{ 3.0782859717654123, 405.96212336156628, 5.479317870558325,
+		1905.7316999870518, 2156.5319906408117, 1959.2392599175871,
+		2247.1552991524773, 4.2150175336776057, 4.6608527512806068 },
+	{ 3.0783643335183792, 405.79331456770524, 5.4799489735563878,
+		1905.9536709743106, 2156.2478666464917, 1959.4876449017854,
+		2246.8211377089697, 4.2153957160951538, 4.6603242595398831 },
+	{ 3.0784426977843382, 405.6237320213483, 5.4805824361197368,
+		1906.176602025695, 2155.9625857780684, 1959.7371134124248,
+		2246.4856341081577, 4.2157755708666071, 4.6597936999348546 },
+	{ 3.0785210645765209, 405.45337115566616, 5.4812182658484794,
+		1906.4004993714145, 2155.6761445442726, 1959.9876726197158,
+		2246.1487844813819, 4.2161571090013181, 4.6592610665852181 },
+	{ 3.0785994339081983, 405.2822274871462, 5.4818564701951384,
+		1906.6253691588818, 2155.3885395314746, 1960.2393296051994,
+		2245.8105850533429, 4.2165403413693925, 4.6587263537559149 },
+	{ 3.078677805792768, 405.11029661852126, 5.4824970564695938,
+		1906.851217449333, 2155.0997674012215, 1960.4920913579522,
+		2245.4710321391894, 4.2169252786958644, 4.6581895558525837 },
+	{ 3.078756180243682, 404.93757423943595, 5.4831400318356724,
+		1907.0780502171169, 2154.8098248919864, 1960.7459647737521,
+		2245.1301221465533, 4.217311931559423, 4.65765066742469 },
+	{ 3.0788345572744706, 404.76405612893001, 5.4837854033134965,
+		1907.3058733468063, 2154.5187088180346, 1961.0009566518561,
+		2244.7878515741941, 4.2177003103874258, 4.6571096831633909 },
+	{ 3.0789129368987651, 404.58973815639501, 5.4844331777806916,
+		1907.5346926321579, 2154.2264160688342, 1961.2570736937778,
+		2244.4442170112916, 4.2180904254540872, 4.6565665979004214 },
+	{ 3.0789913191302389, 404.41461628393739, 5.4850833619699122,
+		1907.7645137733648, 2153.9329436103289, 1961.5143225002189,
+		2244.0992151389196, 4.2184822868757026, 4.6560214066103347 },
+	{ 3.0790697039826922, 404.23868656771316, 5.4857359624744033,
+		1907.9953423755276, 2153.6382884821974, 1961.7727095693065,
+		2243.7528427268039, 4.2188759046079998, 4.6554741044054628 },
+	{ 3.0791480914699618, 404.06194515959464, 5.4863909857435535,
+		1908.2271839467662, 2153.3424478000857, 1962.0322412944668,
+		2243.4050966359264, 4.2192712884428367, 4.6549246865399114 },
+	{ 3.0792264816060135, 403.88438830883848, 5.4870484380882329,
+		1908.4600438962334, 2153.0454187530058, 1962.2929239621712,
+		2243.0559738154429, 4.2196684480047626, 4.6543731484047566 },
+	{ 3.0793048744048543, 403.70601236360778, 5.4877083256776995,
+		1908.6939275324182, 2152.7471986048749, 1962.5547637499885,
+		2242.7054713044768, 4.2200673927480556, 4.6538194855308035 },
+	{ 3.079383269880601, 403.5268137726431, 5.4883706545429609,
+		1908.9288400611724, 2152.4477846928935, 1962.8177667243556,
+		2242.3535862301896, 4.2204681319532815, 4.6532636935855543 },
+	{ 3.0794616680474385, 403.34678908692217, 5.4890354305761244,
+		1909.1647865837722, 2152.1471744278733, 1963.0819388383709,
+		2242.0003158081449, 4.2208706747239173, 4.6527057683737558 },
+	{ 3.0795400689196573, 403.16593496110312, 5.4897026595332292,
+		1909.4017720952615, 2151.845365292877, 1963.3472859298911,
+		2241.6456573406858, 4.2212750299834605, 4.6521457058348403 },
+	{ 3.0796184725116067, 402.98424815485015, 5.4903723470319639,
+		1909.6398014828826, 2151.5423548443805, 1963.6138137197397,
+		2241.2896082182824, 4.2216812064726801, 4.6515835020450025 },
+	{ 3.0796968788377415, 402.8017255346673, 5.4910444985553921,
+		1909.87887952392, 2151.2381407104294, 1963.8815278092479,
+		2240.9321659173424, 4.2220892127458649, 4.6510191532137686 },
+	{ 3.0797752879126046, 402.61836407518371, 5.4917191194522621,
+		1910.1190108842063, 2150.9327205905265, 1964.1504336785374,
+		2240.5733280000568, 4.2224990571681857, 4.6504526556837167 },
+	{ 3.0798536997508164, 402.4341608606419, 5.4923962149370551,
+		1910.3602001163333, 2150.626092255628, 1964.4205366844744,
+		2240.213092114373, 4.2229107479125858, 4.6498840059304323 },
+	{ 3.0799321143670868, 402.24911308627173, 5.4930757900912743,
+		1910.602451658066, 2150.3182535475298, 1964.6918420588333,
+		2239.8514559932541, 4.2233242929569883, 4.6493132005613029 },
+	{ 3.0800105317762121, 402.06321805984408, 5.4937578498652337,
+		1910.8457698304649, 2150.0092023780135, 1964.9643549061602,
+		2239.4884174536464, 4.2237397000810084, 4.6487402363139143 },
+	{ 3.0800889519930985, 401.87647320305717, 5.4944423990790598,
+		1911.0901588362185, 2149.6989367283522, 1965.2380802018358,
+		2239.1239743958845, 4.2241569768630347, 4.6481651100550803 },
+	{ 3.0801673750327141, 401.6888760524663, 5.4951294424226074,
+		1911.335622758568, 2149.3874546494044, 1965.5130227908207,
+		2238.7581248037709, 4.2245761306783134, 4.6475878187809538 },
+	{ 3.080245800910137, 401.50042426151782, 5.4958189844577303,
+		1911.5821655588097, 2149.0747542604822, 1965.7891873848146,
+		2238.390866743232, 4.2249971686945935, 4.6470083596148957 },
+	{ 3.0803242296405315, 401.31111560132865, 5.4965110296192066,
+		1911.8297910753988, 2148.7608337489328, 1966.0665785611739,
+		2238.0221983617976, 4.2254200978705194, 4.6464267298066595 },
+	{ 3.080402661239154, 401.12094796184761, 5.4972055822158428,
+		1912.0785030224938, 2148.4456913696158, 1966.3452007612295,
+		2237.6521178879648, 4.2258449249530665, 4.6458429267313681 },
+	{ 3.0804810957213515, 400.92991935371214, 5.49790264643062,
+		1912.328304987715, 2148.1293254448369, 1966.625058287716,
+		2237.2806236311003, 4.226271656473612, 4.6452569478893357 },
+	{ 3.0805595331025684, 400.73802790904364, 5.4986022263243415,
+		1912.5792004311729, 2147.8117343625772, 1966.9061553036147,
+		2236.907713979333, 4.2267002987461968, 4.6446687909027675 },
+	{ 3.0806379733983373, 400.5452718824252, 5.4993043258340251,
+		1912.8311926842232, 2147.4929165773083, 1967.1884958306914,
+		2236.5333874004918, 4.2271308578653182, 4.6440784535171975 },
+	{ 3.0807164166243113, 400.35164965311543, 5.5000089487778938,
+		1913.084284946789, 2147.172870607521, 1967.4720837464365,
+		2236.1576424391774, 4.2275633397012413, 4.6434859335969145 },
+	{ 3.0807948627961976, 400.15715972447714, 5.5007160988511465,
+		1913.3384802879659, 2146.851595037881, 1967.7569227846504,
+		2235.7804777192732, 4.2279977499009691, 4.6428912291288231 },
+	{ 3.0808733119298291, 399.96180072658626, 5.5014257796328918,
+		1913.5937816428275, 2146.5290885157601, 1968.0430165318253,
+		2235.4018919398491, 4.2284340938826812, 4.6422943382160868 },
+	{ 3.0809517640411346, 399.76557141662545, 5.5021379945848032,
+		1913.8501918119066, 2146.2053497519651, 1968.3303684264497,
+		2235.0218838759879, 4.2288723768347527, 4.641695259079353 },
+	{ 3.0810302191461458, 399.56847068042686, 5.502852747053133,
+		1914.1077134592335, 2145.8803775197475, 1968.6189817567874,
+		2234.6404523776073, 4.2293126037122919, 4.6410939900549231 },
+	{ 3.0811086772609655, 399.37049753237125, 5.5035700402680909,
+		1914.3663491123866, 2145.5541706551148, 1968.9088596607883,
+		2234.257596369795, 4.229754779237167, 4.6404905295952403 },
+	{ 3.0811871384018192, 399.17165111772681, 5.5042898773483637,
+		1914.6261011595711, 2145.226728054623, 1969.2000051227972,
+		2233.8733148502029, 4.2301989078928788, 4.6398848762648157 },
+	{ 3.0812656025850296, 398.97193071290695, 5.5050122613013759,
+		1914.8869718492272, 2144.8980486752616, 1969.4924209729968,
+		2233.4876068888771, 4.2306449939238053, 4.6392770287399498 },
+	{ 3.0813440698270367, 398.77133572641941, 5.5057371950248646,
+		1915.1489632887574, 2144.5681315336988, 1969.7861098859144,
+		2233.1004716273555, 4.2310930413329384, 4.6386669858073022 },
+	{ 3.081422540144338, 398.56986569999674, 5.5064646813062517,
+		1915.412077443063, 2144.2369757065912, 1970.0810743786897,
+		2232.7119082790109, 4.2315430538792578, 4.6380547463644017 },
+	{ 3.0815010135535914, 398.36752030931495, 5.507194722828741,
+		1915.6763161335443, 2143.9045803275858, 1970.3773168098705,
+		2232.3219161255006, 4.2319950350759301, 4.6374403094141137 },
+	{ 3.0815794900715083, 398.16429936457695, 5.5079273221673368,
+		1915.9416810372618, 2143.5709445893299, 1970.6748393783766,
+		2231.9304945191079, 4.2324489881887795, 4.6368236740682471 },
+	{ 3.0816579697149491, 397.96020281205381, 5.5086624817964269,
+		1916.2081736849459, 2143.2360677396919, 1970.9736441211976,
+		2231.5376428782815, 4.2329049162327541, 4.6362048395406177 },
+	{ 3.0817364525008348, 397.75523073380691, 5.5094002040845877,
+		1916.4757954611518, 2142.8999490843817, 1971.2737329134532,
+		2231.1433606906899, 4.233362821972114, 4.6355838051517528 },
+	{ 3.0818149384462283, 397.54938334947394, 5.510140491302181,
+		1916.7445476019816, 2142.5625879831905, 1971.5751074657671,
+		2230.7476475087833, 4.2338227079164037, 4.6349605703219954 },
+	{ 3.0818934275682781, 397.34266101606448, 5.5108833456198498,
+		1917.0144311951237, 2142.2239838507376, 1971.877769324195,
+		2230.3505029506473, 4.234284576320424, 4.6343351345727957 },
+	{ 3.0819719198842557, 397.13506422942214, 5.5116287691110957,
+		1917.2854471779551, 2141.8841361552268, 1972.1817198680183,
+		2229.9519266985235, 4.2347484291808675, 4.6337074975244041 },
+	{ 3.082050415411536, 396.92659362429555, 5.5123767637537622,
+		1917.5575963372337, 2141.5430444177182, 1972.4869603092977,
+		2229.5519184979275, 4.2352142682356817, 4.6330776588944698 },
+	{ 3.0821289141676034, 396.71724997545937, 5.5131273314315186,
+		1917.8308793075582, 2141.200708211406, 1972.7934916910444,
+		2229.1504781567851, 4.2356820949613248, 4.6324456184966882 },
+	{ 3.0822074161700597, 396.50703419749357, 5.5138804739362621,
+		1918.1052965714121, 2140.8571271604337, 1973.1013148871693,
+		2228.7476055440143, 4.2361519105727323, 4.6318113762385815 },
+	{ 3.0822859214365939, 396.29594734605678, 5.5146361929676271,
+		1918.3808484574581, 2140.51230094016, 1973.4104306004688,
+		2228.3433005898196, 4.2366237160202678, 4.6311749321219251 },
+	{ 3.0823644299850406, 396.08399061834831, 5.5153944901389531,
+		1918.6575351396973, 2140.1662292742094, 1973.7208393615904,
+		2227.9375632822066, 4.2370975119881749, 4.6305362862373238 },
+	{ 3.0824429418333246, 395.8711653530097, 5.5161553669747363,
+		1918.9353566373859, 2139.8189119357435, 1974.0325415288125,
+		2227.5303936684518, 4.2375732988943335, 4.629895438766483 },
+	{ 3.0825214569995061, 395.65747303114847, 5.5169188249156154,
+		1919.2143128135547, 2139.4703487450129, 1974.3455372863023,
+		2227.1217918522107, 4.2380510768875759, 4.6292523899776805 },
+	{ 3.0825999755017359, 395.44291527645947, 5.5176848653175528,
+		1919.4944033745858, 2139.1205395697507, 1974.6598266435178,
+		2226.7117579939595, 4.2385308458468725, 4.6286071402264621 },
+	{ 3.0826784973582972, 395.22749385564128, 5.5184534894555419,
+		1919.7756278694803, 2138.7694843233735, 1974.9754094342904,
+		2226.300292308857, 4.2390126053799415, 4.6279596899522781 },
+	{ 3.0827570225875776, 395.01121067861965, 5.5192246985242779,
+		1920.0579856892753, 2138.4171829646357, 1975.2922853160508,
+		2225.8873950663287, 4.2394963548221343, 4.6273100396778295 },
+	{ 3.082835551208106, 394.79406779950307, 5.5199984936422375,
+		1920.3414760656635, 2138.0636354956378, 1975.6104537681845,
+		2225.4730665876968, 4.2399820932339383, 4.6266581900053856 },
+	{ 3.0829140832385176, 394.57606741572391, 5.5207748758503818,
+		1920.6260980716625, 2137.708841962457, 1975.9299140926639,
+		2225.057307246911, 4.2404698194020209, 4.6260041416178845 },
+	{ 3.0829926186975474, 394.35721186895557, 5.5215538461153315,
+		1920.911850620261, 2137.3528024536031, 1976.2506654124129,
+		2224.6401174687121, 4.2409595318367765, 4.6253478952760689 },
+	{ 3.0830711576040879, 394.13750364556114, 5.5223354053329023,
+		1921.1987324635461, 2136.9955170982666, 1976.5727066702293,
+		2224.2214977265544, 4.241451228770698, 4.624689451815259 },
+	{ 3.083149699977128, 393.91694537615535, 5.5231195543277849,
+		1921.4867421929118, 2136.6369860664786, 1976.8960366288927,
+		2223.8014485427811, 4.2419449081586178, 4.6240288121455899 },
+	{ 3.083228245835794, 393.69553983617709, 5.523906293856637,
+		1921.775878238022, 2136.2772095675973, 1977.2206538698972,
+		2223.3799704868243, 4.2424405676757964, 4.6233659772492173 },
+	{ 3.0833067951993214, 393.47328994551759, 5.5246956246094854,
+		1922.0661388669312, 2135.9161878496129, 1977.5465567934611,
+		2222.9570641743735, 4.2429382047180253, 4.6227009481790118 },
+	{ 3.0833853480870839, 393.25019876916889, 5.5254875472126095,
+		1922.3575221849351, 2135.5539211977343, 1977.873743617133,
+		2222.532730265696, 4.2434378163994895, 4.6220337260559239 },
+	{ 3.0834639045185823, 393.02626951669635, 5.5262820622298943,
+		1922.6500261348742, 2135.1904099337148, 1978.2022123760089,
+		2222.1069694648331, 4.2439393995531924, 4.6213643120677466 },
+	{ 3.0835424645134317, 392.80150554304834, 5.5270791701646127,
+		1922.9436484957412, 2134.8256544149867, 1978.531960921056,
+		2221.6797825185636, 4.2444429507284136, 4.6206927074674615 },
+	{ 3.0836210280913892, 392.57591034710612, 5.5278788714621756,
+		1923.2383868840914, 2134.4596550332958, 1978.862986920572,
+		2221.2511702147854, 4.244948466193029, 4.6200189135707523 },
+	{ 3.0836995952723307, 392.34948757309695, 5.5286811665113627,
+		1923.5342387518895, 2134.0924122141014, 1979.1952878576649,
+		2220.8211333817962, 4.2454559419296478, 4.6193429317548445 },
+	{ 3.083778166076268, 392.12224100962834, 5.5294860556467942,
+		1923.8312013873531, 2133.7239264153677, 1979.5288610310647,
+		2220.3896728868585, 4.2459653736369569, 4.6186647634562785 },
+	{ 3.0838567405233466, 391.89417458967455, 5.5302935391522645,
+		1924.1292719144756, 2133.3541981258923, 1979.8637035544805,
+		2219.956789634221, 4.2464767567287591, 4.6179844101678373 },
+	{ 3.0839353186338396, 391.66529239092921, 5.5311036172597046,
+		1924.4284472922279, 2132.9832278658487, 1980.1998123555857,
+		2219.522484565744, 4.2469900863324632, 4.6173018734394802 },
+	{ 3.0840139004281464, 391.43559863410081, 5.5319162901545091,
+		1924.7287243161513, 2132.6110161841348, 1980.5371841776775,
+		2219.086758657772, 4.2475053572917139, 4.6166171548735093 },
+	{ 3.0840924859268326, 391.20509768521805, 5.5327315579771339,
+		1925.0300996151886, 2132.2375636576053, 1980.8758155760156,
+		2218.6496129202174, 4.2480225641607694, 4.6159302561231152 },
+	{ 3.0841710751505631, 390.97379405267839, 5.5335494208226583,
+		1925.3325696547215, 2131.8628708912734, 1981.2157029210916,
+		2218.2110483967831, 4.2485417012096267, 4.6152411788927221 },
+	{ 3.0842496681201563, 390.74169238856672, 5.5343698787458981,
+		1925.6361307345667, 2131.4869385157967, 1981.5568423962848,
+		2217.7710661620031, 4.2490627624204214, 4.6145499249333835 },
+	{ 3.0843282648565622, 390.50879748743114, 5.5351929317618129,
+		1925.9407789899785, 2131.1097671872644, 1981.8992299988433,
+		2217.3296673209747, 4.2495857414890308, 4.6138564960423603 },
+	{ 3.0844068653808825, 390.27511428697642, 5.5360185798494577,
+		1926.2465103903178, 2130.7313575852613, 1982.2428615382846,
+		2216.8868530070804, 4.2501106318226327, 4.6131608940595772 },
+	{ 3.0844854697143491, 390.04064786662815, 5.5368468229520023,
+		1926.5533207402943, 2130.3517104128441, 1982.587732637676,
+		2216.442624381943, 4.2506374265417159, 4.6124631208675426 },
+	{ 3.0845640778783427, 389.80540344747197, 5.5376776609810108,
+		1926.8612056795741, 2129.9708263944367, 1982.9338387330581,
+		2215.9969826329525, 4.2511661184792642, 4.611763178387501 },
+	{ 3.0846426898943813, 389.5693863917345, 5.5385110938171067,
+		1927.1701606828433, 2129.5887062754978, 1983.2811750734072,
+		2215.549928972855, 4.2516967001807426, 4.6110610685788007 },
+	{ 3.0847213057841181, 389.3326022023677, 5.5393471213119687,
+		1927.4801810598465, 2129.2053508215386, 1983.6297367205548,
+		2215.1014646385997, 4.2522291639039995, 4.610356793437079 },
+	{ 3.084799925569381, 389.09505652248953, 5.5401857432942156,
+		1927.7912619554927, 2128.8207608152043, 1983.9795185491944,
+		2214.651590887901, 4.2527635016193432, 4.6096503549889452 },
+	{ 3.0848785492721116, 388.85675513475263, 5.5410269595655386,
+		1928.1033983501245, 2128.434937058204, 1984.3305152470607,
+		2214.2003090014919, 4.25329970500984, 4.6089417552954499 },
+	{ 3.0849571769144193, 388.61770396057443, 5.5418707699086953,
+		1928.4165850598451, 2128.0478803673468, 1984.6827213151744,
+		2213.7476202784687, 4.2538377654717676, 4.6082309964448687 },
+	{ 3.0850358085185552, 388.37790905993069, 5.5427171740870333,
+		1928.730816736268, 2127.659591574768, 1985.0361310674537,
+		2213.2935260365521, 4.254377674114016, 4.6075180805530991 },
+	{ 3.0851144441069276, 388.13737663033322, 5.5435661718468952,
+		1929.0460878671922, 2127.2700715267652, 1985.3907386313426,
+		2212.8380276107027, 4.2549194217591273, 4.60680300976151 },
+	{ 3.0851930837020864, 387.89611300639126, 5.5444177629201317,
+		1929.3623927765011, 2126.8793210825397, 1985.7465379475952,
+		2212.38112635165, 4.2554629989429893, 4.6060857862346527 },
+	{ 3.0852717273267389, 387.65412465861209, 5.5452719470274516,
+		1929.6797256250943, 2126.4873411125382, 1986.1035227711884,
+		2211.9228236239364, 4.2560083959162922, 4.6053664121572266 },
+	{ 3.0853503750037468, 387.411418193109, 5.5461287238790975,
+		1929.9980804106242, 2126.0941324981291, 1986.4616866709266,
+		2211.4631208055303, 4.2565556026439513, 4.6046448897334802 },
+	{ 3.0854290267561439, 387.16800035117797, 5.5469880931798299,
+		1930.3174509674168, 2125.6996961291334, 1986.8210230292357,
+		2211.0020192849297, 4.2571046088048003, 4.6039212211826976 },
+	{ 3.0855076826070884, 386.92387800717864, 5.5478500546268403,
+		1930.6378309684183, 2125.3040329048517, 1987.1815250442214,
+		2210.5395204623587, 4.2576554037948533, 4.6031954087410769 },
+	{ 3.0855863425799215, 386.67905816901521, 5.5487146079172129,
+		1930.9592139240315, 2124.9071437303837, 1987.5431857282638,
+		2210.0756257454482, 4.2582079767251244, 4.6024674546550122 },
+	{ 3.0856650066981355, 386.43354797664114, 5.5495817527470814,
+		1931.2815931832604, 2124.5090295170412, 1987.905997909186,
+		2209.6103365497229, 4.258762316423482, 4.6017373611818462 },
+	{ 3.0857436749853839, 386.18735470103326, 5.5504514888148249,
+		1931.6049619343712, 2124.1096911807717, 1988.2699542308796,
+		2209.1436542967404, 4.2593184114356424, 4.601005130586997 },
+	{ 3.0858223474654833, 385.94048574411528, 5.5513238158242775,
+		1931.9293132043063, 2123.7091296405615, 1988.6350471525461,
+		2208.6755804122249, 4.2598762500240266, 4.6002707651410537 },
+	{ 3.0859010241624252, 385.69294863640147, 5.552198733486323,
+		1932.25463986093, 2123.3073458176641, 1989.0012689510995,
+		2208.2061163251601, 4.2604358201714954, 4.5995342671183677 },
+	{ 3.0859797051003328, 385.44475103730497, 5.5530762415202171,
+		1932.5809346119593, 2122.9043406349274, 1989.3686117198617,
+		2207.7352634669974, 4.260997109579379, 4.5987956387958295 },
+	{ 3.086058390303549, 385.19590073351401, 5.5539563396610454,
+		1932.9081900063175, 2122.5001150131293, 1989.7370673699743,
+		2207.2630232673655, 4.2615601056696555, 4.5980548824462204 },
+	{ 3.0861370797965364, 384.94640563804819, 5.5548390276543858,
+		1933.2363984346005, 2122.0946698735975, 1990.1066276308168,
+		2206.7893971571366, 4.2621247955856312, 4.5973120003429502 },
+	{ 3.0862157736039495, 384.69627378907677, 5.5557243052654393,
+		1933.5655521298097, 2121.6880061337133, 1990.4772840507233,
+		2206.3143865631596, 4.2626911661930773, 4.5965669947519183 },
+	{ 3.0862944717506107, 384.44551334912762, 5.5566121722787729,
+		1933.8956431676688, 2121.2801247070224, 1990.8490279972334,
+		2205.8379929083981, 4.2632592040806294, 4.5958198679317093 },
+	{ 3.0863731742615252, 384.19413260387853, 5.5575026285014602,
+		1934.2266634673924, 2120.871026501698, 1991.2218506578511,
+		2205.3602176101272, 4.26382889556099, 4.5950706221308035 },
+	{ 3.0864518811618487, 383.94213996081112, 5.5583956737640916,
+		1934.5586047926074, 2120.460712420042, 1991.5957430409878,
+		2204.8810620793479, 4.2644002266723797, 4.5943192595866771 },
+	{ 3.0865305924769388, 383.689543948177, 5.55929130792624,
+		1934.8914587519403, 2120.049183355768, 1991.970695976506,
+		2204.400527717622, 4.264973183179424, 4.5935657825208986 },
+	{ 3.0865305924769437, 383.68954394826011, 5.5443141237786291,
+		1934.8914587518395, 2127.4450289420383, 1991.9706959763928,
+		2213.0550750483039, 4.264973183179249, 4.6069746321956835 },
+	{ 3.0865527816852572, 383.61823030375388, 5.5452775124821718,
+		1934.9854526858419, 2126.9773951479169, 1992.0765840608888,
+		2212.5076621756143, 4.2651349890337027, 4.6061237667513151 },
+	{ 3.086574971246991, 383.54686959394547, 5.5464619757873894,
+		1935.0795182711358, 2126.4005758170197, 1992.1825554691668,
+		2211.8324640200781, 4.2652969225711814, 4.6050749143015937 },
+	{ 3.0865971611627305, 383.47546201562074, 5.5478097225180738,
+		1935.1736553123642, 2125.7431737784864, 1992.2886099873165,
+		2211.0630097087487, 4.2654589834597845, 4.6038800473491364 },
+	{ 3.0866193514330389, 383.40400776513326, 5.5492737345964906,
+		1935.2678636146481, 2125.0284578654232, 1992.3947474019376,
+		2210.2265729312185, 4.2656211713684016, 4.6025814404652721 },
+	{ 3.0866415420585085, 383.3325070404988, 5.550815997822883,
+		1935.3621429809969, 2124.2752367880548, 1992.5009674972255,
+		2209.345194874355, 4.2657834859622357, 4.6012132554202507 },
+	{ 3.0866637330396967, 383.26096003976278, 5.5524060005380154,
+		1935.4564932143385, 2123.4986018797786, 1992.6072700572574,
+		2208.4365548989886, 4.2659459269063067, 4.5998028909234465 },
+	{ 3.0866859243771936, 383.18936696214416, 5.5540194603255042,
+		1935.5509141160971, 2122.7105577528127, 1992.7136548643884,
+		2207.5147105383312, 4.2661084938630003, 4.5983721300907163 },
+	{ 3.0867081160715948, 383.11772800781108, 5.5556372458730587,
+		1935.6454054864816, 2121.9205567168838, 1992.8201216995792,
+		2206.5907249578431, 4.2662711864925589, 4.5969381135584033 },
+	{ 3.0867303081234607, 383.04604337715261, 5.5572444652819382,
+		1935.7399671253552, 2121.1359509175913, 1992.9266703433718,
+		2205.6731979821698, 4.2664340044545899, 4.5955141630990779 },
+	{ 3.0867525005333891, 382.97431327136155, 5.5588296970032589,
+		1935.8345988315323, 2120.3623738404021, 1993.0333005750999,
+		2204.7687142085042, 4.2665969474068568, 4.5941104766418936 },
+	{ 3.0867746933019604, 382.90253789278995, 5.5603843425690966,
+		1935.9293004023641, 2119.604061415791, 1993.1400121724225,
+		2203.8822201472631, 4.2667600150045333, 4.5927347131876468 },
+	{ 3.086796886429755, 382.8307174439031, 5.5619020834925417,
+		1936.0240716349588, 2118.8641214184718, 1993.2468049126942,
+		2203.0173405676678, 4.2669232069023568, 4.5913924833949196 },
+	{ 3.086819079917364, 382.75885212845594, 5.5633784271913802,
+		1936.1189123248134, 2118.1447586529935, 1993.3536785714311,
+		2202.1766428430492, 4.2670865227522246, 4.5900877594802099 },
+	{ 3.0868412737653794, 382.68694215055564, 5.5648103287368578,
+		1936.2138222668998, 2117.4474624693644, 1993.4606329235239,
+		2201.3618569904334, 4.2672499622050921, 4.5888232163735401 },
+	{ 3.0868634679743892, 382.61498771533439, 5.5661958773040663,
+		1936.3088012548785, 2116.7731621339244, 1993.5676677423642,
+		2200.5740579096996, 4.2674135249096015, 4.5876005142283187 },
+	{ 3.0868856625449794, 382.54298902827242, 5.5675340375429041,
+		1936.4038490818964, 2116.1223549186202, 1993.6747828007287,
+		2199.8138155508882, 4.267577210513477, 4.5864205311792166 },
+	{ 3.0869078574777458, 382.47094629577293, 5.5688244376830216,
+		1936.4989655399154, 2115.4952109833416, 1993.7819778700371,
+		2199.0813178117155, 4.2677410186623437, 4.5852835538036159 },
+	{ 3.0869300527732717, 382.39885972475395, 5.5700671970123192,
+		1936.5941504201762, 2114.8916587144622, 1993.889252720862,
+		2198.3764704805644, 4.2679049490005454, 4.5841894319854068 },
+	{ 3.0869522484321665, 382.3267295232846, 5.5712627867689077,
+		1936.6894035124324, 2114.3114534879433, 1993.9966071220804,
+		2197.6989777225272, 4.2680690011698097, 4.5831377036104071 },
+	{ 3.0869744444550129, 382.25455589971949, 5.5724119188986281,
+		1936.7847246060303, 2113.7542326171997, 1994.1040408420743,
+		2197.048406357334, 4.2682331748111171, 4.5821276941348827 },
+	{ 3.0869966408424121, 382.18233906357062, 5.5735154584718902,
+		1936.880113488801, 2113.2195585803643, 1994.2115536474919,
+		2196.4242363955855, 4.2683974695627933, 4.5811585948547462 },
+	{ 3.0870188375949663, 382.11007922424074, 5.574574355485491,
+		1936.9755699486309, 2112.7069526507589, 1994.3191453050079,
+		2195.8259003295339, 4.2685618850632165, 4.5802295237472181 },
+	{ 3.0870410347132684, 382.03777659278643, 5.5755895930385968,
+		1937.0710937713086, 2112.2159204283821, 1994.4268155789166,
+		2195.2528129398979, 4.2687264209470888, 4.5793395716174885 },
+	{ 3.0870632321979157, 381.96543138010935, 5.5765621488272332,
+		1937.1666847427218, 2111.7459707888943, 1994.5345642335858,
+		2194.7043933990963, 4.2688910768492505, 4.5784878363108561 },
+	{ 3.0870854300495085, 381.8930437984867, 5.5774929676990892,
+		1937.2623426469934, 2111.296629371273, 1994.6423910313667,
+		2194.1800809872411, 4.2690558524014435, 4.5776734470313079 },
+	{ 3.0871076282686651, 381.82061406070039, 5.5783829430445468,
+		1937.3580672675396, 2110.8674477062577, 1994.7502957337822,
+		2193.6793457130084, 4.2692207472341472, 4.5768955807692446 },
+	{ 3.0871298268559673, 381.74814237985515, 5.5792329053585323,
+		1937.4538583873004, 2110.4580088105308, 1994.8582781017935,
+		2193.2016948064111, 4.2693857609769719, 4.5761534723370465 },
+	{ 3.0871520258120273, 381.67562897004439, 5.5800436166458356,
+		1937.549715787907, 2110.0679299040571, 1994.9663378948519,
+		2192.746675853713, 4.2695508932572253, 4.575446419206048 },
+	{ 3.0871742251374661, 381.6030740463454, 5.5808157691349871,
+		1937.645639249705, 2109.6968630085898, 1995.0744748709326,
+		2192.3138774611575, 4.269716143699946, 4.5747737825184123 },
+	{ 3.0871964248328712, 381.53047782394589, 5.5815499874220524,
+		1937.7416285528125, 2109.3444938615216, 1995.1826887877226,
+		2191.9029279554979, 4.2698815119297402, 4.5741349850607973 },
+	{ 3.0872186248988607, 381.45784051893952, 5.5822468333578046,
+		1937.8376834761355, 2109.0105394841307, 1995.2909794015159,
+		2191.5134925177581, 4.2700469975690751, 4.5735295068137987 },
+	{ 3.0872408253360391, 381.38516234826488, 5.5829068125776784,
+		1937.9338037974612, 2108.6947449461782, 1995.3993464673099,
+		2191.145269382996, 4.2702126002384304, 4.5729568790569761 },
+	{ 3.0872630261450138, 381.31244352914905, 5.5835303823853417,
+		1938.0299892941362, 2108.396879469261, 1995.5077897395756,
+		2190.7979852723024, 4.2703783195574925, 4.5724166772867259 },
+	{ 3.0872852273264044, 381.23968427993015, 5.5841179604426845,
+		1938.1262397420321, 2108.116732138013, 1995.6163089710956,
+		2190.4713903708575, 4.2705441551433427, 4.5719085134328834 },
+	{ 3.087307428880826, 381.16688481952838, 5.5846699337527559,
+		1938.2225549162197, 2107.8541074712621, 1995.7249039137146,
+		2190.1652531459104, 4.2707101066116406, 4.571432027828819 },
+	{ 3.0873296308088909, 381.09404536731267, 5.5851866677793227,
+		1938.3189345911283, 2107.6088209295431, 1995.8335743185237,
+		2189.8793550934283, 4.270876173576883, 4.5709868810722849 },
+	{ 3.0873518331112102, 381.02116614329117, 5.5856685153845325,
+		1938.4153785402864, 2107.3806945150145, 1995.9423199355656,
+		2189.6134855950299, 4.2710423556519794, 4.5705727460580645 },
+	{ 3.0873740357884052, 380.94824736849966, 5.5861158253690233,
+		1938.5118865358777, 2107.1695525691157, 1996.0511405133393,
+		2189.3674370076251, 4.2712086524474522, 4.570189300371716 },
+	{ 3.0873962388410905, 380.87528926424051, 5.5865289505464037,
+		1938.6084583496429, 2106.9752178008198, 1996.1600357998127,
+		2189.1410000236392, 4.271375063573025, 4.5698362191029531 },
+	{ 3.0874184422698852, 380.80229205271564, 5.5869082551800906,
+		1938.7050937521369, 2106.7975076294024, 1996.2690055415826,
+		2188.9339593992422, 4.2715415886363211, 4.5695131682292942 },
+	{ 3.0874406460754158, 380.72925595671666, 5.5872541217456764,
+		1938.8017925130625, 2106.636230859167, 1996.3780494842542,
+		2188.7460900705432, 4.2717082272434412, 4.5692197986007299 },
+	{ 3.0874628502583019, 380.65618119969957, 5.587566956905123,
+		1938.8985544012216, 2106.4911847414978, 1996.4871673723892,
+		2188.5771537219252, 4.271874978998885, 4.5689557406246672 },
+	{ 3.0874850548191675, 380.58306800572802, 5.5878471968150585,
+		1938.9953791845469, 2106.3621523636507, 1996.5963589495336,
+		2188.4268957355371, 4.2720418435056073, 4.5687205995411135 },
+	{ 3.0875072597586355, 380.50991659962517, 5.5880953115883658,
+		1939.0922666299473, 2106.2489004527056, 1996.7056239580477,
+		2188.2950426247771, 4.2722088203647379, 4.5685139514472155 },
+	{ 3.0875294650773211, 380.43672720640012, 5.5883118090600901,
+		1939.1892165039721, 2106.1511775201084, 1996.8149621398511,
+		2188.1812998645582, 4.2723759091767546, 4.5683353399360547 },
+	{ 3.0875516707758668, 380.3635000525253, 5.5884972378019251,
+		1939.2862285712933, 2106.0687123739499, 1996.9243732347227,
+		2188.0853501498373, 4.2725431095388169, 4.5681842733983791 },
+	{ 3.087573876854897, 380.29023536433243, 5.5886521893818397,
+		1939.383302596611, 2106.0012130003961, 1997.0338569824319,
+		2188.0068520838968, 4.2727104210481137, 4.5680602229895122 },
+	{ 3.0875960833150411, 380.21693336942297, 5.5887773000476342,
+		1939.4804383429798, 2105.948365726455, 1997.1434131208675,
+		2187.9454391938966, 4.2728778432989145, 4.5679626211027546 },
+	{ 3.0876182901569282, 380.14359429555088, 5.5888732516636042,
+		1939.5776355731457, 2105.9098347477679, 1997.2530413875324,
+		2187.9007193712146, 4.2730453758849274, 4.567890860500226 },
+	{ 3.0876404973811846, 380.07021837115263, 5.5889407721769109,
+		1939.6748940488851, 2105.8852618856872, 1997.3627415188055,
+		2187.8722745783007, 4.2732130183981338, 4.5678442938561012 },
+	{ 3.0876627049884569, 379.99680582567811, 5.5889806354658482,
+		1939.7722135306317, 2105.8742666462858, 1997.4725132495169,
+		2187.8596609067472, 4.2733807704281359, 4.567822233843355 },
+	{ 3.0876849129793689, 379.92335688881769, 5.5889936606952935,
+		1939.8695937783907, 2105.8764465198133, 1997.582356313985,
+		2187.8624089149644, 4.2735486315637612, 4.5678239536531811 },
+	{ 3.0877071213545624, 379.84987179098971, 5.5889807112612502,
+		1939.967034551167, 2105.8913774806356, 1997.6922704453639,
+		2187.8800241988974, 4.2737166013920449, 4.5678486878750011 },
+	{ 3.0877293301146671, 379.77635076328346, 5.5889426933140642,
+		1940.0645356070024, 2105.918614692861, 1997.8022553756903,
+		2187.9119882020018, 4.2738846794983179, 4.5678956337467129 },
+	{ 3.0877515392603256, 379.70279403742819, 5.5888805539293474,
+		1940.1620967030501, 2105.9576933880589, 1997.9123108359606,
+		2187.9577592253709, 4.2740528654663246, 4.5679639527146589 },
+	{ 3.0877737487921784, 379.62920184557771, 5.5887952789569297,
+		1940.2597175958094, 2106.0081299003664, 1998.0224365564025,
+		2188.0167736210487, 4.2742211588786265, 4.5680527722770581 },
+	{ 3.0877959587108692, 379.55557442074996, 5.5886878906089592,
+		1940.3573980405927, 2106.0694228292323, 1998.1326322658765,
+		2188.0884471339336, 4.2743895593156873, 4.5681611880574415 },
+	{ 3.0878181690170425, 379.48191199652166, 5.588559444852879,
+		1940.4551377918881, 2106.1410542978228, 1998.2428976922749,
+		2188.1721763551668, 4.2745580663564962, 4.5682882660505921 },
+	{ 3.0878403797113294, 379.40821480693984, 5.5884110285332627,
+		1940.5529366034866, 2106.222491344623, 1998.3532325626734,
+		2188.2673403308918, 4.2747266795787855, 4.5684330451090451 },
+	{ 3.0878625907943889, 379.33448308669983, 5.5882437564479766,
+		1940.6507942282676, 2106.3131873378011, 1998.4636366030791,
+		2188.3733021977841, 4.2748953985586633, 4.5685945394710563 },
+	{ 3.0878848022668532, 379.26071707112703, 5.5880587682081098,
+		1940.7487104181862, 2106.4125834963161, 1998.5741095384283,
+		2188.4894109433949, 4.2750642228705926, 4.5687717414818492 },
+	{ 3.0879070141293816, 379.18691699617665, 5.5878572250909961,
+		1940.846684924295, 2106.5201104152261, 1998.6846510926032,
+		2188.6150031718921, 4.2752331520874183, 4.5689636243233487 },
+	{ 3.0879292263826219, 379.11308309862511, 5.5876403067690541,
+		1940.9447174965051, 2106.6351896529936, 1998.795260988169,
+		2188.7494049426932, 4.275402185779968, 4.5691691448568852 },
+	{ 3.0879292263826237, 384.12781273038593, 5.5876403067695177,
+		1934.8384822472631, 2106.6351896527685, 1991.9474172285068,
+		2188.7494049424304, 4.2647904340178151, 4.5691691448564775 },
+	{ 3.0879764818278601, 381.58948000750797, 5.587133173179744,
+		1937.9375064575784, 2106.9024426628635, 1995.42198852868,
+		2189.0615026911996, 4.2701707180071891, 4.5696468849025678 },
+	{ 3.0880237390505929, 379.44965820486044, 5.5865735323889689,
+		1940.5654076537621, 2107.195500645063, 1998.3717414802002,
+		2189.4037115939818, 4.274736202386312, 4.5701712409931883 },
+	{ 3.0880709980571215, 377.64472093343807, 5.5859731410410811,
+		1942.794121540835, 2107.5085962823046, 2000.8758297696193,
+		2189.7693102637877, 4.2786102509172634, 4.570731809307798 },
+	{ 3.088118258853787, 376.1225350184946, 5.5853437219199487,
+		1944.6832736873898, 2107.8359770610541, 2003.0001357261799,
+		2190.1515932728239, 4.2818953876162071, 4.5713182104411931 },
+	{ 3.088165521446955, 374.84021253390898, 5.5846968358456728,
+		1946.2824466310019, 2108.1719678862182, 2004.7996302319584,
+		2190.5439439648835, 4.2846770589113392, 4.5719202020495251 },
+	{ 3.0882127858430115, 373.76233517731941, 5.5840437635939892,
+		1947.6329948930515, 2108.5110289360537, 2006.3202891941298,
+		2190.9399018216491, 4.2870266672819071, 4.5725277830944488 },
+	{ 3.088260052048367, 372.85954108889223, 5.5833953992268368,
+		1948.7695127172717, 2108.8478080649934, 2007.6006612304091,
+		2191.3332235716634, 4.2890040398837215, 4.5731312884294546 },
+	{ 3.0883073200694824, 372.10739279943641, 5.5827621559454936,
+		1949.7210298505049, 2109.1771871914434, 2008.6731567515144,
+		2191.7179373767581, 4.2906594506379703, 4.573721472697172 },
+	{ 3.0883545899128331, 371.48546540416442, 5.5821538847755123,
+		1950.5119910041776, 2109.4943224967037, 2009.5651117663624,
+		2192.0883898810393, 4.2920352841428517, 4.5742895832023471 },
+	{ 3.088401861584908, 370.97660882356928, 5.5815798063407369,
+		1951.1630610964303, 2109.7946782838185, 2010.2996677739602,
+		2192.4392859313871, 4.2931674089414065, 4.5748274214611779 },
+	{ 3.0884491350922509, 370.56634876180055, 5.5810484554552495,
+		1951.6917888635833, 2110.0740546035049, 2010.8965004674708,
+		2192.7657210782286, 4.2940863129532785, 4.5753273935911105 },
+	{ 3.0884964104414157, 370.24239893086832, 5.5805676380908329,
+		1952.1131545124708, 2110.3286088390528, 2011.3724235168013,
+		2193.0632070636266, 4.2948180430707943, 4.5757825498567826 },
+	{ 3.0885436876389991, 369.99426311724937, 5.5801444001442704,
+		1952.440021866289, 2110.5548715089285, 2011.741888685425,
+		2193.3276905819403, 4.2953849826719699, 4.5761866138087814 },
+	{ 3.0885909666916049, 369.81291014050441, 5.5797850072444044,
+		1952.6835115736105, 2110.7497566391294, 2012.0173997365714,
+		2193.5555657081181, 4.2958064946155696, 4.5765340016217815 },
+	{ 3.088638247605894, 369.6905082413528, 5.5794949347317875,
+		1952.8533088516751, 2110.9105671129555, 2012.2098544764581,
+		2193.7436804551216, 4.2960994522825295, 4.5768198323418021 },
+	{ 3.0886855303885397, 369.62020807416548, 5.579278866911201,
+		1952.9579168637556, 2111.0349954254093, 2012.328826869455,
+		2193.8893379466749, 4.2962786773713386, 4.5770399297909448 },
+	{ 3.0887328150462436, 369.59596559697837, 5.5791407047075916,
+		1953.0048648579493, 2111.1211202578697, 2012.3827991140199,
+		2193.9902926802483, 4.2963572999095332, 4.5771908168611777 },
+	{ 3.0887801015857463, 369.61239776603185, 5.5790835807691366,
+		1953.0008786688559, 2111.1673993349846, 2012.3793519700289,
+		2194.044742411555, 4.2963470534180201, 4.5772697030165688 },
+	{ 3.0888273900138139, 369.66466525675901, 5.5791098810537427,
+		1952.9520198961691, 2111.1726590323224, 2012.3253202609953,
+		2194.0513162018601, 4.2962585160150555, 4.5772744658398841 },
+	{ 3.0888746803372311, 369.74837747019291, 5.579221272099967,
+		1952.8637990355953, 2111.1360811254308, 2012.2269193624277,
+		2194.0090590808104, 4.2961013065022948, 4.5772036273228522 },
+	{ 3.0889219725628481, 369.85951592854371, 5.579418733055971,
+		1952.741266967256, 2111.0571871357402, 2012.0898475473618,
+		2193.9174138551953, 4.2958842430048332, 4.5770563257208039 },
+	{ 3.0889692666974926, 369.99437282519938, 5.5797025917433514,
+		1952.5890885132123, 2110.9358206311213, 2011.91936830687,
+		2193.7762004820461, 4.2956154705608656, 4.5768322836194786 },
+	{ 3.0890165627480637, 370.14950207785745, 5.5800725639185913,
+		1952.4116011416911, 2110.7721278965269, 2011.7203760685381,
+		2193.585593493337, 4.2953025629740784, 4.5765317729692496 },
+	{ 3.089063860721486, 370.32168064776471, 5.5805277951051018,
+		1952.2128614455232, 2110.5665372880908, 2011.4974482424616,
+		2193.346097841852, 4.2949526034733001, 4.5761555776603053 },
+	{ 3.0891111606246926, 370.50787829038484, 5.5810669043564509,
+		1951.996681566668, 2110.3197375911045, 2011.2548860204397,
+		2193.058523547038, 4.2945722479407138, 4.5757049542271524 },
+	{ 3.0891584624646722, 370.7052341940223, 5.5816880292625761,
+		1951.7666574080654, 2110.032655726925, 2010.9967459878981,
+		2192.7239595492088, 4.2941677739009503, 4.5751815913169036 },
+	{ 3.0892057662484405, 370.91103921616929, 5.5823888718461161,
+		1951.5261901799631, 2109.7064339893527, 2010.7268642811825,
+		2192.3437469889777, 4.2937451179558748, 4.5745875682595134 },
+	{ 3.0892530719830296, 371.12272264356642, 5.5831667446988611,
+		1951.2785025730059, 2109.3424071373133, 2010.4488747384801,
+		2191.91945229976, 4.2933099039087725, 4.5739253133430324 },
+	{ 3.089300379675505, 371.33784257209254, 5.5840186170534647,
+		1951.0266506475668, 2108.9420795009451, 2010.1662222660652,
+		2191.452840303109, 4.2928674634702988, 4.573197562090173 },
+	{ 3.0893476893329912, 371.55407915023551, 5.5849411603299819,
+		1950.7735323509553, 2108.5071023344922, 2009.8821724422064,
+		2190.9458475855258, 4.2924228511295501, 4.5724073159700422 },
+	{ 3.0893950009626105, 371.76923005286511, 5.5859307928990543,
+		1950.5218934242309, 2108.0392515497369, 2009.5998182128346,
+		2190.4005563186929, 4.2919808545131835, 4.5715578017979963 },
+	{ 3.0894423145715306, 371.98120765437216, 5.5869837237523674,
+		1950.2743313350807, 2107.5404059884122, 2009.322084392162,
+		2189.8191687134181, 4.2915460013372462, 4.5706524321203092 },
+	{ 3.0894896301669625, 372.18803745693458, 5.5880959947263742,
+		1950.0332977663618, 2107.0125264134422, 2009.0517305612227,
+		2189.2039823219498, 4.2911225638702932, 4.5696947669176193 },
+	{ 3.089536947756141, 372.38785740467051, 5.5892635212742547,
+		1949.8011000972297, 2106.4576352269396, 2008.7913528527363,
+		2188.5573662020665, 4.2907145616647071, 4.568688476649335 },
+	{ 3.0895842673463236, 372.57891777498702, 5.5904821314169695,
+		1949.5799022391507, 2105.8777971009595, 2008.5433850266368,
+		2187.8817381633808, 4.2903257631830964, 4.5676373069813865 },
+	{ 3.0896315889448145, 372.75958139298092, 5.5917476028410924,
+		1949.3717251216722, 2105.2751005410837, 2008.310099164556,
+		2187.1795431219603, 4.2899596868289294, 4.5665450452383558 },
+	{ 3.0896789125589295, 372.92832396121014, 5.5930556979468848,
+		1949.1784470661175, 2104.6516404827253, 2008.0936062475464,
+		2186.4532326817548, 4.2896196017918413, 4.5654154887639136 },
+	{ 3.0897262381960631, 373.08373433399612, 5.5944021968011866,
+		1949.0018042403296, 2104.0095019450923, 2007.8958568307628,
+		2185.7052459731913, 4.2893085290396122, 4.5642524152366164 },
+	{ 3.0897735658635939, 373.22451460452231, 5.5957829279603155,
+		1948.8433913406543, 2103.3507447620341, 2007.7186419758311,
+		2184.9379917719534, 4.2890292427070413, 4.5630595549765607 },
+	{ 3.0898208955689568, 373.34947989450177, 5.5971937969809282,
+		1948.7046626218191, 2102.6773894801645, 2007.5635945732438,
+		2184.1538320033314, 4.2887842720879092, 4.5618405654056016 },
+	{ 3.0898682273196214, 373.45755777070519, 5.5986308127464053,
+		1948.5869333547341, 2101.9914043624067, 2007.4321911413783,
+		2183.3550665594521, 4.2885759043654739, 4.5605990075480625 },
+	{ 3.0899155611230804, 373.54778722821055, 5.6000901115024391,
+		1948.4913817742899, 2101.2946935488799, 2007.3257541690107,
+		2182.5439194888768, 4.2884061881863129, 4.5593383246632575 },
+	{ 3.0899628969868798, 373.61931720259884, 5.6015679786029837,
+		1948.419051554125, 2100.5890863738332, 2007.2454550401533,
+		2181.7225265555912, 4.2882769381388508, 4.558061823004377 },
+	{ 3.0900102349185792, 373.67140459055236, 5.6030608680558149,
+		1948.3708548255674, 2099.8763277935109, 2007.1923175582663,
+		2180.8929241130113, 4.2881897401640403, 4.5567726546186238 },
+	{ 3.0900575749257784, 373.70341177053911, 5.6045654197839241,
+		1948.3475757453541, 2099.1580699641727, 2007.1672220731289,
+		2180.0570393366543, 4.2881459579042502, 4.5554738022552144 },
+	{ 3.0901049170161174, 373.71480363045083, 5.6060784747541321,
+		1948.3498745995187, 2098.4358648936982, 2007.1709101947856,
+		2179.2166817240063, 4.2881467399669511, 4.5541680662387236 },
+	{ 3.0901522611972787, 373.70514411866031, 5.607597087951528,
+		1948.3782924213324, 2097.7111581746103, 2007.2039900686964,
+		2178.3735358683771, 4.2881930280637599, 4.5528580533172294 },
+	{ 3.0901996074769538, 373.67409234431295, 5.6091185392619636,
+		1948.4332560912521, 2096.9852837649755, 2007.2669421755893,
+		2177.5291554652017, 4.2882855659686454, 4.5515461674201889 },
+	{ 3.0902469558628969, 373.62139825978659, 5.6106403423775886,
+		1948.5150838796542, 2096.2594597577054, 2007.3601256118559,
+		2176.6849584791503, 4.2884249092271212, 4.550234602214192 },
+	{ 3.0902943063628854, 373.54689796620835, 5.6121602517083851,
+		1948.6239913848515, 2095.5347851431202, 2007.4837847974629,
+		2175.8422234752966, 4.2886114355342144, 4.5489253354609085 },
+	{ 3.0903416589847277, 373.45050868593512, 5.6136762674630365,
+		1948.760097816498, 2094.812237481578, 2007.6380565559962,
+		2175.0020870152116, 4.2888453556953428, 4.5476201250230845 },
+	{ 3.0903890137362842, 373.33222345123107, 5.6151866389410801,
+		1948.9234325688039, 2094.0926714620691, 2007.8229775054751,
+		2174.1655420877814, 4.2891267250745884, 4.5463205064712442 },
+	{ 3.0904363706254263, 373.19210556043782, 5.6166898660830462,
+		1949.1139420264742, 2093.3768183206835, 2008.0384916970954,
+		2173.333437542397, 4.2894554554325595, 4.5450277922404512 },
+	{ 3.0904837296600896, 373.03028285560822, 5.6181846994434697,
+		1949.3314965434308, 2092.6652860351196, 2008.2844584360964,
+		2172.5064784251122, 4.2898313270513411, 4.543743072182961 },
+	{ 3.0905310908482271, 372.84694187452055, 5.619670138636617,
+		1949.5758975362119, 2091.9585602678653, 2008.5606602211808,
+		2171.6852271843668, 4.2902540010472725, 4.5424672154645771 },
+	{ 3.0905784541978436, 372.64232193332015, 5.6211454292874752,
+		1949.8468846300864, 2091.2570060393923, 2008.8668107346282,
+		2170.8701057230878, 4.2907230317658094, 4.5412008737686893 },
+	{ 3.0906258197169572, 372.41670919067462, 5.6226100587149803,
+		1950.1441428024104, 2090.5608700180105, 2009.2025628226911,
+		2170.06139816416, 4.2912378791639139, 4.5399444856018807 },
+	{ 3.0906731874136506, 372.17043075020888, 5.6240637502898219,
+		1950.4673094604968, 2089.8702834523019, 2009.5675163975454,
+		2169.2592543583896, 4.2917979210729156, 4.5386982817460453 },
+	{ 3.0907205572960228, 371.90384884561735, 5.6255064566884254,
+		1950.8159814062451, 2089.1852656361234, 2009.9612262089815,
+		2168.463694006246, 4.292402465260686, 4.5374622916578158 },
+	{ 3.0907679293722272, 371.61735516308721, 5.6269383520217264,
+		1951.1897216265677, 2088.505727914996, 2010.3832094189327,
+		2167.6746114029975, 4.2930507611888569, 4.536236350830074 },
+	{ 3.0908153036504502, 371.31136534001678, 5.6283598230737102,
+		1951.5880658676288, 2087.8314781180115, 2010.8329529332859,
+		2166.8917806721543, 4.2937420113937721, 4.5350201089066209 },
+	{ 3.0908626801388985, 370.98631368579015, 5.6297714594998842,
+		1952.0105289417832, 2087.1622254873273, 2011.3099204348011,
+		2166.114861570627, 4.2944753824036983, 4.5338130386790434 },
+	{ 3.0909100588458398, 370.64264816441636, 5.6311740434244699,
+		1952.4566107226642, 2086.4975858906537, 2011.8135590683173,
+		2165.3434056161695, 4.2952500151160846, 4.5326144455799584 },
+	{ 3.0909574397795847, 370.28082566793682, 5.6325685381482966,
+		1952.9258017968107, 2085.837087456629, 2012.3433057436541,
+		2164.5768626995591, 4.2960650345809768, 4.5314234779240925 },
+	{ 3.0910048229484532, 369.90130761506765, 5.6339560763225869,
+		1953.417588732354, 2085.1801764598549, 2012.8985930126025,
+		2163.8145879803869, 4.2969195591226947, 4.5302391375860722 },
+	{ 3.0910522083608307, 369.50455590439458, 5.6353379475876206,
+		1953.9314589307596, 2084.5262234560328, 2013.4788544823052,
+		2163.0558490671247, 4.2978127087412386, 4.5290602911161724 },
+	{ 3.0910995960251304, 369.0910292390804, 5.6367155856698634,
+		1954.4669050423297, 2083.874529670416, 2014.0835297436745,
+		2162.2998334854319, 4.2987436127602177, 4.5278856813001589 },
+	{ 3.0911469859497975, 368.66117984340246, 5.6380905551763822,
+		1955.0234289209461, 2083.2243335236731, 2014.712068787411,
+		2161.5456563003568, 4.2997114166788153, 4.5267139389556288 },
+	{ 3.0911943781433449, 368.21545059094484, 5.639464538011338,
+		1955.6005450933878, 2082.5748173319857, 2015.3639358798084,
+		2160.7923679355063, 4.3007152881847803, 4.5255435950315048 },
+	{ 3.0912417726142967, 367.75427254231454, 5.6408393196135167,
+		1956.1977837451777, 2081.9251140850661, 2016.0386129003116,
+		2160.0389620776532, 4.3017544223316078, 4.5243730928383235 },
+	{ 3.0912891693712283, 367.27806291182338, 5.6422167749567063,
+		1956.8146931971487, 2081.2743143307885, 2016.7356021114088,
+		2159.2843837003829, 4.302828045834584, 4.5232008004613684 },
+	{ 3.0913365684227538, 366.78722345766033, 5.6435988544862639,
+		1957.4508418773346, 2080.6214730825195, 2017.454428365483,
+		2158.5275371096495, 4.3039354204930502, 4.5220250232065027 },
+	{ 3.0913839697775369, 366.28213929601554, 5.6449875700136376,
+		1958.1058197847904, 2079.9656167389812, 2018.1946407441826,
+		2157.7672939997142, 4.3050758457323273, 4.5208440160609227 },
+	{ 3.091431373444264, 365.76317813206026, 5.6463849805556521,
+		1958.7792394507794, 2079.3057500232831, 2018.9558136356536,
+		2157.0025015273068, 4.3062486602738934, 4.5196559961810818 },
+	{ 3.0914787794316747, 365.23068990424503, 5.6477931783493105,
+		1959.4707363977068, 2078.640862829348, 2019.7375472492593,
+		2156.2319902745294, 4.3074532429334651, 4.5184591552074771 },
+	{ 3.0915261877485585, 364.68500682572227, 5.6492142749298546,
+		1960.1799691117271, 2077.9699370302678, 2020.539467584812,
+		2155.454582163844, 4.3086890125738018, 4.5172516715044209 },
+	{ 3.0915735984037225, 364.12644380554872, 5.6506503873250651,
+		1960.9066185458928, 2077.291953222908, 2021.3612258744377,
+		2154.6690982953683, 4.3099554272404648, 4.5160317222786341 },
+	{ 3.0916210114060414, 363.55529924192155, 5.6521036245973422,
+		1961.6503871584025, 2076.6058972962342, 2022.2024975011946,
+		2153.8743665759907, 4.311251982487347, 4.5147974953750181 },
+	{ 3.0916684267644179, 362.9718561532456, 5.6535760745088073,
+		1962.4109975235513, 2075.9107669322275, 2023.0629804359503,
+		2153.0692292664339, 4.3125782089564071, 4.5135472009445294 },
+	{ 3.0917158444877963, 362.3763836338627, 5.6550697905696854,
+		1963.1881905263053, 2075.2055779126672, 2023.9423932038171,
+		2152.2525502992021, 4.3139336692294421, 4.5122790827568497 },
+	{ 3.0917632645851598, 361.76913860729167, 5.6565867794102092,
+		1963.9817231689165, 2074.4893702603904, 2024.8404724112977,
+		2151.4232224004181, 4.3153179540003466, 4.510991429208814 },
+	{ 3.0918106870655571, 361.15036784890231, 5.6581289884639574,
+		1964.7913660191286, 2073.7612142200746, 2025.7569698665843,
+		2150.5801740211323, 4.3167306776182235, 4.5096825840372423 },
+	{ 3.0918581119380519, 360.52031024153121, 5.6596982941125233,
+		1965.6169003405412, 2073.0202160053964, 2026.6916493379219,
+		2149.7223759930371, 4.3181714730711027, 4.5083509566046489 },
+	{ 3.0919055392117727, 359.87919925001057, 5.6612964902705754,
+		1966.4581149166784, 2072.2655233216969, 2027.6442829622999,
+		2148.8488479189409, 4.3196399864293404, 4.5069950317737932 },
+	{ 3.0919529688958738, 359.22726556190122, 5.6629252773200252,
+		1967.3148026304727, 2071.49633070754, 2028.6146473733886,
+		2147.9586643478292, 4.3211358708554855, 4.5056133794481958 },
+	{ 3.0920004009995647, 358.56473988285632, 5.6645862516635486,
+		1968.1867568079408, 2070.711884563375, 2029.6025195579891,
+		2147.0509605816028, 4.3226587801949785, 4.5042046635420965 },
+	{ 3.0920478355321088, 357.89185583236787, 5.6662808956393977,
+		1969.0737673903543, 2069.9114879911181, 2030.6076725130811,
+		2146.1249382565024, 4.3242083622592737, 4.5027676506010765 },
+	{ 3.0920952725027866, 357.20885291320286, 5.6680105680740551,
+		1969.9756169640382, 2069.0945053098994, 2031.6298707358715,
+		2145.1798705428641, 4.3257842518515455, 4.5013012178315854 },
+	{ 3.0921427119209408, 356.51597952809345, 5.6697764952367491,
+		1970.8920766771155, 2068.2603663610284, 2032.6688655795988,
+		2144.2151070937743, 4.3273860635855756, 4.4998043607412956 },
+	{ 3.092190153795968, 355.81349599686672, 5.6715797624931801,
+		1971.8229020994102, 2067.4085704575341, 2033.7243905383625,
+		2143.230078574923, 4.3290133845956627, 4.498276200131059 },
+	{ 3.0922375981372863, 355.10167753087455, 5.6734213063933163,
+		1972.7678290778738, 2066.5386901053803, 2034.7961565200224,
+		2142.2243009225249, 4.3306657672287905, 4.4967159886656232 },
+	{ 3.0922850449543788, 354.38081716131052, 5.6753019073855731,
+		1973.7265695890235, 2065.6503744027145, 2035.8838471087297,
+		2141.1973792207477, 4.3323427217213695, 4.4951231168553081 },
+	{ 3.0923324942567771, 353.65122855181295, 5.6772221831492642,
+		1974.6988076767275, 2064.7433521203966, 2036.9871139171141,
+		2140.1490112023021, 4.3340437090151465, 4.4934971184544663 },
+	{ 3.0923799460540327, 352.91324867259863, 5.6791825823898314,
+		1975.6841955040063, 2063.8174345381281, 2038.105572060769,
+		2139.0789904581006, 4.3357681337625698, 4.4918376754095721 },
+	{ 3.0924274003557612, 352.16724032775505, 5.6811833794237714,
+		1976.6823495294927, 2062.8725178783952, 2039.2387957672663,
+		2137.9872091735247, 4.3375153375404034, 4.4901446220750554 },
+	{ 3.0924748571716392, 351.41359447086927, 5.6832246692238453,
+		1977.6928468942667, 2061.9085854966906, 2040.3863142172152,
+		2136.8736605746931, 4.3392845924222607, 4.4884179489804952 },
+	{ 3.0925223165113604, 350.65273228683134, 5.685306363083253,
+		1978.7152220504024, 2060.925709751717, 2041.5476076534371,
+		2135.7384409966608, 4.3410750949655688, 4.4866578060131959 },
+	{ 3.092569778384699, 349.88510704329411, 5.6874281850220516,
+		1979.7489636299222, 2059.9240534965952, 2042.7221037572774,
+		2134.5817515057415, 4.3428859606113894, 4.484864504911461 },
+	{ 3.0926172428014453, 349.11120563097842, 5.6895896686072778,
+		1980.7935116653944, 2058.9038713498162, 2043.9091744190416,
+		2133.4038992597602, 4.3447162186932138, 4.4830385213529054 },
+	{ 3.0926647097714381, 348.33154982691627, 5.6917901545859069,
+		1981.8482551232116, 2057.8655105549306, 2045.1081328591363,
+		2132.2052983860485, 4.3465648079874564, 4.4811804962975259 },
+	{ 3.092712179304602, 347.54669723173095, 5.6940287890837711,
+		1982.9125298215513, 2056.8094115490958, 2046.3182311825772,
+		2130.9864705165724, 4.3484305729333252, 4.4792912368012798 },
+	{ 3.0927596514108724, 346.75724184329709, 5.6963045223441613,
+		1983.9856167920784, 2055.7361082546149, 2047.5386584349749,
+		2129.7480449971863, 4.3503122606272413, 4.4773717163264886 },
+	{ 3.092807126100249, 345.96381429738085, 5.698616108177851,
+		1985.0667410549431, 2054.6462280130327, 2048.76853912661,
+		2128.4907586789159, 4.3522085185400199, 4.4754230744069305 },
+	{ 3.0928546033827695, 345.16708172923165, 5.7009621040641196,
+		1986.1550708798034, 2053.5404911933188, 2050.0069323083726,
+		2127.2154553285736, 4.3541178930863325, 4.4734466157254316 },
+	{ 3.0929020832685401, 344.36774725994707, 5.7033408717955378,
+		1987.2497175407793, 2052.4197105282119, 2051.2528312099275,
+		2125.9230847221197, 4.3560388290623182, 4.4714438087020856 },
+	{ 3.0929495657677064, 343.56654909575025, 5.705750578803193,
+		1988.3497355951156, 2051.2847901163082, 2052.5051634752836,
+		2124.6147013497366, 4.3579696700056836, 4.4694162834834659 },
+	{ 3.0929970508904492, 342.76425923846585, 5.7081892000661991,
+		1989.4541237029878, 2050.1367241393923, 2053.7627920170303,
+		2123.2914627908881, 4.3599086595112135, 4.4673658294229979 },
+	{ 3.0930445386470273, 341.96168182392984, 5.7106545207492685,
+		1990.5618259815212, 2048.9765952300095, 2055.0245164828093,
+		2121.9546276855958, 4.3618539434916146, 4.4652943919385368 },
+	{ 3.0930920290477246, 341.15965105738996, 5.7131441392833846,
+		1991.6717339513359, 2047.8055726295263, 2056.2890754017899,
+		2120.6055534648776, 4.3638035734886182, 4.4632040689991932 },
+	{ 3.0931395221028994, 340.35902879491823, 5.7156554712642649,
+		1992.7826890260769, 2046.6249099618217, 2057.5551489563022,
+		2119.245693640084, 4.3657555109494632, 4.4610971069317671 },
+	{ 3.0931870178229368, 339.56070174274532, 5.7181857538155478,
+		1993.8934855999066, 2045.4359427958216, 2058.8213624425539,
+		2117.8765948521132, 4.3677076325677495, 4.4589758958576473 },
+	{ 3.093234516218299, 338.76557832777593, 5.7207320506535666,
+		1995.0028746771145, 2044.2400858882168, 2060.0862903583106,
+		2116.4998935566555, 4.3696577365926315, 4.4568429645686569 },
+	{ 3.0932820172994826, 337.97458521844629, 5.7232912577319945,
+		1996.1095680885271, 2043.0388301692458, 2061.3484611696658,
+		2115.1173124193047, 4.371603550187074, 4.4547009749560376 },
+	{ 3.093329521077028, 337.18866353945924, 5.7258601095004442,
+		1997.2122432505341, 2041.8337394597802, 2062.6063627078706,
+		2113.7306564083819, 4.3735427377594531, 4.4525527159737708 },
+	{ 3.0933770275615564, 336.40876482514801, 5.7284351857834137,
+		1998.309548419189, 2040.6264469213979, 2063.8584481430694,
+		2112.3418085888193, 4.3754729101864474, 4.4504010971413557 },
+	{ 3.0934245367637234, 335.63584667570296, 5.7310129192394443,
+		1999.4001085013022, 2039.4186512628321, 2065.1031426065192,
+		2110.952725645403, 4.37739163503805, 4.4482491416298089 },
+	{ 3.0934720486942413, 334.87086822251257, 5.7335896034224048,
+		2000.4825312868234, 2038.2121126966565, 2066.3388503073761,
+		2109.5654331296651, 4.3792964475668086, 4.4460999789219322 },
+	{ 3.0935195633638646, 334.11478538143257, 5.7361614014087179,
+		2001.5554141400562, 2037.0086486671885, 2067.5639621874707,
+		2108.1820204559103, 4.3811848625286185, 4.4439568370862101 },
+	{ 3.0935670807834308, 333.36854597880154, 5.7387243550939893,
+		2002.6173510380754, 2035.8101293039526, 2068.7768639871242,
+		2106.8046355951392, 4.3830543866389506, 4.4418230345850658 },
+	{ 3.0936146009637957, 332.63308473321189, 5.7412743949302056,
+		2003.666939983442, 2034.6184727125215, 2069.9759447531242,
+		2105.4354795967001, 4.3849025317127213, 4.4397019718180291 },
+	{ 3.0936621239158923, 331.90931821650378, 5.7438073503410383,
+		2004.702790619071, 2033.435639992178, 2071.1596055923442,
+		2104.0768008117238, 4.3867268281841838, 4.4375971222050374 },
+	{ 3.0937096496507079, 331.19813977033539, 5.7463189607211245,
+		2005.7235320754276, 2032.2636300272532, 2072.3262687051019,
+		2102.7308888733291, 4.3885248390596709, 4.4355120228947609 },
+	{ 3.0937571781792728, 330.50041447440054, 5.7488048867618131,
+		2006.7278209094693, 2031.1044741751755, 2073.474386537202,
+		2101.4000685759779, 4.3902941740543282, 4.4334502653178252 },
+	{ 3.0938047095126904, 329.8169742242132, 5.7512607226995121,
+		2007.7143490441917, 2029.9602305694402, 2074.6024509457225,
+		2100.0866933311163, 4.3920325037507508, 4.4314154850858261 },
+	{ 3.0938522436621021, 329.14861294950663, 5.7536820086548506,
+		2008.6818516524822, 2028.832978431192, 2075.7090023131127,
+		2098.7931386522305, 4.3937375736784707, 4.4294113519362144 },
+	{ 3.0938997806387136, 328.4960820842465, 5.7560642438773932,
+		2009.6291148125244, 2027.7248120028669, 2076.79263841088,
+		2097.5217952259372, 4.3954072180072039, 4.4274415590376792 },
+	{ 3.0939473204537871, 327.86008633155438, 5.7584029002140618,
+		2010.5549828543906, 2026.637834424861, 2077.8520229193546,
+		2096.2750619383132, 4.397039372709421, 4.4255098122264132 }
+};
+
+/* beta = p^0.25 = bmin + i * bstep */
+static const double sattab_bmin = 0x1.42043803c9d91p-3;
+static const double sattab_bstep = 0x1.014a27a63f0a7p-9;
+
+/* Tsat = f(beta) */
+static const double sattab_p[SATTAB_P_NODES] = {
+	273.15000726597782,
+	273.83484438026369,
+	274.51510195721607,
+	275.19087819595802,
+	275.86226807200808,
+	276.5293634810638,
+	277.19225337469879,
+	277.85102388852215,
+	278.50575846330514,
+	279.15653795953608,
+	279.80344076583566,
+	280.44654290162703,
+	281.08591811442716,
+	281.72163797210021,
+	282.35377195038325,
+	282.98238751598137,
+	283.60755020549692,
+	284.22932370044748,
+	284.84776989860586,
+	285.46294898187693,
+	286.07491948091729,
+	286.68373833668306,
+	287.28946095908191,
+	287.89214128289649,
+	288.49183182112859,
+	289.08858371590776,
+	289.68244678710255,
+	290.27346957875193,
+	290.86169940344246,
+	291.44718238473513,
+	292.02996349774799,
+	292.61008660798893,
+	293.18759450853332,
+	293.76252895562749,
+	294.33493070279962,
+	294.90483953355647,
+	295.47229429273079,
+	296.03733291655232,
+	296.59999246150147,
+	297.16030913200666,
+	297.71831830703979,
+	298.2740545656651,
+	298.82755171158828,
+	299.37884279675507,
+	299.92796014404257,
+	300.47493536908621,
+	301.01979940128138,
+	301.56258250399713,
+	302.10331429403897,
+	302.64202376039316,
+	303.17873928228431,
+	303.71348864657784,
+	304.24629906455539,
+	304.77719718808913,
+	305.30620912524398,
+	305.83336045532883,
+	306.35867624342245,
+	306.88218105439501,
+	307.40389896644808,
+	307.9238535841896,
+	308.44206805126748,
+	308.95856506257638,
+	309.47336687605662,
+	309.98649532410133,
+	310.49797182458775,
+	311.00781739154706,
+	311.5160526454876,
+	312.02269782338522,
+	312.52777278835276,
+	313.03129703900163,
+	313.53328971850829,
+	314.03376962339507,
+	314.53275521203756,
+	315.03026461290773,
+	315.52631563256443,
+	316.02092576339794,
+	316.51411219114141,
+	317.0058918021532,
+	317.49628119048219,
+	317.98529666472257,
+	318.47295425466507,
+	318.95926971775316,
+	319.44425854535001,
+	319.92793596882251,
+	320.41031696545247,
+	320.89141626417484,
+	321.37124835115401,
+	321.84982747520206,
+	322.32716765304394,
+	322.80328267443491,
+	323.27818610713598,
+	323.75189130175215,
+	324.22441139643593,
+	324.69575932146375,
+	325.16594780368712,
+	325.63498937086388,
+	326.10289635587293,
+	326.56968090081568,
+	327.03535496100983,
+	327.49993030887606,
+	327.96341853772412,
+	328.42583106543862,
+	328.88717913807,
+	329.3474738333324,
+	329.80672606401151,
+	330.26494658128559,
+	330.7221459779621,
+	331.17833469163156,
+	331.63352300774409,
+	332.0877210626067,
+	332.54093884630799,
+	332.99318620556863,
+	333.44447284652381,
+	333.89480833743545,
+	334.34420211133977,
+	334.79266346862994,
+	335.24020157957671,
+	335.68682548678908,
+	336.13254410761493,
+	336.57736623648623,
+	337.02130054720772,
+	337.46435559519233,
+	337.90653981964408,
+	338.34786154569036,
+	338.78832898646419,
+	339.22795024514022,
+	339.66673331692141,
+	340.10468609098325,
+	340.54181635237126,
+	340.97813178385695,
+	341.41363996775289,
+	341.8483483876845,
+	342.2822644303248,
+	342.71539538709033,
+	343.14774845579848,
+	343.57933074228856,
+	344.01014926200946,
+	344.44021094157029,
+	344.86952262025829,
+	345.29809105152486,
+	345.72592290443799,
+	346.15302476510544,
+	346.57940313806648,
+	347.00506444765489,
+	347.43001503933175,
+	347.85426118099292,
+	348.27780906424624,
+	348.70066480566447,
+	349.12283444801119,
+	349.54432396144074,
+	349.96513924467587,
+	350.38528612615892,
+	350.80477036518039,
+	351.22359765298489,
+	351.64177361385526,
+	352.0593038061732,
+	352.47619372346071,
+	352.89244879539899,
+	353.30807438882857,
+	353.72307580872871,
+	354.13745829917809,
+	354.55122704429652,
+	354.96438716916794,
+	355.37694374074613,
+	355.78890176874211,
+	356.2002662064956,
+	356.61104195182787,
+	357.02123384788092,
+	357.43084668393794,
+	357.83988519622994,
+	358.24835406872683,
+	358.65625793391308,
+	359.06360137354989,
+	359.47038891942162,
+	359.87662505406979,
+	360.28231421151276,
+	360.6874607779522,
+	361.09206909246706,
+	361.49614344769333,
+	361.8996880904939,
+	362.30270722261395,
+	362.70520500132562,
+	363.10718554006075,
+	363.50865290903289,
+	363.90961113584626,
+	364.31006420609742,
+	364.71001606396158,
+	365.10947061277295,
+	365.50843171559166,
+	365.90690319576333,
+	366.30488883746602,
+	366.70239238625004,
+	367.09941754956759,
+	367.49596799729272,
+	367.89204736223246,
+	368.28765924063055,
+	368.68280719266056,
+	369.0774947429112,
+	369.47172538086494,
+	369.86550256136621,
+	370.25882970508303,
+	370.65171019896047,
+	371.04414739666709,
+	371.43614461903303,
+	371.82770515448124,
+	372.2188322594522,
+	372.6095291588199,
+	372.99979904630305,
+	373.38964508486868,
+	373.77907040712751,
+	374.16807811572619,
+	374.55667128373108,
+	374.94485295500419,
+	375.3326261445776,
+	375.71999383901777,
+	376.10695899678615,
+	376.49352454859172,
+	376.87969339774264,
+	377.2654684204856,
+	377.65085246634663,
+	378.03584835846118,
+	378.42045889390249,
+	378.8046868440025,
+	379.18853495466919,
+	379.57200594669939,
+	379.95510251608431,
+	380.33782733431326,
+	380.72018304867055,
+	381.10217228252941,
+	381.4837976356398,
+	381.86506168441355,
+	382.24596698220347,
+	382.6265160595799,
+	383.00671142460124,
+	383.38655556308237,
+	383.76605093885769,
+	384.14519999404018,
+	384.52400514927797,
+	384.90246880400491,
+	385.28059333668955,
+	385.65838110507991,
+	386.03583444644244,
+	386.41295567780151,
+	386.7897470961716,
+	387.16621097878817,
+	387.54234958333507,
+	387.91816514816787,
+	388.29365989253392,
+	388.66883601679012,
+	389.04369570261781,
+	389.41824111323194,
+	389.79247439359085,
+	390.16639767060059,
+	390.54001305331769,
+	390.91332263314746,
+	391.28632848404129,
+	391.65903266269032,
+	392.03143720871606,
+	392.40354414485898,
+	392.77535547716445,
+	393.14687319516463,
+	393.51809927206085,
+	393.88903566490029,
+	394.25968431475189,
+	394.63004714688014,
+	395.0001260709148,
+	395.36992298102012,
+	395.73943975606073,
+	396.10867825976533,
+	396.47764034088908,
+	396.84632783337219,
+	397.21474255649775,
+	397.58288631504627,
+	397.95076089944996,
+	398.31836808594244,
+	398.68570963670885,
+	399.05278730003249,
+	399.41960281043907,
+	399.78615788884167,
+	400.15245424268045,
+	400.51849356606255,
+	400.88427753989998,
+	401.24980783204484,
+	401.61508609742384,
+	401.98011397816981,
+	402.34489310375369,
+	402.70942509111075,
+	403.07371154477096,
+	403.4377540569817,
+	403.80155420783365,
+	404.165113565382,
+	404.52843368576686,
+	404.89151611333415,
+	405.25436238075139,
+	405.61697400912487,
+	405.97935250811412,
+	406.34149937604542,
+	406.70341610002316,
+	407.06510415604043,
+	407.42656500908816,
+	407.78780011326307,
+	408.1488109118726,
+	408.50959883754228,
+	408.87016531231689,
+	409.23051174776492,
+	409.59063954507809,
+	409.9505500951725,
+	410.31024477878634,
+	410.66972496657786,
+	411.02899201922139,
+	411.38804728750256,
+	411.74689211241213,
+	412.10552782523871,
+	412.46395574766052,
+	412.82217719183569,
+	413.18019346049209,
+	413.53800584701469,
+	413.89561563553508,
+	414.25302410101494,
+	414.61023250933295,
+	414.96724211736847,
+	415.32405417308547,
+	415.68066991561312,
+	416.0370905753291,
+	416.39331737393752,
+	416.74935152455083,
+	417.10519423176595,
+	417.46084669174309,
+	417.81631009228164,
+	418.17158561289625,
+	418.52667442489155,
+	418.88157769143527,
+	419.23629656763256,
+	419.59083220059784,
+	419.94518572952472,
+	420.29935828575879,
+	420.65335099286574,
+	421.007164966701,
+	421.36080131547749,
+	421.71426113983364,
+	422.06754553289892,
+	422.42065558036001,
+	422.77359236052718,
+	423.12635694439643,
+	423.47895039571443,
+	423.83137377104174,
+	424.18362811981387,
+	424.53571448440329,
+	424.88763390018045,
+	425.23938739557371,
+	425.59097599212851,
+	425.94240070456624,
+	426.29366254084289,
+	426.64476250220565,
+	426.99570158325037,
+	427.34648077197738,
+	427.69710104984745,
+	428.04756339183615,
+	428.3978687664893,
+	428.74801813597514,
+	429.09801245613914,
+	429.44785267655487,
+	429.79753974057792,
+	430.1470745853959,
+	430.49645814207963,
+	430.84569133563411,
+	431.19477508504747,
+	431.54371030334033,
+	431.89249789761527,
+	432.24113876910411,
+	432.58963381321587,
+	432.93798391958427,
+	433.2861899721143,
+	433.63425284902723,
+	433.98217342290815,
+	434.3299525607498,
+	434.67759112399722,
+	435.02508996859314,
+	435.37244994502026,
+	435.7196718983455,
+	436.06675666826237,
+	436.41370508913388,
+	436.76051799003324,
+	437.10719619478675,
+	437.45374052201407,
+	437.80015178516902,
+	438.14643079257911,
+	438.49257834748653,
+	438.83859524808702,
+	439.18448228756796,
+	439.53024025414794,
+	439.87586993111421,
+	440.22137209686161,
+	440.56674752492756,
+	440.91199698403142,
+	441.25712123811013,
+	441.60212104635343,
+	441.94699716324186,
+	442.29175033857985,
+	442.63638131753265,
+	442.9808908406597,
+	443.32527964395001,
+	443.66954845885567,
+	444.01369801232516,
+	444.357729026838,
+	444.7016422204357,
+	445.04543830675681,
+	445.38911799506656,
+	445.73268199029127,
+	446.07613099304899,
+	446.41946569968002,
+	446.76268680227929,
+	447.10579498872659,
+	447.44879094271704,
+	447.79167534379002,
+	448.13444886736153,
+	448.47711218475069,
+	448.81966596321126,
+	449.16211086595922,
+	449.5044475522019,
+	449.84667667716604,
+	450.18879889212621,
+	450.53081484443237,
+	450.87272517753706,
+	451.21453053102294,
+	451.55623154062982,
+	451.89782883828059,
+	452.23932305210894,
+	452.58071480648414,
+	452.92200472203751,
+	453.26319341568899,
+	453.60428150066963,
+	453.94526958655041,
+	454.2861582792641,
+	454.6269481811326,
+	454.96763989088799,
+	455.3082340036994,
+	455.64873111119618,
+	455.98913180149043,
+	456.32943665920266,
+	456.66964626548264,
+	457.00976119803369,
+	457.34978203113531,
+	457.68970933566538,
+	458.02954367912247,
+	458.36928562564833,
+	458.70893573604911,
+	459.04849456781756,
+	459.38796267515443,
+	459.72734060898887,
+	460.06662891700103,
+	460.40582814364075,
+	460.74493883015043,
+	461.08396151458356,
+	461.42289673182597,
+	461.76174501361567,
+	462.10050688856222,
+	462.43918288216707,
+	462.77777351684233,
+	463.11627931192936,
+	463.4547007837208,
+	463.79303844547502,
+	464.13129280743874,
+	464.46946437686245,
+	464.80755365802139,
+	465.14556115223166,
+	465.48348735786885,
+	465.82133277038662,
+	466.15909788233273,
+	466.4967831833672,
+	466.83438916028058,
+	467.17191629700869,
+	467.50936507465224,
+	467.84673597149191,
+	468.184029463005,
+	468.52124602188195,
+	468.85838611804371,
+	469.19545021865622,
+	469.53243878814698,
+	469.86935228822159,
+	470.20619117787805,
+	470.54295591342304,
+	470.87964694848711,
+	471.21626473404024,
+	471.55280971840597,
+	471.88928234727695,
+	472.22568306372921,
+	472.56201230823717,
+	472.89827051868815,
+	473.23445813039643,
+	473.57057557611648,
+	473.90662328605913,
+	474.24260168790312,
+	474.57851120680994,
+	474.91435226543831,
+	475.25012528395604,
+	475.58583068005339,
+	475.92146886895745,
+	476.25704026344499,
+	476.59254527385417,
+	476.9279843080983,
+	477.2633577716789,
+	477.59866606769697,
+	477.93390959686587,
+	478.26908875752463,
+	478.60420394564881,
+	478.93925555486294,
+	479.27424397645268,
+	479.60916959937578,
+	479.94403281027496,
+	480.27883399348889,
+	480.61357353106337,
+	480.94825180276234,
+	481.28286918607955,
+	481.61742605625068,
+	481.95192278626246,
+	482.28635974686347,
+	482.62073730657693,
+	482.9550558317095,
+	483.28931568636239,
+	483.62351723244109,
+	483.95766082966713,
+	484.29174683558676,
+	484.62577560558128,
+	484.95974749287745,
+	485.29366284855803,
+	485.62752202156889,
+	485.96132535873176,
+	486.29507320475153,
+	486.62876590222714,
+	486.96240379165965,
+	487.29598721146226,
+	487.62951649796975,
+	487.96299198544511,
+	488.29641400609239,
+	488.62978289006202,
+	488.96309896546165,
+	489.29636255836289,
+	489.62957399281186,
+	489.96273359083568,
+	490.29584167245298,
+	490.62889855567983,
+	490.96190455653885,
+	491.2948599890675,
+	491.62776516532642,
+	491.96062039540556,
+	492.29342598743324,
+	492.62618224758307,
+	492.95888948008303,
+	493.29154798722124,
+	493.62415806935394,
+	493.95672002491233,
+	494.28923415041095,
+	494.62170074045378,
+	494.95412008774139,
+	495.2864924830775,
+	495.61881821537656,
+	495.95109757167091,
+	496.28333083711533,
+	496.6155182949966,
+	496.94766022673684,
+	497.27975691190306,
+	497.61180862821016,
+	497.94381565152969,
+	498.27577825589537,
+	498.60769671350857,
+	498.93957129474518,
+	499.27140226815976,
+	499.60318990049313,
+	499.93493445667809,
+	500.26663619984441,
+	500.59829539132301,
+	500.92991229065507,
+	501.26148715559356,
+	501.59302024211024,
+	501.92451180440219,
+	502.25596209489402,
+	502.58737136424554,
+	502.91873986135613,
+	503.25006783336801,
+	503.58135552567308,
+	503.91260318191701,
+	504.24381104400408,
+	504.5749793521004,
+	504.90610834464115,
+	505.23719825833194,
+	505.5682493281563,
+	505.89926178737608,
+	506.23023586754016,
+	506.56117179848479,
+	506.89206980834007,
+	507.22293012353282,
+	507.55375296879032,
+	507.88453856714466,
+	508.21528713993627,
+	508.54599890681823,
+	508.87667408575902,
+	509.20731289304587,
+	509.53791554328814,
+	509.86848224942355,
+	510.19901322271642,
+	510.52950867276473,
+	510.85996880750253,
+	511.19039383320228,
+	511.52078395447762,
+	511.85113937428747,
+	512.18146029393836,
+	512.5117469130862,
+	512.84199942974101,
+	513.17221804026838,
+	513.50240293939066,
+	513.83255432019189,
+	514.16267237411921,
+	514.49275729098531,
+	514.82280925896964,
+	515.15282846462264,
+	515.48281509286539,
+	515.81276932699427,
+	516.14269134868027,
+	516.47258133797322,
+	516.80243947330223,
+	517.1322659314776,
+	517.46206088769327,
+	517.79182451552754,
+	518.12155698694426,
+	518.45125847229656,
+	518.78092914032447,
+	519.11056915816039,
+	519.44017869132665,
+	519.76975790373967,
+	520.09930695770834,
+	520.42882601393762,
+	520.75831523152749,
+	521.08777476797502,
+	521.4172047791734,
+	521.74660541941648,
+	522.07597684139455,
+	522.40531919619843,
+	522.73463263331882,
+	523.06391730064536,
+	523.3931733444706,
+	523.72240090948628,
+	524.05160013878572,
+	524.38077117386376,
+	524.7099141546156,
+	525.03902921933957,
+	525.36811650473305,
+	525.69717614589536,
+	526.02620827632745,
+	526.35521302792893,
+	526.6841905310007,
+	527.01314091424308,
+	527.34206430475479,
+	527.67096082803334,
+	527.99983060797422,
+	528.32867376686852,
+	528.6574904254054,
+	528.98628070266739,
+	529.31504471613164,
+	529.6437825816696,
+	529.97249441354177,
+	530.30118032440157,
+	530.62984042529081,
+	530.95847482563977,
+	531.28708363326348,
+	531.61566695436454,
+	531.94422489352598,
+	532.27275755371386,
+	532.60126503627271,
+	532.92974744092737,
+	533.25820486577595,
+	533.58663740729082,
+	533.91504516031694,
+	534.24342821806761,
+	534.57178667212418,
+	534.90012061243294,
+	535.22843012730175,
+	535.55671530339782,
+	535.88497622574812,
+	536.21321297773034,
+	536.54142564107758,
+	536.86961429586972,
+	537.19777902053227,
+	537.52591989183475,
+	537.85403698488597,
+	538.1821303731308,
+	538.51020012834715,
+	538.83824632064488,
+	539.166269018457,
+	539.49426828854041,
+	539.82224419597264,
+	540.15019680414525,
+	540.47812617476018,
+	540.80603236782952,
+	541.133915441667,
+	541.46177545288629,
+	541.78961245639709,
+	542.11742650539804,
+	542.44521765137722,
+	542.7729859441024,
+	543.10073143161947,
+	543.42845416024829,
+	543.75615417457436,
+	544.08383151744954,
+	544.41148622998105,
+	544.73911835153092,
+	545.06672791970914,
+	545.3943149703673,
+	545.7218795375951,
+	546.04942165371494,
+	546.37694134927392,
+	546.70443865304128,
+	547.03191359200093,
+	547.3593661913452,
+	547.68679647446925,
+	548.01420446296788,
+	548.34159017662284,
+	548.66895363340348,
+	548.99629484945501,
+	549.32361383909642,
+	549.6509106148103,
+	549.97818518723761,
+	550.30543756517159,
+	550.63266775554894,
+	550.95987576344555,
+	551.28706159206411,
+	551.61422524273507,
+	551.94136671490071,
+	552.26848600611095,
+	552.59558311202022,
+	552.92265802637132,
+	553.24971074099528,
+	553.57674124579637,
+	553.90374952875004,
+	554.23073557589146,
+	554.5576993713081,
+	554.88464089712954,
+	555.21156013352334,
+	555.53845705867991,
+	555.86533164880882,
+	556.19218387812714,
+	556.51901371885197,
+	556.8458211411903,
+	557.1726061133287,
+	557.4993686014252,
+	557.82610856960014,
+	558.15282597992405,
+	558.47952079240952,
+	558.80619296500151,
+	559.13284245356499,
+	559.45946921187681,
+	559.78607319161404,
+	560.11265434234247,
+	560.43921261150922,
+	560.76574794442797,
+	561.09226028427008,
+	561.41874957205198,
+	561.74521574662458,
+	562.07165874466193,
+	562.39807850065063,
+	562.72447494687356,
+	563.05084801340377,
+	563.37719762808786,
+	563.7035237165353,
+	564.02982620210696,
+	564.3561050059011,
+	564.68236004673906,
+	565.00859124115732,
+	565.33479850338836,
+	565.66098174535159,
+	565.98714087663711,
+	566.31327580449499,
+	566.639386433818,
+	566.96547266713026,
+	567.29153440457139,
+	567.61757154388317,
+	567.9435839803956,
+	568.26957160700931,
+	568.59553431418453,
+	568.92147198992143,
+	569.24738451974974,
+	569.57327178670948,
+	569.89913367133647,
+	570.22497005164519,
+	570.55078080311773,
+	570.87656579868008,
+	571.20232490869057,
+	571.52805800092267,
+	571.85376494054503,
+	572.17944559010812,
+	572.50509980952529,
+	572.83072745605443,
+	573.15632838427996,
+	573.48190244609839,
+	573.80744949069538,
+	574.132969364529,
+	574.45846191131295,
+	574.78392697199456,
+	575.10936438473846,
+	575.4347739849045,
+	575.76015560502924,
+	576.08550907480799,
+	576.41083422106999,
+	576.73613086776379,
+	577.06139883593232,
+	577.38663794369313,
+	577.71184800621813,
+	578.03702883571134,
+	578.36218024138782,
+	578.68730202945051,
+	579.01239400306963,
+	579.33745596235929,
+	579.66248770435357,
+	579.98748902298621,
+	580.3124597090648,
+	580.63739955025005,
+	580.96230833102641,
+	581.28718583268414,
+	581.61203183329064,
+	581.93684610766832,
+	582.26162842736744,
+	582.5863785606407,
+	582.91109627241826,
+	583.23578132428338,
+	583.5604334744412,
+	583.88505247769717,
+	584.20963808542729,
+	584.53419004555053,
+	584.85870810250242,
+	585.18319199720565,
+	585.50764146704194,
+	585.83205624582547,
+	586.15643606376966,
+	586.48078064746073,
+	586.80508971982545,
+	587.12936300010438,
+	587.45360020381725,
+	587.77780104273234,
+	588.10196522484057,
+	588.42609245431538,
+	588.75018243148656,
+	589.07423485280299,
+	589.39824941080633,
+	589.72222579408754,
+	590.04616368726488,
+	590.37006277093633,
+	590.69392272165805,
+	591.01774321189828,
+	591.34152391000782,
+	591.66526448018124,
+	591.98896458242154,
+	592.3126238725024,
+	592.63624200192953,
+	592.95981861790551,
+	593.28335336328655,
+	593.60684587654805,
+	593.93029579174095,
+	594.2537027384551,
+	594.57706634177521,
+	594.90038622224188,
+	595.22366199580892,
+	595.54689327380152,
+	595.8700796628699,
+	596.19322076495337,
+	596.51631617722614,
+	596.83936549206112,
+	597.16236829697993,
+	597.48532417460819,
+	597.80823270262647,
+	598.13109345372857,
+	598.45390599556742,
+	598.77666989071122,
+	599.09938469658834,
+	599.42204996544297,
+	599.74466524428328,
+	600.06723007482515,
+	600.38974399344636,
+	600.712206531128,
+	601.03461721340477,
+	601.35697556030721,
+	601.67928108630849,
+	602.00153330026797,
+	602.32373170536937,
+	602.64587579907163,
+	602.96796507303964,
+	603.28999901309373,
+	603.611977099142,
+	603.9338988051237,
+	604.25576359894137,
+	604.57757094239935,
+	604.89932029114277,
+	605.22101109458299,
+	605.54264279583958,
+	605.86421483166646,
+	606.18572663238535,
+	606.50717762181489,
+	606.82856721719747,
+	607.14989482912631,
+	607.47115986147605,
+	607.79236171131799,
+	608.11349976885435,
+	608.43457341733006,
+	608.75558203295873,
+	609.0765249848414,
+	609.39740163487704,
+	609.71821133768935,
+	610.03895344052921,
+	610.35962728319453,
+	610.68023219794031,
+	611.00076750937819,
+	611.32123253439818,
+	611.64162658205964,
+	611.9619489534997,
+	612.28219894183576,
+	612.60237583205947,
+	612.92247890093552,
+	613.24250741689161,
+	613.562460639915,
+	613.88233782143948,
+	614.20213820422282,
+	614.52186102224255,
+	614.84150550056768,
+	615.16107085523379,
+	615.48055629312489,
+	615.79996101183519,
+	616.11928419954006,
+	616.43852503485914,
+	616.7576826867089,
+	617.07675631416453,
+	617.39574506630868,
+	617.71464808207099,
+	618.03346449007677,
+	618.35219340847868,
+	618.67083394478516,
+	618.98938519568617,
+	619.30784624687476,
+	619.62621617285197,
+	619.94449403673696,
+	620.26267889006465,
+	620.58076977256894,
+	620.89876571197613,
+	621.21666572375921,
+	621.53446881092373,
+	621.85217396374173,
+	622.1697801595061,
+	622.48728636225223,
+	622.8046915224885,
+	623.12199457688996,
+	623.43919444799496,
+	623.75629004388247,
+	624.07328025782613,
+	624.39016396793988,
+	624.70694003680183,
+	625.02360731105171,
+	625.34016462097247,
+	625.65661078004678,
+	625.972944584483,
+	626.28916481271165,
+	626.60527022487167,
+	626.92125956221776,
+	627.23713154654513,
+	627.55288487952976,
+	627.86851824204598,
+	628.18403029344222,
+	628.49941967073244,
+	628.81468498776906,
+	629.12982483432654,
+	629.4448377751097,
+	629.75972234871506,
+	630.07447706646337,
+	630.38910041117947,
+	630.70359083583423,
+	631.0179467620776,
+	631.33216657865171,
+	631.64624863965253,
+	631.96019126261831,
+	632.27399272644107,
+	632.58765126909304,
+	632.90116508509004,
+	633.21453232272518,
+	633.52775108099024,
+	633.84081940618353,
+	634.15373528813041,
+	634.46649665599284,
+	634.77910137358867,
+	635.09154723414872,
+	635.40383195446896,
+	635.71595316831667,
+	636.02790841899798,
+	636.33969515099034,
+	636.6513107004356,
+	636.96275228434695,
+	637.27401698831602,
+	637.58510175243953,
+	637.89600335520277,
+	638.20671839489682,
+	638.51724326819692,
+	638.82757414527464,
+	639.1377069408735,
+	639.44763728048838,
+	639.75736046066913,
+	640.06687140223448,
+	640.37616459482956,
+	640.68523403097333,
+	640.99407312707706,
+	641.30267462845234,
+	641.61103049431608,
+	641.91913175771526,
+	642.22696835381828,
+	642.53452890783763,
+	642.8418004712106,
+	643.14876819066762,
+	643.45541488950778,
+	643.76172053286234,
+	644.06766153778904,
+	644.3732098734514,
+	644.67833187354779,
+	644.98298664861841,
+	645.28712393341368,
+	645.59068112309137,
+	645.89357912333151,
+	646.19571643094491,
+	646.49696051669355,
+	646.79713499578952,
+	647.09600004912602
+};
@@ -13,13 +13,26 @@ extern "C"
 {
 #endif /*__cplusplus*/
 
+#include <stddef.h>
+
+struct h2o_props; /* see h2o.h */
+
 double h2o_region5_v_pT(double p, double T);
+double h2o_region5_p_rhoT(double rho, double T);
 double h2o_region5_u_pT(double p, double T);
 double h2o_region5_s_pT(double p, double T);
 double h2o_region5_h_pT(double p, double T);
+void h2o_region5_h_pT_n(size_t count, const double p[],
+		const double T[], double h[]);
 double h2o_region5_cp_pT(double p, double T);
 double h2o_region5_cv_pT(double p, double T);
 double h2o_region5_w_pT(double p, double T);
+void h2o_region5_props_pT(double p, double T,
+		struct h2o_props* out);
+void h2o_region5_props_derivs_pT(double p, double T,
+		struct h2o_props* out, double* dvdp, double* dvdT);
+void h2o_region5_props_pT_n(size_t count, const double p[],
+		const double T[], struct h2o_props* out);
 
 #ifdef __cplusplus
 };
@@ -0,0 +1,123 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "h2o.h"
+#include "stats.h"
+
+#include <string.h>
+
+#ifdef H2O_STATS
+H2O_STATS_THREAD_LOCAL struct h2o_stats h2o_stats_current;
+#endif
+
+static const char* const stats_names[H2O_STATS_MAX] =
+{
+	"h2o_new_pT",
+	"h2o_new_Tx",
+	"h2o_new_px",
+	"h2o_new_ph",
+	"h2o_new_ps",
+	"h2o_new_hs",
+	"h2o_new_rhoT",
+	"h2o_new_ph_exact",
+	"h2o_new_ps_exact",
+	"h2o_new_hs_exact",
+	"h2o_new_pT_hint",
+	"h2o_new_ph_hint",
+	"h2o_new_ps_hint",
+	"h2o_tracker_update_pT",
+	"h2o_tracker_update_ph",
+	"h2o_tracker_update_ps",
+	"h2o_new_vu",
+	"h2o_sbtl_new_vu",
+	"h2o_ttse_new_ph",
+	"h2o_ttse_new_ps",
+
+	"h2o_get_p",
+	"h2o_get_T",
+	"h2o_get_x",
+	"h2o_get_rho",
+	"h2o_get_v",
+	"h2o_get_u",
+	"h2o_get_h",
+	"h2o_get_s",
+	"h2o_get_cp",
+	"h2o_get_cv",
+	"h2o_get_w",
+	"h2o_get_all",
+	"h2o_get_deriv",
+
+	"h2o_region_pT",
+	"h2o_region_ph",
+	"h2o_region_ps",
+	"h2o_region_pT_hint",
+	"h2o_region_ph_hint",
+	"h2o_region_ps_hint",
+	"h2o_region_hs",
+	"h2o_region_Tx",
+	"h2o_region_px",
+	"h2o_region_rhoT",
+	"h2o_region2_subregion_ph",
+	"h2o_region2_subregion_ps",
+	"h2o_region2_subregion_hs",
+	"h2o_region3_subregion_ph",
+	"h2o_region3_subregion_ps",
+	"h2o_region3_subregion_hs",
+	"h2o_region3_subregion_pT",
+
+	"h2o_region1_T_ph",
+	"h2o_region1_T_ps",
+	"h2o_region1_p_hs",
+	"h2o_region2_T_ph",
+	"h2o_region2_T_ps",
+	"h2o_region2_p_hs",
+	"h2o_region3_T_ph",
+	"h2o_region3_v_ph",
+	"h2o_region3_T_ps",
+	"h2o_region3_v_ps",
+	"h2o_region3_p_hs",
+	"h2o_region3_v_pT",
+	"h2o_region4_T_hs",
+
+	"h2o_region4_p_T",
+	"h2o_region4_T_p",
+	"h2o_region4_sat_T",
+	"h2o_region4_sat_p",
+	"h2o_region4_sat_approx_T",
+	"h2o_region4_sat_approx_p",
+
+	"twoarg_poly_value",
+	"twoarg_poly_derivs"
+};
+
+int h2o_stats_get(struct h2o_stats* out)
+{
+#ifdef H2O_STATS
+	*out = h2o_stats_current;
+	return 1;
+#else
+	memset(out, 0, sizeof(*out));
+	return 0;
+#endif
+}
+
+void h2o_stats_reset(void)
+{
+#ifdef H2O_STATS
+	memset(&h2o_stats_current, 0, sizeof(h2o_stats_current));
+#endif
+}
+
+const char* h2o_stats_name(enum h2o_stats_counter counter)
+{
+	if ((unsigned) counter >= H2O_STATS_MAX)
+		return NULL;
+
+	return stats_names[counter];
+}
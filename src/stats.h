@@ -0,0 +1,69 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#pragma once
+
+#ifndef _H2O_STATS_H
+#define _H2O_STATS_H 1
+
+#include "h2o.h"
+
+/* Call counters (and timers), see h2o_stats_get(). H2O_STATS_SCOPE()
+ * needs to be the first thing in the function body; it counts
+ * the call and, with H2O_STATS_TIME, times it until the function
+ * returns. The times are inclusive, i.e. a getter's time covers
+ * the twoarg_poly_*() calls it does. */
+
+#ifdef H2O_STATS
+extern H2O_STATS_THREAD_LOCAL struct h2o_stats h2o_stats_current;
+
+#	define H2O_STATS_ADD(counter, n) \
+		(h2o_stats_current.calls[counter] += (n))
+
+#	ifdef H2O_STATS_TIME
+#		include <time.h>
+
+struct h2o_stats_scope
+{
+	enum h2o_stats_counter counter;
+	struct timespec start;
+};
+
+static inline struct h2o_stats_scope h2o_stats_enter(
+		enum h2o_stats_counter counter)
+{
+	struct h2o_stats_scope ret;
+
+	++h2o_stats_current.calls[counter];
+	ret.counter = counter;
+	clock_gettime(CLOCK_MONOTONIC, &ret.start);
+	return ret;
+}
+
+static inline void h2o_stats_leave(const struct h2o_stats_scope* scope)
+{
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	h2o_stats_current.ns[scope->counter] +=
+		(end.tv_sec - scope->start.tv_sec) * 1000000000LL
+		+ (end.tv_nsec - scope->start.tv_nsec);
+}
+
+#		define H2O_STATS_SCOPE(counter) \
+			struct h2o_stats_scope h2o_stats_scope_ \
+				__attribute__((cleanup(h2o_stats_leave))) \
+				= h2o_stats_enter(counter)
+#	else /*!H2O_STATS_TIME*/
+#		define H2O_STATS_SCOPE(counter) \
+			unsigned long long h2o_stats_scope_ __attribute__((unused)) \
+				= H2O_STATS_ADD(counter, 1)
+#	endif /*H2O_STATS_TIME*/
+#else /*!H2O_STATS*/
+#	define H2O_STATS_ADD(counter, n) ((void) 0)
+#	define H2O_STATS_SCOPE(counter)
+#endif /*H2O_STATS*/
+
+#endif /*_H2O_STATS_H*/
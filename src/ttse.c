@@ -0,0 +1,689 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "consts.h"
+#include "boundaries.h"
+#include "h2o.h"
+#include "region1.h"
+#include "region2.h"
+#include "region3.h"
+#include "region4.h"
+#include "stats.h"
+#include "xmath.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/* TTSE (Tabular Taylor Series Expansion, after the IAPWS Guideline
+ * on the Tabular Taylor Series Expansion Method) tables for (p,h)
+ * and (p,s). Each node holds a value with its first and second
+ * derivatives over (ln p, y), y being h or s; the look-up takes
+ * a second-order Taylor step from the nearest node. */
+
+/* y = h [kJ/kg], or s [kJ/kgK] */
+static const double ttse_hmin = -20;
+static const double ttse_hmax = 4200;
+static const double ttse_smin = -0.02;
+static const double ttse_smax = 12;
+
+/* above that, the saturation line is too steep for the Taylor series
+ * over the rows, and the segmented saturation tables are used */
+static const double ttse_psat_rows_max = 8; /* [MPa] */
+
+#define TTSE_NP 256
+#define TTSE_NY 384
+
+/* the tabulated values */
+enum ttse_column
+{
+	TTSE_T,
+	TTSE_V,
+
+	TTSE_COLUMNS
+};
+
+/* Tsat and the region boundaries for each row: y', y'', y at Tmin
+ * and Tb25, and y on B13 and B23; and y'' of the saturated vapour
+ * the Region 4 getters use (the metastable one up to 10 MPa) for x */
+enum ttse_row_column
+{
+	TTSE_TSAT,
+	TTSE_Y1,
+	TTSE_Y2,
+	TTSE_Y2X,
+	TTSE_YMIN,
+	TTSE_YB25,
+	TTSE_YB13,
+	TTSE_YB23,
+
+	TTSE_ROW_COLUMNS
+};
+
+/* the value and its derivatives over (ln p, y) */
+enum ttse_deriv
+{
+	TTSE_F,
+	TTSE_FP,
+	TTSE_FY,
+	TTSE_FPP,
+	TTSE_FPY,
+	TTSE_FYY,
+
+	TTSE_DERIVS
+};
+
+enum ttse_kind
+{
+	TTSE_PH,
+	TTSE_PS
+};
+
+struct ttse_table
+{
+	enum ttse_kind kind;
+	double ymin, ystep, yscale;
+
+	/* the value and its derivatives over ln p, NaN where the boundary
+	 * does not exist (e.g. the saturation line above the critical
+	 * point); and the maximum error of the Taylor series over the row */
+	double rows[TTSE_NP][TTSE_ROW_COLUMNS][3];
+	double rows_err[TTSE_NP][TTSE_ROW_COLUMNS];
+	/* NaN in the two-phase region and out of range */
+	double nodes[TTSE_NP][TTSE_NY][TTSE_COLUMNS][TTSE_DERIVS];
+	/* the region the node was solved in, H2O_REGION_OUT_OF_RANGE
+	 * if it is not valid */
+	unsigned char regions[TTSE_NP][TTSE_NY];
+};
+
+struct h2o_ttse
+{
+	double lnpmin, lnpstep, lnpscale;
+	/* 1/p of each row, for ttse_row_index() */
+	double pinv[TTSE_NP];
+
+	struct ttse_table ph, ps;
+};
+
+/* p of row i; the last row is pmax exactly, not past it */
+static double ttse_p(const h2o_ttse_t* tab, int i)
+{
+	if (i == TTSE_NP - 1)
+		return pmax;
+
+	return exp(tab->lnpmin + i * tab->lnpstep);
+}
+
+/* Find the row nearest to p, and dp = ln(p / p_i). The row is first
+ * guessed from a rough log2(p) taken from the bits of p, good within
+ * 5E-3; dp = ln(1 + u) is then a short series since u = p / p_i - 1
+ * is within 3%, and the guess is corrected by a row if necessary.
+ * That is much shorter than a full xmath_log(). */
+static int ttse_row_index(const h2o_ttse_t* tab, double p, double* dp)
+{
+	const uint64_t mant_mask = (UINT64_C(1) << 52) - 1;
+	const double half_step = tab->lnpstep / 2;
+
+	uint64_t bits = xmath_to_bits(p);
+	double m = xmath_from_bits((bits & mant_mask)
+			| (UINT64_C(1023) << 52)) - 1;
+	double log2p = (double) ((int) (bits >> 52) - 1023)
+		+ m + 0.3466 * m * (1 - m);
+	double u, d;
+	int i;
+
+	i = (int) ((log2p * xmath_ln2_hi - tab->lnpmin) * tab->lnpscale + 0.5);
+	if (i < 0)
+		i = 0;
+	else if (i > TTSE_NP - 1)
+		i = TTSE_NP - 1;
+
+	u = p * tab->pinv[i] - 1;
+	d = u * (1 - u * (1./2 - u * (1./3 - u * (1./4 - u * (1./5)))));
+
+	if (d > half_step && i < TTSE_NP - 1)
+	{
+		++i;
+		d -= tab->lnpstep;
+	}
+	else if (d < -half_step && i > 0)
+	{
+		--i;
+		d += tab->lnpstep;
+	}
+
+	*dp = d;
+	return i;
+}
+
+/* Solve y(p, T) = y using the equation of the given region, starting
+ * with the given T (and v for Region 3). Regions 1 and 2 use a Newton
+ * in T, Region 3 a 2D Newton in (rho, T) with the Jacobian computed
+ * using finite differences. */
+static int ttse_solve(enum ttse_kind kind, enum h2o_region region,
+		double p, double y, double* T, double* v)
+{
+	int i;
+
+	for (i = 0; i < 30; ++i)
+	{
+		struct h2o_props props;
+
+		if (region == H2O_REGION3)
+		{
+			struct h2o_props props_rho, props_T;
+			double rho = 1 / *v;
+			double hrho = rho * 1E-7;
+			double hT = *T * 1E-7;
+			double r1, r2, j11, j12, j21, j22, det, drho, dT;
+
+			h2o_region3_props_rhoT(rho, *T, &props);
+			h2o_region3_props_rhoT(rho + hrho, *T, &props_rho);
+			h2o_region3_props_rhoT(rho, *T + hT, &props_T);
+
+			r1 = props.p - p;
+			r2 = (kind == TTSE_PH ? props.h : props.s) - y;
+			j11 = (props_rho.p - props.p) / hrho;
+			j12 = (props_T.p - props.p) / hT;
+			j21 = ((kind == TTSE_PH ? props_rho.h : props_rho.s)
+					- (kind == TTSE_PH ? props.h : props.s)) / hrho;
+			j22 = ((kind == TTSE_PH ? props_T.h : props_T.s)
+					- (kind == TTSE_PH ? props.h : props.s)) / hT;
+
+			det = j11 * j22 - j12 * j21;
+			drho = (r1 * j22 - r2 * j12) / det;
+			dT = (j11 * r2 - j21 * r1) / det;
+
+			/* keep far steps within reason */
+			if (fabs(drho) > rho * 0.2)
+			{
+				dT *= rho * 0.2 / fabs(drho);
+				drho *= rho * 0.2 / fabs(drho);
+			}
+
+			rho -= drho;
+			*T -= dT;
+			*v = 1 / rho;
+
+			if (!(rho > 0))
+				return 0;
+			if (fabs(drho) < rho * 1E-13 && fabs(dT) < *T * 1E-13)
+				return 1;
+		}
+		else
+		{
+			double dT;
+
+			if (region == H2O_REGION1)
+				h2o_region1_props_pT(p, *T, &props);
+			else
+				h2o_region2_props_pT(p, *T, &props);
+
+			/* (dh/dT)_p = cp, (ds/dT)_p = cp / T */
+			if (kind == TTSE_PH)
+				dT = (props.h - y) / props.cp;
+			else
+				dT = (props.s - y) * *T / props.cp;
+			if (fabs(dT) > 50)
+				dT = dT > 0 ? 50 : -50;
+
+			*T -= dT;
+			*v = props.v;
+
+			if (fabs(dT) < *T * 1E-13)
+				return 1;
+		}
+
+		if (!(*T > 0))
+			return 0;
+	}
+
+	return 0;
+}
+
+/* Fill in the node (i, j): solve it in the given region, starting
+ * with the given T and v, and take the derivatives using central
+ * differences over a fraction of the grid step. */
+static void ttse_solve_node(const h2o_ttse_t* tab, struct ttse_table* t,
+		int i, int j, enum h2o_region region, double T, double v)
+{
+	double (*node)[TTSE_DERIVS] = t->nodes[i][j];
+	double lnp = log(ttse_p(tab, i));
+	double y = t->ymin + j * t->ystep;
+	double dlnp = tab->lnpstep / 8;
+	double dy = t->ystep / 8;
+	double f[3][3][TTSE_COLUMNS];
+	int k, di, dj;
+
+	for (di = -1; di <= 1; ++di)
+		for (dj = -1; dj <= 1; ++dj)
+		{
+			double Tn = T, vn = v;
+
+			if (!ttse_solve(t->kind, region, exp(lnp + di * dlnp),
+						y + dj * dy, &Tn, &vn))
+				return;
+
+			f[di + 1][dj + 1][TTSE_T] = Tn;
+			f[di + 1][dj + 1][TTSE_V] = vn;
+		}
+
+	for (k = 0; k < TTSE_COLUMNS; ++k)
+	{
+		node[k][TTSE_F] = f[1][1][k];
+		node[k][TTSE_FP] = (f[2][1][k] - f[0][1][k]) / (2 * dlnp);
+		node[k][TTSE_FY] = (f[1][2][k] - f[1][0][k]) / (2 * dy);
+		node[k][TTSE_FPP] = (f[2][1][k] - 2 * f[1][1][k] + f[0][1][k])
+			/ (dlnp * dlnp);
+		node[k][TTSE_FPY] = (f[2][2][k] - f[2][0][k] - f[0][2][k] + f[0][0][k])
+			/ (4 * dlnp * dy);
+		node[k][TTSE_FYY] = (f[1][2][k] - 2 * f[1][1][k] + f[1][0][k])
+			/ (dy * dy);
+	}
+}
+
+/* The row values at p, NaN where they are not defined. */
+static void ttse_row_values(enum ttse_kind kind, double p,
+		double f[TTSE_ROW_COLUMNS])
+{
+	struct h2o_sat sat;
+	int ph = kind == TTSE_PH;
+
+	if (h2o_sat_p(p, &sat))
+	{
+		f[TTSE_TSAT] = sat.T;
+		f[TTSE_Y1] = ph ? sat.liquid.h : sat.liquid.s;
+		f[TTSE_Y2] = f[TTSE_Y2X] = ph ? sat.vapour.h : sat.vapour.s;
+
+		/* the stable vapour h2o_region_ph() and h2o_region_ps()
+		 * compare with */
+		if (p <= psat12max)
+			f[TTSE_Y2] = ph ? h2o_region2_h_pT(p, sat.T)
+				: h2o_region2_s_pT(p, sat.T);
+	}
+	else
+		f[TTSE_TSAT] = f[TTSE_Y1] = f[TTSE_Y2] = f[TTSE_Y2X] = NAN;
+
+	f[TTSE_YMIN] = ph ? h2o_region1_h_pT(p, Tmin)
+		: h2o_region1_s_pT(p, Tmin);
+	f[TTSE_YB25] = ph ? h2o_region2_h_pT(p, Tb25)
+		: h2o_region2_s_pT(p, Tb25);
+	f[TTSE_YB13] = ph ? h2o_region1_h_pT(p, Tb13)
+		: h2o_region1_s_pT(p, Tb13);
+	if (p >= psat12max)
+		f[TTSE_YB23] = ph ? h2o_region2_h_pT(p, h2o_b23_T_p(p))
+			: h2o_region2_s_pT(p, h2o_b23_T_p(p));
+	else
+		f[TTSE_YB23] = NAN;
+}
+
+/* Fill in the row values for row i, the derivatives taken the same
+ * way as for the nodes, and the maximum error of the Taylor series
+ * over the half steps around the row. */
+static void ttse_build_row(const h2o_ttse_t* tab, struct ttse_table* t,
+		int i)
+{
+	double lnp = log(ttse_p(tab, i));
+	double dlnp = tab->lnpstep / 8;
+	double f[3][TTSE_ROW_COLUMNS];
+	int k, di;
+
+	for (di = -1; di <= 1; ++di)
+		ttse_row_values(t->kind, exp(lnp + di * dlnp), f[di + 1]);
+
+	for (k = 0; k < TTSE_ROW_COLUMNS; ++k)
+	{
+		t->rows[i][k][0] = f[1][k];
+		t->rows[i][k][1] = (f[2][k] - f[0][k]) / (2 * dlnp);
+		t->rows[i][k][2] = (f[2][k] - 2 * f[1][k] + f[0][k]) / (dlnp * dlnp);
+		t->rows_err[i][k] = 0;
+	}
+
+	/* the points past the ends of the range are never looked up */
+	for (di = -4; di <= 4; ++di)
+	{
+		double dp = di * dlnp;
+		double pd = exp(lnp + dp);
+		double fd[TTSE_ROW_COLUMNS];
+
+		if (pd < psatmin || pd > pmax)
+			continue;
+
+		ttse_row_values(t->kind, pd, fd);
+		for (k = 0; k < TTSE_ROW_COLUMNS; ++k)
+		{
+			const double* row = t->rows[i][k];
+			double err = fabs(row[0] + dp * (row[1] + dp * row[2] / 2)
+					- fd[k]);
+
+			/* the boundaries that are not defined at the row */
+			if (err > t->rows_err[i][k] || isnan(err))
+				t->rows_err[i][k] = err;
+		}
+	}
+
+	/* for the higher-order terms in between, and the round-off */
+	for (k = 0; k < TTSE_ROW_COLUMNS; ++k)
+		t->rows_err[i][k] = t->rows_err[i][k] * 2
+			+ fabs(t->rows[i][k][0]) * 1E-12;
+}
+
+static void ttse_build(const h2o_ttse_t* tab, struct ttse_table* t,
+		enum ttse_kind kind, double ymin, double ymax)
+{
+	int i, j, k, d;
+
+	t->kind = kind;
+	t->ymin = ymin;
+	t->ystep = (ymax - ymin) / (TTSE_NY - 1);
+	t->yscale = 1 / t->ystep;
+
+	for (i = 0; i < TTSE_NP; ++i)
+	{
+		double p = ttse_p(tab, i);
+		unsigned char in_range[TTSE_NY];
+
+		ttse_build_row(tab, t, i);
+
+		for (j = 0; j < TTSE_NY; ++j)
+		{
+			double y = t->ymin + j * t->ystep;
+			h2o_t state = kind == TTSE_PH ? h2o_new_ph(p, y)
+				: h2o_new_ps(p, y);
+			enum h2o_region region = h2o_get_region(state);
+
+			for (k = 0; k < TTSE_COLUMNS; ++k)
+				for (d = 0; d < TTSE_DERIVS; ++d)
+					t->nodes[i][j][k][d] = NAN;
+			t->regions[i][j] = H2O_REGION_OUT_OF_RANGE;
+
+			/* the backward equations give the initial guess;
+			 * the two-phase nodes are never used */
+			in_range[j] = region != H2O_REGION_OUT_OF_RANGE;
+			if (region == H2O_REGION1 || region == H2O_REGION2
+					|| region == H2O_REGION3)
+				ttse_solve_node(tab, t, i, j, region,
+						h2o_get_T(state), h2o_get_v(state));
+			if (!isnan(t->nodes[i][j][TTSE_T][TTSE_F]))
+				t->regions[i][j] = region;
+		}
+
+		/* extend the equations a node past the ends of the range
+		 * (below Tmin and above Tb25), so that the points next to them
+		 * have a node on the same side */
+		for (j = 0; j < TTSE_NY; ++j)
+		{
+			const double (*next)[TTSE_DERIVS];
+			enum h2o_region region;
+
+			if (in_range[j])
+				continue;
+			else if (j + 1 < TTSE_NY && in_range[j + 1])
+			{
+				next = t->nodes[i][j + 1];
+				region = H2O_REGION1;
+			}
+			else if (j > 0 && in_range[j - 1])
+			{
+				next = t->nodes[i][j - 1];
+				region = H2O_REGION2;
+			}
+			else
+				continue;
+
+			if (!isnan(next[TTSE_T][TTSE_F]))
+				ttse_solve_node(tab, t, i, j, region,
+						next[TTSE_T][TTSE_F], next[TTSE_V][TTSE_F]);
+			if (!isnan(t->nodes[i][j][TTSE_T][TTSE_F]))
+				t->regions[i][j] = region;
+		}
+	}
+}
+
+h2o_ttse_t* h2o_ttse_new(void)
+{
+	h2o_ttse_t* tab = malloc(sizeof(*tab));
+	int i;
+
+	if (!tab)
+		return NULL;
+
+	tab->lnpmin = log(psatmin);
+	tab->lnpstep = (log(pmax) - tab->lnpmin) / (TTSE_NP - 1);
+	tab->lnpscale = 1 / tab->lnpstep;
+	for (i = 0; i < TTSE_NP; ++i)
+		tab->pinv[i] = 1 / ttse_p(tab, i);
+
+	ttse_build(tab, &tab->ph, TTSE_PH, ttse_hmin, ttse_hmax);
+	ttse_build(tab, &tab->ps, TTSE_PS, ttse_smin, ttse_smax);
+
+	return tab;
+}
+
+void h2o_ttse_free(h2o_ttse_t* tab)
+{
+	free(tab);
+}
+
+/* Check whether node j of row i can be used for a point in the given
+ * region; below the critical point, it also has to be on the same side
+ * of the saturation line (Region 3 is on both). */
+static int ttse_node_ok(const struct ttse_table* t, int i, int j,
+		enum h2o_region region, int side, double y1, double y2)
+{
+	double yj = t->ymin + j * t->ystep;
+
+	if (j < 0 || j >= TTSE_NY || t->regions[i][j] != region)
+		return 0;
+
+	return side == 0 || (side < 0 ? yj <= y1 : yj >= y2);
+}
+
+/* The Taylor series of a row value. */
+static double ttse_row(const struct ttse_table* t, int i, double dp,
+		enum ttse_row_column col)
+{
+	const double* row = t->rows[i][col];
+
+	return row[0] + dp * (row[1] + dp * row[2] / 2);
+}
+
+/* Compare y with the boundary of the row: negative if y is below it,
+ * positive if above it, and zero if it is within the error of the
+ * Taylor series (or the boundary is not defined there). */
+static int ttse_compare(const struct ttse_table* t, int i, double dp,
+		enum ttse_row_column col, double y, double* b)
+{
+	*b = ttse_row(t, i, dp, col);
+
+	if (y < *b - t->rows_err[i][col])
+		return -1;
+	else if (y > *b + t->rows_err[i][col])
+		return 1;
+	return 0;
+}
+
+/* Find the state using the tables. The region is found from the row
+ * boundaries the same way h2o_new_ph() and h2o_new_ps() find it, and
+ * only the nodes solved in that region are used, so that the Taylor
+ * series do not cross the region boundaries (where the equations
+ * disagree a bit). Returns 0 if the state needs to be found using
+ * the exact functions, which includes the points within the error
+ * of the tabulated boundaries, Region 5 and the points out of range. */
+static int ttse_lookup(const h2o_ttse_t* tab, const struct ttse_table* t,
+		double p, double y, h2o_t* state)
+{
+	const double (*node)[TTSE_DERIVS];
+	double fy, dp, dy, T, b;
+	double y1 = NAN, y2 = NAN;
+	enum h2o_region region;
+	int i, j, c, side;
+
+	if (!(p >= psatmin && p <= pmax))
+		return 0;
+	if (t->kind == TTSE_PS && !(y >= smin))
+		return 0;
+
+	fy = (y - t->ymin) * t->yscale;
+	if (!(fy >= 0 && fy <= TTSE_NY - 1))
+		return 0;
+
+	i = ttse_row_index(tab, p, &dp);
+	j = (int) (fy + 0.5);
+
+	if (ttse_compare(t, i, dp, TTSE_YMIN, y, &b) <= 0)
+		return 0;
+
+	if (p <= psat12max)
+	{
+		c = ttse_compare(t, i, dp, TTSE_Y1, y, &y1);
+		if (c < 0)
+			region = H2O_REGION1;
+		else if (c == 0)
+			return 0;
+		else
+		{
+			c = ttse_compare(t, i, dp, TTSE_Y2, y, &y2);
+			if (c == 0)
+				return 0;
+			region = c < 0 ? H2O_REGION4 : H2O_REGION2;
+		}
+	}
+	else if (p > pcrit)
+	{
+		c = ttse_compare(t, i, dp, TTSE_YB13, y, &b);
+		if (c < 0)
+			region = H2O_REGION1;
+		else if (c == 0)
+			return 0;
+		else
+		{
+			c = ttse_compare(t, i, dp, TTSE_YB23, y, &b);
+			if (c == 0)
+				return 0;
+			region = c < 0 ? H2O_REGION3 : H2O_REGION2;
+		}
+
+		/* h2o_region_ph() takes the whole psat3(h) range as Region 3 */
+		if (t->kind == TTSE_PH && y >= psat3_hmin && y <= psat3_hmax)
+			region = H2O_REGION3;
+	}
+	/* Region 3 around the saturation line is bounded by psat3(y),
+	 * which is not tabulated */
+	else
+	{
+		region = t->kind == TTSE_PH ? h2o_region_ph(p, y)
+			: h2o_region_ps(p, y);
+		if (region != H2O_REGION1 && region != H2O_REGION2
+				&& region != H2O_REGION3 && region != H2O_REGION4)
+			return 0;
+
+		y1 = ttse_row(t, i, dp, TTSE_Y1);
+		y2 = ttse_row(t, i, dp, TTSE_Y2);
+	}
+
+	if (region == H2O_REGION2
+			&& ttse_compare(t, i, dp, TTSE_YB25, y, &b) >= 0)
+		return 0;
+
+	if (region == H2O_REGION4)
+	{
+		double Tsat, y2x, x;
+
+		if (p <= ttse_psat_rows_max)
+		{
+			Tsat = ttse_row(t, i, dp, TTSE_TSAT);
+			y2x = ttse_row(t, i, dp, TTSE_Y2X);
+		}
+		else
+		{
+			struct h2o_sat approx;
+
+			h2o_region4_sat_approx_p(p, &approx);
+			Tsat = approx.T;
+			y1 = t->kind == TTSE_PH ? approx.liquid.h : approx.liquid.s;
+			y2x = t->kind == TTSE_PH ? approx.vapour.h : approx.vapour.s;
+		}
+
+		x = (y - y1) / (y2x - y1);
+		/* the tabulated saturation line disagrees */
+		if (!(x >= 0 && x <= 1))
+			return 0;
+
+		state->region = H2O_REGION4;
+		state->_arg1 = Tsat;
+		state->_arg2 = x;
+		return 1;
+	}
+
+	/* use a node of the same phase (the two-phase ones are NaN);
+	 * near the critical point, the dome can be narrower than a cell */
+	if (p >= pcrit)
+		side = 0;
+	else
+	{
+		side = y < y1 ? -1 : y > y2 ? 1 : 0;
+		if (side == 0)
+			return 0;
+	}
+
+	/* the nearest node, or the other one of the cell if that one is
+	 * in another region or on the other side of the saturation line */
+	if (!ttse_node_ok(t, i, j, region, side, y1, y2))
+	{
+		j += fy > j ? 1 : -1;
+		if (!ttse_node_ok(t, i, j, region, side, y1, y2))
+			return 0;
+	}
+
+	node = t->nodes[i][j];
+	dy = y - (t->ymin + j * t->ystep);
+
+#define TTSE_TAYLOR(col) \
+	(node[col][TTSE_F] + dp * node[col][TTSE_FP] + dy * node[col][TTSE_FY] \
+		+ dp * dp * node[col][TTSE_FPP] / 2 + dp * dy * node[col][TTSE_FPY] \
+		+ dy * dy * node[col][TTSE_FYY] / 2)
+
+	T = TTSE_TAYLOR(TTSE_T);
+	/* leave the range checks to the exact functions */
+	if (!(T >= Tmin && T <= Tb25))
+		return 0;
+
+	state->region = region;
+	if (region == H2O_REGION3)
+		state->_arg1 = 1 / TTSE_TAYLOR(TTSE_V);
+	else
+		state->_arg1 = p;
+	state->_arg2 = T;
+
+#undef TTSE_TAYLOR
+
+	return 1;
+}
+
+h2o_t h2o_ttse_new_ph(const h2o_ttse_t* tab, double p, double h)
+{
+	H2O_STATS_SCOPE(H2O_STATS_TTSE_NEW_PH);
+	h2o_t ret;
+
+	if (!ttse_lookup(tab, &tab->ph, p, h, &ret))
+		ret = h2o_new_ph(p, h);
+
+	return ret;
+}
+
+h2o_t h2o_ttse_new_ps(const h2o_ttse_t* tab, double p, double s)
+{
+	H2O_STATS_SCOPE(H2O_STATS_TTSE_NEW_PS);
+	h2o_t ret;
+
+	if (!ttse_lookup(tab, &tab->ps, p, s, &ret))
+		ret = h2o_new_ps(p, s);
+
+	return ret;
+}
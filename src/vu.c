@@ -0,0 +1,1097 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include "consts.h"
+#include "boundaries.h"
+#include "h2o.h"
+#include "region1.h"
+#include "region2.h"
+#include "region3.h"
+#include "region4.h"
+#include "region5.h"
+#include "stats.h"
+#include "xmath.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+
+/* (v, u) state points: the iterative solver, and the SBTL tables
+ * (after the IAPWS Guideline on the Fast Calculation of Steam and Water
+ * Properties with the Spline-Based Table Look-Up Method) built on it */
+
+typedef void (*props_func_t)(double, double, struct h2o_props*);
+
+/* Region 3: solve u(1/v, T) = u for T, starting with the given T.
+ * cv is du/dT at constant density, so this is the plain Newton. */
+static int vu_solve_rhoT(double v, double u, double* T)
+{
+	double rho = 1 / v;
+	int i;
+
+	for (i = 0; i < 30; ++i)
+	{
+		struct h2o_props props;
+		double dT;
+
+		h2o_region3_props_rhoT(rho, *T, &props);
+		if (fabs(props.u - u) < 1E-10)
+			return 1;
+
+		dT = (props.u - u) / props.cv;
+		if (dT > 50)
+			dT = 50;
+		else if (dT < -50)
+			dT = -50;
+		*T -= dT;
+
+		/* also catches NaN */
+		if (!(*T > Tb13 - 50 && *T < Tb25))
+			return 0;
+	}
+
+	return 0;
+}
+
+/* The temperature range of a region at a given pressure. If meta is
+ * true, the range extends over the saturation line and a bit out
+ * of the IF97 range. */
+static void vu_T_range(enum h2o_region region, double p, int meta,
+		double* Tlow, double* Thigh)
+{
+	/* the lower bound of Region 2 */
+	double Tb;
+
+	if (p > psat12max)
+		Tb = h2o_b23_T_p(p);
+	else if (meta || p < psatmin)
+		Tb = Tmin;
+	else
+		Tb = h2o_region4_T_p(p);
+
+	switch (region)
+	{
+		case H2O_REGION1:
+			*Tlow = meta ? Tmin - 50 : Tmin;
+			*Thigh = p <= psat12max && !meta ? Tb : Tb13;
+			break;
+		case H2O_REGION2:
+			*Tlow = Tb;
+			*Thigh = meta ? Tmax : Tb25;
+			break;
+		case H2O_REGION5:
+			*Tlow = Tb25;
+			*Thigh = Tmax;
+			break;
+		default:
+			assert(not_reached);
+	}
+}
+
+/* Regions 1, 2 and 5: solve v(p, T) = v, u(p, T) = u for (p, T),
+ * starting with the given ones. The Jacobian is computed using finite
+ * differences, which is good enough for the Newton to converge.
+ *
+ * The equations can be evaluated a bit outside their regions, and near
+ * the saturation line and B23 they give other, spurious solutions
+ * there. To avoid them, the steps are cut at the region boundaries. */
+static int vu_solve_pT(enum h2o_region region, double v, double u,
+		int meta, double* p, double* T)
+{
+	props_func_t props_func;
+	double lnv = log(v);
+	double lastres = 0;
+	int cuts = 0;
+	int i;
+
+	switch (region)
+	{
+		case H2O_REGION1:
+			props_func = h2o_region1_props_pT;
+			break;
+		case H2O_REGION2:
+			props_func = h2o_region2_props_pT;
+			break;
+		case H2O_REGION5:
+			props_func = h2o_region5_props_pT;
+			break;
+		default:
+			assert(not_reached);
+			return 0;
+	}
+
+	for (i = 0; i < 50; ++i)
+	{
+		struct h2o_props props, props_p, props_T;
+		double hp = (fabs(*p) + 1E-3) * 1E-6;
+		double hT = *T * 1E-6;
+		double r1, r2, res, j11, j12, j21, j22, det, dp, dT, step;
+		double Tlow = Tmin, Thigh = Tmax;
+		double phigh = meta ? 2 * pmax : pmax;
+		int cut = 0;
+
+		/* the metastable liquid can be under tension; also catches NaN */
+		if (!(*p > 0 || (meta && *p > -pmax)))
+			return 0;
+		else if (*p > phigh)
+		{
+			*p = phigh;
+			cut = 1;
+		}
+
+		vu_T_range(region, *p, meta, &Tlow, &Thigh);
+		if (*T < Tlow)
+		{
+			*T = Tlow;
+			cut = 1;
+		}
+		else if (*T > Thigh)
+		{
+			*T = Thigh;
+			cut = 1;
+		}
+		else if (!(*T == *T))
+			return 0;
+
+		/* in the liquid, v is barely affected by p, so check
+		 * the residuals rather than the steps */
+		props_func(*p, *T, &props);
+		r1 = log(props.v) - lnv;
+		r2 = props.u - u;
+		if (fabs(r1) < 1E-14 && fabs(r2) < 1E-10)
+			return 1;
+
+		/* if the steps keep on getting cut without getting closer,
+		 * the solution is out of the region */
+		res = fabs(r1) + fabs(r2) * 1E-3;
+		if (!cut || i == 0 || res < 0.5 * lastres)
+			cuts = 0;
+		else if (++cuts == 5)
+			return 0;
+		lastres = res;
+
+		props_func(*p + hp, *T, &props_p);
+		props_func(*p, *T + hT, &props_T);
+		j11 = (log(props_p.v) - log(props.v)) / hp;
+		j12 = (log(props_T.v) - log(props.v)) / hT;
+		j21 = (props_p.u - props.u) / hp;
+		j22 = (props_T.u - props.u) / hT;
+
+		det = j11 * j22 - j12 * j21;
+		dp = (r1 * j22 - r2 * j12) / det;
+		dT = (j11 * r2 - j21 * r1) / det;
+
+		/* keep the steps within reason far from the solution,
+		 * scaling both to preserve the direction */
+		step = 1;
+		if (meta)
+		{
+			if (fabs(dp) > fabs(*p) + 1)
+				step = (fabs(*p) + 1) / fabs(dp);
+		}
+		else if (dp > *p * 0.75)
+			step = *p * 0.75 / dp;
+		else if (dp < -*p * 3)
+			step = -*p * 3 / dp;
+		if (fabs(dT) * step > 50)
+			step = 50 / fabs(dT);
+
+		*p -= dp * step;
+		*T -= dT * step;
+	}
+
+	return 0;
+}
+
+/* Dryness of the saturated mixture at T giving v, and the one giving u;
+ * they are equal at the two-phase solution. */
+static double vu_sat_residual(const struct h2o_sat* sat, double v, double u)
+{
+	double xv = (v - sat->liquid.v) / (sat->vapour.v - sat->liquid.v);
+	double xu = (u - sat->liquid.u) / (sat->vapour.u - sat->liquid.u);
+
+	return xv - xu;
+}
+
+typedef void (*sat_func_t)(double, struct h2o_sat*);
+
+/* Region 4: find T at which v and u give the same dryness, using
+ * the Illinois method (the residual grows with T). Returns NaN if there
+ * is no such temperature between Ta and Tcrit. */
+static double vu_solve_Tx(sat_func_t sat_func, double Ta, double v, double u)
+{
+	struct h2o_sat sat;
+	double Tb = Tcrit;
+	double fa, fb;
+	int side = 0;
+	int i;
+
+	sat_func(Ta, &sat);
+	fa = vu_sat_residual(&sat, v, u);
+	sat_func(Tb, &sat);
+	fb = vu_sat_residual(&sat, v, u);
+
+	if (!(fa <= 0 && fb >= 0))
+		return NAN;
+
+	for (i = 0; i < 100 && Tb - Ta > 1E-12 * Tb; ++i)
+	{
+		double T = (Ta * fb - Tb * fa) / (fb - fa);
+		double f;
+
+		sat_func(T, &sat);
+		f = vu_sat_residual(&sat, v, u);
+
+		if (f == 0)
+			return T;
+		else if (f < 0)
+		{
+			Ta = T;
+			fa = f;
+			if (side == -1)
+				fb /= 2;
+			side = -1;
+		}
+		else
+		{
+			Tb = T;
+			fb = f;
+			if (side == 1)
+				fa /= 2;
+			side = 1;
+		}
+	}
+
+	return (Ta + Tb) / 2;
+}
+
+/* Find T at which the saturated phase has the given volume. */
+static double vu_T_vsat(sat_func_t sat_func, double v)
+{
+	struct h2o_sat sat;
+	double Ta, Tb;
+	int liquid, i;
+
+	sat_func(Tcrit, &sat);
+	if (v <= sat.liquid.v)
+	{
+		/* v' falls below 4 °C, use only the part above */
+		liquid = 1;
+		Ta = 277.13;
+	}
+	else if (v >= sat.vapour.v)
+	{
+		liquid = 0;
+		Ta = Tmin;
+	}
+	else
+		return Tcrit;
+	Tb = Tcrit;
+
+	for (i = 0; i < 60; ++i)
+	{
+		double T = (Ta + Tb) / 2;
+		double vsat;
+
+		sat_func(T, &sat);
+		vsat = liquid ? sat.liquid.v : sat.vapour.v;
+
+		if ((vsat < v) == liquid)
+			Ta = T;
+		else
+			Tb = T;
+	}
+
+	return (Ta + Tb) / 2;
+}
+
+/* Check whether (v, T) is inside the saturation dome. */
+static int vu_in_dome(double v, double T)
+{
+	struct h2o_sat sat;
+
+	if (T >= Tcrit)
+		return 0;
+
+	h2o_region4_sat_T(T, &sat);
+	return v > sat.liquid.v && v < sat.vapour.v;
+}
+
+/* Solve for a single-phase state in the given region, starting from
+ * (arg1, arg2) in the h2o_t convention. If meta is true, the state
+ * is allowed to be metastable (inside the saturation dome). */
+static int vu_solve_region(enum h2o_region region, double v, double u,
+		double arg1, double arg2, int meta, h2o_t* out)
+{
+	switch (region)
+	{
+		case H2O_REGION3:
+			if (!vu_solve_rhoT(v, u, &arg2))
+				return 0;
+			if (!meta && (h2o_region_pT(h2o_region3_p_rhoT(1 / v, arg2),
+							arg2) != H2O_REGION3 || vu_in_dome(v, arg2)))
+				return 0;
+
+			out->region = region;
+			out->_arg1 = 1 / v;
+			out->_arg2 = arg2;
+			return 1;
+		case H2O_REGION1:
+		case H2O_REGION2:
+		case H2O_REGION5:
+			break;
+		default:
+			assert(not_reached);
+			return 0;
+	}
+
+	if (!vu_solve_pT(region, v, u, meta, &arg1, &arg2)
+			|| (!meta && h2o_region_pT(arg1, arg2) != region))
+		return 0;
+
+	out->region = region;
+	out->_arg1 = arg1;
+	out->_arg2 = arg2;
+	return 1;
+}
+
+/* Solve for the single-phase state, trying all the regions. */
+static int vu_solve_single(double v, double u, const h2o_t* hint,
+		h2o_t* out)
+{
+	double T;
+	int i;
+
+	if (hint && hint->region != H2O_REGION4
+			&& vu_solve_region(hint->region, v, u,
+				hint->_arg1, hint->_arg2, 0, out))
+		return 1;
+
+	if (vu_solve_region(H2O_REGION3, v, u, NAN, 700, 0, out))
+		return 1;
+
+	T = Tmin + u / 4.2;
+	if (T > Tb13)
+		T = Tb13;
+	if (vu_solve_region(H2O_REGION1, v, u, 50, T, 0, out))
+		return 1;
+
+	/* near Tb13, the Newton can get pushed away along the saturation
+	 * line; retry from the saturated liquid of the same volume */
+	T = v < 1 / rhocrit ? vu_T_vsat(h2o_region4_sat_approx_T, v) : Tcrit;
+	if (T < Tb13 && vu_solve_region(H2O_REGION1, v, u,
+				h2o_region4_p_T(T) + 1, T, 0, out))
+		return 1;
+
+	/* ideal gas guesses for the steam regions, kept above
+	 * the saturation line since the Region 2 equation diverges
+	 * in the liquid */
+	T = Tmin + (u - 2375) / 1.5;
+	if (T < Tmin)
+		T = Tmin;
+	else if (T > Tb25)
+		T = Tb25;
+	for (i = 0; i < 5; ++i)
+	{
+		double p = R * T / v * 1E-3;
+		double Tsat;
+
+		if (p >= pcrit)
+			break;
+		Tsat = h2o_region4_T_p(p > psatmin ? p : psatmin);
+		if (T > Tsat)
+			break;
+		T = Tsat + 1;
+	}
+	if (vu_solve_region(H2O_REGION2, v, u, R * T / v * 1E-3, T, 0, out))
+		return 1;
+
+	/* close to the saturation line, the Newton may end up
+	 * in the metastable vapour instead; start from the saturated
+	 * vapour of the same volume then */
+	T = v > 1 / rhocrit ? vu_T_vsat(h2o_region4_sat_approx_T, v) : Tcrit;
+	if (T < Tcrit && vu_solve_region(H2O_REGION2, v, u,
+				h2o_region4_p_T(T), T + 0.1, 0, out))
+		return 1;
+
+	T = Tb25 + (u - 3666) / 1.9;
+	if (T < Tb25)
+		T = Tb25;
+	else if (T > Tmax)
+		T = Tmax;
+	if (vu_solve_region(H2O_REGION5, v, u, R * T / v * 1E-3, T, 0, out))
+		return 1;
+
+	return 0;
+}
+
+static void vu_solve(double v, double u, const h2o_t* hint, h2o_t* out)
+{
+	double T;
+
+	if (vu_solve_single(v, u, hint, out))
+		return;
+
+	T = vu_solve_Tx(h2o_region4_sat_T, Tmin, v, u);
+	if (!isnan(T))
+	{
+		struct h2o_sat sat;
+		double x;
+
+		h2o_region4_sat_T(T, &sat);
+		x = (u - sat.liquid.u) / (sat.vapour.u - sat.liquid.u);
+
+		if (x >= 0 && x <= 1)
+		{
+			out->region = H2O_REGION4;
+			out->_arg1 = T;
+			out->_arg2 = x;
+			return;
+		}
+	}
+
+	out->region = H2O_REGION_OUT_OF_RANGE;
+}
+
+h2o_t h2o_new_vu(double v, double u)
+{
+	H2O_STATS_SCOPE(H2O_STATS_NEW_VU);
+	h2o_t ret;
+
+	if (v > 0)
+		vu_solve(v, u, NULL, &ret);
+	else
+		ret.region = H2O_REGION_OUT_OF_RANGE;
+
+	return ret;
+}
+
+/* The SBTL grid: x = ln(v - sbtl_v0) and u, both uniform. The shift
+ * gives the liquid, where v barely changes, most of the nodes. */
+
+static const double sbtl_v0 = 0.0009; /* [m³/kg] */
+static const double sbtl_vmax = 1000; /* [m³/kg] */
+static const double sbtl_umin = -1; /* [kJ/kg] */
+static const double sbtl_umax = 3700; /* [kJ/kg] */
+
+#define SBTL_NX 768
+#define SBTL_NY 384
+
+enum sbtl_column
+{
+	SBTL_T,
+	SBTL_P,
+	/* the temperature of the saturated mixture with the same v and u,
+	 * valid also outside the dome as long as there is one */
+	SBTL_TSAT,
+
+	SBTL_COLUMNS
+};
+
+/* the single-phase nodes within that many nodes from the saturation
+ * line are extended into the dome with the metastable states, so that
+ * the bicubics do not have to cross it */
+#define SBTL_META_NODES 3
+
+struct h2o_sbtl
+{
+	double xmin, xstep, ustep;
+
+	/* u on the saturation line as a function of x, NaN outside it;
+	 * points closer than usat_margin[i] to it (between the nodes i
+	 * and i + 1) are solved exactly */
+	double usat[SBTL_NX];
+	double usat_margin[SBTL_NX];
+	/* closer than that, the interpolated p and T are not accurate
+	 * enough to tell which side of the saturation line they are on */
+	double pmargin[SBTL_NX];
+	/* v range of the saturation line */
+	double vsatmin, vsatmax;
+
+	double nodes[SBTL_NY][SBTL_NX][SBTL_COLUMNS];
+	/* region of the single-phase nodes, H2O_REGION_OUT_OF_RANGE
+	 * if they are not valid */
+	unsigned char regions[SBTL_NY][SBTL_NX];
+};
+
+static double sbtl_v(const h2o_sbtl_t* tab, double fx)
+{
+	return sbtl_v0 + exp(tab->xmin + fx * tab->xstep);
+}
+
+/* u on the saturation line for the given v. Below vsatmin, it follows
+ * the branch above 4 °C, so that the interpolation does not run out
+ * of nodes at the end of the range. */
+static double sbtl_usat_exact(double v)
+{
+	struct h2o_sat sat;
+	const struct h2o_props* phase;
+
+	/* v' and v'' do not meet at the critical point, join them
+	 * with a line */
+	h2o_region4_sat_T(Tcrit, &sat);
+	if (v > sat.liquid.v && v < sat.vapour.v)
+		return sat.liquid.u + (sat.vapour.u - sat.liquid.u)
+			* (v - sat.liquid.v) / (sat.vapour.v - sat.liquid.v);
+
+	h2o_region4_sat_T(vu_T_vsat(h2o_region4_sat_T, v), &sat);
+	phase = v < 1 / rhocrit ? &sat.liquid : &sat.vapour;
+
+	/* v out of the saturation line range */
+	if (fabs(phase->v - v) > 1E-9 * v)
+		return NAN;
+	return phase->u;
+}
+
+/* Interpolate usat; NaN if the point is not covered by the dome. */
+static double sbtl_usat(const h2o_sbtl_t* tab, double fx)
+{
+	double w[4];
+	int base = xmath_lagrange4_weights(fx, SBTL_NX, w);
+	const double* f = &tab->usat[base];
+
+	return w[0] * f[0] + w[1] * f[1] + w[2] * f[2] + w[3] * f[3];
+}
+
+/* Interpolate the given column over the 4x4 nodes; NaN if any of them
+ * is not valid. */
+static double sbtl_interp(const h2o_sbtl_t* tab, int basex, int basey,
+		const double wx[4], const double wy[4], enum sbtl_column col)
+{
+	double ret = 0;
+	int i, j;
+
+	for (j = 0; j < 4; ++j)
+	{
+		double row = 0;
+
+		for (i = 0; i < 4; ++i)
+			row += wx[i] * tab->nodes[basey + j][basex + i][col];
+		ret += wy[j] * row;
+	}
+
+	return ret;
+}
+
+static void sbtl_build_usat(h2o_sbtl_t* tab)
+{
+	double err[SBTL_NX];
+	int i, k;
+
+	for (i = 0; i < SBTL_NX; ++i)
+		tab->usat[i] = sbtl_usat_exact(sbtl_v(tab, i));
+
+	/* the interpolation error, checked between the nodes */
+	for (i = 0; i < SBTL_NX - 1; ++i)
+	{
+		err[i] = 0;
+		for (k = 1; k < 4; ++k)
+		{
+			double fx = i + k / 4.;
+			double d = fabs(sbtl_usat(tab, fx)
+					- sbtl_usat_exact(sbtl_v(tab, fx)));
+
+			if (d > err[i])
+				err[i] = d;
+		}
+	}
+	err[SBTL_NX - 1] = 0;
+
+	/* twice that, including the neighbour cells */
+	for (i = 0; i < SBTL_NX; ++i)
+	{
+		double m = err[i];
+
+		if (i > 0 && err[i - 1] > m)
+			m = err[i - 1];
+		if (i < SBTL_NX - 1 && err[i + 1] > m)
+			m = err[i + 1];
+		tab->usat_margin[i] = 2 * m + 1E-6;
+	}
+}
+
+/* Solve for the single-phase (v, u) starting with the node (ni, nj),
+ * or without a hint if it is not valid. Returns the region,
+ * or H2O_REGION_OUT_OF_RANGE if there is no solution. */
+static enum h2o_region sbtl_solve(const h2o_sbtl_t* tab, double v, double u,
+		int ni, int nj, int meta, struct h2o_props* props)
+{
+	h2o_t state, hint;
+	int ret;
+
+	hint.region = H2O_REGION_OUT_OF_RANGE;
+	if (ni >= 0 && ni < SBTL_NX && nj >= 0 && nj < SBTL_NY
+			&& tab->regions[nj][ni] != H2O_REGION_OUT_OF_RANGE)
+	{
+		const double* hnode = tab->nodes[nj][ni];
+
+		hint.region = tab->regions[nj][ni];
+		hint._arg1 = hint.region == H2O_REGION3 ? NAN : hnode[SBTL_P];
+		hint._arg2 = hnode[SBTL_T];
+	}
+
+	if (meta)
+		ret = h2o_is_valid(hint) && vu_solve_region(hint.region, v, u,
+				hint._arg1, hint._arg2, 1, &state);
+	else
+		ret = vu_solve_single(v, u,
+				h2o_is_valid(hint) ? &hint : NULL, &state);
+	/* Region 5 is not tabulated, Region 2 is extended over it instead
+	 * to keep the interpolation smooth */
+	if (!ret || state.region == H2O_REGION5)
+		return H2O_REGION_OUT_OF_RANGE;
+
+	/* h2o_get_*() do not support the metastable states */
+	switch (state.region)
+	{
+		case H2O_REGION1:
+			h2o_region1_props_pT(state._arg1, state._arg2, props);
+			break;
+		case H2O_REGION2:
+			h2o_region2_props_pT(state._arg1, state._arg2, props);
+			break;
+		case H2O_REGION3:
+			h2o_region3_props_rhoT(state._arg1, state._arg2, props);
+			break;
+		default:
+			assert(not_reached);
+	}
+
+	return state.region;
+}
+
+static void sbtl_solve_node(h2o_sbtl_t* tab, int i, int j, int ni, int nj,
+		int meta)
+{
+	double* node = tab->nodes[j][i];
+	struct h2o_props props;
+	enum h2o_region region = sbtl_solve(tab, sbtl_v(tab, i),
+			sbtl_umin + j * tab->ustep, ni, nj, meta, &props);
+
+	if (region == H2O_REGION_OUT_OF_RANGE)
+		return;
+
+	node[SBTL_T] = props.T;
+	node[SBTL_P] = props.p;
+	tab->regions[j][i] = region;
+}
+
+/* p - psat(T), positive in the single phase */
+static double sbtl_dpsat(double v, double p, double T)
+{
+	double dp = p - h2o_region4_p_T(T);
+
+	return v < 1 / rhocrit ? dp : -dp;
+}
+
+/* Compute the error of sbtl_dpsat() using the interpolated p and T
+ * between the nodes around the saturation line. */
+static void sbtl_build_pmargin(h2o_sbtl_t* tab)
+{
+	double err[SBTL_NX];
+	int i, j;
+
+	for (i = 0; i < SBTL_NX - 1; ++i)
+	{
+		double wx[4];
+		int basex = xmath_lagrange4_weights(i + 0.5, SBTL_NX, wx);
+		double ulow = fmin(tab->usat[i], tab->usat[i + 1]) - 2 * tab->ustep;
+		double uhigh = fmax(tab->usat[i], tab->usat[i + 1]) + 2 * tab->ustep;
+
+		err[i] = 0;
+		for (j = 0; j < SBTL_NY - 1; ++j)
+		{
+			double v = sbtl_v(tab, i + 0.5);
+			double u = sbtl_umin + (j + 0.5) * tab->ustep;
+			double wy[4], T, p;
+			int basey;
+			struct h2o_props props;
+
+			/* also skips the columns outside the dome */
+			if (!(u > ulow && u < uhigh))
+				continue;
+
+			basey = xmath_lagrange4_weights(j + 0.5, SBTL_NY, wy);
+			T = sbtl_interp(tab, basex, basey, wx, wy, SBTL_T);
+			p = sbtl_interp(tab, basex, basey, wx, wy, SBTL_P);
+			if (isnan(T) || isnan(p) || T >= Tcrit
+					|| sbtl_solve(tab, v, u, i, j, 1, &props)
+						== H2O_REGION_OUT_OF_RANGE
+					|| props.T >= Tcrit)
+				continue;
+
+			err[i] = fmax(err[i], fabs(sbtl_dpsat(v, p, T)
+					- sbtl_dpsat(v, props.p, props.T)));
+		}
+	}
+	err[SBTL_NX - 1] = 0;
+
+	for (i = 0; i < SBTL_NX; ++i)
+	{
+		double m = err[i];
+
+		if (i > 0 && err[i - 1] > m)
+			m = err[i - 1];
+		if (i < SBTL_NX - 1 && err[i + 1] > m)
+			m = err[i + 1];
+		tab->pmargin[i] = 2 * m + 1E-9;
+	}
+}
+
+h2o_sbtl_t* h2o_sbtl_new(void)
+{
+	h2o_sbtl_t* tab = malloc(sizeof(*tab));
+	unsigned char (*solved)[SBTL_NX] = malloc(sizeof(*solved) * SBTL_NY);
+	struct h2o_sat sat;
+	int i, j, k, d;
+
+	if (!tab || !solved)
+	{
+		free(tab);
+		free(solved);
+		return NULL;
+	}
+
+	tab->xmin = log(1 / 1045.5 - sbtl_v0);
+	tab->xstep = (log(sbtl_vmax - sbtl_v0) - tab->xmin) / (SBTL_NX - 1);
+	tab->ustep = (sbtl_umax - sbtl_umin) / (SBTL_NY - 1);
+
+	h2o_region4_sat_T(Tmin, &sat);
+	tab->vsatmin = sat.liquid.v;
+	tab->vsatmax = sat.vapour.v;
+
+	sbtl_build_usat(tab);
+
+	for (j = 0; j < SBTL_NY; ++j)
+	{
+		double u = sbtl_umin + j * tab->ustep;
+
+		for (i = 0; i < SBTL_NX; ++i)
+		{
+			double v = sbtl_v(tab, i);
+			double* node = tab->nodes[j][i];
+
+			for (k = 0; k < SBTL_COLUMNS; ++k)
+				node[k] = NAN;
+			tab->regions[j][i] = H2O_REGION_OUT_OF_RANGE;
+
+			/* extended a bit below Tmin, for the interpolation */
+			if (v >= tab->vsatmin && v <= tab->vsatmax)
+				node[SBTL_TSAT] = vu_solve_Tx(h2o_region4_sat_approx_T,
+						Tmin - 10, v, u);
+
+			/* the saturated mixture, there is no single-phase state */
+			if (u < tab->usat[i])
+				continue;
+
+			/* start with the previous node, if it was solved */
+			sbtl_solve_node(tab, i, j, i - 1, j, 0);
+			if (tab->regions[j][i] == H2O_REGION_OUT_OF_RANGE)
+				sbtl_solve_node(tab, i, j, i, j - 1, 0);
+		}
+	}
+
+	/* extend the single phase a node at a time into the dome (with
+	 * the metastable states) and out of range, starting from
+	 * the neighbours solved earlier */
+	for (d = 0; d < SBTL_META_NODES; ++d)
+	{
+		for (j = 0; j < SBTL_NY; ++j)
+			for (i = 0; i < SBTL_NX; ++i)
+				solved[j][i] = tab->regions[j][i] != H2O_REGION_OUT_OF_RANGE;
+
+		for (j = 0; j < SBTL_NY; ++j)
+		{
+			for (i = 0; i < SBTL_NX; ++i)
+			{
+				int di, dj;
+
+				for (dj = -1; dj <= 1; ++dj)
+					for (di = -1; di <= 1; ++di)
+					{
+						int ni = i + di, nj = j + dj;
+
+						if (tab->regions[j][i] != H2O_REGION_OUT_OF_RANGE
+								|| ni < 0 || ni >= SBTL_NX
+								|| nj < 0 || nj >= SBTL_NY
+								|| !solved[nj][ni])
+							continue;
+
+						sbtl_solve_node(tab, i, j, ni, nj, 1);
+					}
+			}
+		}
+	}
+
+	sbtl_build_pmargin(tab);
+
+	free(solved);
+	return tab;
+}
+
+void h2o_sbtl_free(h2o_sbtl_t* tab)
+{
+	free(tab);
+}
+
+/* Solve vu_sat_residual() = 0 for T using the secant method over
+ * h2o_sat_approx_T(), starting with T and T + dT. Returns the solution
+ * with sat filled in for it, or NaN if it does not converge within
+ * the saturation line. */
+static double sbtl_secant_Tx(double v, double u, double T, double dT,
+		struct h2o_sat* sat)
+{
+	double T1 = T + dT;
+	double f, f1;
+	int i;
+
+	h2o_region4_sat_approx_T(T, sat);
+	f = vu_sat_residual(sat, v, u);
+
+	for (i = 0; i < 8; ++i)
+	{
+		double T2;
+
+		/* also catches NaN */
+		if (!(T1 >= Tmin - 10 && T1 <= Tcrit))
+			return NAN;
+
+		h2o_region4_sat_approx_T(T1, sat);
+		f1 = vu_sat_residual(sat, v, u);
+		if (f1 == f)
+			return T1;
+
+		T2 = T1 - f1 * (T1 - T) / (f1 - f);
+		if (fabs(T2 - T1) < 1E-9)
+			return T1;
+
+		T = T1;
+		f = f1;
+		T1 = T2;
+	}
+
+	return NAN;
+}
+
+/* Fill in the two-phase state (and props, unless NULL). */
+static int sbtl_lookup_Tx(const h2o_sbtl_t* tab, double v, double u,
+		int basex, int basey, const double wx[4], const double wy[4],
+		h2o_t* state, struct h2o_props* props)
+{
+	struct h2o_sat sat;
+	double T = sbtl_interp(tab, basex, basey, wx, wy, SBTL_TSAT);
+	double x;
+
+	/* Tsat has kinks where the saturation line equations switch, so
+	 * polish the interpolated one; close to the critical point,
+	 * the residual is steep and that takes a few steps */
+	T = sbtl_secant_Tx(v, u, T, 1E-3, &sat);
+
+	/* also catches NaN */
+	if (!(T >= Tmin && T <= Tcrit))
+		return 0;
+
+	x = (u - sat.liquid.u) / (sat.vapour.u - sat.liquid.u);
+	if (!(x >= 0 && x <= 1))
+		return 0;
+
+	state->region = H2O_REGION4;
+	state->_arg1 = T;
+	state->_arg2 = x;
+
+	if (props)
+	{
+		props->p = sat.p;
+		props->T = T;
+		props->x = x;
+		props->h = sat.liquid.h + (sat.vapour.h - sat.liquid.h) * x;
+		props->cp = props->w = NAN;
+	}
+
+	return 1;
+}
+
+/* Take a Newton step from the interpolated (p, T) using the forward
+ * equation of the region. In the liquid, p is very sensitive to v, and
+ * the interpolated one is only good to a few kPa; the step takes it
+ * (and T) to the precision of the equation, so that p is within a small
+ * relative deviation even at the lowest pressures. cp and w (if props
+ * is not NULL) are taken from the equation at the interpolated point. */
+static void sbtl_polish(enum h2o_region region, double v, double u,
+		double* p, double* T, struct h2o_props* props)
+{
+	struct h2o_props eq;
+	double dp, dT;
+
+	if (region == H2O_REGION3)
+	{
+		double dpdrho, dpdT;
+
+		/* v is exact, so it is a plain Newton in T */
+		h2o_region3_props_derivs_rhoT(1 / v, *T, &eq, &dpdrho, &dpdT);
+		dT = (eq.u - u) / eq.cv;
+		dp = *p - (eq.p - dpdT * dT);
+	}
+	else
+	{
+		double dvdp, dvdT, j21, j22, det;
+		double r1, r2;
+
+		if (region == H2O_REGION1)
+			h2o_region1_props_derivs_pT(*p, *T, &eq, &dvdp, &dvdT);
+		else
+			h2o_region2_props_derivs_pT(*p, *T, &eq, &dvdp, &dvdT);
+
+		r1 = eq.v - v;
+		r2 = eq.u - u;
+		j21 = -(*T * dvdT + *p * dvdp) * 1E3;
+		j22 = eq.cp - *p * dvdT * 1E3;
+
+		det = dvdp * j22 - dvdT * j21;
+		dp = (r1 * j22 - r2 * dvdT) / det;
+		dT = (dvdp * r2 - j21 * r1) / det;
+	}
+
+	*p -= dp;
+	*T -= dT;
+
+	if (props)
+	{
+		props->cp = eq.cp;
+		props->w = eq.w;
+	}
+}
+
+/* Fill in state (and the props specific to the phase, unless NULL)
+ * using the tables. Returns 0 if the point needs to be solved exactly. */
+static int sbtl_lookup_state(const h2o_sbtl_t* tab, double v, double u,
+		h2o_t* state, struct h2o_props* props)
+{
+	double fx, fy, wx[4], wy[4], T, p;
+	int basex, basey;
+	int near_sat = 0;
+	enum h2o_region region;
+
+	if (!(v > sbtl_v0 && v <= sbtl_vmax && u >= sbtl_umin && u <= sbtl_umax))
+		return 0;
+
+	fx = (log(v - sbtl_v0) - tab->xmin) / tab->xstep;
+	fy = (u - sbtl_umin) / tab->ustep;
+	if (!(fx >= 0))
+		return 0;
+
+	basex = xmath_lagrange4_weights(fx, SBTL_NX, wx);
+	basey = xmath_lagrange4_weights(fy, SBTL_NY, wy);
+
+	if (v >= tab->vsatmin && v <= tab->vsatmax)
+	{
+		double us = sbtl_usat(tab, fx);
+		double margin = tab->usat_margin[(int) fx];
+
+		if (u < us - margin)
+			return sbtl_lookup_Tx(tab, v, u, basex, basey, wx, wy,
+					state, props);
+		/* at the ends of the saturation line, usat runs out of nodes,
+		 * rely on p and T only there; also catches NaN */
+		near_sat = !(u > us + margin);
+	}
+
+	T = sbtl_interp(tab, basex, basey, wx, wy, SBTL_T);
+	p = sbtl_interp(tab, basex, basey, wx, wy, SBTL_P);
+	if (isnan(T) || isnan(p))
+		return 0;
+
+	/* use p and T to tell the side of the saturation line */
+	if (near_sat && T < Tcrit)
+	{
+		double dp = sbtl_dpsat(v, p, T);
+
+		if (fabs(dp) <= tab->pmargin[(int) fx])
+			return 0;
+		else if (dp < 0)
+			return sbtl_lookup_Tx(tab, v, u, basex, basey, wx, wy,
+					state, props);
+	}
+
+	region = h2o_region_pT(p, T);
+	/* out of range, past the saturation line outside the dome
+	 * (below 4 °C), or in Region 5 (which is not tabulated) */
+	if (region == H2O_REGION_OUT_OF_RANGE || region == H2O_REGION5
+			|| (region == H2O_REGION2 && v < 1 / rhocrit && p < pcrit)
+			|| (region == H2O_REGION1 && v > 1 / rhocrit))
+		return 0;
+
+	sbtl_polish(region, v, u, &p, &T, props);
+
+	state->region = region;
+	state->_arg1 = region == H2O_REGION3 ? 1 / v : p;
+	state->_arg2 = T;
+
+	if (props)
+	{
+		props->p = p;
+		props->T = T;
+		props->x = region == H2O_REGION3 ? NAN
+			: region == H2O_REGION1 ? 0 : 1;
+		props->h = u + p * v * 1E3;
+	}
+
+	return 1;
+}
+
+/* Fill in state (and props, unless NULL) using the tables.
+ * Returns 0 if the point needs to be solved exactly. */
+static int sbtl_lookup(const h2o_sbtl_t* tab, double v, double u,
+		h2o_t* state, struct h2o_props* props)
+{
+	if (!sbtl_lookup_state(tab, v, u, state, props))
+		return 0;
+
+	if (props)
+	{
+		props->v = v;
+		props->rho = 1 / v;
+		props->u = u;
+		props->s = props->cv = NAN;
+	}
+
+	return 1;
+}
+
+h2o_t h2o_sbtl_new_vu(const h2o_sbtl_t* tab, double v, double u)
+{
+	H2O_STATS_SCOPE(H2O_STATS_SBTL_NEW_VU);
+	h2o_t ret;
+
+	if (!sbtl_lookup(tab, v, u, &ret, NULL))
+		ret = h2o_new_vu(v, u);
+
+	return ret;
+}
+
+int h2o_sbtl_get_vu(const h2o_sbtl_t* tab, double v, double u,
+		struct h2o_props* out)
+{
+	h2o_t state;
+
+	if (sbtl_lookup(tab, v, u, &state, out))
+		return 1;
+
+	state = h2o_new_vu(v, u);
+	if (!h2o_is_valid(state))
+		return 0;
+
+	h2o_get_all(state, out);
+	/* keep the same set of properties as the table look-up */
+	out->s = out->cv = NAN;
+	if (state.region == H2O_REGION4)
+		out->cp = out->w = NAN;
+
+	return 1;
+}
@@ -7,12 +7,81 @@
 #	include "config.h"
 #endif
 
+#include "consts.h"
 #include "xmath.h"
 
 #include <assert.h>
 #include <math.h>
+#include <stddef.h>
 
-static void fill_powers(double* powers, const double* exponents,
+enum xmath_variant xmath_current_variant = XMATH_VARIANT_GENERIC;
+
+const char* xmath_variant_name(enum xmath_variant variant)
+{
+	switch (variant)
+	{
+		case XMATH_VARIANT_GENERIC:
+			return "generic";
+		case XMATH_VARIANT_FMA:
+			return "fma";
+		case XMATH_VARIANT_AVX2:
+			return "avx2";
+		case XMATH_VARIANT_AVX512:
+			return "avx512";
+		default:
+			assert(not_reached);
+	}
+
+	return NULL;
+}
+
+int xmath_variant_supported(enum xmath_variant variant)
+{
+	switch (variant)
+	{
+		case XMATH_VARIANT_GENERIC:
+			return 1;
+#ifdef H2O_CPU_DISPATCH
+		case XMATH_VARIANT_FMA:
+			return __builtin_cpu_supports("fma");
+		case XMATH_VARIANT_AVX2:
+			return __builtin_cpu_supports("avx2")
+				&& __builtin_cpu_supports("fma");
+		case XMATH_VARIANT_AVX512:
+			return __builtin_cpu_supports("avx512f")
+				&& __builtin_cpu_supports("avx2")
+				&& __builtin_cpu_supports("fma");
+#endif
+		default:
+			return 0;
+	}
+}
+
+int xmath_set_variant(enum xmath_variant variant)
+{
+	if (!xmath_variant_supported(variant))
+		return 0;
+
+	xmath_current_variant = variant;
+	return 1;
+}
+
+#ifdef H2O_CPU_DISPATCH
+static void __attribute__((constructor)) xmath_select_variant(void)
+{
+	int variant;
+
+	__builtin_cpu_init();
+
+	for (variant = XMATH_VARIANT_MAX - 1; variant > 0; --variant)
+	{
+		if (xmath_set_variant(variant))
+			break;
+	}
+}
+#endif
+
+static XMATH_ALWAYS_INLINE void fill_powers(double* powers, const double* exponents,
 		int zeropos, int count, double expr, int deriv)
 {
 	int i;
@@ -44,7 +113,7 @@ static void fill_powers(double* powers, const double* exponents,
 	}
 }
 
-double poly_value(double x,
+static XMATH_ALWAYS_INLINE double poly_value_impl(double x,
 		int min, int max, int deriv,
 		const double n[])
 {
@@ -76,7 +145,13 @@ double poly_value(double x,
 	return sum;
 }
 
-double twoarg_poly_value(double x1, double x2,
+XMATH_DISPATCH(double, poly_value,
+		(double x,
+		int min, int max, int deriv,
+		const double n[]),
+		(x, min, max, deriv, n))
+
+static XMATH_ALWAYS_INLINE double twoarg_poly_value_impl(double x1, double x2,
 		const int I[], const double Ipows[], int Ipowzero,
 		int Ipowlen, int x1der,
 		const int J[], const double Jpows[], int Jpowzero,
@@ -122,3 +197,366 @@ double twoarg_poly_value(double x1, double x2,
 
 	return sum;
 }
+
+XMATH_DISPATCH(double, twoarg_poly_value,
+		(double x1, double x2,
+		const int I[], const double Ipows[], int Ipowzero,
+		int Ipowlen, int x1der,
+		const int J[], const double Jpows[], int Jpowzero,
+		int Jpowlen, int x2der,
+		const double n[], int nlen),
+		(x1, x2, I, Ipows, Ipowzero, Ipowlen, x1der,
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen))
+
+/* fill powers[] with x^e, der1[] with (x^e)' and der2[] with (x^e)'' */
+static XMATH_ALWAYS_INLINE void fill_power_derivs(double* powers, double* der1, double* der2,
+		const double* exponents, int zeropos, int count, double expr)
+{
+	int i;
+
+	fill_powers(powers, exponents, zeropos, count, expr, 0);
+
+	if (expr != 0)
+	{
+		double inv = 1 / expr;
+
+		for (i = 0; i < count; ++i)
+		{
+			double prev = powers[i] * inv;
+
+			der1[i] = exponents[i] * prev;
+			der2[i] = exponents[i] * (exponents[i] - 1) * prev * inv;
+		}
+	}
+	else /* x^e / x won't work, take the slow path */
+	{
+		fill_powers(der1, exponents, zeropos, count, expr, 1);
+		fill_powers(der2, exponents, zeropos, count, expr, 2);
+
+		for (i = 0; i < count; ++i)
+		{
+			der1[i] *= exponents[i];
+			der2[i] *= exponents[i] * (exponents[i] - 1);
+		}
+	}
+}
+
+static XMATH_ALWAYS_INLINE void twoarg_poly_derivs_impl(double x1, double x2,
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs* out)
+{
+	double val = 0, d1 = 0, d2 = 0, d11 = 0, d12 = 0, d22 = 0;
+
+	int i;
+
+	double x1powers[20], x1der1[20], x1der2[20];
+	double x2powers[34], x2der1[34], x2der2[34];
+
+	assert(Ipowlen <= 20);
+	assert(Jpowlen <= 34);
+
+	fill_power_derivs(x1powers, x1der1, x1der2,
+			Ipows, Ipowzero, Ipowlen, x1);
+	fill_power_derivs(x2powers, x2der1, x2der2,
+			Jpows, Jpowzero, Jpowlen, x2);
+
+	for (i = 1; i <= nlen; ++i)
+	{
+		int ii = I[i], ji = J[i];
+
+		double n1pow = n[i] * x1powers[ii];
+		double n1der1 = n[i] * x1der1[ii];
+
+		val += n1pow * x2powers[ji];
+		d1 += n1der1 * x2powers[ji];
+		d2 += n1pow * x2der1[ji];
+		d11 += n[i] * x1der2[ii] * x2powers[ji];
+		d12 += n1der1 * x2der1[ji];
+		d22 += n1pow * x2der2[ji];
+	}
+
+	out->val = val;
+	out->d1 = d1;
+	out->d2 = d2;
+	out->d11 = d11;
+	out->d12 = d12;
+	out->d22 = d22;
+}
+
+XMATH_DISPATCH_VOID(twoarg_poly_derivs,
+		(double x1, double x2,
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs* out),
+		(x1, x2, I, Ipows, Ipowzero, Ipowlen,
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out))
+
+/* tmp = expr^e, for a gap in the exponent sequence */
+static XMATH_ALWAYS_INLINE void fill_gap_n(double tmp[XMATH_LANES],
+		const double expr[XMATH_LANES], double e)
+{
+	int l;
+
+	if (e == (int) e)
+	{
+		for (l = 0; l < XMATH_LANES; ++l)
+			tmp[l] = xmath_powi(expr[l], e);
+	}
+	else
+	{
+		for (l = 0; l < XMATH_LANES; ++l)
+			tmp[l] = xmath_pow(expr[l], e);
+	}
+}
+
+/* fill_powers() for XMATH_LANES points at once */
+static XMATH_ALWAYS_INLINE void fill_powers_n(double powers[][XMATH_LANES],
+		const double* exponents, int zeropos, int count,
+		const double expr[XMATH_LANES], int deriv)
+{
+	int i, l;
+	double tmp[XMATH_LANES];
+
+	assert(exponents[zeropos + deriv] == deriv);
+	assert(exponents[zeropos + deriv + 1] == deriv + 1);
+
+	for (l = 0; l < XMATH_LANES; ++l)
+	{
+		powers[zeropos + deriv][l] = 1;
+		powers[zeropos + deriv + 1][l] = tmp[l] = expr[l];
+	}
+
+	for (i = zeropos + deriv + 2; i < count; ++i)
+	{
+		if (exponents[i] - 1 == exponents[i - 1])
+		{
+			for (l = 0; l < XMATH_LANES; ++l)
+				tmp[l] *= expr[l];
+		}
+		else
+			fill_gap_n(tmp, expr, exponents[i] - deriv);
+
+		for (l = 0; l < XMATH_LANES; ++l)
+			powers[i][l] = tmp[l];
+	}
+
+	for (l = 0; l < XMATH_LANES; ++l)
+		tmp[l] = 1.0;
+	for (i = zeropos + deriv - 1; i >= 0; --i)
+	{
+		if (exponents[i] + 1 == exponents[i + 1])
+		{
+			for (l = 0; l < XMATH_LANES; ++l)
+				tmp[l] /= expr[l];
+		}
+		else
+			fill_gap_n(tmp, expr, exponents[i] - deriv);
+
+		for (l = 0; l < XMATH_LANES; ++l)
+			powers[i][l] = tmp[l];
+	}
+}
+
+/* fill_power_derivs() for XMATH_LANES points at once */
+static XMATH_ALWAYS_INLINE void fill_power_derivs_n(double powers[][XMATH_LANES],
+		double der1[][XMATH_LANES], double der2[][XMATH_LANES],
+		const double* exponents, int zeropos, int count,
+		const double expr[XMATH_LANES])
+{
+	int i, l;
+	double inv[XMATH_LANES];
+
+	fill_powers_n(powers, exponents, zeropos, count, expr, 0);
+
+	for (l = 0; l < XMATH_LANES; ++l)
+		inv[l] = 1 / expr[l];
+
+	for (i = 0; i < count; ++i)
+	{
+		for (l = 0; l < XMATH_LANES; ++l)
+		{
+			double prev = powers[i][l] * inv[l];
+
+			der1[i][l] = exponents[i] * prev;
+			der2[i][l] = exponents[i] * (exponents[i] - 1) * prev * inv[l];
+		}
+	}
+
+	/* redo the lanes where x^e / x didn't work */
+	for (l = 0; l < XMATH_LANES; ++l)
+	{
+		if (expr[l] == 0)
+		{
+			double p[34], d1[34], d2[34];
+
+			assert(count <= 34);
+
+			fill_power_derivs(p, d1, d2, exponents, zeropos, count, 0);
+			for (i = 0; i < count; ++i)
+			{
+				der1[i][l] = d1[i];
+				der2[i][l] = d2[i];
+			}
+		}
+	}
+}
+
+/* copy the next block of points into lanes, padding the partial block
+ * with the last point; returns the number of actual points */
+static XMATH_ALWAYS_INLINE int load_lanes(double x1l[XMATH_LANES], double x2l[XMATH_LANES],
+		const double x1[], const double x2[], int count)
+{
+	int l;
+	int lanes = count < XMATH_LANES ? count : XMATH_LANES;
+
+	for (l = 0; l < XMATH_LANES; ++l)
+	{
+		int src = l < lanes ? l : lanes - 1;
+
+		x1l[l] = x1[src];
+		x2l[l] = x2[src];
+	}
+
+	return lanes;
+}
+
+static XMATH_ALWAYS_INLINE void twoarg_poly_value_n_impl(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero,
+		int Ipowlen, int x1der,
+		const int J[], const double Jpows[], int Jpowzero,
+		int Jpowlen, int x2der,
+		const double n[], int nlen,
+		double out[])
+{
+	double x1powers[20][XMATH_LANES], x2powers[34][XMATH_LANES];
+
+	int off;
+
+	assert(x1der >= 0 && x1der <= 2);
+	assert(x2der >= 0 && x2der <= 2);
+	assert(Ipowlen <= 20);
+	assert(Jpowlen <= 34);
+
+	for (off = 0; off < count; off += XMATH_LANES)
+	{
+		double sum[XMATH_LANES] = { 0 };
+		double x1l[XMATH_LANES], x2l[XMATH_LANES];
+
+		int i, l;
+		int lanes = load_lanes(x1l, x2l, &x1[off], &x2[off], count - off);
+
+		fill_powers_n(x1powers, Ipows, Ipowzero, Ipowlen, x1l, x1der);
+		fill_powers_n(x2powers, Jpows, Jpowzero, Jpowlen, x2l, x2der);
+
+		for (i = 1; i <= nlen; ++i)
+		{
+			const double* x1p = x1powers[I[i]];
+			const double* x2p = x2powers[J[i]];
+
+			double coeff = n[i];
+			if (x1der >= 1)
+				coeff *= Ipows[I[i]];
+			if (x1der == 2)
+				coeff *= Ipows[I[i]] - 1;
+			if (x2der >= 1)
+				coeff *= Jpows[J[i]];
+			if (x2der == 2)
+				coeff *= Jpows[J[i]] - 1;
+
+			for (l = 0; l < XMATH_LANES; ++l)
+				sum[l] += coeff * x1p[l] * x2p[l];
+		}
+
+		for (l = 0; l < lanes; ++l)
+			out[off + l] = sum[l];
+	}
+}
+
+XMATH_DISPATCH_VOID(twoarg_poly_value_n,
+		(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero,
+		int Ipowlen, int x1der,
+		const int J[], const double Jpows[], int Jpowzero,
+		int Jpowlen, int x2der,
+		const double n[], int nlen,
+		double out[]),
+		(count, x1, x2, I, Ipows, Ipowzero, Ipowlen, x1der,
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen, out))
+
+static XMATH_ALWAYS_INLINE void twoarg_poly_derivs_n_impl(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs out[])
+{
+	double x1powers[20][XMATH_LANES], x1der1[20][XMATH_LANES],
+		x1der2[20][XMATH_LANES];
+	double x2powers[34][XMATH_LANES], x2der1[34][XMATH_LANES],
+		x2der2[34][XMATH_LANES];
+
+	int off;
+
+	assert(Ipowlen <= 20);
+	assert(Jpowlen <= 34);
+
+	for (off = 0; off < count; off += XMATH_LANES)
+	{
+		double val[XMATH_LANES] = { 0 }, d1[XMATH_LANES] = { 0 },
+			d2[XMATH_LANES] = { 0 }, d11[XMATH_LANES] = { 0 },
+			d12[XMATH_LANES] = { 0 }, d22[XMATH_LANES] = { 0 };
+		double x1l[XMATH_LANES], x2l[XMATH_LANES];
+
+		int i, l;
+		int lanes = load_lanes(x1l, x2l, &x1[off], &x2[off], count - off);
+
+		fill_power_derivs_n(x1powers, x1der1, x1der2,
+				Ipows, Ipowzero, Ipowlen, x1l);
+		fill_power_derivs_n(x2powers, x2der1, x2der2,
+				Jpows, Jpowzero, Jpowlen, x2l);
+
+		for (i = 1; i <= nlen; ++i)
+		{
+			const double* x1p = x1powers[I[i]];
+			const double* x1d1 = x1der1[I[i]];
+			const double* x1d2 = x1der2[I[i]];
+			const double* x2p = x2powers[J[i]];
+			const double* x2d1 = x2der1[J[i]];
+			const double* x2d2 = x2der2[J[i]];
+
+			for (l = 0; l < XMATH_LANES; ++l)
+			{
+				double n1pow = n[i] * x1p[l];
+				double n1der1 = n[i] * x1d1[l];
+
+				val[l] += n1pow * x2p[l];
+				d1[l] += n1der1 * x2p[l];
+				d2[l] += n1pow * x2d1[l];
+				d11[l] += n[i] * x1d2[l] * x2p[l];
+				d12[l] += n1der1 * x2d1[l];
+				d22[l] += n1pow * x2d2[l];
+			}
+		}
+
+		for (l = 0; l < lanes; ++l)
+		{
+			out[off + l].val = val[l];
+			out[off + l].d1 = d1[l];
+			out[off + l].d2 = d2[l];
+			out[off + l].d11 = d11[l];
+			out[off + l].d12 = d12[l];
+			out[off + l].d22 = d22[l];
+		}
+	}
+}
+
+XMATH_DISPATCH_VOID(twoarg_poly_derivs_n,
+		(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs out[]),
+		(count, x1, x2, I, Ipows, Ipowzero, Ipowlen,
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out))
@@ -14,11 +14,118 @@ extern "C"
 #endif /*__cplusplus*/
 
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* CPU-specific variants of the kernels; the best one supported
+ * by the CPU is selected when the library is loaded */
+enum xmath_variant
+{
+	XMATH_VARIANT_GENERIC,
+	XMATH_VARIANT_FMA,
+	XMATH_VARIANT_AVX2,
+	XMATH_VARIANT_AVX512,
+
+	XMATH_VARIANT_MAX
+};
+
+extern enum xmath_variant xmath_current_variant;
+
+const char* xmath_variant_name(enum xmath_variant variant);
+int xmath_variant_supported(enum xmath_variant variant);
+/* force the given variant (e.g. for testing); returns 0 if it is not
+ * supported by the CPU, or was not built */
+int xmath_set_variant(enum xmath_variant variant);
+
+/* Define the exported function name() calling name##_impl(), which
+ * must be declared XMATH_ALWAYS_INLINE, in all the variants. */
+
+#ifdef H2O_CPU_DISPATCH
+#	define XMATH_ALWAYS_INLINE inline __attribute__((always_inline))
+#	define XMATH_DISPATCH_(ret, retkw, name, params, args) \
+		static ret __attribute__((target("fma"))) name##_fma params \
+		{ \
+			retkw name##_impl args; \
+		} \
+		static ret __attribute__((target("avx2,fma"))) name##_avx2 params \
+		{ \
+			retkw name##_impl args; \
+		} \
+		static ret __attribute__((target("avx512f,avx2,fma"))) \
+			name##_avx512 params \
+		{ \
+			retkw name##_impl args; \
+		} \
+		ret name params \
+		{ \
+			switch (xmath_current_variant) \
+			{ \
+				case XMATH_VARIANT_AVX512: \
+					retkw name##_avx512 args; \
+					break; \
+				case XMATH_VARIANT_AVX2: \
+					retkw name##_avx2 args; \
+					break; \
+				case XMATH_VARIANT_FMA: \
+					retkw name##_fma args; \
+					break; \
+				default: \
+					retkw name##_impl args; \
+			} \
+		}
+#else
+#	define XMATH_ALWAYS_INLINE inline
+#	define XMATH_DISPATCH_(ret, retkw, name, params, args) \
+		ret name params \
+		{ \
+			retkw name##_impl args; \
+		}
+#endif
+
+#define XMATH_DISPATCH(ret, name, params, args) \
+	XMATH_DISPATCH_(ret, return, name, params, args)
+#define XMATH_DISPATCH_VOID(name, params, args) \
+	XMATH_DISPATCH_(void, , name, params, args)
+
+/* number of points processed at once by the batch (*_n) kernels;
+ * the inner loops run over lanes so that they can be vectorized */
+#define XMATH_LANES 8
+/* number of points the batch functions keep on stack at once */
+#define XMATH_BLOCK 64
 
 static inline double pow2(double arg);
 static inline double pow4(double arg);
 static inline double quadr_value(double a, double b, double c, double x);
 
+/* Branch-free replacements for log(), exp() and pow() for the batch
+ * kernels. Unlike the libm functions, they are inlined into the lane
+ * loops and therefore vectorized along with them.
+ *
+ * xmath_log(): x must be positive and normal; within 2 ulp.
+ * xmath_exp(): x must be in [-708, 709]; within 1 ulp.
+ * xmath_powi(): integer powers by squaring; within |e| ulp.
+ * xmath_pow(): x must be positive, e * ln(x) in [-708, 709];
+ *   within (2 |e * ln(x)| + 5) ulp. */
+static inline double xmath_log(double x);
+static inline double xmath_exp(double x);
+static inline double xmath_powi(double x, int e);
+static inline double xmath_pow(double x, double e);
+
+/* Weights of the cubic through the nodes base..base+3 of a uniform grid
+ * with the given number of nodes, u being the grid coordinate of the point
+ * (node i at u = i). Returns base, picked to have u between the middle
+ * nodes, except at the ends of the grid. */
+static inline int xmath_lagrange4_weights(double u, int nodes, double w[4]);
+
+/* value of a two-argument function along with its partial derivatives
+ * up to the second order; d1 & d2 are with respect to x1 & x2 */
+struct twoarg_derivs
+{
+	double val;
+	double d1, d2;
+	double d11, d12, d22;
+};
+
 double poly_value(double x,
 		int min, int max, int deriv,
 		const double n[]);
@@ -28,6 +135,99 @@ double twoarg_poly_value(double x1, double x2,
 		const int J[], const double Jpows[], int Jpowzero,
 		int Jpowlen, int x2der,
 		const double n[], int nlen);
+void twoarg_poly_derivs(double x1, double x2,
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs* out);
+
+/* batch variants of twoarg_poly_value() and twoarg_poly_derivs()
+ * for count points */
+void twoarg_poly_value_n(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero,
+		int Ipowlen, int x1der,
+		const int J[], const double Jpows[], int Jpowzero,
+		int Jpowlen, int x2der,
+		const double n[], int nlen,
+		double out[]);
+void twoarg_poly_derivs_n(int count, const double x1[], const double x2[],
+		const int I[], const double Ipows[], int Ipowzero, int Ipowlen,
+		const int J[], const double Jpows[], int Jpowzero, int Jpowlen,
+		const double n[], int nlen,
+		struct twoarg_derivs out[]);
+
+/* Evaluate twoarg_poly_value(), twoarg_poly_derivs() or their batch
+ * variants, using the straight-line code emitted by h2o-polygen for
+ * the given equation if available. The file needs to include "gen/<equation>.h" then.
+ * The points are counted with --enable-stats. */
+
+#ifdef H2O_STATS
+#	include "stats.h"
+#	define TWOARG_POLY_STATS(counter, count) H2O_STATS_ADD(counter, count),
+#else
+#	define TWOARG_POLY_STATS(counter, count)
+#endif
+
+#ifdef H2O_GENERATED_POLY
+#	define TWOARG_POLY_VALUE(gen, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, x1der, \
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen) \
+		((void) (I), (void) (Ipows), (void) (J), (void) (Jpows), \
+			(void) (n), TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_VALUE, 1) \
+			poly_##gen##_value(x1, x2, x1der, x2der))
+#	define TWOARG_POLY_DERIVS(gen, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, \
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out) \
+		((void) (I), (void) (Ipows), (void) (J), (void) (Jpows), \
+			(void) (n), TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_DERIVS, 1) \
+			poly_##gen##_derivs(x1, x2, out))
+#	define TWOARG_POLY_VALUE_N(gen, count, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, x1der, \
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen, out) \
+		((void) (I), (void) (Ipows), (void) (J), (void) (Jpows), \
+			(void) (n), \
+			TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_VALUE, count) \
+			poly_##gen##_value_n(count, x1, x2, x1der, x2der, out))
+#	define TWOARG_POLY_DERIVS_N(gen, count, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, \
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out) \
+		((void) (I), (void) (Ipows), (void) (J), (void) (Jpows), \
+			(void) (n), \
+			TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_DERIVS, count) \
+			poly_##gen##_derivs_n(count, x1, x2, out))
+#else
+#	define TWOARG_POLY_VALUE(gen, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, x1der, \
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen) \
+		(TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_VALUE, 1) \
+			twoarg_poly_value(x1, x2, \
+				I, Ipows, Ipowzero, Ipowlen, x1der, \
+				J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen))
+#	define TWOARG_POLY_DERIVS(gen, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, \
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out) \
+		(TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_DERIVS, 1) \
+			twoarg_poly_derivs(x1, x2, \
+				I, Ipows, Ipowzero, Ipowlen, \
+				J, Jpows, Jpowzero, Jpowlen, n, nlen, out))
+#	define TWOARG_POLY_VALUE_N(gen, count, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, x1der, \
+			J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen, out) \
+		(TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_VALUE, count) \
+			twoarg_poly_value_n(count, x1, x2, \
+				I, Ipows, Ipowzero, Ipowlen, x1der, \
+				J, Jpows, Jpowzero, Jpowlen, x2der, n, nlen, out))
+#	define TWOARG_POLY_DERIVS_N(gen, count, x1, x2, \
+			I, Ipows, Ipowzero, Ipowlen, \
+			J, Jpows, Jpowzero, Jpowlen, n, nlen, out) \
+		(TWOARG_POLY_STATS(H2O_STATS_TWOARG_POLY_DERIVS, count) \
+			twoarg_poly_derivs_n(count, x1, x2, \
+				I, Ipows, Ipowzero, Ipowlen, \
+				J, Jpows, Jpowzero, Jpowlen, n, nlen, out))
+#endif
+
+static inline void twoarg_derivs_add(struct twoarg_derivs* out,
+		const struct twoarg_derivs* a, const struct twoarg_derivs* b);
 
 /* using pow(arg, N) is basically equivalent
  * but it will be optimized out only with -ffast-math;
@@ -48,6 +248,119 @@ static inline double quadr_value(double a, double b, double c, double x)
 	return (a * x + b) * x + c;
 }
 
+static inline double xmath_from_bits(uint64_t bits)
+{
+	double ret;
+
+	memcpy(&ret, &bits, sizeof(ret));
+	return ret;
+}
+
+static inline uint64_t xmath_to_bits(double x)
+{
+	uint64_t ret;
+
+	memcpy(&ret, &x, sizeof(ret));
+	return ret;
+}
+
+static const double xmath_ln2_hi = 6.93147180369123816490e-01;
+static const double xmath_ln2_lo = 1.90821492927058770002e-10;
+
+static inline double xmath_log(double x)
+{
+	/* x = 2^k * z, with z in [sqrt(1/2), sqrt(2)) */
+	const uint64_t sqrt_half = 0x3fe6a09e667f3bcdULL;
+	uint64_t bits = xmath_to_bits(x);
+	uint64_t tmp = bits - sqrt_half;
+	int64_t k = (int64_t) tmp >> 52;
+	double z = xmath_from_bits(bits - (tmp & 0xfff0000000000000ULL));
+
+	/* (double) k without int64 -> double conversion */
+	double kd = xmath_from_bits(0x4338000000000000ULL + (uint64_t) k)
+		- 6755399441055744.0;
+
+	/* log(z) = 2 atanh(s), |s| <= 0.172 */
+	double s = (z - 1) / (z + 1);
+	double s2 = s * s;
+	double poly = 1 + s2 * (1./3 + s2 * (1./5 + s2 * (1./7
+			+ s2 * (1./9 + s2 * (1./11 + s2 * (1./13 + s2 * (1./15
+			+ s2 * (1./17 + s2 * (1./19 + s2 * (1./21 + s2 / 23))))))))));
+
+	return kd * xmath_ln2_hi + (2 * s * poly + kd * xmath_ln2_lo);
+}
+
+static inline double xmath_exp(double x)
+{
+	/* x = k ln2 + r, |r| <= ln2 / 2 */
+	const double shift = 6755399441055744.0; /* 1.5 * 2^52 */
+	double kd = x * 1.44269504088896338700 + shift;
+	uint64_t k = xmath_to_bits(kd) - xmath_to_bits(shift);
+	double r;
+
+	kd -= shift;
+	r = x - kd * xmath_ln2_hi - kd * xmath_ln2_lo;
+
+	return (1 + r * (1 + r * (1./2 + r * (1./6 + r * (1./24
+			+ r * (1./120 + r * (1./720 + r * (1./5040
+			+ r * (1./40320 + r * (1./362880 + r * (1./3628800
+			+ r * (1./39916800 + r * (1./479001600
+			+ r / 6227020800.)))))))))))))
+		* xmath_from_bits((k + 1023) << 52);
+}
+
+static inline double xmath_powi(double x, int e)
+{
+	unsigned int n = e < 0 ? -e : e;
+	double ret = 1;
+
+	for (; n; n >>= 1)
+	{
+		if (n & 1)
+			ret *= x;
+		x *= x;
+	}
+
+	return e < 0 ? 1 / ret : ret;
+}
+
+static inline double xmath_pow(double x, double e)
+{
+	return xmath_exp(e * xmath_log(x));
+}
+
+static inline int xmath_lagrange4_weights(double u, int nodes, double w[4])
+{
+	int base = (int) u - 1;
+	double t;
+
+	if (base < 0)
+		base = 0;
+	else if (base > nodes - 4)
+		base = nodes - 4;
+
+	/* relative to the second node */
+	t = u - (base + 1);
+
+	w[0] = -t * (t - 1) * (t - 2) / 6;
+	w[1] = (t + 1) * (t - 1) * (t - 2) / 2;
+	w[2] = -(t + 1) * t * (t - 2) / 2;
+	w[3] = (t + 1) * t * (t - 1) / 6;
+
+	return base;
+}
+
+static inline void twoarg_derivs_add(struct twoarg_derivs* out,
+		const struct twoarg_derivs* a, const struct twoarg_derivs* b)
+{
+	out->val = a->val + b->val;
+	out->d1 = a->d1 + b->d1;
+	out->d2 = a->d2 + b->d2;
+	out->d11 = a->d11 + b->d11;
+	out->d12 = a->d12 + b->d12;
+	out->d22 = a->d22 + b->d22;
+}
+
 #ifdef __cplusplus
 };
 #endif /*__cplusplus*/
@@ -8,11 +8,18 @@
 #endif
 
 #include <assert.h>
+#include <float.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #include "consts.h"
 #include "h2o.h"
+#include "region1.h"
+#include "region2.h"
+#include "region3.h"
+#include "region4.h"
+#include "xmath.h"
 
 int tests_done = 0;
 int tests_failed = 0;
@@ -171,6 +178,1025 @@ void check_Tv(func_new constr, double arg1, double arg2,
 	check_any(constr, arg1, arg2, &h2o_get_v, v_expected, v_precision);
 }
 
+#define CHECK_ALL_FIELD(field, getter) \
+	check(props.field, getter(state), fabs(getter(state)) * 1E-11 + DBL_MIN, \
+			"all." #field, \
+			name1_by_constr(constr), arg1, \
+			name2_by_constr(constr), arg2)
+
+void check_all(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	struct h2o_props props;
+
+	h2o_get_all(state, &props);
+
+	CHECK_ALL_FIELD(p, h2o_get_p);
+	CHECK_ALL_FIELD(T, h2o_get_T);
+	if (state.region != H2O_REGION3)
+		CHECK_ALL_FIELD(x, h2o_get_x);
+	CHECK_ALL_FIELD(rho, h2o_get_rho);
+	CHECK_ALL_FIELD(v, h2o_get_v);
+	CHECK_ALL_FIELD(u, h2o_get_u);
+	CHECK_ALL_FIELD(h, h2o_get_h);
+	CHECK_ALL_FIELD(s, h2o_get_s);
+	CHECK_ALL_FIELD(cp, h2o_get_cp);
+	CHECK_ALL_FIELD(cv, h2o_get_cv);
+	CHECK_ALL_FIELD(w, h2o_get_w);
+}
+
+/* compare h2o_batch_get_h_pT() and h2o_batch_new_pT() against
+ * the scalar path over a grid spanning all the (p,T) regions,
+ * with a partial last block */
+void check_batch_h(void)
+{
+	static const double pressures[] = {
+		0.001, 0.01, 0.1, 0.5, 1, 5, 10, 25, 50, 100
+	};
+
+	double p[100], T[100], h[100];
+	h2o_t states[100];
+	int i;
+
+	for (i = 0; i < 100; ++i)
+	{
+		p[i] = pressures[i % 10];
+		T[i] = 275 + 20 * i + (i % 7);
+	}
+
+	h2o_batch_get_h_pT(100, p, T, h);
+	h2o_batch_new_pT(100, p, T, states);
+
+	for (i = 0; i < 100; ++i)
+	{
+		h2o_t state = h2o_new_pT(p[i], T[i]);
+
+		check(states[i].region, state.region, 0.5, "batch.region",
+				"p", p[i], "T", T[i]);
+		if (h2o_is_valid(state))
+			check(states[i]._arg1, state._arg1,
+					fabs(state._arg1) * 1E-15, "batch._arg1",
+					"p", p[i], "T", T[i]);
+
+		if (h2o_is_valid(state))
+		{
+			double expected = h2o_get_h(state);
+
+			check(h[i], expected, fabs(expected) * 1E-11, "batch.h",
+					"p", p[i], "T", T[i]);
+		}
+		else
+			check(isnan(h[i]) ? 0 : 1, 0, 0.5, "isnan(batch.h)",
+					"p", p[i], "T", T[i]);
+	}
+}
+
+/* compare h2o_batch_get_props() against h2o_get_all() over a mix
+ * of states in all the regions */
+void check_batch_props(void)
+{
+	static const double p[] = { 3, 0.0035, 30, 50, 30, 0.5, 80, 10 };
+	static const double T[] = { 300, 700, 2000, 650, 700, 1500, 300, 1000 };
+
+	h2o_t states[40];
+	struct h2o_props props[40];
+	int i;
+
+	h2o_batch_new_pT(8, p, T, states);
+	for (i = 0; i < 8; ++i)
+	{
+		h2o_t expected = h2o_new_pT(p[i], T[i]);
+
+		check(states[i].region, expected.region, 0.5, "batch.region",
+				"p", p[i], "T", T[i]);
+		check(states[i]._arg1, expected._arg1,
+				fabs(expected._arg1) * 1E-15, "batch._arg1",
+				"p", p[i], "T", T[i]);
+	}
+
+	/* repeat and add some wet steam to get more than one lane block */
+	for (i = 8; i < 32; ++i)
+		states[i] = states[i % 8];
+	for (i = 32; i < 40; ++i)
+		states[i] = h2o_new_Tx(300 + 48 * (i - 32), (i - 32) / 7.);
+
+	h2o_batch_get_props(40, states, props);
+
+	for (i = 0; i < 40; ++i)
+	{
+		struct h2o_props expected;
+
+		h2o_get_all(states[i], &expected);
+
+#define CHECK_BATCH_FIELD(field) \
+		check(props[i].field, expected.field, \
+				fabs(expected.field) * 1E-11 + DBL_MIN, \
+				"batch." #field, \
+				"a1", states[i]._arg1, "a2", states[i]._arg2)
+
+		CHECK_BATCH_FIELD(p);
+		CHECK_BATCH_FIELD(T);
+		if (states[i].region != H2O_REGION3)
+			CHECK_BATCH_FIELD(x);
+		CHECK_BATCH_FIELD(rho);
+		CHECK_BATCH_FIELD(v);
+		CHECK_BATCH_FIELD(u);
+		CHECK_BATCH_FIELD(h);
+		CHECK_BATCH_FIELD(s);
+		CHECK_BATCH_FIELD(cp);
+		CHECK_BATCH_FIELD(cv);
+		CHECK_BATCH_FIELD(w);
+
+#undef CHECK_BATCH_FIELD
+	}
+}
+
+/* check h2o_expand_line() against the stage-by-stage initializers */
+void check_expand_line(void)
+{
+	static const double pout[] = {
+		12, 8, 4, 2, 1, 0.4, 0.15, 0.05, 0.015, 0.005
+	};
+	static const double eta[] = {
+		0.85, 0.88, 0.9, 0.9, 0.91, 0.9, 0.88, 0.85, 0.8, 0.75
+	};
+	const int nstages = sizeof(pout) / sizeof(*pout);
+
+	h2o_t in = h2o_new_pT(16, 810);
+	h2o_t out[sizeof(pout) / sizeof(*pout)];
+	double bad_pout[] = { 5, 200, 1 };
+	int ideal, i;
+
+	/* s and h are carried over between the stages, so the outlets
+	 * differ from chained h2o_expand_real() calls within the backward
+	 * equation errors */
+	for (ideal = 0; ideal <= 1; ++ideal)
+	{
+		double s = h2o_get_s(in);
+		double h = h2o_get_h(in);
+
+		h2o_expand_line(in, nstages, pout, ideal ? NULL : eta, out);
+
+		for (i = 0; i < nstages; ++i)
+		{
+			h2o_t expected = h2o_new_ps(pout[i], s);
+
+			if (!ideal)
+			{
+				h -= (h - h2o_get_h(expected)) * eta[i];
+				expected = h2o_new_ph(pout[i], h);
+				s = h2o_get_s(expected);
+			}
+
+			check(out[i].region, expected.region, 0.5, "expand_line.region",
+					"p", pout[i], "eta", ideal ? 1 : eta[i]);
+			check(h2o_get_h(out[i]), h2o_get_h(expected),
+					h2o_get_h(expected) * 1E-11, "expand_line.h",
+					"p", pout[i], "eta", ideal ? 1 : eta[i]);
+		}
+	}
+
+	/* the stages following an out-of-range one are out of range too */
+	h2o_expand_line(in, 3, bad_pout, NULL, out);
+	for (i = 0; i < 3; ++i)
+		check(out[i].region, i == 0 ? H2O_REGION2 : H2O_REGION_OUT_OF_RANGE,
+				0.5, "expand_line.region", "p", bad_pout[i], "eta", 1);
+}
+
+void check_batch_par(void)
+{
+	enum { N = 20000 };
+
+	static double p[N], T[N];
+	static h2o_t states[N], expected_states[N];
+	static struct h2o_props props[N], expected_props[N];
+	int nthreads, i;
+
+	/* a grid over all the regions, with some points out of range */
+	for (i = 0; i < N; ++i)
+	{
+		p[i] = exp(log(1E-3) + (i % 200) * (log(110) - log(1E-3)) / 199);
+		T[i] = 270 + (i / 200) * 20.;
+	}
+
+	h2o_batch_new_pT(N, p, T, expected_states);
+
+	for (nthreads = 1; nthreads <= 4; nthreads += 3)
+	{
+		h2o_pool_t* pool = h2o_pool_new(nthreads);
+		int mismatches = 0;
+		int valid = 0;
+
+		check(pool ? 1 : 0, 1, 0.5, "h2o_pool_new()",
+				"nthreads", nthreads, "n", N);
+		if (!pool)
+			continue;
+#ifdef H2O_THREADS
+		check(h2o_pool_threads(pool), nthreads, 0.5, "h2o_pool_threads()",
+				"nthreads", nthreads, "n", N);
+#else
+		check(h2o_pool_threads(pool), 1, 0.5, "h2o_pool_threads()",
+				"nthreads", nthreads, "n", N);
+#endif
+
+		h2o_batch_new_pT_par(pool, N, p, T, states);
+		for (i = 0; i < N; ++i)
+		{
+			if (states[i].region != expected_states[i].region
+					|| (h2o_is_valid(states[i])
+						&& (states[i]._arg1 != expected_states[i]._arg1
+							|| states[i]._arg2 != expected_states[i]._arg2)))
+				++mismatches;
+
+			/* the valid states go to the front for the props */
+			if (h2o_is_valid(states[i]))
+				states[valid++] = states[i];
+		}
+		check(mismatches, 0, 0.5, "batch_new_pT_par() mismatches",
+				"nthreads", nthreads, "n", N);
+
+		h2o_batch_get_props(valid, states, expected_props);
+		h2o_batch_get_props_par(pool, valid, states, props);
+		mismatches = 0;
+		for (i = 0; i < valid; ++i)
+		{
+			if (props[i].h != expected_props[i].h
+					|| props[i].s != expected_props[i].s
+					|| props[i].w != expected_props[i].w)
+				++mismatches;
+		}
+		check(mismatches, 0, 0.5, "batch_get_props_par() mismatches",
+				"nthreads", nthreads, "n", valid);
+
+		h2o_pool_free(pool);
+	}
+}
+
+/* the maximum relative error of the batch math functions over a sweep */
+void check_xmath(void)
+{
+	double log_err = 0, exp_err = 0, powi_err = 0, pow_err = 0;
+	double x;
+	int e;
+
+	for (x = 1E-3; x < 1E3; x *= 1.001)
+	{
+		log_err = fmax(log_err, fabs(xmath_log(x) / log(x) - 1));
+		for (e = -41; e <= 41; e += 4)
+			powi_err = fmax(powi_err,
+					fabs(xmath_powi(x, e) / pow(x, e) - 1));
+		pow_err = fmax(pow_err, fabs(xmath_pow(x, 0.25) / pow(x, 0.25) - 1));
+	}
+
+	for (x = -700; x < 700; x += 0.0137)
+		exp_err = fmax(exp_err, fabs(xmath_exp(x) / exp(x) - 1));
+
+	check(log_err, 0, 4 * DBL_EPSILON, "max.err(xmath_log)",
+			"x", 1E-3, "x", 1E3);
+	check(exp_err, 0, 2 * DBL_EPSILON, "max.err(xmath_exp)",
+			"x", -700, "x", 700);
+	check(powi_err, 0, 41 * 2 * DBL_EPSILON, "max.err(xmath_powi)",
+			"x", 1E-3, "x", 1E3);
+	check(pow_err, 0, 10 * DBL_EPSILON, "max.err(xmath_pow)",
+			"x", 1E-3, "x", 1E3);
+}
+
+#define CHECK_EX_FIELD(getter, ex_getter) \
+	check(ex_getter(&ex), getter(state), fabs(getter(state)) * 1E-11 + DBL_MIN, \
+			#ex_getter, \
+			name1_by_constr(constr), arg1, \
+			name2_by_constr(constr), arg2)
+
+#define CHECK_EX_DERIV(of, wrt, const_) \
+	check(h2o_ex_get_deriv(&ex, of, wrt, const_), \
+			h2o_get_deriv(state, of, wrt, const_), \
+			fabs(h2o_get_deriv(state, of, wrt, const_)) * 1E-11, \
+			"h2o_ex_get_deriv(" #of ")", \
+			name1_by_constr(constr), arg1, \
+			name2_by_constr(constr), arg2)
+
+/* check h2o_ex_t getters against h2o_t ones, reading each twice;
+ * the derivative set first, so that the properties come with it */
+void check_ex(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	h2o_ex_t ex = h2o_ex_new(state);
+	int i;
+
+	for (i = 0; i < 2; ++i)
+	{
+		CHECK_EX_DERIV(H2O_PROP_H, H2O_PROP_P, H2O_PROP_T);
+		CHECK_EX_DERIV(H2O_PROP_V, H2O_PROP_T, H2O_PROP_P);
+		CHECK_EX_DERIV(H2O_PROP_S, H2O_PROP_P, H2O_PROP_H);
+		if (state.region == H2O_REGION4)
+		{
+			struct h2o_sat sat;
+
+			h2o_sat_T(h2o_get_T(state), &sat);
+			check(h2o_ex_get_sat(&ex)->vapour.h, sat.vapour.h,
+					sat.vapour.h * 1E-11, "h2o_ex_get_sat(vapour.h)",
+					name1_by_constr(constr), arg1,
+					name2_by_constr(constr), arg2);
+			check(h2o_ex_get_sat(&ex)->liquid.v, sat.liquid.v,
+					sat.liquid.v * 1E-11, "h2o_ex_get_sat(liquid.v)",
+					name1_by_constr(constr), arg1,
+					name2_by_constr(constr), arg2);
+		}
+		else
+			check(h2o_ex_get_sat(&ex) == NULL, 1, 0.5,
+					"h2o_ex_get_sat() == NULL",
+					name1_by_constr(constr), arg1,
+					name2_by_constr(constr), arg2);
+		CHECK_EX_FIELD(h2o_get_h, h2o_ex_get_h);
+		CHECK_EX_FIELD(h2o_get_p, h2o_ex_get_p);
+		CHECK_EX_FIELD(h2o_get_T, h2o_ex_get_T);
+		if (state.region != H2O_REGION3)
+			CHECK_EX_FIELD(h2o_get_x, h2o_ex_get_x);
+		CHECK_EX_FIELD(h2o_get_rho, h2o_ex_get_rho);
+		CHECK_EX_FIELD(h2o_get_v, h2o_ex_get_v);
+		CHECK_EX_FIELD(h2o_get_u, h2o_ex_get_u);
+		CHECK_EX_FIELD(h2o_get_s, h2o_ex_get_s);
+		CHECK_EX_FIELD(h2o_get_cp, h2o_ex_get_cp);
+		CHECK_EX_FIELD(h2o_get_cv, h2o_ex_get_cv);
+		CHECK_EX_FIELD(h2o_get_w, h2o_ex_get_w);
+	}
+}
+
+#define CHECK_SAT_FIELD(phase, getter, field) \
+	check(sat.phase.field, getter(phase), \
+			fabs(getter(phase)) * 1E-11 + DBL_MIN, \
+			"sat." #phase "." #field, "T", T, "p", sat.p)
+
+/* check h2o_sat_T() and h2o_sat_p() against the Region 4 getters */
+void check_sat(double T)
+{
+	h2o_t liquid = h2o_new_Tx(T, 0);
+	h2o_t vapour = h2o_new_Tx(T, 1);
+	struct h2o_sat sat;
+
+	check(h2o_sat_T(T, &sat), 1, 0.5, "h2o_sat_T()", "T", T, "x", 0);
+	check(sat.p, h2o_get_p(liquid), sat.p * 1E-15, "sat.p",
+			"T", T, "x", 0);
+
+	CHECK_SAT_FIELD(liquid, h2o_get_rho, rho);
+	CHECK_SAT_FIELD(liquid, h2o_get_v, v);
+	CHECK_SAT_FIELD(liquid, h2o_get_u, u);
+	CHECK_SAT_FIELD(liquid, h2o_get_h, h);
+	CHECK_SAT_FIELD(liquid, h2o_get_s, s);
+	CHECK_SAT_FIELD(liquid, h2o_get_cp, cp);
+	CHECK_SAT_FIELD(liquid, h2o_get_cv, cv);
+	CHECK_SAT_FIELD(liquid, h2o_get_w, w);
+
+	CHECK_SAT_FIELD(vapour, h2o_get_rho, rho);
+	CHECK_SAT_FIELD(vapour, h2o_get_v, v);
+	CHECK_SAT_FIELD(vapour, h2o_get_u, u);
+	CHECK_SAT_FIELD(vapour, h2o_get_h, h);
+	CHECK_SAT_FIELD(vapour, h2o_get_s, s);
+	CHECK_SAT_FIELD(vapour, h2o_get_cp, cp);
+	CHECK_SAT_FIELD(vapour, h2o_get_cv, cv);
+	CHECK_SAT_FIELD(vapour, h2o_get_w, w);
+
+	check(h2o_sat_p(sat.p, &sat), 1, 0.5, "h2o_sat_p()", "T", T, "x", 0);
+	check(sat.T, T, T * 1E-9, "sat.T", "T", T, "x", 0);
+	/* T_p(p_T(T)) is not exact, and h is steep near the critical point */
+	check(sat.liquid.h, h2o_get_h(liquid), sat.liquid.h * 1E-6,
+			"sat.liquid.h", "T", T, "p", sat.p);
+	check(sat.vapour.h, h2o_get_h(vapour), sat.vapour.h * 1E-6,
+			"sat.vapour.h", "T", T, "p", sat.p);
+}
+
+#undef CHECK_SAT_FIELD
+
+/* check the documented h2o_sat_approx_*() deviations over a sweep */
+void check_sat_approx(void)
+{
+	double p_err = 0, rho_err = 0, uh_err = 0, s_err = 0;
+	double Tsat_err = 0, uh_p_err = 0;
+	double T, lnp;
+
+	for (T = Tmin; T <= Tcrit; T += 0.0123)
+	{
+		struct h2o_sat a, e;
+
+		h2o_sat_T(T, &e);
+		h2o_sat_approx_T(T, &a);
+
+		p_err = fmax(p_err, fabs(a.p / e.p - 1));
+		rho_err = fmax(rho_err, fabs(a.liquid.rho / e.liquid.rho - 1));
+		rho_err = fmax(rho_err, fabs(a.vapour.rho / e.vapour.rho - 1));
+		uh_err = fmax(uh_err, fabs(a.liquid.u - e.liquid.u));
+		uh_err = fmax(uh_err, fabs(a.vapour.u - e.vapour.u));
+		uh_err = fmax(uh_err, fabs(a.liquid.h - e.liquid.h));
+		uh_err = fmax(uh_err, fabs(a.vapour.h - e.vapour.h));
+		s_err = fmax(s_err, fabs(a.liquid.s - e.liquid.s));
+		s_err = fmax(s_err, fabs(a.vapour.s - e.vapour.s));
+	}
+
+	for (lnp = log(psatmin); lnp <= log(pcrit); lnp += 0.0017)
+	{
+		struct h2o_sat a, e;
+
+		h2o_sat_p(exp(lnp), &e);
+		h2o_sat_approx_p(exp(lnp), &a);
+
+		Tsat_err = fmax(Tsat_err, fabs(a.T - e.T));
+		uh_p_err = fmax(uh_p_err, fabs(a.liquid.h - e.liquid.h));
+		uh_p_err = fmax(uh_p_err, fabs(a.vapour.h - e.vapour.h));
+	}
+
+	check(p_err, 0, 2E-6, "max.err(sat_approx.p)", "T", Tmin, "T", Tcrit);
+	check(rho_err, 0, 2E-6, "max.err(sat_approx.rho)", "T", Tmin, "T", Tcrit);
+	check(uh_err, 0, 1E-3, "max.err(sat_approx.u/h)", "T", Tmin, "T", Tcrit);
+	check(s_err, 0, 1E-6, "max.err(sat_approx.s)", "T", Tmin, "T", Tcrit);
+	check(Tsat_err, 0, 5E-6, "max.err(sat_approx.T)",
+			"p", psatmin, "p", pcrit);
+	check(uh_p_err, 0, 2E-3, "max.err(sat_approx.h)",
+			"p", psatmin, "p", pcrit);
+}
+
+/* the region just below, on, and just above a boundary */
+void check_boundary_ph_ps(int ps, double p, double y,
+		enum h2o_region below, enum h2o_region on, enum h2o_region above)
+{
+	static const double offsets[] = { -1E-3, -1E-6, 0, 1E-6, 1E-3 };
+	int i;
+
+	for (i = 0; i < (int) (sizeof(offsets) / sizeof(*offsets)); ++i)
+	{
+		double x = y + offsets[i];
+		enum h2o_region expected = offsets[i] < 0 ? below
+			: offsets[i] > 0 ? above : on;
+
+		if (expected == H2O_REGION_MAX)
+			continue;
+		if (ps)
+			check(h2o_region_ps(p, x), expected, 0.5, "region_ps", "p", p, "s", x);
+		else
+			check(h2o_region_ph(p, x), expected, 0.5, "region_ph", "p", p, "h", x);
+	}
+}
+
+/* check h2o_region_ph() and h2o_region_ps() around all the boundaries */
+void check_region_ph_ps(void)
+{
+	const enum h2o_region any = H2O_REGION_MAX;
+	double lnp;
+
+	/* hmin, h' and smin, s' meet at psatmin */
+	for (lnp = log(psatmin) + 0.1; lnp < log(pmax); lnp += 0.731)
+	{
+		double p = exp(lnp);
+		double T1 = p <= psat12max ? h2o_region4_T_p(p) : Tb13;
+		double T2 = p <= psat12max ? T1 : h2o_b23_T_p(p);
+		enum h2o_region r12 = p <= psat12max ? H2O_REGION4 : H2O_REGION3;
+		double h1 = h2o_region1_h_pT(p, T1);
+		double h2 = h2o_region2_h_pT(p, T2);
+
+		check_boundary_ph_ps(0, p, h2o_region1_h_pT(p, Tmin),
+				H2O_REGION_OUT_OF_RANGE, H2O_REGION1, H2O_REGION1);
+		/* psat3(h) is used there instead */
+		if (h1 < psat3_hmin)
+			check_boundary_ph_ps(0, p, h1, H2O_REGION1, H2O_REGION1, r12);
+		if (h2 > psat3_hmax)
+			check_boundary_ph_ps(0, p, h2, r12, H2O_REGION2, H2O_REGION2);
+		check_boundary_ph_ps(0, p, h2o_region2_h_pT(p, Tb25),
+				H2O_REGION2, H2O_REGION2, any);
+
+		check_boundary_ph_ps(1, p, h2o_region1_s_pT(p, T1),
+				H2O_REGION1, H2O_REGION1, r12);
+		if (p <= psat12max || h2o_region2_s_pT(p, T2) > psat3_smax)
+			check_boundary_ph_ps(1, p, h2o_region2_s_pT(p, T2),
+					r12, H2O_REGION2, H2O_REGION2);
+		check_boundary_ph_ps(1, p, h2o_region2_s_pT(p, Tb25),
+				H2O_REGION2, H2O_REGION2, any);
+	}
+}
+
+/* the table subregion selection against the exact one, over a grid
+ * and around each of the boundaries */
+void check_region3_subregion_pT(void)
+{
+	typedef double (*boundary_func_t)(double);
+	static const boundary_func_t boundaries[] = {
+		h2o_region3ab_T_p, h2o_region3cd_T_p, h2o_region3ef_T_p,
+		h2o_region3gh_T_p, h2o_region3ij_T_p, h2o_region3jk_T_p,
+		h2o_region3mn_T_p, h2o_region3op_T_p, h2o_region3qu_T_p,
+		h2o_region3rx_T_p, h2o_region3uv_T_p, h2o_region3wx_T_p,
+		h2o_region4_T_p
+	};
+	static const double offsets[] = { -1E-3, -1E-6, 0, 1E-6, 1E-3 };
+	int mismatches = 0;
+	double p, T;
+	int i, j;
+
+	for (p = psat12max + 0.0071; p <= pmax; p += 0.0173)
+	{
+		double Tmax = h2o_b23_T_p(p);
+
+		for (T = Tb13; T <= Tmax; T += 0.0937)
+			mismatches += h2o_region3_subregion_pT(p, T)
+				!= h2o_region3_subregion_pT_exact(p, T);
+
+		/* around the boundaries */
+		for (i = 0; i < (int) (sizeof(boundaries) / sizeof(*boundaries)); ++i)
+		{
+			double Tb;
+
+			if (boundaries[i] == h2o_region4_T_p && p > pcrit)
+				continue;
+
+			Tb = boundaries[i](p);
+			for (j = 0; j < (int) (sizeof(offsets) / sizeof(*offsets)); ++j)
+			{
+				T = Tb + offsets[j];
+				if (T > Tb13 && T < Tmax)
+					mismatches += h2o_region3_subregion_pT(p, T)
+						!= h2o_region3_subregion_pT_exact(p, T);
+			}
+		}
+	}
+
+	check(mismatches, 0, 0.5, "mismatches(region3_subregion_pT)",
+			"p", psat12max, "p", pmax);
+}
+
+void check_hs_regions(void)
+{
+	static const double ps[] = { 25, 50, 90 };
+	/* past the pressure limit, below Tmin and past B25 */
+	static const double out_of_range[][2] = {
+		{ 2330, 3.0 }, { 2060, 11.5 }, { 4220, 8.56 }
+	};
+	int i, j;
+
+	/* around B13 and B23, approximated by h2o_region_hs() */
+	for (i = 0; i < (int) (sizeof(ps) / sizeof(*ps)); ++i)
+	{
+		double Ts[] = { Tb13 - 2, Tb13 + 2,
+			h2o_b23_T_p(ps[i]) - 2, h2o_b23_T_p(ps[i]) + 2 };
+
+		for (j = 0; j < (int) (sizeof(Ts) / sizeof(*Ts)); ++j)
+		{
+			h2o_t state = h2o_new_pT(ps[i], Ts[j]);
+			double h = h2o_get_h(state);
+			double s = h2o_get_s(state);
+			h2o_t hs = h2o_new_hs(h, s);
+
+			check(hs.region, state.region, 0.5, "hs.region",
+					"h", h, "s", s);
+			if (hs.region == state.region)
+				check(h2o_get_T(hs), Ts[j], 0.1, "hs.T",
+						"h", h, "s", s);
+		}
+	}
+
+	for (i = 0; i < (int) (sizeof(out_of_range) / sizeof(*out_of_range)); ++i)
+	{
+		double h = out_of_range[i][0];
+		double s = out_of_range[i][1];
+
+		check(h2o_new_hs(h, s).region, H2O_REGION_OUT_OF_RANGE, 0.5,
+				"hs.region", "h", h, "s", s);
+	}
+}
+
+int states_differ(h2o_t a, h2o_t b)
+{
+	return a.region != b.region || (a.region
+			&& (a._arg1 != b._arg1 || a._arg2 != b._arg2));
+}
+
+/* the hinted initializers give the same states whatever the hint */
+void check_hints(void)
+{
+	static const double offsets[] = { -1E-3, -1E-6, 0, 1E-6, 1E-3 };
+	int mismatches = 0;
+	double lnp, T;
+	int i, r;
+
+	for (lnp = log(psatmin) + 0.1; lnp < log(pmax); lnp += 0.347)
+	{
+		double p = exp(lnp);
+
+		/* the saturated states are close to the boundaries */
+		for (T = Tmin - 27.4; T <= Tmax; T += 13.7)
+		{
+			h2o_t state = T >= Tmin ? h2o_new_pT(p, T)
+				: h2o_new_px(p, T < Tmin - 13.7 ? 0 : 1);
+			double h, s;
+
+			if (!state.region)
+				continue;
+			h = h2o_get_h(state);
+			s = h2o_get_s(state);
+
+			for (r = H2O_REGION_OUT_OF_RANGE; r < H2O_REGION_MAX; ++r)
+			{
+				if (T >= Tmin)
+					mismatches += states_differ(state,
+							h2o_new_pT_hint(p, T, r));
+
+				for (i = 0; i < (int) (sizeof(offsets) / sizeof(*offsets)); ++i)
+				{
+					mismatches += states_differ(
+							h2o_new_ph(p, h + offsets[i]),
+							h2o_new_ph_hint(p, h + offsets[i], r));
+					mismatches += states_differ(
+							h2o_new_ps(p, s + offsets[i]),
+							h2o_new_ps_hint(p, s + offsets[i], r));
+				}
+			}
+		}
+	}
+
+	check(mismatches, 0, 0.5, "mismatches(new_*_hint)",
+			"p", psatmin, "p", pmax);
+}
+
+/* the trackers give the same states as the initializers, and report
+ * the boundary crossings */
+void check_tracker(void)
+{
+	static const double ps[] = { 0.1, 5, 25 };
+	int mismatches = 0;
+	int i, j;
+
+	for (i = 0; i < (int) (sizeof(ps) / sizeof(*ps)); ++i)
+	{
+		h2o_tracker_t tr_pT = h2o_tracker_new();
+		h2o_tracker_t tr_ph = h2o_tracker_new();
+		h2o_tracker_t tr_ps = h2o_tracker_new();
+		int ph_crossings = 0;
+
+		/* heating up along the isobar */
+		for (j = 0; j <= 2000; ++j)
+		{
+			double T = 280 + j * 0.3;
+			double h = 50 + j * 1.7;
+			double s = 0.2 + j * 0.0035;
+
+			h2o_tracker_update_pT(&tr_pT, ps[i], T);
+			mismatches += states_differ(tr_pT.state, h2o_new_pT(ps[i], T));
+			ph_crossings += h2o_tracker_update_ph(&tr_ph, ps[i], h);
+			mismatches += states_differ(tr_ph.state, h2o_new_ph(ps[i], h));
+			h2o_tracker_update_ps(&tr_ps, ps[i], s);
+			mismatches += states_differ(tr_ps.state, h2o_new_ps(ps[i], s));
+		}
+
+		/* into Region 1, then 4 (or 3) and 2 */
+		check(ph_crossings, 3, 0.5, "crossings(tracker_update_ph)",
+				"p", ps[i], "h", 50 + 2000 * 1.7);
+		check(tr_ph.prev_region, H2O_REGION2, 0.5, "tracker.prev_region",
+				"p", ps[i], "h", 50 + 2000 * 1.7);
+	}
+
+	check(mismatches, 0, 0.5, "mismatches(tracker_update_*)",
+			"p", ps[0], "p", ps[2]);
+}
+
+/* check that h2o_new_rhoT() gets back the state it got rho and T from */
+void check_rhoT(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	h2o_t rhoT = h2o_new_rhoT(h2o_get_rho(state), h2o_get_T(state));
+
+	check(rhoT.region, state.region, 0.5, "rhoT.region",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_p(rhoT), h2o_get_p(state), h2o_get_p(state) * 1E-11
+			+ 1E-11, "rhoT.p",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_x(rhoT), h2o_get_x(state), 1E-11, "rhoT.x",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+}
+
+/* check the derivatives against the thermodynamic identities,
+ * and dp/dT at constant rho against the finite difference */
+void check_deriv(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	double p = h2o_get_p(state);
+	double T = h2o_get_T(state);
+	double v = h2o_get_v(state);
+	double dT = T * 1E-6;
+	double dpdT = (h2o_get_p(h2o_new_rhoT(1 / v, T + dT))
+			- h2o_get_p(h2o_new_rhoT(1 / v, T - dT))) / (2 * dT);
+
+	check(h2o_get_deriv(state, H2O_PROP_H, H2O_PROP_T, H2O_PROP_P),
+			h2o_get_cp(state), 1E-9, "deriv(h,T,p)",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_deriv(state, H2O_PROP_H, H2O_PROP_S, H2O_PROP_P),
+			T, T * 1E-12, "deriv(h,s,p)",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_deriv(state, H2O_PROP_H, H2O_PROP_P, H2O_PROP_S),
+			v * 1E3, v * 1E-9, "deriv(h,p,s)",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_deriv(state, H2O_PROP_U, H2O_PROP_V, H2O_PROP_S),
+			-p * 1E3, p * 1E-9, "deriv(u,v,s)",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_deriv(state, H2O_PROP_P, H2O_PROP_T, H2O_PROP_RHO),
+			dpdT, fabs(dpdT) * 1E-6, "deriv(p,T,rho)",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+}
+
+/* check the two-phase derivatives against the Clausius-Clapeyron
+ * equation, and drho/dp, drho/dh against the finite differences */
+void check_deriv_Tx(double T, double x, double fd_prec)
+{
+	h2o_t state = h2o_new_Tx(T, x);
+	h2o_t liquid = h2o_new_Tx(T, 0);
+	h2o_t vapour = h2o_new_Tx(T, 1);
+	double p = h2o_get_p(state);
+	double h = h2o_get_h(state);
+	double dp = p * 1E-6;
+	double dh = h * 1E-6;
+	double dpdT = (h2o_get_h(vapour) - h2o_get_h(liquid))
+		/ (T * (h2o_get_v(vapour) - h2o_get_v(liquid))) * 1E-3;
+	double drhodp = (h2o_get_rho(h2o_new_ph(p + dp, h))
+			- h2o_get_rho(h2o_new_ph(p - dp, h))) / (2 * dp);
+	double drhodh = (h2o_get_rho(h2o_new_ph(p, h + dh))
+			- h2o_get_rho(h2o_new_ph(p, h - dh))) / (2 * dh);
+
+	/* the saturation line is consistent with the phases within 1E-3 */
+	check(h2o_get_deriv(state, H2O_PROP_P, H2O_PROP_T, H2O_PROP_H),
+			dpdT, dpdT * 1E-3, "deriv(p,T,h)", "T", T, "x", x);
+	check(h2o_get_deriv(state, H2O_PROP_H, H2O_PROP_S, H2O_PROP_P),
+			T, T * 1E-5, "deriv(h,s,p)", "T", T, "x", x);
+	check(h2o_get_deriv(state, H2O_PROP_RHO, H2O_PROP_P, H2O_PROP_H),
+			drhodp, fabs(drhodp) * fd_prec, "deriv(rho,p,h)",
+			"T", T, "x", x);
+	check(h2o_get_deriv(state, H2O_PROP_RHO, H2O_PROP_H, H2O_PROP_P),
+			drhodh, fabs(drhodh) * fd_prec, "deriv(rho,h,p)",
+			"T", T, "x", x);
+}
+
+/* check that the h2o_new_*_exact() initializers get back the state */
+void check_exact(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	double p = h2o_get_p(state);
+	double T = h2o_get_T(state);
+	double h = h2o_get_h(state);
+	double s = h2o_get_s(state);
+	h2o_t ph = h2o_new_ph_exact(p, h);
+	h2o_t ps = h2o_new_ps_exact(p, s);
+	h2o_t hs = h2o_new_hs_exact(h, s);
+
+	check(ph.region, state.region, 0.5, "ph_exact.region",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_T(ph), T, 1E-9, "ph_exact.T",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(ps.region, state.region, 0.5, "ps_exact.region",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_T(ps), T, 1E-9, "ps_exact.T",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(hs.region, state.region, 0.5, "hs_exact.region",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_T(hs), T, 1E-9, "hs_exact.T",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_p(hs), p, p * 1E-11, "hs_exact.p",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+}
+
+/* check that h2o_new_vu() gets back the state it got v and u from */
+void check_vu(func_new constr, double arg1, double arg2)
+{
+	h2o_t state = constr(arg1, arg2);
+	h2o_t vu = h2o_new_vu(h2o_get_v(state), h2o_get_u(state));
+
+	check(vu.region, state.region, 0.5, "vu.region",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_T(vu), h2o_get_T(state), 1E-9, "vu.T",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+	check(h2o_get_p(vu), h2o_get_p(state), h2o_get_p(state) * 1E-9, "vu.p",
+			name1_by_constr(constr), arg1,
+			name2_by_constr(constr), arg2);
+}
+
+/* check the documented SBTL deviations over a sweep */
+void check_sbtl(void)
+{
+	h2o_sbtl_t* tab = h2o_sbtl_new();
+	double T_err = 0, p_err = 0, h_err = 0, w_err = 0, cp_err = 0;
+	double T2_err = 0, x_err = 0;
+	double lnp, T, x;
+	int failed = 0, not4 = 0;
+
+	check(tab != NULL, 1, 0.5, "h2o_sbtl_new()", "v", 0, "u", 0);
+	if (!tab)
+		return;
+
+	for (lnp = log(1E-3); lnp <= log(100); lnp += 0.19)
+	{
+		for (T = 275; T <= Tb25; T += 9.7)
+		{
+			h2o_t state = h2o_new_pT(exp(lnp), T);
+			struct h2o_props a, e;
+			double v, u;
+
+			if (!h2o_is_valid(state))
+				continue;
+			v = h2o_get_v(state);
+			u = h2o_get_u(state);
+
+			if (!h2o_sbtl_get_vu(tab, v, u, &a))
+			{
+				++failed;
+				continue;
+			}
+			h2o_get_all(h2o_new_vu(v, u), &e);
+
+			T_err = fmax(T_err, fabs(a.T - e.T));
+			p_err = fmax(p_err, fabs(a.p / e.p - 1));
+			h_err = fmax(h_err, fabs(a.h - e.h));
+			w_err = fmax(w_err, fabs(a.w / e.w - 1));
+			if (fabs(e.T - Tcrit) > 25)
+				cp_err = fmax(cp_err, fabs(a.cp / e.cp - 1));
+		}
+	}
+
+	/* Region 5 is not tabulated and has to fall back to h2o_new_vu() */
+	for (lnp = log(1E-3); lnp <= log(50); lnp += 0.19)
+	{
+		for (T = Tb25 + 0.1; T < Tb25 + 10; T += 0.7)
+		{
+			h2o_t state = h2o_new_pT(exp(lnp), T);
+			double v = h2o_get_v(state);
+			double u = h2o_get_u(state);
+			h2o_t a = h2o_sbtl_new_vu(tab, v, u);
+			h2o_t e = h2o_new_vu(v, u);
+
+			T_err = fmax(T_err, fabs(h2o_get_T(a) - h2o_get_T(e)));
+			p_err = fmax(p_err, fabs(h2o_get_p(a) / h2o_get_p(e) - 1));
+		}
+	}
+
+	/* close to the critical point, the saturated phases of IF97 do not
+	 * give (v,u) back exactly, so compare with h2o_new_vu(); stay off
+	 * the temperatures where they switch equations (and jump) */
+	for (T = Tmin + 0.1; T < 646.4; T += 3.7)
+	{
+		for (x = 0.01; x < 1; x += 0.1)
+		{
+			h2o_t state = h2o_new_Tx(T, x);
+			double v = h2o_get_v(state);
+			double u = h2o_get_u(state);
+			h2o_t a, e;
+
+			if (v > 1000)
+				continue;
+			a = h2o_sbtl_new_vu(tab, v, u);
+			e = h2o_new_vu(v, u);
+
+			if (a.region != H2O_REGION4)
+				++not4;
+			T2_err = fmax(T2_err, fabs(h2o_get_T(a) - h2o_get_T(e)));
+			x_err = fmax(x_err, fabs(h2o_get_x(a) - h2o_get_x(e)));
+		}
+	}
+
+	check(failed, 0, 0.5, "failed(h2o_sbtl_get_vu)", "p", 1E-3, "p", 100);
+	check(not4, 0, 0.5, "non-Region 4(h2o_sbtl_new_vu)", "T", Tmin, "T", 646.4);
+	check(T_err, 0, 1E-6, "max.err(sbtl.T)", "p", 1E-3, "p", 100);
+	check(p_err, 0, 1E-7, "max.relerr(sbtl.p)", "p", 1E-3, "p", 100);
+	check(h_err, 0, 1E-6, "max.err(sbtl.h)", "p", 1E-3, "p", 100);
+	check(w_err, 0, 2E-4, "max.err(sbtl.w)", "p", 1E-3, "p", 100);
+	check(cp_err, 0, 2E-4, "max.err(sbtl.cp)", "p", 1E-3, "p", 100);
+	check(T2_err, 0, 1E-5, "max.err(sbtl.T)", "T", Tmin, "T", 646.4);
+	check(x_err, 0, 1E-7, "max.err(sbtl.x)", "T", Tmin, "T", 646.4);
+
+	h2o_sbtl_free(tab);
+}
+
+/* check the documented TTSE deviations over a sweep */
+void check_ttse(void)
+{
+	h2o_ttse_t* tab = h2o_ttse_new();
+	double T_err = 0, rho_err = 0, Tsat_err = 0, x_err = 0;
+	double lnp, T, x, p, h;
+	int i, regions = 0;
+
+	check(tab != NULL, 1, 0.5, "h2o_ttse_new()", "p", 0, "h", 0);
+	if (!tab)
+		return;
+
+	for (lnp = log(psatmin); lnp <= log(100); lnp += 0.097)
+	{
+		for (T = 275; T <= Tb25; T += 7.3)
+		{
+			h2o_t state = h2o_new_pT(exp(lnp), T);
+
+			if (!h2o_is_valid(state))
+				continue;
+
+			for (i = 0; i < 2; ++i)
+			{
+				h2o_t a = i
+					? h2o_ttse_new_ps(tab, exp(lnp), h2o_get_s(state))
+					: h2o_ttse_new_ph(tab, exp(lnp), h2o_get_h(state));
+
+				T_err = fmax(T_err, fabs(h2o_get_T(a) - T));
+				if (a.region == H2O_REGION3)
+					rho_err = fmax(rho_err,
+							fabs(h2o_get_rho(a) / h2o_get_rho(state) - 1));
+			}
+		}
+	}
+
+	for (lnp = log(psatmin); lnp < log(pcrit); lnp += 0.0731)
+	{
+		for (x = 0.01; x < 1; x += 0.1)
+		{
+			h2o_t state = h2o_new_px(exp(lnp), x);
+
+			for (i = 0; i < 2; ++i)
+			{
+				h2o_t a = i
+					? h2o_ttse_new_ps(tab, exp(lnp), h2o_get_s(state))
+					: h2o_ttse_new_ph(tab, exp(lnp), h2o_get_h(state));
+
+				Tsat_err = fmax(Tsat_err, fabs(h2o_get_T(a) - h2o_get_T(state)));
+				x_err = fmax(x_err, fabs(h2o_get_x(a) - x));
+			}
+		}
+	}
+
+	/* around B23, where the Region 2 and 3 equations disagree a bit */
+	for (p = psat12max; p <= 60; p += 0.0731)
+	{
+		for (h = 2500; h <= 2800; h += 0.37)
+		{
+			h2o_t a = h2o_ttse_new_ph(tab, p, h);
+			h2o_t e = h2o_new_ph(p, h);
+			h2o_t ex = h2o_new_ph_exact(p, h);
+
+			if (a.region != e.region)
+				++regions;
+			else if (h2o_is_valid(ex) && ex.region == e.region)
+				T_err = fmax(T_err, fabs(h2o_get_T(a) - h2o_get_T(ex)));
+		}
+	}
+
+	check(regions, 0, 0.5, "region mismatch(ttse)", "p", psat12max, "p", 60);
+	check(T_err, 0, 0.025, "max.err(ttse.T)", "p", psatmin, "p", 100);
+	check(rho_err, 0, 2E-4, "max.err(ttse.rho)", "p", psatmin, "p", 100);
+	check(Tsat_err, 0, 1E-5, "max.err(ttse.Tsat)", "p", psatmin, "p", pcrit);
+	check(x_err, 0, 2E-5, "max.err(ttse.x)", "p", psatmin, "p", pcrit);
+
+	h2o_ttse_free(tab);
+}
+
+void check_stats(void)
+{
+	struct h2o_stats st;
+	h2o_t state;
+	int enabled;
+
+	h2o_stats_reset();
+	state = h2o_new_pT(25, 650);
+	h2o_get_h(state);
+	h2o_new_ph(30, 2800);
+
+	/* without --enable-stats, everything is zero */
+	enabled = h2o_stats_get(&st);
+	check(st.calls[H2O_STATS_NEW_PT], enabled, 0.5,
+			"stats.calls[NEW_PT]", "p", 25, "T", 650);
+	check(st.calls[H2O_STATS_REGION3_V_PT], enabled, 0.5,
+			"stats.calls[REGION3_V_PT]", "p", 25, "T", 650);
+	check(st.calls[H2O_STATS_GET_H], enabled, 0.5,
+			"stats.calls[GET_H]", "p", 25, "T", 650);
+	check(st.calls[H2O_STATS_REGION2_SUBREGION_PH], enabled, 0.5,
+			"stats.calls[REGION2_SUBREGION_PH]", "p", 30, "h", 2800);
+	check(st.calls[H2O_STATS_TWOARG_POLY_DERIVS] > 0, enabled, 0.5,
+			"stats.calls[TWOARG_POLY_DERIVS]", "p", 25, "T", 650);
+
+	h2o_stats_reset();
+	h2o_stats_get(&st);
+	check(st.calls[H2O_STATS_NEW_PT], 0, 0.5,
+			"stats.calls[NEW_PT]", "p", 0, "T", 0);
+
+	check(!strcmp(h2o_stats_name(H2O_STATS_GET_H), "h2o_get_h"), 1, 0.5,
+			"h2o_stats_name(GET_H)", "p", 0, "T", 0);
+	check(h2o_stats_name(H2O_STATS_MAX) == NULL, 1, 0.5,
+			"h2o_stats_name(MAX)", "p", 0, "T", 0);
+}
+
 int main(void)
 {
 	/* Region 1 */
@@ -518,6 +1544,122 @@ int main(void)
 	check_any(h2o_new_pT, 22.064, 647.15, &h2o_get_v,
 			0.3701940010E-2, 1E-12);
 
+	/* h2o_get_all() consistency with separate getters */
+	check_all(h2o_new_pT, 3., 300);
+	check_all(h2o_new_pT, 30E+0, 700);
+	check_all(h2o_new_rhoT, 500, 650);
+	check_all(h2o_new_pT, 30, 2000);
+	check_all(h2o_new_Tx, 400, 0.3);
+	check_all(h2o_new_Tx, 600, 0);
+	check_all(h2o_new_Tx, 640, 0.5);
+	check_all(h2o_new_Tx, 646.5, 1);
+
+	/* h2o_batch_get_h_pT() consistency with h2o_get_h() */
+	check_batch_h();
+	check_expand_line();
+
+	/* h2o_batch_*() consistency with the scalar functions */
+	check_batch_props();
+	check_batch_par();
+	check_xmath();
+
+	/* h2o_ex_t consistency with h2o_t */
+	check_ex(h2o_new_pT, 3., 300);
+	check_ex(h2o_new_rhoT, 500, 650);
+	check_ex(h2o_new_Tx, 500, 0.4);
+	check_ex(h2o_new_Tx, 640, 0.6);
+	check_ex(h2o_new_pT, 30, 2000);
+
+	/* h2o_sat_*() consistency with the Region 4 getters */
+	check_sat(300);
+	check_sat(500);
+	check_sat(630);
+	check_sat(645);
+	check_sat(646.55);
+	{
+		struct h2o_sat sat;
+
+		check(h2o_sat_T(Tcrit + 1, &sat), 0, 0.5, "h2o_sat_T()",
+				"T", Tcrit + 1, "x", 0);
+		check(h2o_sat_p(psatmin / 2, &sat), 0, 0.5, "h2o_sat_p()",
+				"p", psatmin / 2, "x", 0);
+		check(h2o_sat_approx_T(Tcrit + 1, &sat), 0, 0.5,
+				"h2o_sat_approx_T()", "T", Tcrit + 1, "x", 0);
+	}
+	check_sat_approx();
+	check_region3_subregion_pT();
+	check_hs_regions();
+	check_hints();
+	check_tracker();
+	check_region_ph_ps();
+
+	check_deriv(h2o_new_pT, 3., 300);
+	check_deriv(h2o_new_pT, 0.0035, 700);
+	check_deriv(h2o_new_pT, 30, 700);
+	check_deriv(h2o_new_rhoT, 500, 650);
+	check_deriv(h2o_new_pT, 30, 2000);
+	check_deriv_Tx(300, 0.5, 1E-6);
+	check_deriv_Tx(500, 0.1, 1E-6);
+	/* Region 3 phases come from the backward equations */
+	check_deriv_Tx(640, 0.5, 1E-3);
+	check(isnan(h2o_get_deriv(h2o_new_Tx(300, 0.5),
+					H2O_PROP_H, H2O_PROP_P, H2O_PROP_T)), 1, 0.5,
+			"isnan(deriv(h,p,T))", "T", 300, "x", 0.5);
+	check(isnan(h2o_get_deriv(h2o_new_pT(3., 300),
+					H2O_PROP_H, H2O_PROP_V, H2O_PROP_RHO)), 1, 0.5,
+			"isnan(deriv(h,v,rho))", "p", 3., "T", 300);
+	check(isnan(h2o_get_deriv(h2o_new_pT(200, 300),
+					H2O_PROP_H, H2O_PROP_T, H2O_PROP_P)), 1, 0.5,
+			"isnan(deriv(h,T,p))", "p", 200, "T", 300);
+	check(isnan(h2o_get_deriv(h2o_new_pT(3., 300),
+					H2O_PROP_MAX, H2O_PROP_T, H2O_PROP_P)), 1, 0.5,
+			"isnan(deriv(MAX,T,p))", "p", 3., "T", 300);
+
+	/* h2o_new_rhoT() round trips */
+	check_rhoT(h2o_new_pT, 0.001, 300);
+	check_rhoT(h2o_new_pT, 3., 300);
+	check_rhoT(h2o_new_pT, 80, 300);
+	check_rhoT(h2o_new_pT, 16.9, 622);
+	check_rhoT(h2o_new_pT, 0.0035, 700);
+	check_rhoT(h2o_new_pT, 30, 700);
+	check_rhoT(h2o_new_pT, 80, 1000);
+	check_rhoT(h2o_new_pT, 13.7, 975);
+	check_rhoT(h2o_new_pT, 0.5, 1500);
+	check_rhoT(h2o_new_pT, 30, 2000);
+	check_rhoT(h2o_new_Tx, 300, 0.5);
+	check_rhoT(h2o_new_Tx, 640, 0.9);
+	check(h2o_new_rhoT(1200, 300).region, H2O_REGION_OUT_OF_RANGE, 0.5,
+			"rhoT.region", "rho", 1200, "T", 300);
+	check(h2o_new_rhoT(1044, 726).region, H2O_REGION_OUT_OF_RANGE, 0.5,
+			"rhoT.region", "rho", 1044, "T", 726);
+
+	/* exact-consistency round trips */
+	check_exact(h2o_new_pT, 3., 300);
+	check_exact(h2o_new_pT, 0.0035, 400);
+	check_exact(h2o_new_pT, 30, 700);
+	check_exact(h2o_new_pT, 80, 1000);
+	check_exact(h2o_new_rhoT, 500, 650);
+	check_exact(h2o_new_Tx, 300, 0.5);
+	check_exact(h2o_new_Tx, 500, 0.05);
+
+	/* h2o_new_vu() round trips */
+	check_vu(h2o_new_pT, 0.001, 300);
+	check_vu(h2o_new_pT, 3., 300);
+	check_vu(h2o_new_pT, 16.9, 622);
+	check_vu(h2o_new_pT, 0.0035, 700);
+	check_vu(h2o_new_pT, 80, 1000);
+	check_vu(h2o_new_rhoT, 500, 650);
+	check_vu(h2o_new_rhoT, 200, 660);
+	check_vu(h2o_new_pT, 30, 2000);
+	check_vu(h2o_new_Tx, 300, 0.5);
+	check_vu(h2o_new_Tx, 500, 0.01);
+	check_vu(h2o_new_Tx, 640, 0.9);
+	check(h2o_new_vu(-1, 100).region, H2O_REGION_OUT_OF_RANGE, 0.5,
+			"vu.region", "v", -1, "u", 100);
+	check_sbtl();
+	check_ttse();
+	check_stats();
+
 	if (tests_failed == 0)
 		fprintf(stderr, "%d tests done. All tests suceeded.\n", tests_done);
 	else
@@ -16,6 +16,8 @@
 #include "region3.h"
 #include "region4.h"
 #include "region5.h"
+#include "h2o.h"
+#include "xmath.h"
 
 int tests_done = 0;
 int tests_failed = 0;
@@ -39,7 +41,7 @@ void _check(double result, double expected, double precision, const char* call)
 
 #define CHECK(call, expected, precision) _check(call, expected, precision, #call)
 
-int main(void)
+void check_values(void)
 {
 	CHECK(h2o_region4_p_T(300), 0.353658941E-2, 1E-11);
 	CHECK(h2o_region4_p_T(500), 0.263889776E+1, 1E-8);
@@ -326,6 +328,134 @@ int main(void)
 	CHECK(h2o_region3rx_T_p(22.0), 0.6482622754E3, 1E-7);
 	CHECK(h2o_region3uv_T_p(22.3), 0.6477996121E3, 1E-7);
 	CHECK(h2o_region3wx_T_p(22.3), 0.6482049480E3, 1E-7);
+}
+
+/* the same forward equations, through the batch kernels */
+void check_batch_values(void)
+{
+	struct h2o_props props[3];
+	double h[3];
+
+	static const double r1p[] = { 3., 80, 3. };
+	static const double r1T[] = { 300, 300, 500 };
+	static const double r2p[] = { 35E-4, 35E-4, 30E+0 };
+	static const double r2T[] = { 300, 700, 700 };
+	static const double r3rho[] = { 500, 200, 500 };
+	static const double r3T[] = { 650, 650, 750 };
+	static const double r5p[] = { .5, 30, 30 };
+	static const double r5T[] = { 1500, 1500, 2000 };
+
+	h2o_region1_props_pT_n(3, r1p, r1T, props);
+	CHECK(props[0].v, 0.100215168E-2, 1E-11);
+	CHECK(props[1].v, 0.971180894E-3, 1E-12);
+	CHECK(props[2].v, 0.120241800E-2, 1E-11);
+	CHECK(props[0].h, 0.115331273E+3, 1E-6);
+	CHECK(props[1].h, 0.184142828E+3, 1E-6);
+	CHECK(props[2].h, 0.975542239E+3, 1E-6);
+	CHECK(props[0].u, 0.112324818E+3, 1E-6);
+	CHECK(props[1].u, 0.106448356E+3, 1E-6);
+	CHECK(props[2].u, 0.971934985E+3, 1E-6);
+	CHECK(props[0].s, 0.392294792E+0, 1E-9);
+	CHECK(props[1].s, 0.368563852E+0, 1E-9);
+	CHECK(props[2].s, 0.258041912E+1, 1E-8);
+	CHECK(props[0].cp, 0.417301218E+1, 1E-8);
+	CHECK(props[1].cp, 0.401008987E+1, 1E-8);
+	CHECK(props[2].cp, 0.465580682E+1, 1E-8);
+	CHECK(props[0].w, 0.150773921E+4, 1E-5);
+	CHECK(props[1].w, 0.163469054E+4, 1E-5);
+	CHECK(props[2].w, 0.124071337E+4, 1E-5);
+	h2o_region1_h_pT_n(3, r1p, r1T, h);
+	CHECK(h[0], 0.115331273E+3, 1E-6);
+	CHECK(h[1], 0.184142828E+3, 1E-6);
+	CHECK(h[2], 0.975542239E+3, 1E-6);
+
+	h2o_region2_props_pT_n(3, r2p, r2T, props);
+	CHECK(props[0].v, 0.394913866E+2, 1E-7);
+	CHECK(props[1].v, 0.923015898E+2, 1E-7);
+	CHECK(props[2].v, 0.542946619E-2, 1E-11);
+	CHECK(props[0].h, 0.254991145E+4, 1E-5);
+	CHECK(props[1].h, 0.333568375E+4, 1E-5);
+	CHECK(props[2].h, 0.263149474E+4, 1E-5);
+	CHECK(props[0].u, 0.241169160E+4, 1E-5);
+	CHECK(props[1].u, 0.301262819E+4, 1E-5);
+	CHECK(props[2].u, 0.246861076E+4, 1E-5);
+	CHECK(props[0].s, 0.852238967E+1, 1E-8);
+	CHECK(props[1].s, 0.101749996E+2, 1E-7);
+	CHECK(props[2].s, 0.517540298E+1, 1E-8);
+	CHECK(props[0].cp, 0.191300162E+1, 1E-8);
+	CHECK(props[1].cp, 0.208141274E+1, 1E-8);
+	CHECK(props[2].cp, 0.103505092E+2, 1E-7);
+	CHECK(props[0].w, 0.427920172E+3, 1E-6);
+	CHECK(props[1].w, 0.644289068E+3, 1E-6);
+	CHECK(props[2].w, 0.480386523E+3, 1E-6);
+	h2o_region2_h_pT_n(3, r2p, r2T, h);
+	CHECK(h[0], 0.254991145E+4, 1E-5);
+	CHECK(h[1], 0.333568375E+4, 1E-5);
+	CHECK(h[2], 0.263149474E+4, 1E-5);
+
+	h2o_region3_props_rhoT_n(3, r3rho, r3T, props);
+	CHECK(props[0].p, 0.255837018E2, 1E-7);
+	CHECK(props[1].p, 0.222930643E2, 1E-7);
+	CHECK(props[2].p, 0.783095639E2, 1E-7);
+	CHECK(props[0].h, 0.186343019E4, 1E-5);
+	CHECK(props[1].h, 0.237512401E4, 1E-5);
+	CHECK(props[2].h, 0.225868845E4, 1E-5);
+	CHECK(props[0].u, 0.181226279E4, 1E-5);
+	CHECK(props[1].u, 0.226365868E4, 1E-5);
+	CHECK(props[2].u, 0.210206932E4, 1E-5);
+	CHECK(props[0].s, 0.405427273E1, 1E-8);
+	CHECK(props[1].s, 0.485438792E1, 1E-8);
+	CHECK(props[2].s, 0.446971906E1, 1E-8);
+	CHECK(props[0].cp, 0.138935717E2, 1E-7);
+	CHECK(props[1].cp, 0.446579342E2, 1E-7);
+	CHECK(props[2].cp, 0.634165359E1, 1E-8);
+	CHECK(props[0].w, 0.502005554E3, 1E-6);
+	CHECK(props[1].w, 0.383444594E3, 1E-6);
+	CHECK(props[2].w, 0.760696041E3, 1E-6);
+
+	h2o_region5_props_pT_n(3, r5p, r5T, props);
+	CHECK(props[0].v, 0.138455090E+1, 1E-08);
+	CHECK(props[1].v, 0.230761299E-1, 1E-10);
+	CHECK(props[2].v, 0.311385219E-1, 1E-10);
+	CHECK(props[0].h, 0.521976855E+4, 1E-5);
+	CHECK(props[1].h, 0.516723514E+4, 1E-5);
+	CHECK(props[2].h, 0.657122604E+4, 1E-5);
+	CHECK(props[0].u, 0.452749310E+4, 1E-5);
+	CHECK(props[1].u, 0.447495124E+4, 1E-5);
+	CHECK(props[2].u, 0.563707038E+4, 1E-5);
+	CHECK(props[0].s, 0.965408875E+1, 1E-8);
+	CHECK(props[1].s, 0.772970133E+1, 1E-8);
+	CHECK(props[2].s, 0.853640523E+1, 1E-8);
+	CHECK(props[0].cp, 0.261609445E+1, 1E-8);
+	CHECK(props[1].cp, 0.272724317E+1, 1E-8);
+	CHECK(props[2].cp, 0.288569882E+1, 1E-8);
+	CHECK(props[0].w, 0.917068690E+3, 1E-6);
+	CHECK(props[1].w, 0.928548002E+3, 1E-6);
+	CHECK(props[2].w, 0.106736948E+4, 1E-5);
+	h2o_region5_h_pT_n(3, r5p, r5T, h);
+	CHECK(h[0], 0.521976855E+4, 1E-5);
+	CHECK(h[1], 0.516723514E+4, 1E-5);
+	CHECK(h[2], 0.657122604E+4, 1E-5);
+}
+
+int main(void)
+{
+	enum xmath_variant variant;
+
+	for (variant = 0; variant < XMATH_VARIANT_MAX; ++variant)
+	{
+		if (!xmath_set_variant(variant))
+		{
+			fprintf(stderr, "[SKIP] %s kernels not supported.\n",
+					xmath_variant_name(variant));
+			continue;
+		}
+
+		fprintf(stderr, "Checking %s kernels.\n",
+				xmath_variant_name(variant));
+		check_values();
+		check_batch_values();
+	}
 
 	if (tests_failed == 0)
 		fprintf(stderr, "%d tests done. All tests suceeded.\n", tests_done);
@@ -0,0 +1,213 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+/* h2o-bndtabgen -- emit the h(p) and s(p) region boundary tables
+ *
+ * The program evaluates the region boundaries used by h2o_region_ph()
+ * and h2o_region_ps() on uniform grids and writes a header with
+ * the node values, the interpolation errors and the node range margins
+ * (see src/boundaries/boundaries.c).
+ *
+ * Usage: h2o-bndtabgen [nodes...] > src/boundaries/bndtab.h
+ *
+ * The optional arguments override the node counts of the grids.
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "boundaries.h"
+#include "consts.h"
+#include "region1.h"
+#include "region2.h"
+#include "region4.h"
+#include "xmath.h"
+
+typedef double (*boundary_func_t)(double);
+
+static double hmin_p(double p)
+{
+	return h2o_region1_h_pT(p, Tmin);
+}
+
+static double hb25_p(double p)
+{
+	return h2o_region2_h_pT(p, Tb25);
+}
+
+static double sb25_p(double p)
+{
+	return h2o_region2_s_pT(p, Tb25);
+}
+
+static double hsat1_p(double p)
+{
+	return h2o_region1_h_pT(p, h2o_region4_T_p(p));
+}
+
+static double hsat2_p(double p)
+{
+	return h2o_region2_h_pT(p, h2o_region4_T_p(p));
+}
+
+static double ssat1_p(double p)
+{
+	return h2o_region1_s_pT(p, h2o_region4_T_p(p));
+}
+
+static double ssat2_p(double p)
+{
+	return h2o_region2_s_pT(p, h2o_region4_T_p(p));
+}
+
+static double hb13_p(double p)
+{
+	return h2o_region1_h_pT(p, Tb13);
+}
+
+static double hb23_p(double p)
+{
+	return h2o_region2_h_pT(p, h2o_b23_T_p(p));
+}
+
+static double sb13_p(double p)
+{
+	return h2o_region1_s_pT(p, Tb13);
+}
+
+static double sb23_p(double p)
+{
+	return h2o_region2_s_pT(p, h2o_b23_T_p(p));
+}
+
+#define COLUMNS 7
+
+/* The grids are split at psat12max, where the liquid and vapour side
+ * boundaries switch from the saturation line to B13 and B23. */
+struct grid
+{
+	const char* name;
+	double pmin, pmax;
+	int nodes;
+	boundary_func_t columns[COLUMNS];
+};
+
+/* The errors only need to be small compared to the distances between
+ * the boundaries, since the exact functions are evaluated within them;
+ * the node counts keep them below 2E-4 kJ/kg (0.015 kJ/kg for h along
+ * B23) and the tables small. */
+static struct grid grids[] = {
+	{ "low", psatmin, psat12max, 256,
+		{ hmin_p, hb25_p, sb25_p, hsat1_p, hsat2_p, ssat1_p, ssat2_p } },
+	{ "high", psat12max, pmax, 128,
+		{ hmin_p, hb25_p, sb25_p, hb13_p, hb23_p, sb13_p, sb23_p } }
+};
+
+#define GRIDS ((int) (sizeof(grids) / sizeof(*grids)))
+
+/* the points checked between each two nodes */
+static const int node_samples = 16;
+
+int main(int argc, char* argv[])
+{
+	int i, j, k, m;
+
+	/* optional node counts, for tuning */
+	for (k = 0; k < GRIDS && k + 1 < argc; ++k)
+		grids[k].nodes = atoi(argv[k + 1]);
+
+	printf("/* generated by h2o-bndtabgen, do not edit */\n");
+
+	for (k = 0; k < GRIDS; ++k)
+	{
+		const struct grid* g = &grids[k];
+		double bmin = pow(g->pmin, 0.25);
+		double bstep = (pow(g->pmax, 0.25) - bmin) / (g->nodes - 1);
+		double (*f)[COLUMNS] = malloc(g->nodes * sizeof(*f));
+		double err[COLUMNS] = { 0 };
+		double span[COLUMNS] = { 0 };
+
+		if (!f)
+			return 1;
+
+		for (i = 0; i < g->nodes; ++i)
+		{
+			double p = i == 0 ? g->pmin
+				: i == g->nodes - 1 ? g->pmax
+				: pow(bmin + i * bstep, 4);
+
+			for (j = 0; j < COLUMNS; ++j)
+				f[i][j] = g->columns[j](p);
+		}
+
+		/* interpolate the same way h2o_region_ph() does */
+		for (i = 0; i < (g->nodes - 1) * node_samples; ++i)
+		{
+			double p = pow(bmin + (double) i / node_samples * bstep, 4);
+			double w[4];
+			int base = xmath_lagrange4_weights(
+					(sqrt(sqrt(p)) - bmin) / bstep, g->nodes, w);
+
+			for (j = 0; j < COLUMNS; ++j)
+			{
+				double exact = g->columns[j](p);
+				double y = 0;
+				int node = i / node_samples;
+
+				for (m = 0; m < 4; ++m)
+					y += w[m] * f[base + m][j];
+				err[j] = fmax(err[j], fabs(y - exact));
+
+				/* the boundary can pass the values at the two nodes
+				 * around p where it is not monotonic */
+				span[j] = fmax(span[j], fmax(
+						fmin(f[node][j], f[node + 1][j]) - exact,
+						exact - fmax(f[node][j], f[node + 1][j])));
+			}
+		}
+
+		printf("\n/* beta = p^0.25 = bmin + i * bstep */\n");
+		printf("static const double bndtab_%s_bmin = %a;\n", g->name, bmin);
+		printf("static const double bndtab_%s_bstep = %a;\n\n", g->name, bstep);
+
+		/* the maximum is checked on the samples only */
+		printf("/* the interpolation errors */\n");
+		printf("static const double bndtab_%s_err[BNDTAB_COLUMNS] = {\n\t",
+				g->name);
+		for (j = 0; j < COLUMNS; ++j)
+			printf("%a%s", 2 * err[j] + 1E-9,
+					j < COLUMNS - 1 ? (j % 3 == 2 ? ",\n\t" : ", ") : "\n");
+		printf("};\n\n");
+
+		printf("/* the margins outside the values at the two nodes around p */\n");
+		printf("static const double bndtab_%s_span[BNDTAB_COLUMNS] = {\n\t",
+				g->name);
+		for (j = 0; j < COLUMNS; ++j)
+			printf("%a%s", 2 * span[j] + 1E-9,
+					j < COLUMNS - 1 ? (j % 3 == 2 ? ",\n\t" : ", ") : "\n");
+		printf("};\n\n");
+
+		printf("static const double bndtab_%s[%d][BNDTAB_COLUMNS] = {\n",
+				g->name, g->nodes);
+		for (i = 0; i < g->nodes; ++i)
+		{
+			printf("\t{ %.17g, %.17g, %.17g,\n"
+					"\t\t%.17g, %.17g, %.17g, %.17g }%s\n",
+					f[i][0], f[i][1], f[i][2], f[i][3],
+					f[i][4], f[i][5], f[i][6],
+					i < g->nodes - 1 ? "," : "");
+		}
+		printf("};\n");
+
+		free(f);
+	}
+
+	return 0;
+}
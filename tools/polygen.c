@@ -0,0 +1,521 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+/* h2o-polygen -- emit specialized straight-line evaluators for the IF97
+ * coefficient tables.
+ *
+ * The program reads the n[], I[], Ipows[], J[] and Jpows[] tables from
+ * a region source file and writes a header with static inline
+ * functions equivalent to twoarg_poly_value() (and optionally
+ * twoarg_poly_derivs() and twoarg_poly_derivs_n()) over those tables,
+ * with all the exponents baked into a fixed multiplication ladder.
+ *
+ * Usage: h2o-polygen [-d] [-o offset] name source.c > name.h
+ *
+ * -d: emit the derivatives (for the forward equations),
+ * -o: skip that many leading terms (like &n[1] in Region 3).
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_TERMS 64
+#define MAX_POW 64
+
+/* indentation of the emitted function bodies */
+static const char* indent = "\t";
+
+struct table
+{
+	double values[MAX_TERMS];
+	int count;
+};
+
+static char* read_file(const char* path)
+{
+	FILE* f = fopen(path, "r");
+	char* buf;
+	size_t len = 0, size = 4096;
+
+	if (!f)
+	{
+		perror(path);
+		return NULL;
+	}
+
+	buf = malloc(size);
+	while (buf)
+	{
+		len += fread(&buf[len], 1, size - len - 1, f);
+		if (len < size - 1)
+			break;
+		size *= 2;
+		buf = realloc(buf, size);
+	}
+
+	if (buf)
+		buf[len] = 0;
+	fclose(f);
+	return buf;
+}
+
+/* replace C comments with whitespace */
+static void strip_comments(char* buf)
+{
+	char* p = buf;
+
+	while ((p = strstr(p, "/*")))
+	{
+		char* end = strstr(p + 2, "*/");
+
+		if (!end)
+			end = p + strlen(p) - 2;
+		memset(p, ' ', end + 2 - p);
+		p = end + 2;
+	}
+}
+
+static int parse_table(const char* buf, const char* name,
+		struct table* out)
+{
+	char pattern[32];
+	const char* p;
+
+	sprintf(pattern, " %s[] = {", name);
+	p = strstr(buf, pattern);
+	if (!p)
+	{
+		fprintf(stderr, "Table %s[] not found\n", name);
+		return 0;
+	}
+	p += strlen(pattern);
+
+	out->count = 0;
+	while (1)
+	{
+		char* end;
+		double val;
+
+		while (*p == ' ' || *p == '\t' || *p == '\n' || *p == ',')
+			++p;
+		if (*p == '}')
+			break;
+
+		val = strtod(p, &end);
+		if (end == p || out->count == MAX_TERMS)
+		{
+			fprintf(stderr, "Unable to parse table %s[]\n", name);
+			return 0;
+		}
+
+		out->values[out->count++] = val;
+		p = end;
+	}
+
+	return 1;
+}
+
+/* the generated code uses integer power ladders only */
+static int check_exponents(const struct table* pows, const char* name)
+{
+	int i;
+
+	for (i = 0; i < pows->count; ++i)
+	{
+		if (pows->values[i] != (int) pows->values[i])
+		{
+			fprintf(stderr, "Non-integer exponent %g in table %s[]\n",
+					pows->values[i], name);
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* power ladder for a single variable */
+struct ladder
+{
+	const char* var;
+	char have_pos[MAX_POW + 1];
+	char have_neg[MAX_POW + 1];
+};
+
+static void pow_name(char* buf, const char* var, int e)
+{
+	if (e >= 0)
+		sprintf(buf, "%sp%d", var, e);
+	else
+		sprintf(buf, "%sm%d", var, -e);
+}
+
+/* emit the power x^k (k > 0) of either x or 1/x, reusing the already
+ * computed powers where possible */
+static void ensure_pow(struct ladder* l, int k, int neg)
+{
+	char* have = neg ? l->have_neg : l->have_pos;
+	int sign = neg ? -1 : 1;
+	char name[32], a[32], b[32];
+	int j;
+
+	assert(k > 0 && k <= MAX_POW);
+
+	if (have[k])
+		return;
+
+	pow_name(name, l->var, sign * k);
+
+	if (k == 1)
+	{
+		if (neg)
+			printf("%sconst double %s = 1 / %s;\n", indent, name, l->var);
+		else
+			printf("%sconst double %s = %s;\n", indent, name, l->var);
+		have[k] = 1;
+		return;
+	}
+
+	for (j = k - 1; j >= (k + 1) / 2; --j)
+	{
+		if (have[j] && have[k - j])
+			break;
+	}
+
+	if (j < (k + 1) / 2)
+	{
+		/* nothing to combine; go by halves */
+		j = k - k / 2;
+		ensure_pow(l, j, neg);
+		ensure_pow(l, k - j, neg);
+	}
+
+	pow_name(a, l->var, sign * j);
+	pow_name(b, l->var, sign * (k - j));
+	printf("%sconst double %s = %s * %s;\n", indent, name, a, b);
+	have[k] = 1;
+}
+
+static void emit_pow(struct ladder* l, int e)
+{
+	if (e > 0)
+		ensure_pow(l, e, 0);
+	else if (e < 0)
+		ensure_pow(l, -e, 1);
+}
+
+/* the factor for a given power, or NULL for x^0 */
+static const char* factor(char* buf, const char* var, int e)
+{
+	if (e == 0)
+		return NULL;
+	pow_name(buf, var, e);
+	return buf;
+}
+
+static void emit_term(const char* acc, double coeff,
+		const char* var1, int e1, const char* var2, int e2)
+{
+	char b1[32], b2[32];
+	const char* f1 = factor(b1, var1, e1);
+	const char* f2 = factor(b2, var2, e2);
+
+	if (coeff == 0)
+		return;
+
+	printf("%s%s += %+.17e", indent, acc, coeff);
+	if (f1)
+		printf(" * %s", f1);
+	if (f2)
+		printf(" * %s", f2);
+	printf(";\n");
+}
+
+struct equation
+{
+	struct table n, I, Ipows, J, Jpows;
+	int offset;
+	int nlen;
+};
+
+/* the factor resulting from differentiating x^e der times */
+static int deriv_factor(int e, int der)
+{
+	switch (der)
+	{
+		case 0:
+			return 1;
+		case 1:
+			return e;
+		case 2:
+			return e * (e - 1);
+		default:
+			assert(0);
+			return 0;
+	}
+}
+
+static int term_exp(const struct table* pows, const struct table* idx,
+		int i)
+{
+	int k = (int) idx->values[i];
+
+	assert(k >= 0 && k < pows->count);
+	return (int) pows->values[k];
+}
+
+/* emit the code computing sum for given derivative orders */
+static void emit_single_body(const struct equation* eq,
+		int x1der, int x2der)
+{
+	struct ladder l1 = { "x1", { 0 }, { 0 } };
+	struct ladder l2 = { "x2", { 0 }, { 0 } };
+	int i;
+
+	for (i = 1 + eq->offset; i <= eq->nlen + eq->offset; ++i)
+	{
+		int e1 = term_exp(&eq->Ipows, &eq->I, i);
+		int e2 = term_exp(&eq->Jpows, &eq->J, i);
+
+		if (deriv_factor(e1, x1der) && deriv_factor(e2, x2der))
+		{
+			emit_pow(&l1, e1 - x1der);
+			emit_pow(&l2, e2 - x2der);
+		}
+	}
+
+	printf("\n%sdouble sum = 0;\n\n", indent);
+
+	for (i = 1 + eq->offset; i <= eq->nlen + eq->offset; ++i)
+	{
+		int e1 = term_exp(&eq->Ipows, &eq->I, i);
+		int e2 = term_exp(&eq->Jpows, &eq->J, i);
+		double coeff = eq->n.values[i]
+			* deriv_factor(e1, x1der) * deriv_factor(e2, x2der);
+
+		emit_term("sum", coeff, "x1", e1 - x1der, "x2", e2 - x2der);
+	}
+}
+
+/* emit the code computing all the derivatives into out (a pointer) */
+static void emit_derivs_body(const struct equation* eq, const char* out)
+{
+	struct ladder l1 = { "x1", { 0 }, { 0 } };
+	struct ladder l2 = { "x2", { 0 }, { 0 } };
+	int i, d;
+
+	for (i = 1 + eq->offset; i <= eq->nlen + eq->offset; ++i)
+	{
+		int e1 = term_exp(&eq->Ipows, &eq->I, i);
+		int e2 = term_exp(&eq->Jpows, &eq->J, i);
+
+		for (d = 0; d <= 2; ++d)
+		{
+			if (deriv_factor(e1, d))
+				emit_pow(&l1, e1 - d);
+			if (deriv_factor(e2, d))
+				emit_pow(&l2, e2 - d);
+		}
+	}
+
+	printf("\n%sdouble val = 0, d1 = 0, d2 = 0, d11 = 0, d12 = 0, d22 = 0;\n\n",
+			indent);
+
+	for (i = 1 + eq->offset; i <= eq->nlen + eq->offset; ++i)
+	{
+		int e1 = term_exp(&eq->Ipows, &eq->I, i);
+		int e2 = term_exp(&eq->Jpows, &eq->J, i);
+		double n = eq->n.values[i];
+
+		emit_term("val", n, "x1", e1, "x2", e2);
+		emit_term("d1", n * deriv_factor(e1, 1),
+				"x1", e1 - 1, "x2", e2);
+		emit_term("d2", n * deriv_factor(e2, 1),
+				"x1", e1, "x2", e2 - 1);
+		emit_term("d11", n * deriv_factor(e1, 2),
+				"x1", e1 - 2, "x2", e2);
+		emit_term("d12", n * deriv_factor(e1, 1) * deriv_factor(e2, 1),
+				"x1", e1 - 1, "x2", e2 - 1);
+		emit_term("d22", n * deriv_factor(e2, 2),
+				"x1", e1, "x2", e2 - 2);
+	}
+
+	printf("\n%s%s->val = val;\n", indent, out);
+	printf("%s%s->d1 = d1;\n", indent, out);
+	printf("%s%s->d2 = d2;\n", indent, out);
+	printf("%s%s->d11 = d11;\n", indent, out);
+	printf("%s%s->d12 = d12;\n", indent, out);
+	printf("%s%s->d22 = d22;\n", indent, out);
+}
+
+/* emit the start of a loop over XMATH_LANES-sized blocks of points,
+ * with the last block padded by repeating the last point; the body
+ * of the lane loop has x1 and x2 set for a single point */
+static void emit_lanes_start(const char* rtype)
+{
+	printf("\tint off;\n\n"
+			"\tfor (off = 0; off < count; off += XMATH_LANES)\n\t{\n"
+			"\t\tdouble x1l[XMATH_LANES], x2l[XMATH_LANES];\n"
+			"\t\t%s r[XMATH_LANES];\n\n"
+			"\t\tint l;\n"
+			"\t\tint lanes = count - off < XMATH_LANES\n"
+			"\t\t\t? count - off : XMATH_LANES;\n\n"
+			"\t\tfor (l = 0; l < XMATH_LANES; ++l)\n\t\t{\n"
+			"\t\t\tint src = off + (l < lanes ? l : lanes - 1);\n\n"
+			"\t\t\tx1l[l] = x1[src];\n"
+			"\t\t\tx2l[l] = x2[src];\n"
+			"\t\t}\n\n", rtype);
+}
+
+static void emit_lane_loop_start(const char* ind)
+{
+	printf("%sfor (l = 0; l < XMATH_LANES; ++l)\n%s{\n"
+			"%s\tconst double x1 = x1l[l];\n"
+			"%s\tconst double x2 = x2l[l];\n\n",
+			ind, ind, ind, ind);
+}
+
+static void emit_lanes_end(void)
+{
+	printf("\n\t\tfor (l = 0; l < lanes; ++l)\n"
+			"\t\t\tout[off + l] = r[l];\n"
+			"\t}\n}\n\n");
+}
+
+static void emit(const char* name, const char* source,
+		const struct equation* eq, int derivs)
+{
+	static const int ders[][2] = {
+		{ 0, 0 }, { 1, 0 }, { 0, 1 }, { 2, 0 }, { 1, 1 }, { 0, 2 }
+	};
+	int i;
+
+	printf("/* generated by h2o-polygen from %s -- do not edit */\n\n",
+			source);
+	printf("#include <stdlib.h>\n\n");
+
+	for (i = 0; i < (derivs ? 6 : 1); ++i)
+	{
+		printf("static inline double %s_d%d%d(double x1, double x2)\n{\n",
+				name, ders[i][0], ders[i][1]);
+		emit_single_body(eq, ders[i][0], ders[i][1]);
+		printf("\n\treturn sum;\n}\n\n");
+	}
+
+	if (!derivs)
+	{
+		printf("static inline double %s_value(double x1, double x2,\n"
+				"\t\tint x1der, int x2der)\n{\n"
+				"\t(void) x1der;\n\t(void) x2der;\n"
+				"\treturn %s_d00(x1, x2);\n}\n", name, name);
+		return;
+	}
+
+	printf("static inline double %s_value(double x1, double x2,\n"
+			"\t\tint x1der, int x2der)\n{\n"
+			"\tswitch (x1der * 3 + x2der)\n\t{\n", name);
+	for (i = 0; i < 6; ++i)
+		printf("\t\tcase %d:\n\t\t\treturn %s_d%d%d(x1, x2);\n",
+				ders[i][0] * 3 + ders[i][1], name,
+				ders[i][0], ders[i][1]);
+	printf("\t\tdefault:\n\t\t\tabort();\n\t}\n}\n\n");
+
+	printf("static inline void %s_derivs(double x1, double x2,\n"
+			"\t\tstruct twoarg_derivs* out)\n{\n", name);
+	emit_derivs_body(eq, "out");
+	printf("}\n\n");
+
+	/* the batch variants have the code inline in fixed-size loops over
+	 * lanes, so that the compiler can vectorize them; they are always
+	 * inlined to get built for each of the CPU variants of the caller */
+	printf("static XMATH_ALWAYS_INLINE void %s_value_n(int count,\n"
+			"\t\tconst double x1[], const double x2[],\n"
+			"\t\tint x1der, int x2der, double out[])\n{\n", name);
+	emit_lanes_start("double");
+	printf("\t\tswitch (x1der * 3 + x2der)\n\t\t{\n");
+	indent = "\t\t\t\t\t";
+	for (i = 0; i < 6; ++i)
+	{
+		printf("\t\t\tcase %d:\n", ders[i][0] * 3 + ders[i][1]);
+		emit_lane_loop_start("\t\t\t\t");
+		emit_single_body(eq, ders[i][0], ders[i][1]);
+		printf("\n\t\t\t\t\tr[l] = sum;\n\t\t\t\t}\n\t\t\t\tbreak;\n");
+	}
+	printf("\t\t\tdefault:\n\t\t\t\tabort();\n\t\t}\n");
+	emit_lanes_end();
+
+	printf("static XMATH_ALWAYS_INLINE void %s_derivs_n(int count,\n"
+			"\t\tconst double x1[], const double x2[],\n"
+			"\t\tstruct twoarg_derivs out[])\n{\n", name);
+	emit_lanes_start("struct twoarg_derivs");
+	indent = "\t\t\t";
+	emit_lane_loop_start("\t\t");
+	emit_derivs_body(eq, "(&r[l])");
+	printf("\t\t}\n");
+	emit_lanes_end();
+	indent = "\t";
+}
+
+int main(int argc, char* argv[])
+{
+	struct equation eq;
+	int derivs = 0;
+	int opt;
+	char* buf;
+
+	eq.offset = 0;
+
+	while ((opt = getopt(argc, argv, "do:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'd':
+				derivs = 1;
+				break;
+			case 'o':
+				eq.offset = atoi(optarg);
+				break;
+			default:
+				return 1;
+		}
+	}
+
+	if (argc - optind != 2)
+	{
+		fprintf(stderr, "Usage: %s [-d] [-o offset] name source.c\n",
+				argv[0]);
+		return 1;
+	}
+
+	buf = read_file(argv[optind + 1]);
+	if (!buf)
+		return 1;
+	strip_comments(buf);
+
+	if (!parse_table(buf, "n", &eq.n)
+			|| !parse_table(buf, "I", &eq.I)
+			|| !parse_table(buf, "Ipows", &eq.Ipows)
+			|| !parse_table(buf, "J", &eq.J)
+			|| !parse_table(buf, "Jpows", &eq.Jpows))
+		return 1;
+	if (!check_exponents(&eq.Ipows, "Ipows")
+			|| !check_exponents(&eq.Jpows, "Jpows"))
+		return 1;
+
+	eq.nlen = eq.n.count - 1 - eq.offset;
+	if (eq.I.count != eq.n.count || eq.J.count != eq.n.count)
+	{
+		fprintf(stderr, "Table length mismatch in %s\n",
+				argv[optind + 1]);
+		return 1;
+	}
+
+	emit(argv[optind], argv[optind + 1], &eq, derivs);
+
+	free(buf);
+	return 0;
+}
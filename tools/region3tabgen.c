@@ -0,0 +1,288 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+/* h2o-region3tabgen -- emit the Region 3 v(p,T) subregion tables
+ *
+ * The program splits the Region 3 pressure range into bins, finds
+ * the subregion boundaries crossing each of them using
+ * h2o_region3_subregion_pT_exact() and writes a header with their
+ * linear fits, used by h2o_region3_subregion_pT() (see
+ * src/region3/region3pT.c).
+ *
+ * Usage: h2o-region3tabgen [bins...] > src/region3/pTtab.h
+ *
+ * The optional arguments override the bin counts of the segments.
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "boundaries.h"
+#include "consts.h"
+#include "region3.h"
+#include "region4.h"
+
+/* The pressure range is split at the pressures the subregion selection
+ * branches on, so that the boundaries crossing a segment are the same
+ * throughout it (mostly). The segments are listed from the highest
+ * pressure, which is looked up first. */
+struct segment
+{
+	double pmax, pmin;
+	int bins;
+};
+
+static struct segment segments[] = {
+	{ 100, 40, 60 },
+	{ 40, 25, 60 },
+	{ 25, 23.5, 75 },
+	{ 23.5, 23, 25 },
+	{ 23, 22.5, 25 },
+	{ 22.5, 22.11, 20 },
+	{ 22.11, pcrit, 4 },
+	{ pcrit, p3ymin, 8 },
+	{ p3ymin, p3zmin, 4 },
+	{ p3zmin, psat3rsmax, 43 },
+	{ psat3rsmax, 20.5, 27 },
+	{ 20.5, p3cd, 30 },
+	{ p3cd, psat12max, 50 }
+};
+
+#define SEGMENTS ((int) (sizeof(segments) / sizeof(*segments)))
+
+typedef double (*boundary_func_t)(double);
+
+static const boundary_func_t boundaries[] = {
+	h2o_region3ab_T_p, h2o_region3cd_T_p, h2o_region3ef_T_p,
+	h2o_region3gh_T_p, h2o_region3ij_T_p, h2o_region3jk_T_p,
+	h2o_region3mn_T_p, h2o_region3op_T_p, h2o_region3qu_T_p,
+	h2o_region3rx_T_p, h2o_region3uv_T_p, h2o_region3wx_T_p,
+	/* only up to pcrit */
+	h2o_region4_T_p
+};
+
+#define BOUNDARIES ((int) (sizeof(boundaries) / sizeof(*boundaries)))
+
+/* the subregion below the given boundary; the last one has boundary
+ * -1 and holds the subregion above all of them */
+struct cut
+{
+	int boundary;
+	enum h2o_region3_subregion_pT subregion;
+};
+
+/* the points checked within a bin */
+static const int bin_samples = 64;
+
+/* Find the subregions along the isobar. The selection compares T only
+ * with the boundaries, so it is constant between each two of them. */
+static int find_cuts(double p, struct cut* out)
+{
+	double T[BOUNDARIES + 2];
+	int id[BOUNDARIES + 2];
+	double Tmax = h2o_b23_T_p(p);
+	int n = 0;
+	int ncuts = 0;
+	int i, j;
+
+	T[n] = Tb13;
+	id[n++] = -1;
+	for (i = 0; i < BOUNDARIES; ++i)
+	{
+		double Tb;
+
+		if (boundaries[i] == h2o_region4_T_p && p > pcrit)
+			continue;
+
+		Tb = boundaries[i](p);
+		if (Tb > Tb13 && Tb < Tmax)
+		{
+			/* insertion sort */
+			for (j = n; j > 0 && T[j - 1] > Tb; --j)
+			{
+				T[j] = T[j - 1];
+				id[j] = id[j - 1];
+			}
+			T[j] = Tb;
+			id[j] = i;
+			++n;
+		}
+	}
+	T[n] = Tmax;
+	id[n++] = -1;
+
+	for (i = 0; i + 1 < n; ++i)
+	{
+		enum h2o_region3_subregion_pT sub;
+
+		if (!(T[i + 1] > T[i]))
+			continue;
+
+		sub = h2o_region3_subregion_pT_exact(p, (T[i] + T[i + 1]) / 2);
+		if (ncuts > 0 && out[ncuts - 1].subregion == sub)
+			continue;
+
+		/* the previous interval ends at this boundary */
+		if (ncuts > 0)
+			out[ncuts - 1].boundary = id[i];
+		out[ncuts].boundary = -1;
+		out[ncuts].subregion = sub;
+		++ncuts;
+	}
+
+	return ncuts;
+}
+
+static int cuts_equal(const struct cut* a, int na,
+		const struct cut* b, int nb)
+{
+	int i;
+
+	if (na != nb)
+		return 0;
+	for (i = 0; i < na; ++i)
+	{
+		if (a[i].boundary != b[i].boundary
+				|| a[i].subregion != b[i].subregion)
+			return 0;
+	}
+
+	return 1;
+}
+
+int main(int argc, char* argv[])
+{
+	struct cut (*cuts)[BOUNDARIES + 1];
+	int* ncuts;
+	int nbins = 0;
+	int first;
+	int i, k, l;
+
+	/* optional bin counts, for tuning */
+	for (k = 0; k < SEGMENTS && k + 1 < argc; ++k)
+		segments[k].bins = atoi(argv[k + 1]);
+
+	for (k = 0; k < SEGMENTS; ++k)
+		nbins += segments[k].bins;
+	cuts = malloc(nbins * sizeof(*cuts));
+	ncuts = malloc(nbins * sizeof(*ncuts));
+	if (!cuts || !ncuts)
+		return 1;
+
+	printf("/* generated by h2o-region3tabgen, do not edit */\n\n");
+	printf("#define PTTAB_SEGMENTS %d\n\n", SEGMENTS);
+
+	printf("/* pmax, pmin, pstep, first bin, bin count */\n");
+	printf("static const struct pTtab_segment pTtab_segments[PTTAB_SEGMENTS] = {\n");
+	first = 0;
+	for (k = 0; k < SEGMENTS; ++k)
+	{
+		const struct segment* seg = &segments[k];
+
+		printf("\t{ %a, %a, %a, %d, %d }%s\n",
+				seg->pmax, seg->pmin, (seg->pmax - seg->pmin) / seg->bins,
+				first, seg->bins, k < SEGMENTS - 1 ? "," : "");
+
+		/* the boundaries crossing each bin, if constant */
+		for (i = 0; i < seg->bins; ++i)
+		{
+			double pstep = (seg->pmax - seg->pmin) / seg->bins;
+			double pa = seg->pmin + i * pstep;
+			double pb = i == seg->bins - 1 ? seg->pmax : pa + pstep;
+			struct cut* c = cuts[first + i];
+			int* n = &ncuts[first + i];
+
+			*n = find_cuts((pa + pb) / 2, c);
+			for (l = 0; l <= bin_samples; ++l)
+			{
+				struct cut sc[BOUNDARIES + 1];
+				/* pmin itself belongs to the next segment */
+				double p = l == 0 ? nextafter(pa, pb)
+					: l == bin_samples ? pb
+					: pa + l * (pb - pa) / bin_samples;
+				int sn = find_cuts(p, sc);
+
+				if (!cuts_equal(c, *n, sc, sn))
+				{
+					*n = 0;
+					break;
+				}
+			}
+		}
+		first += seg->bins;
+	}
+	printf("};\n\n");
+
+	printf("/* the first cut for each bin, or -1 if the boundaries change"
+			" within it */\n");
+	printf("static const int pTtab_bins[%d] = {\n", nbins);
+	first = 0;
+	for (i = 0; i < nbins; ++i)
+	{
+		printf("\t%d%s\n", ncuts[i] ? first : -1, i < nbins - 1 ? "," : "");
+		first += ncuts[i];
+	}
+	printf("};\n\n");
+
+	printf("/* T = T0 + dTdp * (p - pbin) within Terr, the subregion"
+			" below */\n");
+	printf("static const struct pTtab_cut pTtab_cuts[%d] = {\n", first);
+	l = 0;
+	for (k = 0; k < SEGMENTS; ++k)
+	{
+		const struct segment* seg = &segments[k];
+		double pstep = (seg->pmax - seg->pmin) / seg->bins;
+
+		for (i = 0; i < seg->bins; ++i, ++l)
+		{
+			double pa = seg->pmin + i * pstep;
+			double pb = i == seg->bins - 1 ? seg->pmax : pa + pstep;
+			int j, m;
+
+			for (j = 0; j < ncuts[l]; ++j)
+			{
+				const struct cut* c = &cuts[l][j];
+				double T0 = INFINITY, dTdp = 0, Terr = 0;
+
+				--first;
+				if (c->boundary != -1)
+				{
+					boundary_func_t f = boundaries[c->boundary];
+
+					T0 = f(pa);
+					dTdp = (f(pb) - T0) / (pb - pa);
+					for (m = 0; m <= bin_samples; ++m)
+					{
+						double p = pa + m * (pb - pa) / bin_samples;
+
+						Terr = fmax(Terr, fabs(f(p) - (T0 + dTdp * (p - pa))));
+					}
+
+					/* the fit is checked on the samples only,
+					 * and the runtime evaluation may round differently */
+					Terr = 2 * Terr + 1E-9;
+				}
+
+				if (isinf(T0))
+					printf("\t{ INFINITY, 0, 0, H2O_REGION3%c_PT }%s\n",
+							'A' + c->subregion, first ? "," : "");
+				else
+					printf("\t{ %a, %a, %a, H2O_REGION3%c_PT }%s\n",
+							T0, dTdp, Terr, 'A' + c->subregion,
+							first ? "," : "");
+			}
+		}
+	}
+	printf("};\n");
+
+	free(cuts);
+	free(ncuts);
+	return 0;
+}
@@ -0,0 +1,147 @@
+/* libh2o -- steam & water properties
+ * (c) 2012 Michał Górny
+ * Released under the terms of the 2-clause BSD license
+ */
+
+/* h2o-sattabgen -- emit the saturation line tables
+ *
+ * The program evaluates the Region 4 equations on uniform grids and
+ * writes a header with the node values, used by h2o_sat_approx_T()
+ * and h2o_sat_approx_p() (see src/region4/region4tab.c).
+ *
+ * Usage: h2o-sattabgen [nodes...] > src/region4/sattab.h
+ *
+ * The optional arguments override the node counts of the temperature
+ * segments and the pressure table (in this order).
+ */
+
+#ifdef HAVE_CONFIG_H
+#	include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "consts.h"
+#include "h2o.h"
+#include "region4.h"
+
+/* The temperature range is split at the subregion boundaries
+ * of the saturation line (see h2o_region4_subregion_T()), since
+ * the equations used on both sides do not match exactly. */
+struct segment
+{
+	double Tmin, Tmax;
+	int nodes;
+};
+
+/* the node counts are picked to keep the deviations documented
+ * in h2o.h, the steep near-critical segments need the most */
+static struct segment segments[] = {
+	{ Tmin, Tsat2metamax, 256 },
+	{ Tsat2metamax, Tsat12max, 64 },
+	{ Tsat12max, Tsat3cmax, 32 },
+	{ Tsat3cmax, Tsat3tmax, 32 },
+	{ Tsat3tmax, Tsat3rsmax, 32 },
+	{ Tsat3rsmax, Tsat3xmax, 512 },
+	{ Tsat3xmax, Tsat3umax, 64 },
+	{ Tsat3umax, Tcrit, 128 }
+};
+
+#define SEGMENTS ((int) (sizeof(segments) / sizeof(*segments)))
+
+/* Tsat(p) is tabulated against beta = p^0.25 */
+static int p_nodes = 1025;
+
+int main(int argc, char* argv[])
+{
+	double bmin = pow(psatmin, 0.25);
+	double bstep;
+	int first = 0;
+	int i, k;
+
+	/* optional node counts, for tuning */
+	for (k = 0; k < SEGMENTS && k + 1 < argc; ++k)
+		segments[k].nodes = atoi(argv[k + 1]);
+	if (argc > SEGMENTS + 1)
+		p_nodes = atoi(argv[SEGMENTS + 1]);
+
+	bstep = (pow(pcrit, 0.25) - bmin) / (p_nodes - 1);
+
+	printf("/* generated by h2o-sattabgen, do not edit */\n\n");
+	printf("#define SATTAB_SEGMENTS %d\n", SEGMENTS);
+	printf("#define SATTAB_P_NODES %d\n\n", p_nodes);
+
+	printf("/* Tmax, Tmin, Tstep, first node, node count */\n");
+	printf("static const struct sattab_segment sattab_segments[SATTAB_SEGMENTS] = {\n");
+	for (k = 0; k < SEGMENTS; ++k)
+	{
+		const struct segment* seg = &segments[k];
+
+		printf("\t{ %a, %a, %a, %d, %d }%s\n",
+				seg->Tmax, seg->Tmin,
+				(seg->Tmax - seg->Tmin) / (seg->nodes - 1),
+				first, seg->nodes, k < SEGMENTS - 1 ? "," : "");
+		first += seg->nodes;
+	}
+	printf("};\n\n");
+
+	printf("/* ln(psat), rho', ln(rho''), u', u'', h', h'', s', s''"
+			" = f(Tmin + i * Tstep) */\n");
+	printf("static const double sattab_T[%d][SATTAB_COLUMNS] = {\n", first);
+	for (k = 0; k < SEGMENTS; ++k)
+	{
+		const struct segment* seg = &segments[k];
+		double Tstep = (seg->Tmax - seg->Tmin) / (seg->nodes - 1);
+
+		for (i = 0; i < seg->nodes; ++i)
+		{
+			double T;
+			struct h2o_sat sat;
+
+			if (i == 0)
+				/* the boundary itself belongs to the previous segment */
+				T = k == 0 ? Tmin : nextafter(seg->Tmin, Tcrit);
+			else if (i == seg->nodes - 1)
+				T = seg->Tmax;
+			else
+				T = seg->Tmin + i * Tstep;
+
+			h2o_region4_sat_T(T, &sat);
+
+			printf("\t{ %.17g, %.17g, %.17g,\n"
+					"\t\t%.17g, %.17g, %.17g,\n"
+					"\t\t%.17g, %.17g, %.17g }%s\n",
+					log(sat.p), sat.liquid.rho, log(sat.vapour.rho),
+					sat.liquid.u, sat.vapour.u, sat.liquid.h, sat.vapour.h,
+					sat.liquid.s, sat.vapour.s,
+					k < SEGMENTS - 1 || i < seg->nodes - 1 ? "," : "");
+		}
+	}
+	printf("};\n\n");
+
+	printf("/* beta = p^0.25 = bmin + i * bstep */\n");
+	printf("static const double sattab_bmin = %a;\n", bmin);
+	printf("static const double sattab_bstep = %a;\n\n", bstep);
+
+	printf("/* Tsat = f(beta) */\n");
+	printf("static const double sattab_p[SATTAB_P_NODES] = {\n");
+	for (i = 0; i < p_nodes; ++i)
+	{
+		double p;
+
+		if (i == 0)
+			p = psatmin;
+		else if (i == p_nodes - 1)
+			p = pcrit;
+		else
+			p = pow(bmin + i * bstep, 4);
+
+		printf("\t%.17g%s\n", h2o_region4_T_p(p),
+				i < p_nodes - 1 ? "," : "");
+	}
+	printf("};\n");
+
+	return 0;
+}